@@ -0,0 +1,118 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#include "DataInputInternal.hpp"
+#include "DataOutputInternal.hpp"
+#include "util/string.hpp"
+
+using apache::geode::client::DataInputInternal;
+using apache::geode::client::DataOutputInternal;
+using apache::geode::client::to_utf8;
+
+template <class T>
+T readInt(DataInputInternal& input);
+
+template <>
+int32_t readInt(DataInputInternal& input) {
+  return input.readInt32();
+}
+
+template <>
+int64_t readInt(DataInputInternal& input) {
+  return input.readInt64();
+}
+
+template <class T>
+void DataSerializationBM_writeInt(benchmark::State& state) {
+  DataOutputInternal output;
+  for (auto _ : state) {
+    output.reset();
+    for (int i = 0; i < 64; i++) {
+      output.writeInt(static_cast<T>(i));
+    }
+    benchmark::DoNotOptimize(output.getBuffer());
+  }
+  state.SetBytesProcessed(state.iterations() * 64 * sizeof(T));
+}
+
+template <class T>
+void DataSerializationBM_readInt(benchmark::State& state) {
+  DataOutputInternal output;
+  for (int i = 0; i < 64; i++) {
+    output.writeInt(static_cast<T>(i));
+  }
+
+  for (auto _ : state) {
+    DataInputInternal input(output.getBuffer(), output.getBufferLength());
+    for (int i = 0; i < 64; i++) {
+      benchmark::DoNotOptimize(readInt<T>(input));
+    }
+  }
+  state.SetBytesProcessed(state.iterations() * 64 * sizeof(T));
+}
+
+template <char32_t UnicodeChar>
+void DataSerializationBM_writeString(benchmark::State& state) {
+  const auto string =
+      to_utf8(std::u32string(static_cast<size_t>(state.range(0)), UnicodeChar));
+
+  DataOutputInternal output;
+  for (auto _ : state) {
+    output.reset();
+    output.writeString(string);
+    benchmark::DoNotOptimize(output.getBuffer());
+  }
+  state.SetBytesProcessed(state.iterations() * string.size());
+}
+
+template <char32_t UnicodeChar>
+void DataSerializationBM_readString(benchmark::State& state) {
+  const auto string =
+      to_utf8(std::u32string(static_cast<size_t>(state.range(0)), UnicodeChar));
+
+  DataOutputInternal output;
+  output.writeString(string);
+
+  for (auto _ : state) {
+    DataInputInternal input(output.getBuffer(), output.getBufferLength());
+    benchmark::DoNotOptimize(input.readString());
+  }
+  state.SetBytesProcessed(state.iterations() * string.size());
+}
+
+constexpr char32_t LATIN_CAPITAL_LETTER_C = U'\U00000043';
+constexpr char32_t SAMARITAN_PUNCTUATION_ZIQAA = U'\U00000838';
+
+BENCHMARK_TEMPLATE(DataSerializationBM_writeInt, int32_t);
+BENCHMARK_TEMPLATE(DataSerializationBM_writeInt, int64_t);
+BENCHMARK_TEMPLATE(DataSerializationBM_readInt, int32_t);
+BENCHMARK_TEMPLATE(DataSerializationBM_readInt, int64_t);
+
+BENCHMARK_TEMPLATE(DataSerializationBM_writeString, LATIN_CAPITAL_LETTER_C)
+    ->Range(8, 8 << 10);
+BENCHMARK_TEMPLATE(DataSerializationBM_writeString,
+                   SAMARITAN_PUNCTUATION_ZIQAA)
+    ->Range(8, 8 << 10);
+BENCHMARK_TEMPLATE(DataSerializationBM_readString, LATIN_CAPITAL_LETTER_C)
+    ->Range(8, 8 << 10);
+BENCHMARK_TEMPLATE(DataSerializationBM_readString, SAMARITAN_PUNCTUATION_ZIQAA)
+    ->Range(8, 8 << 10);
@@ -0,0 +1,88 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <thread>
+
+#include "EventIdMap.hpp"
+
+using apache::geode::client::EventId;
+using apache::geode::client::EventIdMap;
+
+static EventIdMap& sharedEventIdMap() {
+  static EventIdMap* eventIdMap = [] {
+    auto map = new EventIdMap();
+    map->init(std::chrono::seconds(300));
+    return map;
+  }();
+  return *eventIdMap;
+}
+
+static std::shared_ptr<EventId> eventId(std::string& member, int64_t thread,
+                                        int64_t sequence) {
+  return EventId::create(&member[0], static_cast<uint32_t>(member.size()),
+                         thread, sequence);
+}
+
+static void EventIdMapBM_putNew(benchmark::State& state) {
+  auto& map = sharedEventIdMap();
+  std::string member("putNew");
+  int64_t sequence = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        map.put(*eventId(member, state.thread_index, ++sequence), true));
+  }
+}
+
+static void EventIdMapBM_putDuplicate(benchmark::State& state) {
+  auto& map = sharedEventIdMap();
+  std::string member("putDuplicate");
+  const auto duplicate = eventId(member, state.thread_index, 1);
+  map.put(*duplicate, true);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(map.put(*duplicate, true));
+  }
+}
+
+static void EventIdMapBM_putManySources(benchmark::State& state) {
+  auto& map = sharedEventIdMap();
+  std::string member("putManySources");
+  const auto sources = state.range(0);
+  int64_t sequence = 0;
+  for (auto _ : state) {
+    const auto thread = state.thread_index * sources + sequence % sources;
+    benchmark::DoNotOptimize(
+        map.put(*eventId(member, thread, ++sequence), true));
+  }
+}
+
+const auto MAX_THREADS = std::thread::hardware_concurrency() * 8;
+
+BENCHMARK(EventIdMapBM_putNew)->ThreadRange(1, MAX_THREADS)->UseRealTime();
+
+BENCHMARK(EventIdMapBM_putDuplicate)
+    ->ThreadRange(1, MAX_THREADS)
+    ->UseRealTime();
+
+BENCHMARK(EventIdMapBM_putManySources)
+    ->Range(8, 8 << 10)
+    ->ThreadRange(1, MAX_THREADS)
+    ->UseRealTime();
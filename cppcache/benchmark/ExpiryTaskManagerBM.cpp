@@ -0,0 +1,102 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <vector>
+
+#include "ExpiryTaskManager.hpp"
+
+using apache::geode::client::ExpiryTaskManager;
+
+class NoopHandler : public ACE_Event_Handler {
+ public:
+  int handle_timeout(const ACE_Time_Value&, const void*) override { return 0; }
+
+  int handle_close(ACE_HANDLE, ACE_Reactor_Mask) override { return 0; }
+};
+
+// Holds state.range(0) tasks that never come due so that the cost of the
+// timer structure at that size is part of every measurement.
+template <bool UseTimingWheel>
+class PendingTasks {
+ public:
+  explicit PendingTasks(benchmark::State& state) {
+    if (UseTimingWheel) {
+      manager_.enableTimingWheel(std::chrono::milliseconds(100));
+    }
+    manager_.begin();
+    for (int64_t i = 0; i < state.range(0); i++) {
+      ids_.push_back(schedule(std::chrono::hours(1) + std::chrono::seconds(i),
+                              std::chrono::seconds(0)));
+    }
+  }
+
+  ~PendingTasks() {
+    for (auto id : ids_) {
+      manager_.cancelTask(id);
+    }
+    manager_.stopExpiryTaskManager();
+  }
+
+  ExpiryTaskManager::id_type schedule(std::chrono::seconds expiry,
+                                      std::chrono::seconds interval) {
+    return manager_.scheduleExpiryTask(&handler_, expiry, interval);
+  }
+
+  ExpiryTaskManager& manager() { return manager_; }
+
+ private:
+  NoopHandler handler_;
+  ExpiryTaskManager manager_;
+  std::vector<ExpiryTaskManager::id_type> ids_;
+};
+
+template <bool UseTimingWheel>
+void ExpiryTaskManagerBM_scheduleAndCancel(benchmark::State& state) {
+  PendingTasks<UseTimingWheel> tasks(state);
+  for (auto _ : state) {
+    auto id =
+        tasks.schedule(std::chrono::seconds(600), std::chrono::seconds(0));
+    tasks.manager().cancelTask(id);
+  }
+}
+
+template <bool UseTimingWheel>
+void ExpiryTaskManagerBM_resetTask(benchmark::State& state) {
+  PendingTasks<UseTimingWheel> tasks(state);
+  auto id =
+      tasks.schedule(std::chrono::seconds(600), std::chrono::seconds(600));
+  for (auto _ : state) {
+    tasks.manager().resetTask(id, std::chrono::seconds(600));
+  }
+  tasks.manager().cancelTask(id);
+}
+
+constexpr bool TIMER_HEAP = false;
+constexpr bool TIMING_WHEEL = true;
+
+BENCHMARK_TEMPLATE(ExpiryTaskManagerBM_scheduleAndCancel, TIMER_HEAP)
+    ->Range(1, 64 << 10);
+BENCHMARK_TEMPLATE(ExpiryTaskManagerBM_scheduleAndCancel, TIMING_WHEEL)
+    ->Range(1, 64 << 10);
+BENCHMARK_TEMPLATE(ExpiryTaskManagerBM_resetTask, TIMER_HEAP)
+    ->Range(1, 64 << 10);
+BENCHMARK_TEMPLATE(ExpiryTaskManagerBM_resetTask, TIMING_WHEEL)
+    ->Range(1, 64 << 10);
@@ -0,0 +1,143 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <benchmark/benchmark.h>
+
+#include <thread>
+#include <vector>
+
+#include <geode/Cache.hpp>
+#include <geode/CacheFactory.hpp>
+#include <geode/CacheableString.hpp>
+#include <geode/Region.hpp>
+#include <geode/RegionFactory.hpp>
+#include <geode/RegionShortcut.hpp>
+
+using apache::geode::client::Cache;
+using apache::geode::client::CacheableKey;
+using apache::geode::client::CacheableString;
+using apache::geode::client::CacheFactory;
+using apache::geode::client::Region;
+using apache::geode::client::RegionShortcut;
+
+constexpr int32_t ENTRIES = 10000;
+
+// Both regions hold ENTRIES entries. The LRU region is limited to exactly
+// that many so that reads and updates do the LRU bookkeeping without
+// evicting.
+class LocalRegions {
+ public:
+  LocalRegions()
+      : cache_(CacheFactory()
+                   .set("log-level", "none")
+                   .set("statistic-sampling-enabled", "false")
+                   .create()),
+        value_(CacheableString::create("value")) {
+    concurrent_ = cache_.createRegionFactory(RegionShortcut::LOCAL)
+                      .create("ConcurrentEntriesMap");
+    lru_ = cache_.createRegionFactory(RegionShortcut::LOCAL)
+               .setLruEntriesLimit(ENTRIES)
+               .create("LRUEntriesMap");
+    evicting_ = cache_.createRegionFactory(RegionShortcut::LOCAL)
+                    .setLruEntriesLimit(ENTRIES)
+                    .create("EvictingLRUEntriesMap");
+
+    for (int32_t i = 0; i < 2 * ENTRIES; i++) {
+      keys_.push_back(CacheableKey::create(i));
+    }
+    for (int32_t i = 0; i < ENTRIES; i++) {
+      concurrent_->put(keys_[i], value_);
+      lru_->put(keys_[i], value_);
+    }
+  }
+
+  static LocalRegions& instance() {
+    static auto localRegions = new LocalRegions();
+    return *localRegions;
+  }
+
+  Region& region(bool lru) { return lru ? *lru_ : *concurrent_; }
+  Region& evicting() { return *evicting_; }
+  const std::shared_ptr<CacheableKey>& key(size_t i) { return keys_[i]; }
+  const std::shared_ptr<CacheableString>& value() { return value_; }
+
+ private:
+  Cache cache_;
+  std::shared_ptr<CacheableString> value_;
+  std::shared_ptr<Region> concurrent_;
+  std::shared_ptr<Region> lru_;
+  std::shared_ptr<Region> evicting_;
+  std::vector<std::shared_ptr<CacheableKey>> keys_;
+};
+
+// Threads start at different keys so that they spread over the map.
+static size_t firstKey(benchmark::State& state) {
+  return static_cast<size_t>(state.thread_index) * 7919;
+}
+
+template <bool Lru>
+void LocalRegionBM_get(benchmark::State& state) {
+  auto& regions = LocalRegions::instance();
+  auto& region = regions.region(Lru);
+  auto i = firstKey(state);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(region.get(regions.key(i++ % ENTRIES)));
+  }
+}
+
+template <bool Lru>
+void LocalRegionBM_put(benchmark::State& state) {
+  auto& regions = LocalRegions::instance();
+  auto& region = regions.region(Lru);
+  auto i = firstKey(state);
+  for (auto _ : state) {
+    region.put(regions.key(i++ % ENTRIES), regions.value());
+  }
+}
+
+// Cycles through twice as many keys as the region may hold, so every put
+// evicts the least recently used entry.
+static void LocalRegionBM_putEvicting(benchmark::State& state) {
+  auto& regions = LocalRegions::instance();
+  auto& region = regions.evicting();
+  auto i = firstKey(state);
+  for (auto _ : state) {
+    region.put(regions.key(i++ % (2 * ENTRIES)), regions.value());
+  }
+}
+
+constexpr bool CONCURRENT_ENTRIES_MAP = false;
+constexpr bool LRU_ENTRIES_MAP = true;
+
+const auto MAX_THREADS = std::thread::hardware_concurrency() * 8;
+
+BENCHMARK_TEMPLATE(LocalRegionBM_get, CONCURRENT_ENTRIES_MAP)
+    ->ThreadRange(1, MAX_THREADS)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(LocalRegionBM_get, LRU_ENTRIES_MAP)
+    ->ThreadRange(1, MAX_THREADS)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(LocalRegionBM_put, CONCURRENT_ENTRIES_MAP)
+    ->ThreadRange(1, MAX_THREADS)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(LocalRegionBM_put, LRU_ENTRIES_MAP)
+    ->ThreadRange(1, MAX_THREADS)
+    ->UseRealTime();
+BENCHMARK(LocalRegionBM_putEvicting)
+    ->ThreadRange(1, MAX_THREADS)
+    ->UseRealTime();
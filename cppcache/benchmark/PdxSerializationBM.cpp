@@ -0,0 +1,134 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include <geode/Cache.hpp>
+#include <geode/CacheFactory.hpp>
+#include <geode/PdxReader.hpp>
+#include <geode/PdxSerializable.hpp>
+#include <geode/PdxWriter.hpp>
+
+#include "CacheImpl.hpp"
+#include "CacheRegionHelper.hpp"
+#include "PdxTypeRegistry.hpp"
+#include "PdxWriterWithTypeCollector.hpp"
+
+using apache::geode::client::Cache;
+using apache::geode::client::CacheFactory;
+using apache::geode::client::CacheRegionHelper;
+using apache::geode::client::PdxReader;
+using apache::geode::client::PdxSerializable;
+using apache::geode::client::PdxWriter;
+using apache::geode::client::PdxWriterWithTypeCollector;
+
+class TestPdxOrder : public PdxSerializable {
+ public:
+  TestPdxOrder()
+      : id_(1971),
+        customer_("customer-with-a-typical-name"),
+        price_(19.71),
+        quantity_(42),
+        items_(16, 7) {}
+
+  void fromData(PdxReader& reader) override {
+    id_ = reader.readInt("id");
+    customer_ = reader.readString("customer");
+    price_ = reader.readDouble("price");
+    quantity_ = reader.readLong("quantity");
+    items_ = reader.readIntArray("items");
+  }
+
+  void toData(PdxWriter& writer) const override {
+    writer.writeInt("id", id_);
+    writer.markIdentityField("id");
+    writer.writeString("customer", customer_);
+    writer.writeDouble("price", price_);
+    writer.writeLong("quantity", quantity_);
+    writer.writeIntArray("items", items_);
+  }
+
+  const std::string& getClassName() const override { return className; }
+
+  static std::shared_ptr<PdxSerializable> createDeserializable() {
+    return std::make_shared<TestPdxOrder>();
+  }
+
+ private:
+  std::string className = "TestPdxOrder";
+  int32_t id_;
+  std::string customer_;
+  double price_;
+  int64_t quantity_;
+  std::vector<int32_t> items_;
+};
+
+// A cache without a pool cannot ask a server for a type id, so the type is
+// collected and registered locally the same way the first serialization of
+// a class does it.
+static Cache createCacheWithPdxType() {
+  auto cache = CacheFactory()
+                   .set("log-level", "none")
+                   .set("statistic-sampling-enabled", "false")
+                   .create();
+  cache.getTypeRegistry().registerPdxType(TestPdxOrder::createDeserializable);
+
+  auto pdxTypeRegistry =
+      CacheRegionHelper::getCacheImpl(&cache)->getPdxTypeRegistry();
+  auto output = cache.createDataOutput();
+  TestPdxOrder order;
+  PdxWriterWithTypeCollector writer(output, order.getClassName(),
+                                    pdxTypeRegistry);
+  order.toData(writer);
+  auto pdxType = writer.getPdxLocalType();
+  pdxType->InitializeType();
+  pdxType->setTypeId(1);
+  pdxTypeRegistry->addLocalPdxType(order.getClassName(), pdxType);
+  pdxTypeRegistry->addPdxType(pdxType->getTypeId(), pdxType);
+
+  return cache;
+}
+
+static void PdxSerializationBM_serialize(benchmark::State& state) {
+  auto cache = createCacheWithPdxType();
+  auto order = std::make_shared<TestPdxOrder>();
+  auto output = cache.createDataOutput();
+  for (auto _ : state) {
+    output.reset();
+    output.writeObject(order);
+  }
+  state.SetBytesProcessed(state.iterations() * output.getBufferLength());
+}
+
+static void PdxSerializationBM_deserialize(benchmark::State& state) {
+  auto cache = createCacheWithPdxType();
+  auto output = cache.createDataOutput();
+  output.writeObject(std::make_shared<TestPdxOrder>());
+  for (auto _ : state) {
+    auto input =
+        cache.createDataInput(output.getBuffer(), output.getBufferLength());
+    benchmark::DoNotOptimize(input.readObject());
+  }
+  state.SetBytesProcessed(state.iterations() * output.getBufferLength());
+}
+
+BENCHMARK(PdxSerializationBM_serialize);
+BENCHMARK(PdxSerializationBM_deserialize);
@@ -0,0 +1,174 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <vector>
+
+#include <geode/Cache.hpp>
+#include <geode/CacheFactory.hpp>
+#include <geode/CacheableString.hpp>
+#include <geode/Region.hpp>
+#include <geode/RegionFactory.hpp>
+#include <geode/RegionShortcut.hpp>
+
+#include "CacheRegionHelper.hpp"
+#include "DataOutputInternal.hpp"
+#include "TcrMessage.hpp"
+
+using apache::geode::client::Cache;
+using apache::geode::client::CacheableKey;
+using apache::geode::client::CacheableString;
+using apache::geode::client::CacheFactory;
+using apache::geode::client::CacheRegionHelper;
+using apache::geode::client::DataOutputInternal;
+using apache::geode::client::HashMapOfCacheable;
+using apache::geode::client::Region;
+using apache::geode::client::RegionShortcut;
+using apache::geode::client::TcrMessageContainsKey;
+using apache::geode::client::TcrMessageDestroy;
+using apache::geode::client::TcrMessageGetAll;
+using apache::geode::client::TcrMessagePing;
+using apache::geode::client::TcrMessagePut;
+using apache::geode::client::TcrMessagePutAll;
+using apache::geode::client::TcrMessageQuery;
+using apache::geode::client::TcrMessageRequest;
+
+// Messages are built against a local region so that they serialize keys and
+// values through a real cache's serialization registry.
+class MessageFixture {
+ public:
+  MessageFixture()
+      : cache_(CacheFactory()
+                   .set("log-level", "none")
+                   .set("statistic-sampling-enabled", "false")
+                   .create()),
+        region_(cache_.createRegionFactory(RegionShortcut::LOCAL)
+                    .create("TcrMessageBM")),
+        key_(CacheableKey::create("key-of-a-typical-length")),
+        value_(CacheableString::create(std::string(100, 'v'))) {}
+
+  DataOutputInternal* dataOutput() {
+    return new DataOutputInternal(CacheRegionHelper::getCacheImpl(&cache_));
+  }
+
+  const Region* region() const { return region_.get(); }
+  const std::shared_ptr<CacheableKey>& key() const { return key_; }
+  const std::shared_ptr<CacheableString>& value() const { return value_; }
+
+  std::vector<std::shared_ptr<CacheableKey>> keys(int64_t count) const {
+    std::vector<std::shared_ptr<CacheableKey>> keys;
+    for (int32_t i = 0; i < count; i++) {
+      keys.push_back(CacheableKey::create(i));
+    }
+    return keys;
+  }
+
+ private:
+  Cache cache_;
+  std::shared_ptr<Region> region_;
+  std::shared_ptr<CacheableKey> key_;
+  std::shared_ptr<CacheableString> value_;
+};
+
+static void TcrMessageBM_put(benchmark::State& state) {
+  MessageFixture fixture;
+  for (auto _ : state) {
+    TcrMessagePut message(fixture.dataOutput(), fixture.region(),
+                          fixture.key(), fixture.value(), nullptr);
+    benchmark::DoNotOptimize(message.getMsgData());
+  }
+}
+
+static void TcrMessageBM_request(benchmark::State& state) {
+  MessageFixture fixture;
+  for (auto _ : state) {
+    TcrMessageRequest message(fixture.dataOutput(), fixture.region(),
+                              fixture.key(), nullptr);
+    benchmark::DoNotOptimize(message.getMsgData());
+  }
+}
+
+static void TcrMessageBM_destroy(benchmark::State& state) {
+  MessageFixture fixture;
+  for (auto _ : state) {
+    TcrMessageDestroy message(fixture.dataOutput(), fixture.region(),
+                              fixture.key(), nullptr, nullptr);
+    benchmark::DoNotOptimize(message.getMsgData());
+  }
+}
+
+static void TcrMessageBM_containsKey(benchmark::State& state) {
+  MessageFixture fixture;
+  for (auto _ : state) {
+    TcrMessageContainsKey message(fixture.dataOutput(), fixture.region(),
+                                  fixture.key(), nullptr, true, nullptr);
+    benchmark::DoNotOptimize(message.getMsgData());
+  }
+}
+
+static void TcrMessageBM_query(benchmark::State& state) {
+  MessageFixture fixture;
+  for (auto _ : state) {
+    TcrMessageQuery message(fixture.dataOutput(),
+                            "SELECT * FROM /TcrMessageBM WHERE id > 100",
+                            std::chrono::seconds(15), nullptr);
+    benchmark::DoNotOptimize(message.getMsgData());
+  }
+}
+
+static void TcrMessageBM_ping(benchmark::State& state) {
+  MessageFixture fixture;
+  for (auto _ : state) {
+    TcrMessagePing message(fixture.dataOutput(), true);
+    benchmark::DoNotOptimize(message.getMsgData());
+  }
+}
+
+static void TcrMessageBM_putAll(benchmark::State& state) {
+  MessageFixture fixture;
+  HashMapOfCacheable map;
+  for (auto& key : fixture.keys(state.range(0))) {
+    map.emplace(key, fixture.value());
+  }
+  for (auto _ : state) {
+    TcrMessagePutAll message(fixture.dataOutput(), fixture.region(), map,
+                             std::chrono::seconds(15), nullptr, nullptr);
+    benchmark::DoNotOptimize(message.getMsgData());
+  }
+}
+
+static void TcrMessageBM_getAll(benchmark::State& state) {
+  MessageFixture fixture;
+  auto keys = fixture.keys(state.range(0));
+  for (auto _ : state) {
+    TcrMessageGetAll message(fixture.dataOutput(), fixture.region(), &keys);
+    message.InitializeGetallMsg(nullptr);
+    benchmark::DoNotOptimize(message.getMsgData());
+  }
+}
+
+BENCHMARK(TcrMessageBM_put);
+BENCHMARK(TcrMessageBM_request);
+BENCHMARK(TcrMessageBM_destroy);
+BENCHMARK(TcrMessageBM_containsKey);
+BENCHMARK(TcrMessageBM_query);
+BENCHMARK(TcrMessageBM_ping);
+BENCHMARK(TcrMessageBM_putAll)->Range(1, 1 << 10);
+BENCHMARK(TcrMessageBM_getAll)->Range(1, 1 << 10);
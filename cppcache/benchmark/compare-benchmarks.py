@@ -0,0 +1,105 @@
+#!/usr/bin/env python3
+
+# Licensed to the Apache Software Foundation (ASF) under one or more
+# contributor license agreements.  See the NOTICE file distributed with
+# this work for additional information regarding copyright ownership.
+# The ASF licenses this file to You under the Apache License, Version 2.0
+# (the "License"); you may not use this file except in compliance with
+# the License.  You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Compare two benchmark runs and flag regressions.
+
+Both runs are JSON files written by a benchmark executable, for example:
+
+  cpp-benchmark --benchmark_repetitions=5 \\
+      --benchmark_out=baseline.json --benchmark_out_format=json
+
+When the runs have repetitions only the mean of each benchmark is compared.
+Exits with status 1 if any benchmark got slower by more than the threshold.
+"""
+
+import argparse
+import json
+import sys
+
+NANOSECONDS = {'ns': 1.0, 'us': 1e3, 'ms': 1e6, 's': 1e9}
+
+
+def load(path, metric):
+    with open(path) as f:
+        benchmarks = json.load(f)['benchmarks']
+
+    aggregated = any(b.get('run_type') == 'aggregate' for b in benchmarks)
+    times = {}
+    for b in benchmarks:
+        if aggregated:
+            if b.get('aggregate_name') != 'mean':
+                continue
+            name = b['run_name']
+        else:
+            name = b['name']
+        times[name] = b[metric] * NANOSECONDS[b.get('time_unit', 'ns')]
+    return times
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description=__doc__,
+        formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('baseline', help='JSON output of the baseline run')
+    parser.add_argument('contender', help='JSON output of the run to check')
+    parser.add_argument('--threshold', type=float, default=5.0,
+                        help='percent slowdown reported as a regression '
+                             '(default: %(default)s)')
+    parser.add_argument('--metric', choices=['real_time', 'cpu_time'],
+                        default='real_time',
+                        help='time to compare (default: %(default)s)')
+    args = parser.parse_args()
+
+    baseline = load(args.baseline, args.metric)
+    contender = load(args.contender, args.metric)
+
+    names = sorted(set(baseline) | set(contender))
+    width = max([len(name) for name in names] + [9])
+    regressions = 0
+    print('%-*s %14s %14s %9s' % (width, 'Benchmark', 'Baseline (ns)',
+                                  'Contender (ns)', 'Change'))
+    for name in names:
+        if name not in contender:
+            print('%-*s %14.1f %14s %9s' % (width, name, baseline[name], '-',
+                                            'MISSING'))
+            continue
+        if name not in baseline:
+            print('%-*s %14s %14.1f %9s' % (width, name, '-', contender[name],
+                                            'NEW'))
+            continue
+
+        before = baseline[name]
+        after = contender[name]
+        change = (after - before) / before * 100.0 if before else 0.0
+        flag = ''
+        if change > args.threshold:
+            flag = '  REGRESSION'
+            regressions += 1
+        elif change < -args.threshold:
+            flag = '  improvement'
+        print('%-*s %14.1f %14.1f %+8.1f%%%s' % (width, name, before, after,
+                                                 change, flag))
+
+    if regressions:
+        print('\n%d benchmark(s) regressed by more than %.1f%%' %
+              (regressions, args.threshold))
+        return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -37,6 +37,7 @@ namespace client {
 
 class AuthenticatedView;
 class AuthInitialize;
+class TraceExporter;
 class CacheFactory;
 class CacheImpl;
 class CacheRegionHelper;
@@ -168,6 +169,19 @@ class APACHE_GEODE_EXPORT Cache : public GeodeCache {
   virtual std::shared_ptr<QueryService> getQueryService(
       const std::string& poolName) const;
 
+  /**
+   * Gets a QueryService that evaluates queries against the entries cached in
+   * this client's local regions without contacting a server. It supports a
+   * single-region subset of OQL: SELECT [DISTINCT] projections or COUNT(*),
+   * FROM one region's values, keySet or entrySet, WHERE, ORDER BY and LIMIT.
+   * Fields of cached values can be read from PdxInstance and Struct values,
+   * so PDX values should be cached with read-serialized enabled. Continuous
+   * query operations throw UnsupportedOperationException.
+   *
+   * @returns A smart pointer to the local QueryService.
+   */
+  virtual std::shared_ptr<QueryService> getLocalQueryService();
+
   /**
    * Send the "client ready" message to the server from a durable client.
    */
@@ -273,7 +287,8 @@ class APACHE_GEODE_EXPORT Cache : public GeodeCache {
    */
   Cache(const std::shared_ptr<Properties>& dsProp, bool ignorePdxUnreadFields,
         bool readPdxSerialized,
-        const std::shared_ptr<AuthInitialize>& authInitialize);
+        const std::shared_ptr<AuthInitialize>& authInitialize,
+        const std::shared_ptr<TraceExporter>& traceExporter);
 
   std::unique_ptr<CacheImpl> m_cacheImpl;
 
@@ -36,6 +36,7 @@ namespace client {
 
 class CppCacheLibrary;
 class AuthInitialize;
+class TraceExporter;
 
 /**
  * @class CacheFactory CacheFactory.hpp
@@ -108,6 +109,17 @@ class APACHE_GEODE_EXPORT CacheFactory {
   CacheFactory& setAuthInitialize(
       const std::shared_ptr<AuthInitialize>& authInitialize);
 
+  /**
+   * Sets the exporter that receives the spans of traced operations. Which
+   * operations are traced is set by the <code>tracing-sample-rate</code>
+   * property; without an exporter, spans are written to the file named by
+   * <code>tracing-file</code>, if any.
+   * @param traceExporter the exporter to set
+   * @return this CacheFactory
+   */
+  CacheFactory& setTraceExporter(
+      const std::shared_ptr<TraceExporter>& traceExporter);
+
   /** Sets the object preference to PdxInstance type.
    * When a cached object that was serialized as a PDX is read
    * from the cache a {@link PdxInstance} will be returned instead of the actual
@@ -142,6 +154,7 @@ class APACHE_GEODE_EXPORT CacheFactory {
   bool ignorePdxUnreadFields;
   bool pdxReadSerialized;
   std::shared_ptr<AuthInitialize> authInitialize;
+  std::shared_ptr<TraceExporter> traceExporter;
 
   friend class CppCacheLibrary;
   friend class RegionFactory;
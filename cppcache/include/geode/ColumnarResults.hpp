@@ -0,0 +1,191 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_COLUMNARRESULTS_H_
+#define GEODE_COLUMNARRESULTS_H_
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "CacheableBuiltins.hpp"
+#include "SelectResults.hpp"
+#include "internal/geode_globals.hpp"
+
+/**
+ * @file
+ */
+
+namespace apache {
+namespace geode {
+namespace client {
+
+class ColumnarResultsBuilder;
+
+/**
+ * @class ColumnarResults ColumnarResults.hpp
+ *
+ * Query or function results stored column by column. Each field of the
+ * results is one column. Primitive fields are held in contiguous arrays of
+ * their native type, strings are dictionary encoded and anything else is
+ * kept as the deserialized object. Columns whose values do not share a
+ * single type are stored as objects.
+ *
+ * Obtained from Query::executeColumnar or built from existing results with
+ * ColumnarResults::create.
+ */
+class APACHE_GEODE_EXPORT ColumnarResults {
+ public:
+  enum class ColumnType {
+    /** No non-null value was seen. */
+    Null,
+    Boolean,
+    Byte,
+    Int16,
+    Int32,
+    Int64,
+    Float,
+    Double,
+    /** Milliseconds since the epoch, stored as Int64. */
+    Date,
+    String,
+    Object
+  };
+
+  ColumnarResults() = default;
+  ColumnarResults(const ColumnarResults&) = delete;
+  ColumnarResults& operator=(const ColumnarResults&) = delete;
+  ColumnarResults(ColumnarResults&&) = default;
+  ColumnarResults& operator=(ColumnarResults&&) = default;
+
+  /**
+   * Copies a ResultSet into a single column named "result", or a StructSet
+   * into one column per field.
+   */
+  static std::shared_ptr<ColumnarResults> create(const SelectResults& results);
+
+  /**
+   * Copies function results. If the results are Structs each field becomes
+   * a column, otherwise they form a single column named "result".
+   *
+   * @throws IllegalArgumentException if the Structs differ in field count.
+   */
+  static std::shared_ptr<ColumnarResults> create(
+      const std::vector<std::shared_ptr<Cacheable>>& results);
+
+  /** The number of rows. */
+  size_t size() const { return m_rows; }
+
+  size_t getColumnCount() const { return m_columns.size(); }
+
+  /**
+   * @throws std::out_of_range if the column does not exist.
+   */
+  const std::string& getFieldName(size_t column) const;
+
+  /**
+   * @throws std::invalid_argument if the field name is not found.
+   */
+  size_t getFieldIndex(const std::string& fieldName) const;
+
+  ColumnType getColumnType(size_t column) const;
+
+  bool isNull(size_t row, size_t column) const;
+
+  /**
+   * The values of a Boolean (0 or 1) or Byte column. Rows that are null hold
+   * 0; check isNull to tell them apart.
+   *
+   * @throws IllegalStateException if the column has another type.
+   */
+  const std::vector<int8_t>& getInt8Column(size_t column) const;
+
+  /** @see getInt8Column */
+  const std::vector<int16_t>& getInt16Column(size_t column) const;
+
+  /** @see getInt8Column */
+  const std::vector<int32_t>& getInt32Column(size_t column) const;
+
+  /** The values of an Int64 or Date column. @see getInt8Column */
+  const std::vector<int64_t>& getInt64Column(size_t column) const;
+
+  /** @see getInt8Column */
+  const std::vector<float>& getFloatColumn(size_t column) const;
+
+  /** @see getInt8Column */
+  const std::vector<double>& getDoubleColumn(size_t column) const;
+
+  /**
+   * The dictionary codes of a String column, indexing into
+   * getStringDictionary. Null rows hold -1.
+   *
+   * @throws IllegalStateException if the column is not a String column.
+   */
+  const std::vector<int32_t>& getStringCodes(size_t column) const;
+
+  /** The distinct strings of a String column. @see getStringCodes */
+  const std::vector<std::string>& getStringDictionary(size_t column) const;
+
+  /**
+   * The values of an Object column. Null rows hold nullptr.
+   *
+   * @throws IllegalStateException if the column is not an Object column.
+   */
+  const std::vector<std::shared_ptr<Cacheable>>& getObjectColumn(
+      size_t column) const;
+
+  /**
+   * Returns a single value as an object, creating it for primitive and
+   * String columns.
+   */
+  std::shared_ptr<Cacheable> getObject(size_t row, size_t column) const;
+
+ private:
+  struct Column {
+    std::string name;
+    ColumnType type = ColumnType::Null;
+    std::vector<uint8_t> nulls;
+    std::vector<int8_t> int8s;
+    std::vector<int16_t> int16s;
+    std::vector<int32_t> int32s;
+    std::vector<int64_t> int64s;
+    std::vector<float> floats;
+    std::vector<double> doubles;
+    std::vector<int32_t> codes;
+    std::vector<std::string> dictionary;
+    std::vector<std::shared_ptr<Cacheable>> objects;
+  };
+
+  const Column& column(size_t column, ColumnType type,
+                       ColumnType alternate) const;
+
+  static std::shared_ptr<Cacheable> box(const Column& column, size_t row);
+
+  std::vector<Column> m_columns;
+  size_t m_rows = 0;
+
+  friend class ColumnarResultsBuilder;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_COLUMNARRESULTS_H_
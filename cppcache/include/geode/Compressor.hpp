@@ -0,0 +1,65 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_COMPRESSOR_H_
+#define GEODE_COMPRESSOR_H_
+
+#include <vector>
+
+#include "internal/geode_globals.hpp"
+
+/**
+ * @file
+ */
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * @class Compressor Compressor.hpp
+ *
+ * Compresses serialized values of a region, both as they are held in the
+ * local cache and as they are sent to the server. Implementations typically
+ * wrap a library such as LZ4 or zstd, and are called concurrently from many
+ * threads.
+ *
+ * @see RegionAttributesFactory::setCompressor
+ */
+class APACHE_GEODE_EXPORT Compressor {
+ public:
+  Compressor();
+  virtual ~Compressor();
+
+  /**
+   * Returns input compressed.
+   */
+  virtual std::vector<int8_t> compress(const std::vector<int8_t>& input) = 0;
+
+  /**
+   * Returns the bytes that compress() was given to produce input.
+   */
+  virtual std::vector<int8_t> decompress(const std::vector<int8_t>& input) = 0;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_COMPRESSOR_H_
@@ -24,6 +24,7 @@
 #include <iosfwd>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 #include "ExceptionTypes.hpp"
@@ -343,17 +344,35 @@ class APACHE_GEODE_EXPORT DataInput {
 
   inline std::vector<bool> readBooleanArray() { return readArray<bool>(); }
 
-  inline std::vector<int8_t> readByteArray() { return readArray<int8_t>(); }
+  inline std::vector<int8_t> readByteArray() {
+    std::vector<int8_t> value;
+    auto arrLen = readArrayLength();
+    if (arrLen > 0) {
+      value.resize(arrLen);
+      readBytesOnly(value.data(), arrLen);
+    }
+    return value;
+  }
 
-  inline std::vector<int16_t> readShortArray() { return readArray<int16_t>(); }
+  inline std::vector<int16_t> readShortArray() {
+    return readNumericArray<int16_t>();
+  }
 
-  inline std::vector<int32_t> readIntArray() { return readArray<int32_t>(); }
+  inline std::vector<int32_t> readIntArray() {
+    return readNumericArray<int32_t>();
+  }
 
-  inline std::vector<int64_t> readLongArray() { return readArray<int64_t>(); }
+  inline std::vector<int64_t> readLongArray() {
+    return readNumericArray<int64_t>();
+  }
 
-  inline std::vector<float> readFloatArray() { return readArray<float>(); }
+  inline std::vector<float> readFloatArray() {
+    return readNumericArray<float>();
+  }
 
-  inline std::vector<double> readDoubleArray() { return readArray<double>(); }
+  inline std::vector<double> readDoubleArray() {
+    return readNumericArray<double>();
+  }
 
   inline std::vector<std::string> readStringArray() {
     std::vector<std::string> value;
@@ -484,6 +503,34 @@ class APACHE_GEODE_EXPORT DataInput {
     }
   }
 
+  template <typename T>
+  using UnsignedOf = typename std::conditional<
+      sizeof(T) == 2, uint16_t,
+      typename std::conditional<sizeof(T) == 4, uint32_t,
+                                uint64_t>::type>::type;
+
+  /**
+   * Reads an array of 2, 4 or 8 byte numbers with a single bounds check,
+   * converting from big-endian in a loop the compiler can vectorize.
+   */
+  template <typename T>
+  std::vector<T> readNumericArray() {
+    auto arrayLen = readArrayLength();
+    std::vector<T> objArray;
+    if (arrayLen > 0) {
+      _GEODE_CHECK_BUFFER_SIZE(static_cast<size_t>(arrayLen) * sizeof(T));
+      objArray.resize(arrayLen);
+      for (auto& value : objArray) {
+        UnsignedOf<T> bits = 0;
+        for (size_t i = 0; i < sizeof(T); i++) {
+          bits = static_cast<UnsignedOf<T>>(bits << 8) | *(m_buf++);
+        }
+        std::memcpy(&value, &bits, sizeof(T));
+      }
+    }
+    return objArray;
+  }
+
   template <typename T>
   std::vector<T> readArray() {
     auto arrayLen = readArrayLength();
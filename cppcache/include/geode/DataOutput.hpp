@@ -24,6 +24,8 @@
 #include <cstdlib>
 #include <cstring>
 #include <string>
+#include <type_traits>
+#include <vector>
 
 #include "CacheableString.hpp"
 #include "ExceptionTypes.hpp"
@@ -260,6 +262,56 @@ class APACHE_GEODE_EXPORT DataOutput {
     writeInt(v.ll);
   }
 
+  /**
+   * Write an array of 16-bit signed integers to the <code>DataOutput</code>
+   * in a form compatible with <code>DataInput::readShortArray</code>.
+   *
+   * @param values the values to be written
+   */
+  inline void writeShortArray(const std::vector<int16_t>& values) {
+    writeNumericArray(values);
+  }
+
+  /**
+   * Write an array of 32-bit signed integers to the <code>DataOutput</code>
+   * in a form compatible with <code>DataInput::readIntArray</code>.
+   *
+   * @param values the values to be written
+   */
+  inline void writeIntArray(const std::vector<int32_t>& values) {
+    writeNumericArray(values);
+  }
+
+  /**
+   * Write an array of 64-bit signed integers to the <code>DataOutput</code>
+   * in a form compatible with <code>DataInput::readLongArray</code>.
+   *
+   * @param values the values to be written
+   */
+  inline void writeLongArray(const std::vector<int64_t>& values) {
+    writeNumericArray(values);
+  }
+
+  /**
+   * Write an array of floats to the <code>DataOutput</code> in a form
+   * compatible with <code>DataInput::readFloatArray</code>.
+   *
+   * @param values the values to be written
+   */
+  inline void writeFloatArray(const std::vector<float>& values) {
+    writeNumericArray(values);
+  }
+
+  /**
+   * Write an array of doubles to the <code>DataOutput</code> in a form
+   * compatible with <code>DataInput::readDoubleArray</code>.
+   *
+   * @param values the values to be written
+   */
+  inline void writeDoubleArray(const std::vector<double>& values) {
+    writeNumericArray(values);
+  }
+
   template <class _CharT>
   inline void writeString(const _CharT* value) {
     // TODO string should we convert to empty string?
@@ -415,18 +467,9 @@ class APACHE_GEODE_EXPORT DataOutput {
    * Reset the internal cursor to the start of the buffer.
    */
   inline void reset() {
-    if (m_haveBigBuffer) {
-      // create smaller buffer
-      m_bytes.reset(
-          static_cast<uint8_t*>(std::malloc(m_lowWaterMark * sizeof(uint8_t))));
-      if (m_bytes == nullptr) {
-        throw OutOfMemoryException("Out of Memory while resizing buffer");
-      }
-      m_size = m_lowWaterMark;
-      // reset the flag
-      m_haveBigBuffer = false;
-      // release the lock
-      releaseLock();
+    if (m_size > m_lowWaterMark) {
+      // hand large buffers back rather than pinning them
+      shrinkBuffer();
     }
     m_buf = m_bytes.get();
   }
@@ -435,23 +478,7 @@ class APACHE_GEODE_EXPORT DataOutput {
   inline void ensureCapacity(size_t size) {
     size_t offset = m_buf - m_bytes.get();
     if ((m_size - offset) < size) {
-      size_t newSize = m_size * 2 + (8192 * (size / 8192));
-      if (newSize >= m_highWaterMark && !m_haveBigBuffer) {
-        // acquire the lock
-        acquireLock();
-        // set flag
-        m_haveBigBuffer = true;
-      }
-      m_size = newSize;
-
-      auto bytes = m_bytes.release();
-      auto tmp =
-          static_cast<uint8_t*>(std::realloc(bytes, m_size * sizeof(uint8_t)));
-      if (tmp == nullptr) {
-        throw OutOfMemoryException("Out of Memory while resizing buffer");
-      }
-      m_bytes.reset(tmp);
-      m_buf = m_bytes.get() + offset;
+      growBuffer(std::max(m_size * 2, offset + size));
     }
   }
 
@@ -471,7 +498,6 @@ class APACHE_GEODE_EXPORT DataOutput {
 
   /** Destruct a DataOutput, including releasing the created buffer. */
   virtual ~DataOutput() noexcept {
-    reset();
     if (m_bytes) {
       DataOutput::checkinBuffer(m_bytes.release(), m_size);
     }
@@ -494,8 +520,8 @@ class APACHE_GEODE_EXPORT DataOutput {
   void writeObjectInternal(const std::shared_ptr<Serializable>& ptr,
                            bool isDelta = false);
 
-  static void acquireLock();
-  static void releaseLock();
+  void growBuffer(size_t minSize);
+  void shrinkBuffer();
 
   struct FreeDeleter {
     void operator()(uint8_t* p) { free(p); }
@@ -507,14 +533,35 @@ class APACHE_GEODE_EXPORT DataOutput {
   uint8_t* m_buf;
   // size of m_bytes.
   size_t m_size;
-  // high and low water marks for buffer size
+  // initial buffer size, and the size reset() shrinks larger buffers to
   static size_t m_lowWaterMark;
-  static size_t m_highWaterMark;
-  // flag to indicate we have a big buffer
-  volatile bool m_haveBigBuffer;
   const CacheImpl* m_cache;
   Pool* m_pool;
 
+  template <typename T>
+  using UnsignedOf = typename std::conditional<
+      sizeof(T) == 2, uint16_t,
+      typename std::conditional<sizeof(T) == 4, uint32_t,
+                                uint64_t>::type>::type;
+
+  /**
+   * Writes an array of 2, 4 or 8 byte numbers with a single capacity check,
+   * converting to big-endian in a loop the compiler can vectorize.
+   */
+  template <typename T>
+  inline void writeNumericArray(const std::vector<T>& values) {
+    writeArrayLen(static_cast<int32_t>(values.size()));
+    ensureCapacity(values.size() * sizeof(T));
+    for (const auto& value : values) {
+      UnsignedOf<T> bits;
+      std::memcpy(&bits, &value, sizeof(T));
+      for (size_t shift = sizeof(T) * 8; shift > 0;) {
+        shift -= 8;
+        *(m_buf++) = static_cast<uint8_t>(bits >> shift);
+      }
+    }
+  }
+
   inline void writeAscii(const std::string& value) {
     uint16_t len = static_cast<uint16_t>(
         std::min<size_t>(value.length(), std::numeric_limits<uint16_t>::max()));
@@ -728,7 +775,7 @@ class APACHE_GEODE_EXPORT DataOutput {
 
   Pool* getPool() const { return m_pool; }
 
-  static uint8_t* checkoutBuffer(size_t* size);
+  static uint8_t* checkoutBuffer(size_t minSize, size_t* size);
   static void checkinBuffer(uint8_t* buffer, size_t size);
 
   friend Cache;
@@ -199,6 +199,12 @@ class APACHE_GEODE_EXPORT Pool : public std::enable_shared_from_this<Pool> {
    */
   bool getPRSingleHopEnabled() const;
 
+  /**
+   * Returns true if reads use adaptive timeouts and hedging on this pool.
+   * @see PoolFactory#setLatencyAwareReads
+   */
+  bool getLatencyAwareReads() const;
+
   /**
    * If this pool was configured to use <code>threadlocalconnections</code>,
    * then this method will release the connection cached for the calling thread.
@@ -259,6 +265,18 @@ class APACHE_GEODE_EXPORT Pool : public std::enable_shared_from_this<Pool> {
    */
   virtual std::shared_ptr<QueryService> getQueryService() = 0;
 
+  /**
+   * Opens connections to the servers, several at a time, until this pool
+   * holds at least {@link #getMinConnections} of them. Blocks until that
+   * many are open or until <code>timeout</code> has elapsed. Connection
+   * attempts under way when the timeout elapses are allowed to finish.
+   *
+   * @param timeout how long to wait for the connections to open
+   * @return true if the pool holds at least its minimum number of connections
+   * @throws IllegalStateException if the pool has been destroyed
+   */
+  virtual bool warmUp(std::chrono::milliseconds timeout) = 0;
+
   virtual ~Pool();
 
   /**
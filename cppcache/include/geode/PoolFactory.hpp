@@ -191,6 +191,13 @@ class APACHE_GEODE_EXPORT PoolFactory {
    */
   static constexpr bool DEFAULT_PR_SINGLE_HOP_ENABLED = true;
 
+  /**
+   * The default value for whether reads adapt their timeouts to observed
+   * server latency and are hedged to a second server.
+   * <p>Current value: <code>false</code>.
+   */
+  static constexpr bool DEFAULT_LATENCY_AWARE_READS = false;
+
   /**
    * Sets the free connection timeout for this pool.
    * If the pool has a max connections setting, operations will block
@@ -536,6 +543,25 @@ class APACHE_GEODE_EXPORT PoolFactory {
    */
   PoolFactory& setPRSingleHopEnabled(bool enabled);
 
+  /**
+   * By default setLatencyAwareReads is false.<br>
+   * When enabled the pool tracks the reply latency of each server and
+   * replaces the fixed read timeout of the following operations with one
+   * derived from the observed 99th percentile, capped at
+   * {@link PoolFactory#setReadTimeout}:<br>
+   * 1. {@link Region#get(Object)}<br>
+   * 2. {@link Region#containsKeyOnServer(Object)}<br>
+   * If such a read has not been answered within the 95th percentile latency of
+   * its server, the same request is sent to another server and the first
+   * reply is used. At most about one read in ten is hedged this way.
+   * Reads in transactions, on pools with thread local connections or with
+   * multiuser authentication are not affected.
+   * @param enabled is a boolean indicating whether latency aware reads
+   * should be enabled or not.
+   * @return a reference to <code>this</code>
+   */
+  PoolFactory& setLatencyAwareReads(bool enabled);
+
   ~PoolFactory() = default;
 
   PoolFactory(const PoolFactory&) = default;
@@ -21,7 +21,10 @@
 #define GEODE_QUERY_H_
 
 #include <chrono>
+#include <functional>
+#include <memory>
 
+#include "ColumnarResults.hpp"
 #include "SelectResults.hpp"
 #include "internal/geode_globals.hpp"
 
@@ -90,6 +93,56 @@ class APACHE_GEODE_EXPORT Query {
   virtual std::shared_ptr<SelectResults> execute(
       std::shared_ptr<CacheableVector> paramList,
       std::chrono::milliseconds timeout = DEFAULT_QUERY_RESPONSE_TIMEOUT) = 0;
+
+  /**
+   * Handler invoked by {@link executeStreaming} with the results contained
+   * in each response chunk.
+   */
+  using ResultsHandler =
+      std::function<void(const std::shared_ptr<SelectResults>& results)>;
+
+  /**
+   * Executes the OQL Query on the cache server and hands the results to the
+   * given handler one response chunk at a time instead of materializing the
+   * complete result. Each invocation receives a ResultSet or StructSet that
+   * holds only the results decoded from a single chunk.
+   *
+   * The handler may be invoked from an internal thread but never
+   * concurrently for the same execution. Results delivered before a query
+   * error is raised are not retracted.
+   *
+   * @param handler invoked once per non-empty response chunk; must not throw.
+   * @param paramList The query parameters list, optional.
+   * @param timeout The time to wait for query response, optional.
+   *
+   * @throws IllegalArgumentException If timeout exceeds 2147483647ms or the
+   * handler is empty.
+   * @throws QueryException if some query error occurred at the server.
+   * @throws IllegalStateException if some error occurred.
+   * @throws NotConnectedException if no java cache server is available.
+   */
+  virtual void executeStreaming(
+      const ResultsHandler& handler,
+      std::shared_ptr<CacheableVector> paramList = nullptr,
+      std::chrono::milliseconds timeout = DEFAULT_QUERY_RESPONSE_TIMEOUT) = 0;
+
+  /**
+   * Executes the OQL Query and returns the results column by column. Values
+   * of primitive and string fields are decoded straight into typed columns
+   * instead of being materialized as one object per value.
+   *
+   * @param paramList The query parameters list, optional.
+   * @param timeout The time to wait for query response, optional.
+   *
+   * @throws IllegalArgumentException If timeout exceeds 2147483647ms.
+   * @throws QueryException if some query error occurred at the server.
+   * @throws IllegalStateException if some error occurred.
+   * @throws NotConnectedException if no java cache server is available.
+   */
+  virtual std::shared_ptr<ColumnarResults> executeColumnar(
+      std::shared_ptr<CacheableVector> paramList = nullptr,
+      std::chrono::milliseconds timeout = DEFAULT_QUERY_RESPONSE_TIMEOUT);
+
   /**
    * Get the query string provided when a new Query was created from a
    * QueryService.
@@ -174,6 +174,52 @@ class APACHE_GEODE_EXPORT QueryService {
    */
   virtual std::shared_ptr<CacheableArrayList> getAllDurableCqsFromServer()
       const = 0;
+
+  /**
+   * Creates a sorted index on a field of the values cached in a region.
+   * Sorted indexes are used for equality, IN and range (<, <=, >, >=)
+   * predicates on the field. Indexes are maintained as entries are put,
+   * destroyed or invalidated, including by subscription events.
+   *
+   * Only the QueryService returned by Cache::getLocalQueryService()
+   * supports indexes.
+   *
+   * @param name the name of the index, unique within this QueryService
+   * @param indexedExpression the field to index, e.g. "status" or
+   * "p.status"
+   * @param regionPath the region to index, optionally followed by the alias
+   * used in indexedExpression, e.g. "/portfolios p"
+   * @throws UnsupportedOperationException if this QueryService does not
+   * evaluate queries locally
+   * @throws IllegalArgumentException if an index with this name exists, the
+   * region does not exist, or indexedExpression is not a field
+   * @throws IllegalStateException if the region does not cache data
+   * locally
+   * @throws QueryException if the expressions cannot be parsed
+   */
+  virtual void createIndex(const std::string& name,
+                           const std::string& indexedExpression,
+                           const std::string& regionPath);
+
+  /**
+   * Creates a hash index on a field of the values cached in a region. Hash
+   * indexes are used for equality and IN predicates only, and cost less to
+   * maintain than sorted indexes.
+   *
+   * @see createIndex
+   */
+  virtual void createHashIndex(const std::string& name,
+                               const std::string& indexedExpression,
+                               const std::string& regionPath);
+
+  /**
+   * Removes an index created by createIndex or createHashIndex.
+   *
+   * @returns true if the index existed
+   * @throws UnsupportedOperationException if this QueryService does not
+   * evaluate queries locally
+   */
+  virtual bool removeIndex(const std::string& name);
 };
 }  // namespace client
 }  // namespace geode
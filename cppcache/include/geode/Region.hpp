@@ -21,6 +21,7 @@
 #define GEODE_REGION_H_
 
 #include <chrono>
+#include <functional>
 #include <iosfwd>
 #include <memory>
 
@@ -1329,6 +1330,46 @@ class APACHE_GEODE_EXPORT Region : public std::enable_shared_from_this<Region> {
       const std::vector<std::shared_ptr<CacheableKey>>& keys,
       const std::shared_ptr<Serializable>& aCallbackArgument = nullptr) = 0;
 
+  /**
+   * Handler invoked by {@link getAllStreaming} for each entry as it is
+   * received. The value is nullptr if the key was not found on the server.
+   */
+  using GetAllEntryHandler =
+      std::function<void(const std::shared_ptr<CacheableKey>& key,
+                         const std::shared_ptr<Cacheable>& value)>;
+
+  /**
+   * Streaming variant of {@link getAll}. Instead of accumulating all values
+   * into a map, the given handler is invoked for each entry as soon as the
+   * response chunk holding it has been deserialized, so the client never
+   * holds more than one chunk of the result at a time.
+   *
+   * Values found in the local cache are handed to the handler first. Values
+   * fetched from the server are not added to the local cache. The handler
+   * may be invoked from an internal thread, but never concurrently for the
+   * same call, and all invocations have completed when this method returns.
+   * If an operation is retried on another server after a failure, entries
+   * may be handed to the handler more than once.
+   *
+   * @param keys the array of keys
+   * @param handler invoked once per received entry; must not throw.
+   * @param aCallbackArgument an argument that is passed to the callback
+   *   functions. It may be nullptr.
+   * @throws IllegalArgumentException If the array of keys is empty or the
+   *   handler is empty.
+   * @throws CacheServerException If an exception is received from the Java
+   *   cache server while processing the request.
+   * @throws NotConnectedException if it is not connected to the cache.
+   * @throws RegionDestroyedException If region destroy is pending.
+   * @throws TimeoutException if operation timed out.
+   *
+   * @see getAll
+   */
+  virtual void getAllStreaming(
+      const std::vector<std::shared_ptr<CacheableKey>>& keys,
+      const GetAllEntryHandler& handler,
+      const std::shared_ptr<Serializable>& aCallbackArgument = nullptr) = 0;
+
   /**
    * Executes the query on the server based on the predicate.
    * Valid only for a Native Client region.
@@ -1448,6 +1489,18 @@ class APACHE_GEODE_EXPORT Region : public std::enable_shared_from_this<Region> {
 
   virtual const std::shared_ptr<Pool>& getPool() const = 0;
 
+  /**
+   * Writes the puts queued by a region in write-behind mode to the server
+   * and waits until they are written. Does nothing for other regions.
+   *
+   * @throws CacheServerException If an exception is received from the Java
+   *   cache server while writing the puts.
+   * @throws NotConnectedException if it is not connected to the cache.
+   * @throws TimeoutException if operation timed out.
+   * @see RegionAttributesFactory::setWriteBehindBatchSize
+   */
+  virtual void flush();
+
   Cache& getCache();
 
   Region(const Region&) = delete;
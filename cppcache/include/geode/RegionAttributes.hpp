@@ -29,11 +29,13 @@
 #include "CacheListener.hpp"
 #include "CacheLoader.hpp"
 #include "CacheWriter.hpp"
+#include "Compressor.hpp"
 #include "DiskPolicyType.hpp"
 #include "ExpirationAttributes.hpp"
 #include "PartitionResolver.hpp"
 #include "Properties.hpp"
 #include "Serializable.hpp"
+#include "WriteBehindListener.hpp"
 #include "internal/DataSerializableInternal.hpp"
 #include "internal/chrono/duration.hpp"
 #include "internal/geode_globals.hpp"
@@ -310,6 +312,34 @@ class APACHE_GEODE_EXPORT RegionAttributes
   bool getConcurrencyChecksEnabled() const {
     return m_isConcurrencyChecksEnabled;
   }
+
+  /**
+   * Returns the number of distinct keys whose puts are batched before they
+   * are written to the server, or 0 if write-behind is disabled.
+   */
+  uint32_t getWriteBehindBatchSize() const { return m_writeBehindBatchSize; }
+
+  /**
+   * Returns the longest time a put is held back in write-behind mode.
+   */
+  std::chrono::milliseconds getWriteBehindBatchInterval() const {
+    return m_writeBehindBatchInterval;
+  }
+
+  std::shared_ptr<WriteBehindListener> getWriteBehindListener() const {
+    return m_writeBehindListener;
+  }
+
+  /**
+   * Returns the compressor applied to the region's values, or nullptr if
+   * values are not compressed.
+   */
+  std::shared_ptr<Compressor> getCompressor() const { return m_compressor; }
+
+  /**
+   * Returns the serialized size in bytes from which values are compressed.
+   */
+  size_t getCompressionThreshold() const { return m_compressionThreshold; }
   RegionAttributes& operator=(const RegionAttributes&) = default;
 
  private:
@@ -330,6 +360,12 @@ class APACHE_GEODE_EXPORT RegionAttributes
   void setLruEntriesLimit(int limit);
   void setDiskPolicy(DiskPolicyType diskPolicy);
   void setConcurrencyChecksEnabled(bool enable);
+  void setWriteBehindBatchSize(uint32_t batchSize);
+  void setWriteBehindBatchInterval(std::chrono::milliseconds interval);
+  void setWriteBehindListener(
+      const std::shared_ptr<WriteBehindListener>& listener);
+  void setCompressor(const std::shared_ptr<Compressor>& compressor);
+  void setCompressionThreshold(size_t threshold);
 
   inline bool getEntryExpiryEnabled() const {
     return (m_entryTimeToLive > std::chrono::seconds::zero() ||
@@ -378,6 +414,11 @@ class APACHE_GEODE_EXPORT RegionAttributes
   std::string m_poolName;
   bool m_isClonable;
   bool m_isConcurrencyChecksEnabled;
+  uint32_t m_writeBehindBatchSize;
+  std::chrono::milliseconds m_writeBehindBatchInterval;
+  std::shared_ptr<WriteBehindListener> m_writeBehindListener;
+  std::shared_ptr<Compressor> m_compressor;
+  size_t m_compressionThreshold;
   friend class RegionAttributesFactory;
   friend class AttributesMutator;
   friend class Cache;
@@ -427,6 +427,74 @@ class APACHE_GEODE_EXPORT RegionAttributesFactory {
   RegionAttributesFactory& setConcurrencyChecksEnabled(
       bool concurrencyChecksEnabled);
 
+  /**
+   * Enables write-behind for a region connected to a pool. Puts are then
+   * acknowledged once queued, puts to the same key replace each other, and
+   * the queued puts are written to the server as a single putAll once
+   * batchSize distinct keys are queued or the batch interval elapses.
+   * Other operations on the region write the queued puts first. Puts with a
+   * callback argument, a delta or inside a transaction are not queued.
+   *
+   * Values are serialized when their batch is written, so they must not be
+   * modified after they are put. Errors writing a batch are reported to the
+   * WriteBehindListener rather than to the put that queued the value.
+   *
+   * @param batchSize the number of distinct keys per batch; 0, the default,
+   * disables write-behind.
+   * @return a reference to <code>this</code>
+   * @see Region::flush
+   */
+  RegionAttributesFactory& setWriteBehindBatchSize(uint32_t batchSize);
+
+  /**
+   * Sets the longest time a put is queued in write-behind mode before it is
+   * written to the server. The default is 100 milliseconds; 0 writes batches
+   * only when they are full or flushed.
+   * @return a reference to <code>this</code>
+   * @throws IllegalArgumentException if interval is negative.
+   */
+  RegionAttributesFactory& setWriteBehindBatchInterval(
+      std::chrono::milliseconds interval);
+
+  /**
+   * Sets the listener told about each batch written in write-behind mode.
+   * @return a reference to <code>this</code>
+   */
+  RegionAttributesFactory& setWriteBehindListener(
+      const std::shared_ptr<WriteBehindListener>& listener);
+
+  /**
+   * Sets the compressor for the region's values. Values whose serialized
+   * form is at least the compression threshold are held compressed in the
+   * local cache and decompressed when they are read. Reads that overlap
+   * share one decompressed copy, and later reads decompress again.
+   *
+   * Such values are also sent to the server compressed, as a byte array that
+   * starts with a four byte marker and a hash of the compressed bytes, which
+   * the server stores without looking into it. Byte array values of the
+   * region that start with the marker are always sent compressed, so none is
+   * mistaken for a compressed value. Byte arrays received from the server
+   * are decompressed when both the marker and the hash match. All clients of
+   * the region must therefore use the same compressor, and other clients see
+   * compressed values as byte arrays.
+   *
+   * Values are decompressed by region operations and subscription events
+   * only. Query results and function results hold compressed values as the
+   * byte arrays stored by the server, and server side queries cannot look
+   * into them.
+   *
+   * @return a reference to <code>this</code>
+   */
+  RegionAttributesFactory& setCompressor(
+      const std::shared_ptr<Compressor>& compressor);
+
+  /**
+   * Sets the serialized size in bytes from which values are compressed. The
+   * default is 1024.
+   * @return a reference to <code>this</code>
+   */
+  RegionAttributesFactory& setCompressionThreshold(size_t threshold);
+
   // FACTORY METHOD
 
   /**
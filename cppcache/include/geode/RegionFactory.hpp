@@ -262,6 +262,39 @@ class APACHE_GEODE_EXPORT RegionFactory {
    */
   RegionFactory& setConcurrencyChecksEnabled(bool enable);
 
+  /**
+   * Enables write-behind for the region.
+   * @see RegionAttributesFactory::setWriteBehindBatchSize
+   * @return a reference to <code>this</code>
+   */
+  RegionFactory& setWriteBehindBatchSize(uint32_t batchSize);
+
+  /**
+   * @see RegionAttributesFactory::setWriteBehindBatchInterval
+   * @return a reference to <code>this</code>
+   */
+  RegionFactory& setWriteBehindBatchInterval(
+      std::chrono::milliseconds interval);
+
+  /**
+   * @see RegionAttributesFactory::setWriteBehindListener
+   * @return a reference to <code>this</code>
+   */
+  RegionFactory& setWriteBehindListener(
+      const std::shared_ptr<WriteBehindListener>& listener);
+
+  /**
+   * @see RegionAttributesFactory::setCompressor
+   * @return a reference to <code>this</code>
+   */
+  RegionFactory& setCompressor(const std::shared_ptr<Compressor>& compressor);
+
+  /**
+   * @see RegionAttributesFactory::setCompressionThreshold
+   * @return a reference to <code>this</code>
+   */
+  RegionFactory& setCompressionThreshold(size_t threshold);
+
  private:
   RegionFactory(apache::geode::client::RegionShortcut preDefinedRegion,
                 CacheImpl* cacheImpl);
@@ -228,6 +228,31 @@ inline void writeArrayObject(apache::geode::client::DataOutput& output,
   }
 }
 
+inline void writeArrayObject(apache::geode::client::DataOutput& output,
+                             const std::vector<int16_t>& array) {
+  output.writeShortArray(array);
+}
+
+inline void writeArrayObject(apache::geode::client::DataOutput& output,
+                             const std::vector<int32_t>& array) {
+  output.writeIntArray(array);
+}
+
+inline void writeArrayObject(apache::geode::client::DataOutput& output,
+                             const std::vector<int64_t>& array) {
+  output.writeLongArray(array);
+}
+
+inline void writeArrayObject(apache::geode::client::DataOutput& output,
+                             const std::vector<float>& array) {
+  output.writeFloatArray(array);
+}
+
+inline void writeArrayObject(apache::geode::client::DataOutput& output,
+                             const std::vector<double>& array) {
+  output.writeDoubleArray(array);
+}
+
 template <typename TObj>
 inline std::vector<TObj> readArrayObject(
     apache::geode::client::DataInput& input) {
@@ -242,6 +267,42 @@ inline std::vector<TObj> readArrayObject(
   return array;
 }
 
+template <>
+inline std::vector<int8_t> readArrayObject<int8_t>(
+    apache::geode::client::DataInput& input) {
+  return input.readByteArray();
+}
+
+template <>
+inline std::vector<int16_t> readArrayObject<int16_t>(
+    apache::geode::client::DataInput& input) {
+  return input.readShortArray();
+}
+
+template <>
+inline std::vector<int32_t> readArrayObject<int32_t>(
+    apache::geode::client::DataInput& input) {
+  return input.readIntArray();
+}
+
+template <>
+inline std::vector<int64_t> readArrayObject<int64_t>(
+    apache::geode::client::DataInput& input) {
+  return input.readLongArray();
+}
+
+template <>
+inline std::vector<float> readArrayObject<float>(
+    apache::geode::client::DataInput& input) {
+  return input.readFloatArray();
+}
+
+template <>
+inline std::vector<double> readArrayObject<double>(
+    apache::geode::client::DataInput& input) {
+  return input.readDoubleArray();
+}
+
 template <typename TObj, typename TLen>
 inline void readObject(apache::geode::client::DataInput& input, TObj*& array,
                        TLen& len) {
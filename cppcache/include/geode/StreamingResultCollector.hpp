@@ -0,0 +1,163 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_STREAMINGRESULTCOLLECTOR_H_
+#define GEODE_STREAMINGRESULTCOLLECTOR_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+
+#include "CacheableBuiltins.hpp"
+#include "ResultCollector.hpp"
+#include "internal/geode_globals.hpp"
+
+/**
+ * @file
+ */
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * @class StreamingResultCollector StreamingResultCollector.hpp
+ *
+ * A ResultCollector that hands function results to the application as they
+ * arrive instead of accumulating them. Results are held in a bounded queue;
+ * when it is full the connection delivering results waits, which stops
+ * reading from that server until the application catches up.
+ *
+ * Since Execution::execute returns only after all results were received,
+ * it has to run on another thread while the application consumes results:
+ * <pre>
+ * auto rc = std::make_shared<StreamingResultCollector>(1000);
+ * auto done = std::async(std::launch::async, [&] {
+ *   FunctionService::onServers(pool).withCollector(rc).execute("fn");
+ * });
+ * std::shared_ptr<Cacheable> result;
+ * while (rc->next(result)) {
+ *   // process result, or rc->cancel() to stop early
+ * }
+ * done.get();
+ * </pre>
+ *
+ * If function execution is retried for HA, results that were not yet taken
+ * are discarded. Once a result was taken the execution is not retried, since
+ * a retry would deliver that result again; it fails instead.
+ *
+ * A consumer that takes no result for as long as the execution timeout
+ * fails the execution, rather than holding the connection forever.
+ */
+class APACHE_GEODE_EXPORT StreamingResultCollector : public ResultCollector {
+ public:
+  /**
+   * @param capacity the number of results that may be queued before
+   * delivery waits for the application.
+   *
+   * @throws IllegalArgumentException if capacity is 0.
+   */
+  explicit StreamingResultCollector(size_t capacity = 1024);
+  ~StreamingResultCollector() noexcept override;
+
+  /**
+   * Waits for the next result.
+   *
+   * @param result set to the next result.
+   * @param timeout the time to wait for a result to arrive.
+   * @return false once all results were taken or the collector is
+   * cancelled.
+   * @throws FunctionExecutionException if no result arrives within timeout.
+   * @throws Exception the error function execution failed with, once the
+   * results received before the error were taken.
+   */
+  bool next(std::shared_ptr<Cacheable>& result,
+            std::chrono::milliseconds timeout = DEFAULT_QUERY_RESPONSE_TIMEOUT);
+
+  /**
+   * Stops delivering results. Queued results are discarded and results still
+   * arriving are skipped without being deserialized.
+   */
+  void cancel();
+
+  bool isCancelled() const;
+
+  /**
+   * Takes all remaining results.
+   *
+   * @param timeout the time to wait for each result to arrive.
+   * @see next
+   */
+  std::shared_ptr<CacheableVector> getResult(
+      std::chrono::milliseconds timeout =
+          DEFAULT_QUERY_RESPONSE_TIMEOUT) override;
+
+  /**
+   * Sets the longest time addResult waits for room in the queue. Execution
+   * sets this to its own timeout.
+   */
+  void setTimeout(std::chrono::milliseconds timeout);
+
+  /**
+   * Queues a result, waiting while the queue is full.
+   *
+   * @throws FunctionExecutionException if the queue stays full for longer
+   * than the timeout. The consumer gets the same error once it has taken the
+   * queued results.
+   */
+  void addResult(
+      const std::shared_ptr<Cacheable>& resultOfSingleExecution) override;
+
+  void endResults() override;
+
+  /**
+   * Discards the results not yet taken, before the execution is retried.
+   *
+   * @throws FunctionExecutionException if a result was already taken.
+   */
+  void clearResults() override;
+
+  /**
+   * Ends the results with the error function execution failed with. The
+   * error is raised by next once the queued results were taken. Only the
+   * first error is kept.
+   */
+  void setException(std::exception_ptr exception);
+
+ private:
+  const size_t m_capacity;
+  std::chrono::milliseconds m_timeout;
+  std::deque<std::shared_ptr<Cacheable>> m_results;
+  bool m_taken;
+  bool m_ended;
+  bool m_cancelled;
+  std::exception_ptr m_exception;
+  std::condition_variable m_notEmpty;
+  std::condition_variable m_notFull;
+  mutable std::mutex m_mutex;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_STREAMINGRESULTCOLLECTOR_H_
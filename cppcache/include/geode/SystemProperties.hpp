@@ -190,6 +190,51 @@ class APACHE_GEODE_EXPORT SystemProperties {
     return m_notifyDupCheckLife;
   }
 
+  /**
+   * Returns the number of threads subscription events are handed to after
+   * they are received. Events for the same key are handled in order on one
+   * thread. Zero, the default, handles events on the receiving thread.
+   */
+  uint32_t notifyDispatchThreads() const { return m_notifyDispatchThreads; }
+
+  /**
+   * Returns the number of received subscription events each dispatch thread
+   * may have waiting before the receiving thread blocks.
+   */
+  uint32_t notifyDispatchQueueSize() const { return m_notifyDispatchQueueSize; }
+
+  /**
+   * Whether SSL connections hand record encryption to the kernel (kTLS) after
+   * the handshake, where the platform supports it. Connections fall back to
+   * encrypting in user space where it does not.
+   *
+   * Offloaded connections negotiate at most TLS 1.2, even when both sides
+   * support TLS 1.3, since records a TLS 1.3 server sends after the
+   * handshake, such as session tickets, cannot be read from an offloaded
+   * socket. If a server refuses TLS 1.2, or the negotiated cipher cannot be
+   * offloaded, the connection is made again without kTLS and later
+   * connections of the pool no longer attempt it.
+   */
+  bool sslKtlsEnabled() const { return m_sslKtlsEnabled; }
+
+  /**
+   * Returns the fraction, between 0 and 1, of region operations whose phases
+   * are recorded as trace spans. Zero, the default, disables tracing.
+   */
+  double tracingSampleRate() const { return m_tracingSampleRate; }
+
+  /**
+   * Returns the file sampled spans are appended to, one JSON object per line,
+   * when no TraceExporter was set on the CacheFactory. Empty by default.
+   */
+  const std::string& tracingFile() const { return m_tracingFile; }
+
+  /**
+   * Returns the number of finished spans kept until the next export. The
+   * oldest spans are dropped when the exporter falls behind.
+   */
+  uint32_t tracingBufferSize() const { return m_tracingBufferSize; }
+
   /**
    * Returns the durable client ID
    */
@@ -285,6 +330,20 @@ class APACHE_GEODE_EXPORT SystemProperties {
     m_onClientDisconnectClearPdxTypeIds = set;
   }
 
+  /**
+   * Returns true if expiry tasks are scheduled on a timing wheel instead of
+   * the reactor's timer heap. Default is false.
+   */
+  bool expiryTimingWheelEnabled() const { return m_expiryTimingWheelEnabled; }
+
+  /**
+   * Returns the tick of the expiry timing wheel. Expiration deadlines are
+   * rounded up to a whole tick.
+   */
+  const std::chrono::milliseconds& expiryTimingWheelTick() const {
+    return m_expiryTimingWheelTick;
+  }
+
   /**
    * @return Empty string
    * @deprecated Diffie-Hellman based credentials encryption is not supported.
@@ -411,6 +470,14 @@ class APACHE_GEODE_EXPORT SystemProperties {
   std::chrono::milliseconds m_tombstoneTimeout;
   bool m_enableChunkHandlerThread;
   bool m_onClientDisconnectClearPdxTypeIds;
+  bool m_expiryTimingWheelEnabled;
+  std::chrono::milliseconds m_expiryTimingWheelTick;
+  uint32_t m_notifyDispatchThreads;
+  uint32_t m_notifyDispatchQueueSize;
+  bool m_sslKtlsEnabled;
+  double m_tracingSampleRate;
+  std::string m_tracingFile;
+  uint32_t m_tracingBufferSize;
 
   /**
    * Processes the given property/value pair, saving
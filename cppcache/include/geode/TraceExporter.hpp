@@ -0,0 +1,99 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#ifndef GEODE_TRACEEXPORTER_H_
+#define GEODE_TRACEEXPORTER_H_
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "internal/geode_globals.hpp"
+
+/**
+ * @file
+ */
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * @class TraceSpan TraceExporter.hpp
+ *
+ * One timed phase of a sampled client operation, such as checking a
+ * connection out of the pool or waiting for the server's reply. Identifiers
+ * have the sizes used by W3C Trace Context and OpenTelemetry: a 128 bit trace
+ * id shared by all spans of an operation and a 64 bit id per span.
+ */
+class APACHE_GEODE_EXPORT TraceSpan {
+ public:
+  uint64_t traceIdHigh = 0;
+  uint64_t traceIdLow = 0;
+  uint64_t spanId = 0;
+
+  /** Id of the enclosing span, or 0 for the root span of the operation. */
+  uint64_t parentSpanId = 0;
+
+  std::string name;
+  std::chrono::system_clock::time_point start;
+  std::chrono::nanoseconds duration{0};
+
+  /** Details such as the region, the server or the number of bytes read. */
+  std::vector<std::pair<std::string, std::string>> attributes;
+
+  /** Whether the phase ended with an error. */
+  bool error = false;
+};
+
+/**
+ * @class TraceExporter TraceExporter.hpp
+ *
+ * Receives the spans of sampled operations. Spans are buffered as operations
+ * finish and handed over in batches on a thread of the cache's own, so an
+ * exporter may block, for example to send them to an OpenTelemetry
+ * collector, without slowing down the operations being traced.
+ *
+ * @see CacheFactory::setTraceExporter
+ */
+class APACHE_GEODE_EXPORT TraceExporter {
+ public:
+  TraceExporter();
+  virtual ~TraceExporter();
+
+  /**
+   * Called with a batch of finished spans. The spans of one operation may be
+   * split across batches.
+   */
+  virtual void exportSpans(const std::vector<TraceSpan>& spans) = 0;
+
+  /**
+   * Called once when the cache closes, after the last batch.
+   */
+  virtual void shutdown();
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_TRACEEXPORTER_H_
@@ -0,0 +1,74 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_WRITEBEHINDLISTENER_H_
+#define GEODE_WRITEBEHINDLISTENER_H_
+
+#include "CacheableBuiltins.hpp"
+#include "internal/geode_globals.hpp"
+
+/**
+ * @file
+ */
+
+namespace apache {
+namespace geode {
+namespace client {
+
+class Exception;
+class Region;
+
+/**
+ * @class WriteBehindListener WriteBehindListener.hpp
+ *
+ * Receives the outcome of each batch of puts written to the server by a
+ * region in write-behind mode.
+ *
+ * @see RegionAttributesFactory::setWriteBehindBatchSize
+ */
+class APACHE_GEODE_EXPORT WriteBehindListener {
+ public:
+  WriteBehindListener();
+  virtual ~WriteBehindListener();
+
+  /**
+   * Called after a batch of puts was written to the server.
+   *
+   * @param region the region the puts were made on.
+   * @param batch the latest value put for each key in the batch.
+   */
+  virtual void afterFlush(Region& region, const HashMapOfCacheable& batch);
+
+  /**
+   * Called when writing a batch of puts to the server failed. The puts are
+   * not retried; the values remain in the local cache, if any.
+   *
+   * @param region the region the puts were made on.
+   * @param batch the latest value put for each key in the batch.
+   * @param exception the reason the batch failed.
+   */
+  virtual void afterFlushError(Region& region, const HashMapOfCacheable& batch,
+                               const Exception& exception);
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_WRITEBEHINDLISTENER_H_
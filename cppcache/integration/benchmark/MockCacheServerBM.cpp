@@ -0,0 +1,129 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <framework/MockCacheServer.h>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <geode/Cache.hpp>
+#include <geode/CacheableString.hpp>
+#include <geode/Region.hpp>
+#include <geode/RegionFactory.hpp>
+#include <geode/RegionShortcut.hpp>
+
+using apache::geode::client::Cache;
+using apache::geode::client::CacheableInt32;
+using apache::geode::client::CacheableKey;
+using apache::geode::client::CacheableString;
+using apache::geode::client::HashMapOfCacheable;
+using apache::geode::client::Region;
+using apache::geode::client::RegionShortcut;
+
+namespace {
+
+/**
+ * Region operations against an in-process MockCacheServer, so that only the
+ * client and the loopback interface are measured. The benchmark argument is
+ * the latency, in microseconds, the server adds to every reply.
+ */
+class MockCacheServerBM : public benchmark::Fixture {
+ public:
+  using benchmark::Fixture::SetUp;
+  void SetUp(benchmark::State& state) override {
+    if (!server) {
+      server = std::unique_ptr<MockCacheServer>(new MockCacheServer());
+      cache = std::unique_ptr<Cache>(new Cache(server->createCache()));
+      region = cache->createRegionFactory(RegionShortcut::PROXY)
+                   .setPoolName("default")
+                   .create("region");
+    }
+    server->setLatency(std::chrono::microseconds(state.range(0)));
+  }
+
+  using benchmark::Fixture::TearDown;
+  void TearDown(benchmark::State&) override {
+    if (server) {
+      region = nullptr;
+      cache = nullptr;
+      server = nullptr;
+    }
+  }
+
+ protected:
+  std::unique_ptr<MockCacheServer> server;
+  std::unique_ptr<Cache> cache;
+  std::shared_ptr<Region> region;
+};
+
+BENCHMARK_DEFINE_F(MockCacheServerBM, put_string)(benchmark::State& state) {
+  auto key = CacheableString::create("key");
+  auto value = CacheableString::create("value");
+
+  for (auto _ : state) {
+    region->put(key, value);
+  }
+}
+
+BENCHMARK_DEFINE_F(MockCacheServerBM, get_string)(benchmark::State& state) {
+  auto key = CacheableString::create("key");
+  auto value = CacheableString::create("value");
+
+  region->put(key, value);
+
+  for (auto _ : state) {
+    region->get(key);
+  }
+}
+
+BENCHMARK_DEFINE_F(MockCacheServerBM, put_all_100)(benchmark::State& state) {
+  HashMapOfCacheable entries;
+  for (int32_t i = 0; i < 100; ++i) {
+    entries.emplace(CacheableInt32::create(i),
+                    CacheableString::create(std::to_string(i)));
+  }
+
+  for (auto _ : state) {
+    region->putAll(entries);
+  }
+  state.SetItemsProcessed(state.iterations() * 100);
+}
+
+BENCHMARK_DEFINE_F(MockCacheServerBM, get_all_100)(benchmark::State& state) {
+  HashMapOfCacheable entries;
+  std::vector<std::shared_ptr<CacheableKey>> keys;
+  for (int32_t i = 0; i < 100; ++i) {
+    auto key = CacheableInt32::create(i);
+    entries.emplace(key, CacheableString::create(std::to_string(i)));
+    keys.push_back(key);
+  }
+  region->putAll(entries);
+
+  for (auto _ : state) {
+    region->getAll(keys);
+  }
+  state.SetItemsProcessed(state.iterations() * 100);
+}
+
+BENCHMARK_REGISTER_F(MockCacheServerBM, put_string)->Arg(0)->Arg(100);
+BENCHMARK_REGISTER_F(MockCacheServerBM, get_string)->Arg(0)->Arg(100);
+BENCHMARK_REGISTER_F(MockCacheServerBM, put_all_100)->Arg(0)->Arg(100);
+BENCHMARK_REGISTER_F(MockCacheServerBM, get_all_100)->Arg(0)->Arg(100);
+
+}  // namespace
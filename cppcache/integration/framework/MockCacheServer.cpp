@@ -0,0 +1,1072 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "MockCacheServer.h"
+
+#include <algorithm>
+#include <cctype>
+#include <stdexcept>
+#include <vector>
+
+#include <geode/CacheFactory.hpp>
+#include <geode/PoolManager.hpp>
+#include <geode/internal/DSCode.hpp>
+#include <geode/internal/DSFixedId.hpp>
+
+namespace {
+
+using apache::geode::client::internal::DSCode;
+using apache::geode::client::internal::DSFid;
+
+const uint8_t CLIENT_TO_SERVER = 100;
+const uint8_t PRIMARY_SERVER_TO_CLIENT = 101;
+const uint8_t SUCCESSFUL_SERVER_TO_CLIENT = 105;
+const uint8_t REPLY_OK = 59;
+const uint8_t REPLY_REFUSED = 60;
+const uint8_t SECURITY_CREDENTIALS_NONE = 0;
+const uint8_t LONER_DM_TYPE = 13;
+const uint8_t LAST_CHUNK = 0x01;
+const uint8_t KEY_NOT_AT_SERVER = 3;
+
+// Reads the big-endian encodings the client writes. Malformed or unsupported
+// input is reported as std::invalid_argument so that it becomes an exception
+// reply rather than a dropped connection.
+class Reader {
+ public:
+  explicit Reader(const std::string &bytes) : bytes_(bytes), position_(0) {}
+
+  uint8_t readByte() {
+    require(1);
+    return static_cast<uint8_t>(bytes_[position_++]);
+  }
+
+  int16_t readInt16() { return static_cast<int16_t>(readUnsigned(2)); }
+
+  int32_t readInt32() { return static_cast<int32_t>(readUnsigned(4)); }
+
+  int32_t readArrayLength() {
+    auto code = readByte();
+    if (code == 0xFF) {
+      return -1;
+    } else if (code == 0xFE) {
+      return static_cast<uint16_t>(readInt16());
+    } else if (code == 0xFD) {
+      return readInt32();
+    }
+    return code;
+  }
+
+  std::string readBytes(size_t length) {
+    require(length);
+    auto bytes = bytes_.substr(position_, length);
+    position_ += length;
+    return bytes;
+  }
+
+  void skip(size_t length) {
+    require(length);
+    position_ += length;
+  }
+
+  // Skips one serialized object of a type that is commonly used as a key.
+  void skipObject() {
+    auto code = static_cast<DSCode>(readByte());
+    switch (code) {
+      case DSCode::NullObj:
+      case DSCode::CacheableNullString:
+        break;
+      case DSCode::CacheableBoolean:
+      case DSCode::CacheableByte:
+        skip(1);
+        break;
+      case DSCode::CacheableCharacter:
+      case DSCode::CacheableInt16:
+        skip(2);
+        break;
+      case DSCode::CacheableInt32:
+      case DSCode::CacheableFloat:
+        skip(4);
+        break;
+      case DSCode::CacheableInt64:
+      case DSCode::CacheableDouble:
+      case DSCode::CacheableDate:
+        skip(8);
+        break;
+      case DSCode::CacheableString:
+      case DSCode::CacheableASCIIString:
+        skip(static_cast<uint16_t>(readInt16()));
+        break;
+      case DSCode::CacheableASCIIStringHuge:
+        skip(static_cast<uint32_t>(readInt32()));
+        break;
+      case DSCode::CacheableStringHuge:
+        skip(2 * static_cast<size_t>(static_cast<uint32_t>(readInt32())));
+        break;
+      case DSCode::CacheableBytes: {
+        auto length = readArrayLength();
+        skip(length > 0 ? static_cast<size_t>(length) : 0);
+        break;
+      }
+      default:
+        throw std::invalid_argument("unsupported key type " +
+                                    std::to_string(static_cast<int>(code)));
+    }
+  }
+
+  size_t getPosition() const { return position_; }
+
+ private:
+  uint32_t readUnsigned(size_t length) {
+    require(length);
+    uint32_t value = 0;
+    for (size_t i = 0; i < length; ++i) {
+      value = (value << 8) | static_cast<uint8_t>(bytes_[position_++]);
+    }
+    return value;
+  }
+
+  void require(size_t length) const {
+    if (bytes_.size() - position_ < length) {
+      throw std::invalid_argument("truncated message");
+    }
+  }
+
+  const std::string &bytes_;
+  size_t position_;
+};
+
+void writeByte(std::string &out, uint8_t value) {
+  out.push_back(static_cast<char>(value));
+}
+
+void writeByte(std::string &out, DSCode code) {
+  writeByte(out, static_cast<uint8_t>(code));
+}
+
+void writeInt16(std::string &out, int16_t value) {
+  writeByte(out, static_cast<uint8_t>(value >> 8));
+  writeByte(out, static_cast<uint8_t>(value));
+}
+
+void writeInt32(std::string &out, int32_t value) {
+  for (int shift = 24; shift >= 0; shift -= 8) {
+    writeByte(out, static_cast<uint8_t>(value >> shift));
+  }
+}
+
+void writeInt64(std::string &out, int64_t value) {
+  for (int shift = 56; shift >= 0; shift -= 8) {
+    writeByte(out, static_cast<uint8_t>(value >> shift));
+  }
+}
+
+void writeArrayLength(std::string &out, size_t length) {
+  if (length <= 252) {
+    writeByte(out, static_cast<uint8_t>(length));
+  } else if (length <= 0xFFFF) {
+    writeByte(out, 0xFE);
+    writeInt16(out, static_cast<int16_t>(length));
+  } else {
+    writeByte(out, 0xFD);
+    writeInt32(out, static_cast<int32_t>(length));
+  }
+}
+
+void writeUnsignedVL(std::string &out, uint64_t value) {
+  while (value > 0x7F) {
+    writeByte(out, static_cast<uint8_t>((value & 0x7F) | 0x80));
+    value >>= 7;
+  }
+  writeByte(out, static_cast<uint8_t>(value));
+}
+
+void writeString(std::string &out, const std::string &value) {
+  writeByte(out, DSCode::CacheableASCIIString);
+  writeInt16(out, static_cast<int16_t>(value.size()));
+  out += value;
+}
+
+std::string part(int8_t isObject, const std::string &bytes) {
+  std::string out;
+  writeInt32(out, static_cast<int32_t>(bytes.size()));
+  writeByte(out, static_cast<uint8_t>(isObject));
+  return out + bytes;
+}
+
+std::string intPart(int32_t value) {
+  std::string bytes;
+  writeInt32(bytes, value);
+  return part(0, bytes);
+}
+
+std::string booleanPart(bool value) {
+  std::string bytes;
+  writeByte(bytes, DSCode::CacheableBoolean);
+  writeByte(bytes, value ? 1 : 0);
+  return part(1, bytes);
+}
+
+// Single-hop metadata: "no refresh needed".
+std::string metadataPart() { return part(0, std::string(1, '\0')); }
+
+std::string message(int32_t type, int32_t transactionId,
+                    const std::vector<std::string> &parts) {
+  size_t length = 0;
+  for (const auto &encoded : parts) {
+    length += encoded.size();
+  }
+  std::string out;
+  out.reserve(17 + length);
+  writeInt32(out, type);
+  writeInt32(out, static_cast<int32_t>(length));
+  writeInt32(out, static_cast<int32_t>(parts.size()));
+  writeInt32(out, transactionId);
+  writeByte(out, 0);
+  for (const auto &encoded : parts) {
+    out += encoded;
+  }
+  return out;
+}
+
+std::string chunk(int32_t type, int32_t transactionId, int32_t numberOfParts,
+                  uint8_t flags, const std::string &body) {
+  std::string out;
+  out.reserve(17 + body.size());
+  writeInt32(out, type);
+  writeInt32(out, numberOfParts);
+  writeInt32(out, transactionId);
+  writeInt32(out, static_cast<int32_t>(body.size()));
+  writeByte(out, flags);
+  return out + body;
+}
+
+bool isChunkedResponse(int32_t type) {
+  switch (type) {
+    case MockCacheServer::REGISTER_INTEREST:
+    case MockCacheServer::REGISTER_INTEREST_LIST:
+    case MockCacheServer::QUERY:
+    case MockCacheServer::QUERY_WITH_PARAMETERS:
+    case MockCacheServer::KEY_SET:
+    case MockCacheServer::EXECUTECQ_MSG_TYPE:
+    case MockCacheServer::EXECUTECQ_WITH_IR_MSG_TYPE:
+    case MockCacheServer::EXECUTE_REGION_FUNCTION:
+    case MockCacheServer::EXECUTE_FUNCTION:
+    case MockCacheServer::EXECUTE_REGION_FUNCTION_SINGLE_HOP:
+    case MockCacheServer::GETDURABLECQS_MSG_TYPE:
+    case MockCacheServer::GET_ALL_70:
+    case MockCacheServer::GET_ALL_WITH_CALLBACK:
+    case MockCacheServer::PUTALL:
+    case MockCacheServer::PUT_ALL_WITH_CALLBACK:
+    case MockCacheServer::REMOVE_ALL:
+      return true;
+    default:
+      return false;
+  }
+}
+
+// The client skips the first part (a serialized Java exception) and reports
+// the second one as the exception message.
+std::string exceptionReply(int32_t request, int32_t transactionId,
+                           const std::string &text) {
+  auto cause = part(1, std::string(1, static_cast<char>(
+                                          DSCode::JavaSerializable)));
+  if (isChunkedResponse(request)) {
+    return chunk(MockCacheServer::EXCEPTION, transactionId, 2,
+                 (2 << 5) | LAST_CHUNK, cause + part(0, text));
+  }
+  return message(MockCacheServer::EXCEPTION, transactionId,
+                 {cause, part(0, text)});
+}
+
+// Values arrive either serialized or, for byte arrays, raw. Replies that
+// embed values in a larger object need the serialized form.
+std::string serialized(int8_t isObject, const std::string &bytes) {
+  if (isObject == 1) {
+    return bytes;
+  }
+  std::string out;
+  writeByte(out, DSCode::CacheableBytes);
+  writeArrayLength(out, bytes.size());
+  return out + bytes;
+}
+
+int32_t intValue(const std::string &bytes) {
+  Reader reader(bytes);
+  return reader.readInt32();
+}
+
+std::string regionFromQuery(const std::string &query) {
+  std::string lower(query);
+  std::transform(lower.begin(), lower.end(), lower.begin(), [](char c) {
+    return static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+  });
+  auto from = lower.find(" from ");
+  if (from == std::string::npos) {
+    throw std::invalid_argument("unsupported query: " + query);
+  }
+  auto begin = query.find_first_not_of(' ', from + 6);
+  if (begin == std::string::npos || query[begin] != '/') {
+    throw std::invalid_argument("unsupported query: " + query);
+  }
+  auto end = query.find_first_of(" \t\r\n", begin);
+  return query.substr(begin, end == std::string::npos ? end : end - begin);
+}
+
+}  // namespace
+
+MockCacheServer::MockCacheServer()
+    : acceptor_(context_,
+                boost::asio::ip::tcp::endpoint(
+                    boost::asio::ip::address_v4::loopback(), 0)),
+      latency_(0),
+      sequence_(0),
+      stopped_(false) {
+  for (auto &count : requestCounts_) {
+    count = 0;
+  }
+
+  // A loner InternalDistributedMember describing this server.
+  std::string member;
+  writeByte(member, DSCode::FixedIDByte);
+  writeByte(member, static_cast<uint8_t>(DSFid::InternalDistributedMember));
+  writeArrayLength(member, 4);
+  member += std::string("\x7f\x00\x00\x01", 4);
+  writeInt32(member, getPort());
+  writeString(member, "localhost");
+  writeByte(member, 0);   // flags, no version ordinal follows
+  writeInt32(member, 0);  // direct channel port
+  writeInt32(member, 0);  // process id
+  writeByte(member, LONER_DM_TYPE);
+  writeArrayLength(member, 0);  // groups
+  writeString(member, "");      // distributed system name
+  writeString(member, "mock");  // unique tag
+  writeString(member, "");      // durable client id
+  writeInt32(member, 0);        // durable client timeout
+  // UUID and weight
+  member += std::string(17, '\0');
+  memberBytes_ = std::move(member);
+
+  acceptThread_ = std::thread([this] { accept(); });
+}
+
+MockCacheServer::~MockCacheServer() { stop(); }
+
+uint16_t MockCacheServer::getPort() const {
+  return acceptor_.local_endpoint().port();
+}
+
+apache::geode::client::Cache MockCacheServer::createCache() {
+  return createCache({});
+}
+
+apache::geode::client::Cache MockCacheServer::createCache(
+    const std::unordered_map<std::string, std::string> &properties) {
+  return createCache(properties, false);
+}
+
+apache::geode::client::Cache MockCacheServer::createCache(
+    const std::unordered_map<std::string, std::string> &properties,
+    bool subscriptionEnabled) {
+  using apache::geode::client::CacheFactory;
+
+  CacheFactory cacheFactory;
+
+  for (auto &&property : properties) {
+    cacheFactory.set(property.first, property.second);
+  }
+
+  auto cache = cacheFactory.set("log-level", "none")
+                   .set("statistic-sampling-enabled", "false")
+                   .create();
+
+  cache.getPoolManager()
+      .createFactory()
+      .setSubscriptionEnabled(subscriptionEnabled)
+      .setPRSingleHopEnabled(false)
+      .addServer("127.0.0.1", getPort())
+      .create("default");
+
+  return cache;
+}
+
+void MockCacheServer::setLatency(std::chrono::microseconds latency) {
+  latency_ = latency.count();
+}
+
+uint64_t MockCacheServer::getRequestCount(int32_t messageType) const {
+  if (messageType < 0 ||
+      static_cast<size_t>(messageType) >= requestCounts_.size()) {
+    return 0;
+  }
+  return requestCounts_[static_cast<size_t>(messageType)];
+}
+
+size_t MockCacheServer::getRegionSize(const std::string &region) const {
+  auto path = region.empty() || region[0] != '/' ? "/" + region : region;
+  std::lock_guard<std::mutex> guard(regionsMutex_);
+  auto entries = regions_.find(path);
+  return entries == regions_.end() ? 0 : entries->second.size();
+}
+
+size_t MockCacheServer::getConnectionCount() const {
+  std::lock_guard<std::mutex> guard(connectionsMutex_);
+  return static_cast<size_t>(
+      std::count_if(sockets_.begin(), sockets_.end(),
+                    [](const std::weak_ptr<Socket> &weak) {
+                      return !weak.expired();
+                    }));
+}
+
+void MockCacheServer::stop() {
+  std::list<std::thread> threads;
+  {
+    std::lock_guard<std::mutex> guard(connectionsMutex_);
+    if (stopped_) {
+      return;
+    }
+    stopped_ = true;
+    for (auto &weak : sockets_) {
+      if (auto socket = weak.lock()) {
+        boost::system::error_code ignored;
+        socket->shutdown(Socket::shutdown_both, ignored);
+      }
+    }
+    threads.swap(threads_);
+    finished_.clear();
+  }
+
+  // Wake the blocking accept so the accept thread sees stopped_.
+  boost::system::error_code ignored;
+  Socket wakeup(context_);
+  wakeup.connect(acceptor_.local_endpoint(), ignored);
+  acceptThread_.join();
+  acceptor_.close(ignored);
+
+  for (auto &thread : threads) {
+    thread.join();
+  }
+}
+
+void MockCacheServer::accept() {
+  while (true) {
+    auto socket = std::make_shared<Socket>(context_);
+    boost::system::error_code error;
+    acceptor_.accept(*socket, error);
+
+    std::list<std::thread> finished;
+    {
+      std::lock_guard<std::mutex> guard(connectionsMutex_);
+      if (error || stopped_) {
+        return;
+      }
+      sockets_.remove_if(
+          [](const std::weak_ptr<Socket> &weak) { return weak.expired(); });
+      sockets_.push_back(socket);
+      for (auto id : finished_) {
+        auto thread = std::find_if(
+            threads_.begin(), threads_.end(),
+            [id](const std::thread &thread) { return thread.get_id() == id; });
+        finished.splice(finished.end(), threads_, thread);
+      }
+      finished_.clear();
+      threads_.emplace_back([this, socket] {
+        serve(socket);
+        std::lock_guard<std::mutex> guard(connectionsMutex_);
+        finished_.push_back(std::this_thread::get_id());
+      });
+    }
+
+    // These threads are returning, so the joins do not wait on clients.
+    for (auto &thread : finished) {
+      thread.join();
+    }
+  }
+}
+
+void MockCacheServer::serve(std::shared_ptr<Socket> socket) {
+  try {
+    socket->set_option(boost::asio::ip::tcp::no_delay(true));
+
+    auto receive = [&socket](size_t length) {
+      std::string bytes(length, '\0');
+      boost::asio::read(*socket, boost::asio::buffer(&bytes[0], length));
+      return bytes;
+    };
+    auto receiveInt32 = [&receive]() { return intValue(receive(4)); };
+
+    // mode, version ordinal and REPLY_OK
+    auto prefix = receive(3);
+    auto mode = static_cast<uint8_t>(prefix[0]);
+    auto subscription = mode != CLIENT_TO_SERVER;
+    if (subscription) {
+      auto ports = receiveInt32();
+      receive(4 * static_cast<size_t>(std::max(ports, 0)));
+    } else {
+      receiveInt32();  // read timeout
+    }
+
+    // ClientProxyMembershipID header and member bytes
+    receive(2);
+    auto code = static_cast<uint8_t>(receive(1)[0]);
+    int32_t length = code;
+    if (code == 0xFE) {
+      length = static_cast<uint16_t>(Reader(receive(2)).readInt16());
+    } else if (code == 0xFD) {
+      length = receiveInt32();
+    }
+    auto memberId = receive(static_cast<size_t>(std::max(length, 0)));
+
+    // 1, overrides and the security mode
+    auto trailer = receive(6);
+    if (static_cast<uint8_t>(trailer[5]) != SECURITY_CREDENTIALS_NONE) {
+      // the client prints the message as a C string
+      reply(*socket, handshakeReply(subscription, REPLY_REFUSED,
+                                    std::string("security is not supported") +
+                                        '\0',
+                                    0));
+      return;
+    }
+
+    // 0 - non-redundant, 1 - redundant, 2 - primary
+    uint8_t queueStatus = 0;
+    if (subscription) {
+      queueStatus = mode == PRIMARY_SERVER_TO_CLIENT ? 2 : 1;
+    }
+    reply(*socket,
+          handshakeReply(subscription,
+                         subscription ? SUCCESSFUL_SERVER_TO_CLIENT : REPLY_OK,
+                         "", queueStatus));
+
+    if (subscription) {
+      serveSubscriber(socket, memberId);
+    } else {
+      serveClient(*socket, memberId);
+    }
+  } catch (const std::exception &) {
+    // connection closed by either side
+  }
+}
+
+std::string MockCacheServer::handshakeReply(bool subscription, uint8_t code,
+                                            const std::string &text,
+                                            uint8_t queueStatus) {
+  std::string out;
+  writeByte(out, code);
+  writeByte(out, queueStatus);
+  writeInt32(out, 0);  // queue size
+  if (!subscription) {
+    writeArrayLength(out, memberBytes_.size());
+    out += memberBytes_;
+  }
+  writeInt16(out, static_cast<int16_t>(text.size()));
+  out += text;
+  if (!subscription) {
+    writeByte(out, 0);  // delta propagation disabled
+  } else if (code == SUCCESSFUL_SERVER_TO_CLIENT) {
+    // empty instantiator and data serializer registrations
+    writeArrayLength(out, 0);
+    writeArrayLength(out, 0);
+    writeArrayLength(out, 0);
+  }
+  return out;
+}
+
+void MockCacheServer::serveClient(Socket &socket,
+                                  const std::string &memberId) {
+  Message request;
+  while (true) {
+    readMessage(socket, request);
+    if (request.type >= 0 &&
+        static_cast<size_t>(request.type) < requestCounts_.size()) {
+      ++requestCounts_[static_cast<size_t>(request.type)];
+    }
+    if (request.type == CLOSE_CONNECTION) {
+      return;
+    }
+
+    std::string response;
+    try {
+      response = handle(request, memberId);
+    } catch (const std::invalid_argument &e) {
+      response = exceptionReply(request.type, request.transactionId, e.what());
+    }
+
+    auto latency = std::chrono::microseconds(latency_.load());
+    if (latency > std::chrono::microseconds::zero()) {
+      std::this_thread::sleep_for(latency);
+    }
+    reply(socket, response);
+  }
+}
+
+void MockCacheServer::serveSubscriber(std::shared_ptr<Socket> socket,
+                                      const std::string &memberId) {
+  auto entry = subscriber(memberId);
+  {
+    std::lock_guard<std::mutex> guard(entry->mutex);
+    entry->socket = socket;
+  }
+
+  // The client never writes on this channel; wait for it to go away.
+  boost::system::error_code error;
+  char discard[64];
+  while (!error) {
+    socket->read_some(boost::asio::buffer(discard), error);
+  }
+
+  std::lock_guard<std::mutex> guard(entry->mutex);
+  if (entry->socket == socket) {
+    entry->socket = nullptr;
+  }
+}
+
+void MockCacheServer::readMessage(Socket &socket, Message &message) {
+  std::string header(17, '\0');
+  boost::asio::read(socket, boost::asio::buffer(&header[0], header.size()));
+  Reader headerReader(header);
+  message.type = headerReader.readInt32();
+  auto length = headerReader.readInt32();
+  auto numberOfParts = headerReader.readInt32();
+  message.transactionId = headerReader.readInt32();
+
+  std::string body(static_cast<size_t>(std::max(length, 0)), '\0');
+  if (!body.empty()) {
+    boost::asio::read(socket, boost::asio::buffer(&body[0], body.size()));
+  }
+
+  message.parts.clear();
+  Reader reader(body);
+  for (int32_t i = 0; i < numberOfParts; ++i) {
+    auto partLength = reader.readInt32();
+    auto isObject = static_cast<int8_t>(reader.readByte());
+    message.parts.push_back(
+        {isObject,
+         reader.readBytes(static_cast<size_t>(std::max(partLength, 0)))});
+  }
+}
+
+void MockCacheServer::reply(Socket &socket, const std::string &bytes) {
+  boost::asio::write(socket, boost::asio::buffer(bytes));
+}
+
+std::string MockCacheServer::handle(const Message &request,
+                                    const std::string &memberId) {
+  switch (request.type) {
+    case PING:
+    case MAKE_PRIMARY:
+    case PERIODIC_ACK:
+    case CLIENT_READY:
+      return message(REPLY, request.transactionId, {metadataPart()});
+    case PUT:
+      return put(request, memberId);
+    case REQUEST:
+      return get(request);
+    case DESTROY:
+      return destroy(request, memberId);
+    case CONTAINS_KEY:
+      return containsKey(request);
+    case PUTALL:
+    case PUT_ALL_WITH_CALLBACK:
+      return putAll(request, memberId);
+    case GET_ALL_70:
+    case GET_ALL_WITH_CALLBACK:
+      return getAll(request);
+    case QUERY:
+    case QUERY_WITH_PARAMETERS:
+      return query(request);
+    case REGISTER_INTEREST:
+    case REGISTER_INTEREST_LIST:
+    case UNREGISTER_INTEREST:
+    case UNREGISTER_INTEREST_LIST:
+      return registerInterest(request, memberId);
+    default:
+      throw std::invalid_argument("unsupported message type " +
+                                  std::to_string(request.type));
+  }
+}
+
+std::string MockCacheServer::put(const Message &request,
+                                 const std::string &memberId) {
+  if (request.parts.size() < 6) {
+    throw std::invalid_argument("malformed put");
+  }
+  const auto &region = request.parts[0].bytes;
+  auto key = serialized(request.parts[3].isObject, request.parts[3].bytes);
+  if (request.parts[4].bytes == std::string("\x35\x01", 2)) {
+    throw std::invalid_argument("deltas are not supported");
+  }
+  Value value{request.parts[5].isObject, request.parts[5].bytes};
+
+  bool created;
+  {
+    std::lock_guard<std::mutex> guard(regionsMutex_);
+    auto &entries = regions_[region];
+    created = entries.find(key) == entries.end();
+    entries[key] = value;
+  }
+  publish(created ? LOCAL_CREATE : LOCAL_UPDATE, region, key, &value,
+          memberId);
+
+  return message(REPLY, request.transactionId, {metadataPart(), intPart(0)});
+}
+
+std::string MockCacheServer::get(const Message &request) {
+  if (request.parts.size() < 2) {
+    throw std::invalid_argument("malformed get");
+  }
+  auto key = serialized(request.parts[1].isObject, request.parts[1].bytes);
+
+  std::string value = part(0, "");
+  {
+    std::lock_guard<std::mutex> guard(regionsMutex_);
+    auto entries = regions_.find(request.parts[0].bytes);
+    if (entries != regions_.end()) {
+      auto entry = entries->second.find(key);
+      if (entry != entries->second.end()) {
+        value = part(entry->second.isObject, entry->second.bytes);
+      }
+    }
+  }
+
+  return message(RESPONSE, request.transactionId, {value, intPart(0)});
+}
+
+std::string MockCacheServer::destroy(const Message &request,
+                                     const std::string &memberId) {
+  if (request.parts.size() < 3) {
+    throw std::invalid_argument("malformed destroy");
+  }
+  const auto &region = request.parts[0].bytes;
+  auto key = serialized(request.parts[1].isObject, request.parts[1].bytes);
+  const auto &expected = request.parts[2];
+  auto conditional =
+      !(expected.isObject == 1 &&
+        expected.bytes ==
+            std::string(1, static_cast<char>(DSCode::NullObj)));
+
+  bool removed = false;
+  {
+    std::lock_guard<std::mutex> guard(regionsMutex_);
+    auto entries = regions_.find(region);
+    if (entries != regions_.end()) {
+      auto entry = entries->second.find(key);
+      if (entry != entries->second.end() &&
+          (!conditional || (entry->second.isObject == expected.isObject &&
+                            entry->second.bytes == expected.bytes))) {
+        entries->second.erase(entry);
+        removed = true;
+      }
+    }
+  }
+  if (removed) {
+    publish(LOCAL_DESTROY, region, key, nullptr, memberId);
+  }
+
+  return message(REPLY, request.transactionId,
+                 {intPart(0), metadataPart(), intPart(removed ? 0 : 1)});
+}
+
+std::string MockCacheServer::containsKey(const Message &request) {
+  if (request.parts.size() < 3) {
+    throw std::invalid_argument("malformed containsKey");
+  }
+  auto key = serialized(request.parts[1].isObject, request.parts[1].bytes);
+  auto forValue = intValue(request.parts[2].bytes) != 0;
+
+  bool found = false;
+  {
+    std::lock_guard<std::mutex> guard(regionsMutex_);
+    auto entries = regions_.find(request.parts[0].bytes);
+    if (entries != regions_.end()) {
+      auto entry = entries->second.find(key);
+      found = entry != entries->second.end() &&
+              (!forValue ||
+               entry->second.bytes !=
+                   std::string(1, static_cast<char>(DSCode::NullObj)));
+    }
+  }
+
+  return message(RESPONSE, request.transactionId, {booleanPart(found)});
+}
+
+std::string MockCacheServer::putAll(const Message &request,
+                                    const std::string &memberId) {
+  if (request.parts.size() < 5) {
+    throw std::invalid_argument("malformed putAll");
+  }
+  const auto &region = request.parts[0].bytes;
+  auto count = static_cast<size_t>(
+      std::max(intValue(request.parts[4].bytes), 0));
+  size_t first = request.type == PUT_ALL_WITH_CALLBACK ? 6 : 5;
+  if (request.parts.size() < first + 2 * count) {
+    throw std::invalid_argument("malformed putAll");
+  }
+
+  std::vector<std::pair<std::string, bool>> keys;
+  keys.reserve(count);
+  {
+    std::lock_guard<std::mutex> guard(regionsMutex_);
+    auto &entries = regions_[region];
+    for (size_t i = 0; i < count; ++i) {
+      const auto &keyPart = request.parts[first + 2 * i];
+      const auto &valuePart = request.parts[first + 2 * i + 1];
+      auto key = serialized(keyPart.isObject, keyPart.bytes);
+      auto created = entries.find(key) == entries.end();
+      entries[key] = Value{valuePart.isObject, valuePart.bytes};
+      keys.emplace_back(std::move(key), created);
+    }
+  }
+  for (size_t i = 0; i < count; ++i) {
+    const auto &valuePart = request.parts[first + 2 * i + 1];
+    Value value{valuePart.isObject, valuePart.bytes};
+    publish(keys[i].second ? LOCAL_CREATE : LOCAL_UPDATE, region,
+            keys[i].first, &value, memberId);
+  }
+
+  return chunk(RESPONSE, request.transactionId, 1, LAST_CHUNK, part(0, ""));
+}
+
+std::string MockCacheServer::getAll(const Message &request) {
+  if (request.parts.size() < 2 || request.parts[1].isObject != 1) {
+    throw std::invalid_argument("malformed getAll");
+  }
+
+  // Object[] of keys: type, length, element class, elements
+  const auto &array = request.parts[1].bytes;
+  Reader reader(array);
+  if (reader.readByte() !=
+      static_cast<uint8_t>(DSCode::CacheableObjectArray)) {
+    throw std::invalid_argument("malformed getAll");
+  }
+  auto count = static_cast<size_t>(std::max(reader.readArrayLength(), 0));
+  reader.skip(1);
+  reader.skipObject();
+  std::vector<std::string> keys;
+  keys.reserve(count);
+  for (size_t i = 0; i < count; ++i) {
+    auto begin = reader.getPosition();
+    reader.skipObject();
+    keys.push_back(array.substr(begin, reader.getPosition() - begin));
+  }
+
+  // VersionedObjectPartList with keys, values and (null) version tags
+  std::string list;
+  writeByte(list, DSCode::FixedIDByte);
+  writeByte(list, static_cast<uint8_t>(DSFid::VersionedObjectPartList));
+  writeByte(list, 0x07);
+  writeUnsignedVL(list, count);
+  for (const auto &key : keys) {
+    list += key;
+  }
+  writeUnsignedVL(list, count);
+  {
+    std::lock_guard<std::mutex> guard(regionsMutex_);
+    auto entries = regions_.find(request.parts[0].bytes);
+    for (const auto &key : keys) {
+      const Value *value = nullptr;
+      if (entries != regions_.end()) {
+        auto entry = entries->second.find(key);
+        if (entry != entries->second.end()) {
+          value = &entry->second;
+        }
+      }
+      if (value) {
+        writeByte(list, 0);
+        list += serialized(value->isObject, value->bytes);
+      } else {
+        writeByte(list, KEY_NOT_AT_SERVER);
+        writeByte(list, DSCode::NullObj);
+      }
+    }
+  }
+  writeUnsignedVL(list, count);
+  list.append(count, '\0');
+
+  return chunk(RESPONSE, request.transactionId, 1, LAST_CHUNK,
+               part(1, list));
+}
+
+std::string MockCacheServer::query(const Message &request) {
+  if (request.parts.empty()) {
+    throw std::invalid_argument("malformed query");
+  }
+  auto region = regionFromQuery(request.parts[0].bytes);
+
+  // CollectionTypeImpl describing a result set of objects
+  std::string type;
+  writeByte(type, DSCode::FixedIDByte);
+  writeByte(type, static_cast<uint8_t>(DSFid::CollectionTypeImpl));
+  writeByte(type, DSCode::Class);
+  writeString(type, "org.apache.geode.cache.query.internal.ResultsBag");
+  writeByte(type, DSCode::FixedIDByte);
+  writeByte(type, DSCode::DataSerializable);
+  writeByte(type, DSCode::Class);
+  writeString(type, "java.lang.Object");
+
+  std::string results;
+  {
+    std::lock_guard<std::mutex> guard(regionsMutex_);
+    auto entries = regions_.find(region);
+    auto size = entries == regions_.end() ? 0 : entries->second.size();
+    writeByte(results, DSCode::CacheableObjectArray);
+    writeArrayLength(results, size);
+    writeByte(results, DSCode::Class);
+    writeString(results, "java.lang.Object");
+    if (entries != regions_.end()) {
+      for (const auto &entry : entries->second) {
+        results += serialized(entry.second.isObject, entry.second.bytes);
+      }
+    }
+  }
+
+  return chunk(RESPONSE, request.transactionId, 2, LAST_CHUNK,
+               part(1, type) + part(1, results));
+}
+
+std::string MockCacheServer::registerInterest(const Message &request,
+                                              const std::string &memberId) {
+  if (request.parts.size() < 4) {
+    throw std::invalid_argument("malformed interest request");
+  }
+  const auto &region = request.parts[0].bytes;
+  auto entry = subscriber(memberId);
+
+  std::vector<std::string> keys;
+  if (request.type == REGISTER_INTEREST_LIST) {
+    // ArrayList of keys: type, length, elements
+    const auto &list = request.parts[3].bytes;
+    Reader reader(list);
+    reader.skip(1);
+    auto count = std::max(reader.readArrayLength(), 0);
+    for (int32_t i = 0; i < count; ++i) {
+      auto begin = reader.getPosition();
+      reader.skipObject();
+      keys.push_back(list.substr(begin, reader.getPosition() - begin));
+    }
+  } else if (request.type == UNREGISTER_INTEREST_LIST) {
+    auto count = static_cast<size_t>(
+        std::max(intValue(request.parts[3].bytes), 0));
+    for (size_t i = 0; i < count && 4 + i < request.parts.size(); ++i) {
+      const auto &keyPart = request.parts[4 + i];
+      keys.push_back(serialized(keyPart.isObject, keyPart.bytes));
+    }
+  }
+
+  {
+    std::lock_guard<std::mutex> guard(entry->mutex);
+    switch (request.type) {
+      case REGISTER_INTEREST:
+        // every regular expression is treated as "all keys"
+        entry->allKeys.insert(region);
+        break;
+      case UNREGISTER_INTEREST:
+        entry->allKeys.erase(region);
+        break;
+      case REGISTER_INTEREST_LIST:
+        entry->keys[region].insert(keys.begin(), keys.end());
+        break;
+      default:
+        for (const auto &key : keys) {
+          entry->keys[region].erase(key);
+        }
+        break;
+    }
+  }
+
+  if (request.type == REGISTER_INTEREST ||
+      request.type == REGISTER_INTEREST_LIST) {
+    // no initial keys are returned
+    std::string list;
+    writeByte(list, DSCode::CacheableArrayList);
+    writeArrayLength(list, 0);
+    return chunk(RESPONSE_FROM_PRIMARY, request.transactionId, 1, LAST_CHUNK,
+                 part(1, list));
+  }
+  return message(REPLY, request.transactionId, {metadataPart()});
+}
+
+void MockCacheServer::publish(int32_t eventType, const std::string &region,
+                              const std::string &key, const Value *value,
+                              const std::string &memberId) {
+  std::vector<std::shared_ptr<Subscriber>> targets;
+  {
+    std::lock_guard<std::mutex> guard(subscribersMutex_);
+    for (const auto &subscriber : subscribers_) {
+      if (subscriber.first != memberId) {
+        targets.push_back(subscriber.second);
+      }
+    }
+  }
+  if (targets.empty()) {
+    return;
+  }
+
+  // EventId: originating member, thread id and sequence number
+  std::string eventId;
+  writeByte(eventId, DSCode::FixedIDByte);
+  writeByte(eventId, static_cast<uint8_t>(DSFid::EventId));
+  writeArrayLength(eventId, memberId.size());
+  eventId += memberId;
+  writeArrayLength(eventId, 18);
+  writeByte(eventId, 3);
+  writeInt64(eventId, 1);
+  writeByte(eventId, 3);
+  writeInt64(eventId, ++sequence_);
+  writeInt32(eventId, -1);  // bucket id
+  writeByte(eventId, 0);    // breadcrumb counter
+
+  std::vector<std::string> parts;
+  parts.push_back(part(0, region));
+  parts.push_back(part(1, key));
+  if (value) {
+    parts.push_back(booleanPart(false));  // not a delta
+    parts.push_back(part(value->isObject, value->bytes));
+  }
+  parts.push_back(part(0, ""));         // callback argument
+  parts.push_back(part(0, ""));         // version tag
+  parts.push_back(booleanPart(true));   // interest list passed
+  parts.push_back(booleanPart(false));  // no CQs
+  parts.push_back(part(1, eventId));
+  auto event = message(eventType, -1, parts);
+
+  for (const auto &target : targets) {
+    std::lock_guard<std::mutex> guard(target->mutex);
+    if (!target->socket) {
+      continue;
+    }
+    auto keys = target->keys.find(region);
+    if (target->allKeys.count(region) == 0 &&
+        (keys == target->keys.end() || keys->second.count(key) == 0)) {
+      continue;
+    }
+    boost::system::error_code error;
+    boost::asio::write(*target->socket, boost::asio::buffer(event), error);
+    if (error) {
+      target->socket = nullptr;
+    }
+  }
+}
+
+std::shared_ptr<MockCacheServer::Subscriber> MockCacheServer::subscriber(
+    const std::string &memberId) {
+  std::lock_guard<std::mutex> guard(subscribersMutex_);
+  auto &entry = subscribers_[memberId];
+  if (!entry) {
+    entry = std::make_shared<Subscriber>();
+  }
+  return entry;
+}
@@ -0,0 +1,212 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef INTEGRATION_TEST_FRAMEWORK_MOCKCACHESERVER_H
+#define INTEGRATION_TEST_FRAMEWORK_MOCKCACHESERVER_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/asio.hpp>
+
+#include <geode/Cache.hpp>
+
+/**
+ * An in-process stand-in for a cache server that speaks enough of the client
+ * protocol to drive region operations over loopback without a JVM.
+ *
+ * Supported: the client and subscription handshakes, PING, PUT, GET, DESTROY,
+ * CONTAINS_KEY, PUTALL, GET_ALL, QUERY (every value of the region named in the
+ * FROM clause; predicates are ignored), register/unregister interest and
+ * create/update/destroy events pushed to other subscribed clients.
+ * Not supported: security, deltas, CQs, functions, transactions and
+ * partitioned region metadata. Unsupported requests get an exception reply.
+ *
+ * Each connection is served by its own thread. An optional latency is slept
+ * before every reply so that client behaviour under a slow server can be
+ * measured deterministically.
+ */
+class MockCacheServer {
+ public:
+  enum MessageType : int32_t {
+    REQUEST = 0,
+    RESPONSE = 1,
+    EXCEPTION = 2,
+    PING = 5,
+    REPLY = 6,
+    PUT = 7,
+    DESTROY = 9,
+    LOCAL_DESTROY = 16,
+    CLOSE_CONNECTION = 18,
+    REGISTER_INTEREST = 20,
+    UNREGISTER_INTEREST = 22,
+    REGISTER_INTEREST_LIST = 24,
+    UNREGISTER_INTEREST_LIST = 25,
+    LOCAL_CREATE = 27,
+    LOCAL_UPDATE = 28,
+    MAKE_PRIMARY = 31,
+    RESPONSE_FROM_PRIMARY = 32,
+    QUERY = 34,
+    CONTAINS_KEY = 38,
+    KEY_SET = 40,
+    EXECUTECQ_MSG_TYPE = 42,
+    EXECUTECQ_WITH_IR_MSG_TYPE = 43,
+    PERIODIC_ACK = 52,
+    CLIENT_READY = 53,
+    PUTALL = 56,
+    EXECUTE_REGION_FUNCTION = 59,
+    EXECUTE_FUNCTION = 62,
+    EXECUTE_REGION_FUNCTION_SINGLE_HOP = 79,
+    QUERY_WITH_PARAMETERS = 80,
+    GET_ALL_70 = 100,
+    GETDURABLECQS_MSG_TYPE = 105,
+    GET_ALL_WITH_CALLBACK = 107,
+    PUT_ALL_WITH_CALLBACK = 108,
+    REMOVE_ALL = 109
+  };
+
+  MockCacheServer();
+  ~MockCacheServer();
+
+  MockCacheServer(const MockCacheServer &copy) = delete;
+  MockCacheServer &operator=(const MockCacheServer &other) = delete;
+
+  uint16_t getPort() const;
+
+  /**
+   * Creates a cache with a pool named "default" pointing at this server.
+   */
+  apache::geode::client::Cache createCache();
+
+  apache::geode::client::Cache createCache(
+      const std::unordered_map<std::string, std::string> &properties);
+
+  apache::geode::client::Cache createCache(
+      const std::unordered_map<std::string, std::string> &properties,
+      bool subscriptionEnabled);
+
+  void setLatency(std::chrono::microseconds latency);
+
+  /**
+   * Number of requests of the given type received since the server started.
+   */
+  uint64_t getRequestCount(int32_t messageType) const;
+
+  /**
+   * Number of entries the server holds for the region, "/" prefix optional.
+   */
+  size_t getRegionSize(const std::string &region) const;
+
+  /**
+   * Number of client connections, subscription channels included, that are
+   * still open.
+   */
+  size_t getConnectionCount() const;
+
+  void stop();
+
+ private:
+  struct Value {
+    int8_t isObject;
+    std::string bytes;
+  };
+
+  struct Part {
+    int8_t isObject;
+    std::string bytes;
+  };
+
+  struct Message {
+    int32_t type;
+    int32_t transactionId;
+    std::vector<Part> parts;
+  };
+
+  struct Subscriber {
+    std::shared_ptr<boost::asio::ip::tcp::socket> socket;
+    std::mutex mutex;
+    std::set<std::string> allKeys;
+    std::map<std::string, std::set<std::string>> keys;
+  };
+
+  using Socket = boost::asio::ip::tcp::socket;
+  using Region = std::unordered_map<std::string, Value>;
+
+  void accept();
+  void serve(std::shared_ptr<Socket> socket);
+  void serveClient(Socket &socket, const std::string &memberId);
+  void serveSubscriber(std::shared_ptr<Socket> socket,
+                       const std::string &memberId);
+
+  std::string handshakeReply(bool subscription, uint8_t code,
+                             const std::string &text, uint8_t queueStatus);
+  void readMessage(Socket &socket, Message &message);
+  void reply(Socket &socket, const std::string &bytes);
+  std::string handle(const Message &request, const std::string &memberId);
+
+  std::string put(const Message &request, const std::string &memberId);
+  std::string get(const Message &request);
+  std::string destroy(const Message &request, const std::string &memberId);
+  std::string containsKey(const Message &request);
+  std::string putAll(const Message &request, const std::string &memberId);
+  std::string getAll(const Message &request);
+  std::string query(const Message &request);
+  std::string registerInterest(const Message &request,
+                               const std::string &memberId);
+
+  void publish(int32_t eventType, const std::string &region,
+               const std::string &key, const Value *value,
+               const std::string &memberId);
+  std::shared_ptr<Subscriber> subscriber(const std::string &memberId);
+
+  boost::asio::io_context context_;
+  boost::asio::ip::tcp::acceptor acceptor_;
+  std::string memberBytes_;
+  std::atomic<int64_t> latency_;
+  std::atomic<int64_t> sequence_;
+  std::array<std::atomic<uint64_t>, 128> requestCounts_;
+
+  mutable std::mutex regionsMutex_;
+  std::unordered_map<std::string, Region> regions_;
+
+  std::mutex subscribersMutex_;
+  std::map<std::string, std::shared_ptr<Subscriber>> subscribers_;
+
+  mutable std::mutex connectionsMutex_;
+  std::list<std::weak_ptr<Socket>> sockets_;
+  std::list<std::thread> threads_;
+  // threads whose connection has closed, joined by the next accept
+  std::vector<std::thread::id> finished_;
+  bool stopped_;
+
+  std::thread acceptThread_;
+};
+
+#endif  // INTEGRATION_TEST_FRAMEWORK_MOCKCACHESERVER_H
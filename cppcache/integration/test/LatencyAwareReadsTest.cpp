@@ -0,0 +1,190 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <geode/Cache.hpp>
+#include <geode/CacheFactory.hpp>
+#include <geode/PoolManager.hpp>
+#include <geode/RegionFactory.hpp>
+#include <geode/RegionShortcut.hpp>
+
+#include "framework/Framework.h"
+#include "framework/MockCacheServer.h"
+
+namespace {
+
+using apache::geode::client::Cache;
+using apache::geode::client::CacheableString;
+using apache::geode::client::CacheFactory;
+using apache::geode::client::Region;
+using apache::geode::client::RegionShortcut;
+
+std::shared_ptr<Region> setupRegion(Cache& cache) {
+  return cache.createRegionFactory(RegionShortcut::PROXY)
+      .setPoolName("default")
+      .create("region");
+}
+
+void seed(MockCacheServer& server, const std::string& value) {
+  auto cache = server.createCache();
+  setupRegion(cache)->put("key", value);
+  cache.close();
+}
+
+Cache createCache(MockCacheServer& first, MockCacheServer& second) {
+  auto cache = CacheFactory()
+                   .set("log-level", "none")
+                   .set("statistic-sampling-enabled", "false")
+                   .create();
+  // connections alternate between the servers and are used in turn
+  cache.getPoolManager()
+      .createFactory()
+      .setLatencyAwareReads(true)
+      .setPRSingleHopEnabled(false)
+      .setMinConnections(4)
+      .addServer("127.0.0.1", first.getPort())
+      .addServer("127.0.0.1", second.getPort())
+      .create("default");
+  return cache;
+}
+
+std::string get(Region& region) {
+  return std::dynamic_pointer_cast<CacheableString>(region.get("key"))
+      ->value();
+}
+
+// Fills the latency window of both servers with reads of about 5ms, so a
+// few slow replies later on do not move their percentiles.
+void warmUp(Cache& cache, Region& region, MockCacheServer& first,
+            MockCacheServer& second) {
+  ASSERT_TRUE(cache.getPoolManager().find("default")->warmUp(
+      debug_safe(std::chrono::seconds(10))));
+  first.setLatency(std::chrono::milliseconds(5));
+  second.setLatency(std::chrono::milliseconds(5));
+  for (int i = 0; i < 600; ++i) {
+    get(region);
+  }
+}
+
+template <typename Predicate>
+bool waitFor(Predicate predicate) {
+  const auto deadline =
+      std::chrono::steady_clock::now() + debug_safe(std::chrono::seconds(10));
+  while (!predicate()) {
+    if (std::chrono::steady_clock::now() > deadline) {
+      return false;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  return true;
+}
+
+TEST(LatencyAwareReadsTest, hedgeAnswersReadStuckOnSlowServer) {
+  MockCacheServer slow;
+  MockCacheServer fast;
+  seed(slow, "slow");
+  seed(fast, "fast");
+
+  auto cache = createCache(slow, fast);
+  auto region = setupRegion(cache);
+  warmUp(cache, *region, slow, fast);
+
+  // Reads on the fast server now answer well within its p95, so only reads
+  // sent to the slow server are hedged.
+  slow.setLatency(std::chrono::milliseconds(200));
+  fast.setLatency(std::chrono::microseconds::zero());
+  const auto slowConnections = slow.getConnectionCount();
+
+  // Every tenth read is hedged and connections to the two servers are used
+  // in turn, so the hedged reads all go to one server. A put takes the next
+  // connection without earning credit, which moves them to the other one.
+  auto hedged = false;
+  for (int i = 0; i < 30 && !hedged; ++i) {
+    if (i == 10) {
+      region->put("other", "value");
+    }
+    const auto slowRequests = slow.getRequestCount(MockCacheServer::REQUEST);
+    const auto fastRequests = fast.getRequestCount(MockCacheServer::REQUEST);
+    const auto start = std::chrono::steady_clock::now();
+    const auto value = get(*region);
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    if (slow.getRequestCount(MockCacheServer::REQUEST) > slowRequests &&
+        fast.getRequestCount(MockCacheServer::REQUEST) > fastRequests) {
+      // the reply came over the hedge's connection to the fast server
+      EXPECT_EQ("fast", value);
+      EXPECT_LT(elapsed, std::chrono::milliseconds(200));
+      hedged = true;
+    }
+  }
+  ASSERT_TRUE(hedged);
+
+  // the primary's connection, cancelled while its reply was pending, is
+  // closed rather than reused
+  EXPECT_TRUE(waitFor(
+      [&] { return slow.getConnectionCount() == slowConnections - 1; }));
+  // and the pool goes on reading from both servers
+  const auto value = get(*region);
+  EXPECT_TRUE(value == "slow" || value == "fast");
+}
+
+TEST(LatencyAwareReadsTest, hedgeThatLosesReturnsItsConnection) {
+  MockCacheServer first;
+  MockCacheServer second;
+  seed(first, "value");
+  seed(second, "value");
+
+  auto cache = createCache(first, second);
+  auto region = setupRegion(cache);
+  warmUp(cache, *region, first, second);
+
+  // Both copies take as long, so the primary, sent one p95 earlier, wins.
+  first.setLatency(std::chrono::milliseconds(100));
+  second.setLatency(std::chrono::milliseconds(100));
+  const auto connections =
+      first.getConnectionCount() + second.getConnectionCount();
+  auto requests = [&] {
+    return first.getRequestCount(MockCacheServer::REQUEST) +
+           second.getRequestCount(MockCacheServer::REQUEST);
+  };
+
+  // the hedge is sent long before the primary's reply, so a hedged read
+  // has reached both servers by the time it returns
+  auto hedged = false;
+  for (int i = 0; i < 30 && !hedged; ++i) {
+    const auto before = requests();
+    EXPECT_EQ("value", get(*region));
+    hedged = requests() == before + 2;
+  }
+  ASSERT_TRUE(hedged);
+
+  // the hedge's connection went back to the pool once its reply arrived
+  std::this_thread::sleep_for(std::chrono::milliseconds(300));
+  EXPECT_EQ(connections,
+            first.getConnectionCount() + second.getConnectionCount());
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_EQ("value", get(*region));
+  }
+  EXPECT_EQ(connections,
+            first.getConnectionCount() + second.getConnectionCount());
+}
+
+}  // namespace
@@ -0,0 +1,121 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <geode/Cache.hpp>
+#include <geode/CacheFactory.hpp>
+#include <geode/QueryService.hpp>
+#include <geode/Region.hpp>
+#include <geode/RegionFactory.hpp>
+#include <geode/RegionShortcut.hpp>
+#include <geode/ResultSet.hpp>
+
+#include "framework/MockCacheServer.h"
+
+namespace {
+
+using apache::geode::client::Cache;
+using apache::geode::client::CacheableInt16;
+using apache::geode::client::CacheableInt32;
+using apache::geode::client::CacheableString;
+using apache::geode::client::CacheFactory;
+using apache::geode::client::Region;
+using apache::geode::client::RegionShortcut;
+using apache::geode::client::SelectResults;
+using apache::geode::client::TimeoutException;
+
+std::shared_ptr<SelectResults> query(Cache& cache, const std::string& text,
+                                     std::chrono::milliseconds timeout =
+                                         std::chrono::seconds(10)) {
+  return cache.getLocalQueryService()->newQuery(text)->execute(timeout);
+}
+
+TEST(LocalQueryTest, scansAndLooksUpLocalRegion) {
+  auto cache = CacheFactory()
+                   .set("log-level", "none")
+                   .set("statistic-sampling-enabled", "false")
+                   .create();
+  auto region = cache.createRegionFactory(RegionShortcut::LOCAL)
+                    .create("region");
+  for (int16_t i = 0; i < 100; ++i) {
+    region->put(CacheableInt16::create(i), CacheableInt32::create(i * 10));
+  }
+  region->invalidate(CacheableInt16::create(99));
+
+  auto results = query(cache, "SELECT * FROM /region r WHERE r >= 900");
+  EXPECT_EQ(9u, results->size());
+
+  results = query(cache,
+                  "SELECT e.value FROM /region.entrySet e WHERE e.key = 42");
+  ASSERT_EQ(1u, results->size());
+  EXPECT_EQ(420,
+            std::dynamic_pointer_cast<CacheableInt32>((*results)[0])->value());
+
+  results = query(cache, "SELECT COUNT(*) FROM /region.keySet");
+  EXPECT_EQ(100, std::dynamic_pointer_cast<CacheableInt32>((*results)[0])
+                     ->value());
+  cache.close();
+}
+
+TEST(LocalQueryTest, scanFailsOnceTimeoutExpires) {
+  auto cache = CacheFactory()
+                   .set("log-level", "none")
+                   .set("statistic-sampling-enabled", "false")
+                   .create();
+  auto region = cache.createRegionFactory(RegionShortcut::LOCAL)
+                    .create("region");
+  for (int32_t i = 0; i < 5000; ++i) {
+    region->put(CacheableInt32::create(i), CacheableInt32::create(i));
+  }
+
+  EXPECT_THROW(query(cache, "SELECT * FROM /region r WHERE r < 0",
+                     std::chrono::milliseconds::zero()),
+               TimeoutException);
+  EXPECT_EQ(0u, query(cache, "SELECT * FROM /region r WHERE r < 0")->size());
+  cache.close();
+}
+
+TEST(LocalQueryTest, queriesValuesCachedByCachingProxy) {
+  MockCacheServer server;
+  auto cache = server.createCache();
+  auto region = cache.createRegionFactory(RegionShortcut::CACHING_PROXY)
+                    .setPoolName("default")
+                    .create("region");
+  for (int i = 0; i < 10; ++i) {
+    region->put("key" + std::to_string(i), "value" + std::to_string(i));
+  }
+
+  auto results =
+      query(cache, "SELECT * FROM /region r WHERE r LIKE 'value%'");
+  EXPECT_EQ(10u, results->size());
+  results =
+      query(cache, "SELECT k FROM /region.keySet k WHERE k IN SET('key3')");
+  ASSERT_EQ(1u, results->size());
+  EXPECT_EQ("key3",
+            std::dynamic_pointer_cast<CacheableString>((*results)[0])->value());
+
+  // served from the local entries only
+  EXPECT_EQ(0u, server.getRequestCount(MockCacheServer::QUERY));
+  cache.close();
+}
+
+}  // namespace
@@ -0,0 +1,155 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <future>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <geode/Cache.hpp>
+#include <geode/CacheListener.hpp>
+#include <geode/EntryEvent.hpp>
+#include <geode/QueryService.hpp>
+#include <geode/RegionFactory.hpp>
+#include <geode/RegionShortcut.hpp>
+
+#include "framework/Framework.h"
+#include "framework/MockCacheServer.h"
+
+namespace {
+
+using apache::geode::client::Cache;
+using apache::geode::client::CacheableKey;
+using apache::geode::client::CacheableString;
+using apache::geode::client::CacheListener;
+using apache::geode::client::EntryEvent;
+using apache::geode::client::HashMapOfCacheable;
+using apache::geode::client::Region;
+using apache::geode::client::RegionShortcut;
+
+class CreateListener : public CacheListener {
+ public:
+  void afterCreate(const EntryEvent& event) override {
+    created.set_value(
+        std::dynamic_pointer_cast<CacheableString>(event.getNewValue())
+            ->value());
+  }
+
+  std::promise<std::string> created;
+};
+
+std::shared_ptr<Region> setupRegion(Cache& cache) {
+  return cache.createRegionFactory(RegionShortcut::PROXY)
+      .setPoolName("default")
+      .create("region");
+}
+
+TEST(MockCacheServerTest, putGetAndDestroy) {
+  MockCacheServer server;
+  auto cache = server.createCache();
+  auto region = setupRegion(cache);
+
+  region->put("one", "1");
+  auto value = std::dynamic_pointer_cast<CacheableString>(region->get("one"));
+  ASSERT_NE(nullptr, value);
+  EXPECT_EQ("1", value->value());
+  EXPECT_EQ(nullptr, region->get("two"));
+  EXPECT_TRUE(region->containsKeyOnServer(CacheableKey::create("one")));
+
+  region->destroy("one");
+  EXPECT_EQ(0u, server.getRegionSize("region"));
+  EXPECT_EQ(1u, server.getRequestCount(MockCacheServer::PUT));
+  EXPECT_EQ(2u, server.getRequestCount(MockCacheServer::REQUEST));
+}
+
+TEST(MockCacheServerTest, putAllAndGetAll) {
+  MockCacheServer server;
+  auto cache = server.createCache();
+  auto region = setupRegion(cache);
+
+  HashMapOfCacheable entries;
+  std::vector<std::shared_ptr<CacheableKey>> keys;
+  for (int i = 0; i < 10; ++i) {
+    auto key = CacheableKey::create("key" + std::to_string(i));
+    entries.emplace(key, CacheableString::create("value" + std::to_string(i)));
+    keys.push_back(key);
+  }
+  region->putAll(entries);
+  EXPECT_EQ(10u, server.getRegionSize("region"));
+
+  auto values = region->getAll(keys);
+  ASSERT_EQ(10u, values.size());
+  auto value =
+      std::dynamic_pointer_cast<CacheableString>(values[keys.front()]);
+  ASSERT_NE(nullptr, value);
+  EXPECT_EQ("value0", value->value());
+}
+
+TEST(MockCacheServerTest, queryReturnsEveryValueOfTheRegion) {
+  MockCacheServer server;
+  auto cache = server.createCache();
+  auto region = setupRegion(cache);
+
+  region->put("one", "1");
+  region->put("two", "2");
+  region->put("three", "3");
+
+  auto results = cache.getQueryService()
+                     ->newQuery("SELECT * FROM /region")
+                     ->execute();
+  EXPECT_EQ(3u, results->size());
+}
+
+TEST(MockCacheServerTest, latencyDelaysEveryReply) {
+  MockCacheServer server;
+  auto cache = server.createCache();
+  auto region = setupRegion(cache);
+  region->put("warm", "up");
+
+  server.setLatency(std::chrono::milliseconds(50));
+  auto start = std::chrono::steady_clock::now();
+  region->put("one", "1");
+  region->get("one");
+  EXPECT_GE(std::chrono::steady_clock::now() - start,
+            std::chrono::milliseconds(100));
+}
+
+TEST(MockCacheServerTest, eventsReachOtherSubscribers) {
+  MockCacheServer server;
+  auto producerCache = server.createCache();
+  auto producer = setupRegion(producerCache);
+
+  auto consumerCache = server.createCache({}, true);
+  auto listener = std::make_shared<CreateListener>();
+  auto consumer =
+      consumerCache.createRegionFactory(RegionShortcut::CACHING_PROXY)
+          .setPoolName("default")
+          .setCacheListener(listener)
+          .create("region");
+  consumer->registerAllKeys();
+
+  producer->put("one", "1");
+
+  auto created = listener->created.get_future();
+  ASSERT_EQ(std::future_status::ready,
+            created.wait_for(debug_safe(std::chrono::seconds(10))));
+  EXPECT_EQ("1", created.get());
+}
+
+}  // namespace
@@ -17,6 +17,7 @@
 
 #include <future>
 #include <iostream>
+#include <map>
 #include <random>
 #include <thread>
 
@@ -34,6 +35,8 @@
 namespace {
 
 using apache::geode::client::Cache;
+using apache::geode::client::Cacheable;
+using apache::geode::client::CacheableKey;
 using apache::geode::client::CacheableString;
 using apache::geode::client::Pool;
 using apache::geode::client::Region;
@@ -94,4 +97,43 @@ TEST(RegionGetAllTest, getAllFromPartitionedRegion) {
   }
 }
 
+TEST(RegionGetAllTest, getAllStreamingFromPartitionedRegion) {
+  Cluster cluster{LocatorCount{1}, ServerCount{2}};
+
+  cluster.start();
+
+  cluster.getGfsh()
+      .create()
+      .region()
+      .withName("region")
+      .withType("PARTITION")
+      .execute();
+
+  auto cache = createCache();
+  auto pool = createPool(cluster, cache);
+  auto region = setupRegion(cache, pool);
+
+  for (int i = 0; i < 1000; i++) {
+    region->put(i, std::to_string(i));
+  }
+
+  auto keys = region->serverKeys();
+  std::map<int, std::string> received;
+  region->getAllStreaming(
+      keys, [&received](const std::shared_ptr<CacheableKey>& key,
+                        const std::shared_ptr<Cacheable>& value) {
+        auto intKey = std::dynamic_pointer_cast<
+            apache::geode::client::CacheableInt32>(key);
+        ASSERT_NE(nullptr, intKey);
+        auto stringValue = std::dynamic_pointer_cast<CacheableString>(value);
+        ASSERT_NE(nullptr, stringValue);
+        received.emplace(intKey->value(), stringValue->value());
+      });
+
+  ASSERT_EQ(1000, received.size());
+  for (const auto& entry : received) {
+    EXPECT_EQ(std::to_string(entry.first), entry.second);
+  }
+}
+
 }  // namespace
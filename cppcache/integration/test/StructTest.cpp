@@ -104,4 +104,42 @@ TEST(StructTest, queryResultForRange) {
   }
 }
 
+TEST(StructTest, queryResultStreaming) {
+  Cluster cluster{LocatorCount{1}, ServerCount{1}};
+
+  cluster.start();
+
+  cluster.getGfsh()
+      .create()
+      .region()
+      .withName("region")
+      .withType("REPLICATE")
+      .execute();
+
+  auto cache = cluster.createCache();
+  auto region = setupRegion(cache);
+
+  for (int i = 0; i < 1000; i++) {
+    region->put(i, std::to_string(i));
+  }
+
+  size_t rows = 0;
+  cache.getQueryService()
+      ->newQuery("SELECT e.key, e.value FROM /region.entries e")
+      ->executeStreaming(
+          [&rows](
+              const std::shared_ptr<apache::geode::client::SelectResults>&
+                  results) {
+            EXPECT_LT(0, results->size());
+            for (auto&& row : hacks::range(*results)) {
+              auto rowStruct = std::dynamic_pointer_cast<Struct>(row);
+              ASSERT_NE(nullptr, rowStruct);
+              EXPECT_EQ(2, rowStruct->size());
+              ++rows;
+            }
+          });
+
+  EXPECT_EQ(1000, rows);
+}
+
 }  // namespace
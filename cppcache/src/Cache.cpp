@@ -97,6 +97,10 @@ std::shared_ptr<QueryService> Cache::getQueryService(
   return m_cacheImpl->getQueryService(poolName.c_str());
 }
 
+std::shared_ptr<QueryService> Cache::getLocalQueryService() {
+  return m_cacheImpl->getLocalQueryService();
+}
+
 std::shared_ptr<CacheTransactionManager> Cache::getCacheTransactionManager()
     const {
   return m_cacheImpl->getCacheTransactionManager();
@@ -104,10 +108,11 @@ std::shared_ptr<CacheTransactionManager> Cache::getCacheTransactionManager()
 
 Cache::Cache(const std::shared_ptr<Properties>& dsProp,
              bool ignorePdxUnreadFields, bool readPdxSerialized,
-             const std::shared_ptr<AuthInitialize>& authInitialize)
+             const std::shared_ptr<AuthInitialize>& authInitialize,
+             const std::shared_ptr<TraceExporter>& traceExporter)
     : m_cacheImpl(std::unique_ptr<CacheImpl>(
           new CacheImpl(this, dsProp, ignorePdxUnreadFields, readPdxSerialized,
-                        authInitialize))) {}
+                        authInitialize, traceExporter))) {}
 
 Cache::Cache(Cache&& other) noexcept {
   other.m_cacheImpl->doIfDestroyNotPending([&]() {
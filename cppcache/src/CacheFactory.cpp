@@ -63,8 +63,8 @@ CacheFactory::CacheFactory(
       pdxReadSerialized(false) {}
 
 Cache CacheFactory::create() const {
-  auto cache =
-      Cache(dsProp, ignorePdxUnreadFields, pdxReadSerialized, authInitialize);
+  auto cache = Cache(dsProp, ignorePdxUnreadFields, pdxReadSerialized,
+                     authInitialize, traceExporter);
 
   try {
     auto&& cacheXml = cache.m_cacheImpl->getDistributedSystem()
@@ -134,6 +134,12 @@ CacheFactory& CacheFactory::setAuthInitialize(
   return *this;
 }
 
+CacheFactory& CacheFactory::setTraceExporter(
+    const std::shared_ptr<TraceExporter>& exporter) {
+  this->traceExporter = exporter;
+  return *this;
+}
+
 CacheFactory& CacheFactory::setPdxIgnoreUnreadFields(bool ignore) {
   ignorePdxUnreadFields = ignore;
   return *this;
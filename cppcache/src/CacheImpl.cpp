@@ -30,7 +30,9 @@
 #include "ClientProxyMembershipID.hpp"
 #include "EvictionController.hpp"
 #include "ExpiryTaskManager.hpp"
+#include "FileTraceExporter.hpp"
 #include "InternalCacheTransactionManager2PCImpl.hpp"
+#include "LocalQueryService.hpp"
 #include "LocalRegion.hpp"
 #include "PdxTypeRegistry.hpp"
 #include "RegionExpiryHandler.hpp"
@@ -43,6 +45,7 @@
 #include "ThinClientPoolRegion.hpp"
 #include "ThinClientRegion.hpp"
 #include "ThreadPool.hpp"
+#include "Tracer.hpp"
 #include "Utils.hpp"
 #include "Version.hpp"
 
@@ -52,9 +55,18 @@ namespace apache {
 namespace geode {
 namespace client {
 
+// idle receive buffers kept for reuse across all connections; buffers larger
+// than the size limit go back to the allocator
+static constexpr size_t MAX_POOLED_RECEIVE_BUFFERS = 64;
+static constexpr size_t MAX_POOLED_RECEIVE_BUFFER_SIZE = 4 * 1024 * 1024;
+
+// how often finished spans are handed to the trace exporter
+static constexpr auto TRACE_EXPORT_INTERVAL = std::chrono::seconds(1);
+
 CacheImpl::CacheImpl(Cache* c, const std::shared_ptr<Properties>& dsProps,
                      bool ignorePdxUnreadFields, bool readPdxSerialized,
-                     const std::shared_ptr<AuthInitialize>& authInitialize)
+                     const std::shared_ptr<AuthInitialize>& authInitialize,
+                     const std::shared_ptr<TraceExporter>& traceExporter)
     : m_ignorePdxUnreadFields(ignorePdxUnreadFields),
       m_readPdxSerialized(readPdxSerialized),
       m_expiryTaskManager(
@@ -75,6 +87,8 @@ CacheImpl::CacheImpl(Cache* c, const std::shared_ptr<Properties>& dsProps,
       m_serializationRegistry(std::make_shared<SerializationRegistry>()),
       m_pdxTypeRegistry(nullptr),
       m_threadPool(m_distributedSystem.getSystemProperties().threadPoolSize()),
+      m_receiveBufferPool(MAX_POOLED_RECEIVE_BUFFERS,
+                          MAX_POOLED_RECEIVE_BUFFER_SIZE),
       m_authInitialize(authInitialize) {
   using apache::geode::statistics::StatisticsManager;
 
@@ -89,8 +103,27 @@ CacheImpl::CacheImpl(Cache* c, const std::shared_ptr<Properties>& dsProps,
     LOGINFO("Heap LRU eviction controller thread started");
   }
 
+  if (prop.expiryTimingWheelEnabled()) {
+    m_expiryTaskManager->enableTimingWheel(prop.expiryTimingWheelTick());
+  }
   m_expiryTaskManager->begin();
 
+  if (prop.tracingSampleRate() > 0.0) {
+    auto exporter = traceExporter;
+    if (!exporter && !prop.tracingFile().empty()) {
+      exporter = std::make_shared<FileTraceExporter>(prop.tracingFile());
+    }
+    if (exporter) {
+      m_tracer = std::unique_ptr<Tracer>(
+          new Tracer(prop.tracingSampleRate(), prop.tracingBufferSize(),
+                     TRACE_EXPORT_INTERVAL, std::move(exporter)));
+    } else {
+      LOGWARN(
+          "tracing-sample-rate is set but neither a trace exporter nor "
+          "tracing-file is configured; tracing is disabled");
+    }
+  }
+
   m_initialized = true;
   m_pdxTypeRegistry = std::make_shared<PdxTypeRegistry>(this);
   m_poolManager = std::unique_ptr<PoolManager>(new PoolManager(this));
@@ -203,6 +236,17 @@ std::shared_ptr<QueryService> CacheImpl::getQueryService(const char* poolName) {
   }
 }
 
+std::shared_ptr<QueryService> CacheImpl::getLocalQueryService() {
+  this->throwIfClosed();
+
+  std::lock_guard<decltype(m_localQueryServiceMutex)> guard(
+      m_localQueryServiceMutex);
+  if (m_localQueryService == nullptr) {
+    m_localQueryService = std::make_shared<LocalQueryService>(this);
+  }
+  return m_localQueryService;
+}
+
 CacheImpl::~CacheImpl() {
   if (!m_closed) {
     close();
@@ -307,6 +351,10 @@ void CacheImpl::close(bool keepalive) {
   LOGFINE("Closed pool manager with keepalive %s",
           keepalive ? "true" : "false");
 
+  if (m_tracer) {
+    m_tracer->stop();
+  }
+
   // Close CachePef Stats
   if (m_cacheStats) {
     _GEODE_SAFE_DELETE(m_cacheStats);
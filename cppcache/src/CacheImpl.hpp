@@ -35,6 +35,7 @@
 #include "DistributedSystem.hpp"
 #include "MemberListForVersionStamp.hpp"
 #include "PdxTypeRegistry.hpp"
+#include "ReceiveBufferPool.hpp"
 #include "RemoteQueryService.hpp"
 #include "ThreadPool.hpp"
 #include "util/synchronized_map.hpp"
@@ -54,6 +55,7 @@ namespace client {
 class CacheFactory;
 class CacheStatistics;
 class ExpiryTaskManager;
+class LocalQueryService;
 class PdxTypeRegistry;
 class Pool;
 class RegionAttributes;
@@ -61,6 +63,8 @@ class SerializationRegistry;
 class ThreadPool;
 class EvictionController;
 class TcrConnectionManager;
+class TraceExporter;
+class Tracer;
 
 /**
  * @class Cache Cache.hpp
@@ -196,13 +200,22 @@ class APACHE_GEODE_EXPORT CacheImpl {
    */
   CacheImpl(Cache* c, const std::shared_ptr<Properties>& dsProps,
             bool ignorePdxUnreadFields, bool readPdxSerialized,
-            const std::shared_ptr<AuthInitialize>& authInitialize);
+            const std::shared_ptr<AuthInitialize>& authInitialize,
+            const std::shared_ptr<TraceExporter>& traceExporter = nullptr);
 
   void initServices();
   EvictionController* getEvictionController();
 
   ExpiryTaskManager& getExpiryTaskManager() { return *m_expiryTaskManager; }
 
+  ReceiveBufferPool& getReceiveBufferPool() { return m_receiveBufferPool; }
+
+  /**
+   * Returns the tracer sampling region operations, or nullptr when tracing
+   * is disabled.
+   */
+  Tracer* getTracer() const { return m_tracer.get(); }
+
   ClientProxyMembershipIDFactory& getClientProxyMembershipIDFactory() {
     return m_clientProxyMembershipIDFactory;
   }
@@ -219,6 +232,8 @@ class APACHE_GEODE_EXPORT CacheImpl {
 
   std::shared_ptr<QueryService> getQueryService(const char* poolName);
 
+  std::shared_ptr<QueryService> getLocalQueryService();
+
   std::shared_ptr<RegionInternal> createRegion_internal(
       const std::string& name,
       const std::shared_ptr<RegionInternal>& rootRegion,
@@ -313,6 +328,8 @@ class APACHE_GEODE_EXPORT CacheImpl {
   bool m_ignorePdxUnreadFields;
   bool m_readPdxSerialized;
   std::unique_ptr<ExpiryTaskManager> m_expiryTaskManager;
+  // outlives the pools so operations still in flight can finish their spans
+  std::unique_ptr<Tracer> m_tracer;
 
   // CachePerfStats
   CachePerfStats* m_cacheStats;
@@ -358,6 +375,8 @@ class APACHE_GEODE_EXPORT CacheImpl {
   std::unique_ptr<EvictionController> m_evictionController;
   TcrConnectionManager* m_tcrConnectionManager;
   std::shared_ptr<RemoteQueryService> m_remoteQueryServicePtr;
+  std::shared_ptr<LocalQueryService> m_localQueryService;
+  std::mutex m_localQueryServiceMutex;
   std::recursive_mutex m_destroyCacheMutex;
   volatile bool m_destroyPending;
   volatile bool m_initDone;
@@ -369,6 +388,7 @@ class APACHE_GEODE_EXPORT CacheImpl {
   std::shared_ptr<SerializationRegistry> m_serializationRegistry;
   std::shared_ptr<PdxTypeRegistry> m_pdxTypeRegistry;
   ThreadPool m_threadPool;
+  ReceiveBufferPool m_receiveBufferPool;
   const std::shared_ptr<AuthInitialize> m_authInitialize;
   std::unique_ptr<TypeRegistry> m_typeRegistry;
 
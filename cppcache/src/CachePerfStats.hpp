@@ -42,7 +42,7 @@ class APACHE_GEODE_EXPORT CachePerfStats {
 
     if (statsType == nullptr) {
       const bool largerIsBetter = true;
-      std::vector<std::shared_ptr<StatisticDescriptor>> statDescArr(24);
+      std::vector<std::shared_ptr<StatisticDescriptor>> statDescArr(28);
 
       statDescArr[0] = factory->createIntCounter(
           "creates", "The total number of cache creates", "entries",
@@ -136,6 +136,25 @@ class APACHE_GEODE_EXPORT CachePerfStats {
           "pdxDeserializedBytes",
           "Total number of bytes read by pdx deserialization.", "entries",
           !largerIsBetter);
+      statDescArr[24] = factory->createLongCounter(
+          "dataOutputBufferHits",
+          "Total number of serialization buffers reused from a thread cache, "
+          "across the process",
+          "buffers", largerIsBetter);
+      statDescArr[25] = factory->createLongCounter(
+          "dataOutputBufferMisses",
+          "Total number of serialization buffers allocated, across the process",
+          "buffers", !largerIsBetter);
+      statDescArr[26] = factory->createLongCounter(
+          "dataOutputBuffersRecycled",
+          "Total number of serialization buffers returned to a thread cache, "
+          "across the process",
+          "buffers", largerIsBetter);
+      statDescArr[27] = factory->createLongCounter(
+          "dataOutputBuffersDiscarded",
+          "Total number of serialization buffers freed because they were "
+          "oversized or their thread cache was full, across the process",
+          "buffers", !largerIsBetter);
 
       statsType = factory->createType("CachePerfStats",
                                       "Statistics about native client cache",
@@ -173,6 +192,12 @@ class APACHE_GEODE_EXPORT CachePerfStats {
     m_pdxSerializedBytesId = statsType->nameToId("pdxSerializedBytes");
     m_pdxDeserializationsId = statsType->nameToId("pdxDeserializations");
     m_pdxDeserializedBytesId = statsType->nameToId("pdxDeserializedBytes");
+    m_dataOutputBufferHitsId = statsType->nameToId("dataOutputBufferHits");
+    m_dataOutputBufferMissesId = statsType->nameToId("dataOutputBufferMisses");
+    m_dataOutputBuffersRecycledId =
+        statsType->nameToId("dataOutputBuffersRecycled");
+    m_dataOutputBuffersDiscardedId =
+        statsType->nameToId("dataOutputBuffersDiscarded");
 
     // Set initial value
     m_cachePerfStats->setInt(m_destroysId, 0);
@@ -199,6 +224,10 @@ class APACHE_GEODE_EXPORT CachePerfStats {
     m_cachePerfStats->setLong(m_pdxSerializedBytesId, 0);
     m_cachePerfStats->setInt(m_pdxDeserializationsId, 0);
     m_cachePerfStats->setLong(m_pdxDeserializedBytesId, 0);
+    m_cachePerfStats->setLong(m_dataOutputBufferHitsId, 0);
+    m_cachePerfStats->setLong(m_dataOutputBufferMissesId, 0);
+    m_cachePerfStats->setLong(m_dataOutputBuffersRecycledId, 0);
+    m_cachePerfStats->setLong(m_dataOutputBuffersDiscardedId, 0);
   }
 
   CachePerfStats(const CachePerfStats& other) = default;
@@ -350,6 +379,10 @@ class APACHE_GEODE_EXPORT CachePerfStats {
   int32_t m_pdxSerializedBytesId;
   int32_t m_pdxDeserializationsId;
   int32_t m_pdxDeserializedBytesId;
+  int32_t m_dataOutputBufferHitsId;
+  int32_t m_dataOutputBufferMissesId;
+  int32_t m_dataOutputBuffersRecycledId;
+  int32_t m_dataOutputBuffersDiscardedId;
 };
 }  // namespace client
 }  // namespace geode
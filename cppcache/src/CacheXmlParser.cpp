@@ -201,6 +201,7 @@ auto CLONING_ENABLED = "cloning-enabled";
 auto ID = "id";
 auto REFID = "refid";
 auto PR_SINGLE_HOP_ENABLED = "pr-single-hop-enabled";
+auto LATENCY_AWARE_READS = "latency-aware-reads";
 
 std::vector<std::pair<std::string, int>> parseEndPoints(
     const std::string &str) {
@@ -745,6 +746,15 @@ void CacheXmlParser::startPool(const xercesc::Attributes &attrs) {
     }
   }
 
+  auto latencyAwareReads = getOptionalAttribute(attrs, LATENCY_AWARE_READS);
+  if (!latencyAwareReads.empty()) {
+    if (equal_ignore_case(latencyAwareReads, "true")) {
+      factory->setLatencyAwareReads(true);
+    } else {
+      factory->setLatencyAwareReads(false);
+    }
+  }
+
   _stack.push(poolxml);
   _stack.push(factory);
 }
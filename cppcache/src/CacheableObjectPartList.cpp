@@ -73,6 +73,7 @@ void CacheableObjectPartList::fromData(DataInput& input) {
         m_exceptions->emplace(key, ex);
       } else {
         input.readObject(value);
+        if (m_region) value = m_region->decompressFromServer(value);
         std::shared_ptr<Cacheable> oldValue;
         if (m_addToLocalCache) {
           // for both  register interest  and getAll it is desired
@@ -155,9 +155,19 @@ void ClientMetadata::getServerLocation(
     }
     LOGFINER("returning random & m_bucketServerLocationsList size is: %zu",
              m_bucketServerLocationsList.size());
+    const auto& locations = m_bucketServerLocationsList[bucketId];
+    const auto size = static_cast<int>(locations.size());
     RandGen randgen;
-    serverLocation = m_bucketServerLocationsList[bucketId].at(randgen(
-        static_cast<int>(m_bucketServerLocationsList[bucketId].size())));
+    const auto first = randgen(size);
+    serverLocation = locations.at(first);
+    if (size > 1 && m_tcrdm != nullptr) {
+      // of two random copies of the bucket read from the healthier server
+      const auto& other = locations.at((first + 1 + randgen(size - 1)) % size);
+      if (m_tcrdm->isHealthier(other->getEpString(),
+                               serverLocation->getEpString())) {
+        serverLocation = other;
+      }
+    }
   }
   // return m_bucketServerLocationsList[bucketId].at(0);
 }
@@ -0,0 +1,221 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdexcept>
+
+#include <geode/CacheableDate.hpp>
+#include <geode/CacheableString.hpp>
+#include <geode/ColumnarResults.hpp>
+#include <geode/ExceptionTypes.hpp>
+#include <geode/Struct.hpp>
+#include <geode/StructSet.hpp>
+
+#include "ColumnarResultsBuilder.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+std::shared_ptr<ColumnarResults> ColumnarResults::create(
+    const SelectResults& results) {
+  ColumnarResultsBuilder builder;
+  if (auto structSet = dynamic_cast<const StructSet*>(&results)) {
+    // StructSet::getFieldName is not const but does not modify the set
+    auto& fields = const_cast<StructSet&>(*structSet);
+    std::vector<std::string> fieldNames;
+    try {
+      for (int32_t i = 0;; ++i) {
+        fieldNames.push_back(fields.getFieldName(i));
+      }
+    } catch (const std::out_of_range&) {
+    }
+    auto fieldCount = static_cast<int32_t>(fieldNames.size());
+    builder.setFieldNames(fieldNames);
+    for (size_t row = 0; row < results.size(); ++row) {
+      auto value = std::dynamic_pointer_cast<Struct>(results[row]);
+      for (int32_t i = 0; i < fieldCount; ++i) {
+        builder.addCell((*value)[i]);
+      }
+    }
+  } else {
+    for (size_t row = 0; row < results.size(); ++row) {
+      builder.addCell(results[row]);
+    }
+  }
+  return builder.build();
+}
+
+std::shared_ptr<ColumnarResults> ColumnarResults::create(
+    const std::vector<std::shared_ptr<Cacheable>>& results) {
+  ColumnarResultsBuilder builder;
+  auto first = results.empty() ? nullptr
+                               : std::dynamic_pointer_cast<Struct>(results[0]);
+  if (first == nullptr) {
+    for (const auto& value : results) {
+      builder.addCell(value);
+    }
+    return builder.build();
+  }
+
+  std::vector<std::string> fieldNames;
+  for (int32_t i = 0; i < first->size(); ++i) {
+    fieldNames.push_back(first->getFieldName(i));
+  }
+  builder.setFieldNames(fieldNames);
+  for (const auto& value : results) {
+    auto row = std::dynamic_pointer_cast<Struct>(value);
+    if (row == nullptr || row->size() != first->size()) {
+      throw IllegalArgumentException(
+          "ColumnarResults::create: results are not Structs of the same "
+          "size");
+    }
+    for (int32_t i = 0; i < row->size(); ++i) {
+      builder.addCell((*row)[i]);
+    }
+  }
+  return builder.build();
+}
+
+const std::string& ColumnarResults::getFieldName(size_t column) const {
+  return m_columns.at(column).name;
+}
+
+size_t ColumnarResults::getFieldIndex(const std::string& fieldName) const {
+  for (size_t i = 0; i < m_columns.size(); ++i) {
+    if (m_columns[i].name == fieldName) {
+      return i;
+    }
+  }
+  throw std::invalid_argument("fieldname not found");
+}
+
+ColumnarResults::ColumnType ColumnarResults::getColumnType(
+    size_t column) const {
+  return m_columns.at(column).type;
+}
+
+bool ColumnarResults::isNull(size_t row, size_t column) const {
+  const auto& values = m_columns.at(column);
+  if (row >= m_rows) {
+    throw std::out_of_range("ColumnarResults: row out of range");
+  }
+  return values.type == ColumnType::Null ||
+         (!values.nulls.empty() && values.nulls[row]);
+}
+
+const std::vector<int8_t>& ColumnarResults::getInt8Column(
+    size_t column) const {
+  return this->column(column, ColumnType::Boolean, ColumnType::Byte).int8s;
+}
+
+const std::vector<int16_t>& ColumnarResults::getInt16Column(
+    size_t column) const {
+  return this->column(column, ColumnType::Int16, ColumnType::Int16).int16s;
+}
+
+const std::vector<int32_t>& ColumnarResults::getInt32Column(
+    size_t column) const {
+  return this->column(column, ColumnType::Int32, ColumnType::Int32).int32s;
+}
+
+const std::vector<int64_t>& ColumnarResults::getInt64Column(
+    size_t column) const {
+  return this->column(column, ColumnType::Int64, ColumnType::Date).int64s;
+}
+
+const std::vector<float>& ColumnarResults::getFloatColumn(
+    size_t column) const {
+  return this->column(column, ColumnType::Float, ColumnType::Float).floats;
+}
+
+const std::vector<double>& ColumnarResults::getDoubleColumn(
+    size_t column) const {
+  return this->column(column, ColumnType::Double, ColumnType::Double).doubles;
+}
+
+const std::vector<int32_t>& ColumnarResults::getStringCodes(
+    size_t column) const {
+  return this->column(column, ColumnType::String, ColumnType::String).codes;
+}
+
+const std::vector<std::string>& ColumnarResults::getStringDictionary(
+    size_t column) const {
+  return this->column(column, ColumnType::String, ColumnType::String)
+      .dictionary;
+}
+
+const std::vector<std::shared_ptr<Cacheable>>&
+ColumnarResults::getObjectColumn(size_t column) const {
+  return this->column(column, ColumnType::Object, ColumnType::Object).objects;
+}
+
+std::shared_ptr<Cacheable> ColumnarResults::getObject(size_t row,
+                                                      size_t column) const {
+  if (isNull(row, column)) {
+    return nullptr;
+  }
+  return box(m_columns[column], row);
+}
+
+const ColumnarResults::Column& ColumnarResults::column(
+    size_t column, ColumnType type, ColumnType alternate) const {
+  const auto& values = m_columns.at(column);
+  // a column with no values is empty for every type
+  if (values.type != type && values.type != alternate &&
+      values.type != ColumnType::Null) {
+    throw IllegalStateException("ColumnarResults: column " + values.name +
+                                " does not hold the requested type");
+  }
+  return values;
+}
+
+std::shared_ptr<Cacheable> ColumnarResults::box(const Column& column,
+                                                size_t row) {
+  switch (column.type) {
+    case ColumnType::Boolean:
+      return CacheableBoolean::create(column.int8s[row] != 0);
+    case ColumnType::Byte:
+      return CacheableByte::create(column.int8s[row]);
+    case ColumnType::Int16:
+      return CacheableInt16::create(column.int16s[row]);
+    case ColumnType::Int32:
+      return CacheableInt32::create(column.int32s[row]);
+    case ColumnType::Int64:
+      return CacheableInt64::create(column.int64s[row]);
+    case ColumnType::Date:
+      return CacheableDate::create(
+          CacheableDate::duration(column.int64s[row]));
+    case ColumnType::Float:
+      return CacheableFloat::create(column.floats[row]);
+    case ColumnType::Double:
+      return CacheableDouble::create(column.doubles[row]);
+    case ColumnType::String:
+      if (column.codes[row] < 0) {
+        return nullptr;
+      }
+      return CacheableString::create(column.dictionary[column.codes[row]]);
+    case ColumnType::Object:
+      return column.objects[row];
+    case ColumnType::Null:
+      break;
+  }
+  return nullptr;
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
@@ -0,0 +1,353 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ColumnarResultsBuilder.hpp"
+
+#include <geode/CacheableDate.hpp>
+#include <geode/CacheableString.hpp>
+#include <geode/ExceptionTypes.hpp>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+using internal::DSCode;
+
+ColumnarResultsBuilder::ColumnarResultsBuilder()
+    : m_results(new ColumnarResults()), m_column(0), m_row(0) {}
+
+void ColumnarResultsBuilder::setFieldNames(
+    const std::vector<std::string>& fieldNames) {
+  if (!m_results->m_columns.empty()) {
+    return;
+  }
+  m_results->m_columns.resize(fieldNames.empty() ? 1 : fieldNames.size());
+  m_dictionaries.resize(m_results->m_columns.size());
+  if (fieldNames.empty()) {
+    m_results->m_columns[0].name = "result";
+  } else {
+    for (size_t i = 0; i < fieldNames.size(); ++i) {
+      m_results->m_columns[i].name = fieldNames[i];
+    }
+  }
+}
+
+void ColumnarResultsBuilder::readCell(DataInput& input) {
+  auto code = static_cast<DSCode>(input.read());
+  switch (code) {
+    case DSCode::NullObj:
+    case DSCode::CacheableNullString:
+      addNull();
+      break;
+    case DSCode::CacheableBoolean:
+      addInt8(ColumnType::Boolean, input.readBoolean() ? 1 : 0);
+      break;
+    case DSCode::CacheableByte:
+      addInt8(ColumnType::Byte, input.read());
+      break;
+    case DSCode::CacheableInt16:
+      addInt16(input.readInt16());
+      break;
+    case DSCode::CacheableInt32:
+      addInt32(input.readInt32());
+      break;
+    case DSCode::CacheableInt64:
+      addInt64(ColumnType::Int64, input.readInt64());
+      break;
+    case DSCode::CacheableDate:
+      addInt64(ColumnType::Date, input.readInt64());
+      break;
+    case DSCode::CacheableFloat:
+      addFloat(input.readFloat());
+      break;
+    case DSCode::CacheableDouble:
+      addDouble(input.readDouble());
+      break;
+    case DSCode::CacheableString:
+    case DSCode::CacheableStringHuge:
+    case DSCode::CacheableASCIIString:
+    case DSCode::CacheableASCIIStringHuge:
+      input.rewindCursor(1);
+      addString(input.readString());
+      break;
+    default:
+      input.rewindCursor(1);
+      addCell(input.readObject());
+      break;
+  }
+}
+
+void ColumnarResultsBuilder::addCell(const std::shared_ptr<Cacheable>& value) {
+  if (value == nullptr) {
+    addNull();
+  } else if (auto v = std::dynamic_pointer_cast<CacheableBoolean>(value)) {
+    addInt8(ColumnType::Boolean, v->value() ? 1 : 0);
+  } else if (auto v = std::dynamic_pointer_cast<CacheableByte>(value)) {
+    addInt8(ColumnType::Byte, v->value());
+  } else if (auto v = std::dynamic_pointer_cast<CacheableInt16>(value)) {
+    addInt16(v->value());
+  } else if (auto v = std::dynamic_pointer_cast<CacheableInt32>(value)) {
+    addInt32(v->value());
+  } else if (auto v = std::dynamic_pointer_cast<CacheableInt64>(value)) {
+    addInt64(ColumnType::Int64, v->value());
+  } else if (auto v = std::dynamic_pointer_cast<CacheableDate>(value)) {
+    addInt64(ColumnType::Date, v->milliseconds());
+  } else if (auto v = std::dynamic_pointer_cast<CacheableFloat>(value)) {
+    addFloat(v->value());
+  } else if (auto v = std::dynamic_pointer_cast<CacheableDouble>(value)) {
+    addDouble(v->value());
+  } else if (auto v = std::dynamic_pointer_cast<CacheableString>(value)) {
+    addString(v->value());
+  } else {
+    addObject(value);
+  }
+}
+
+std::shared_ptr<ColumnarResults> ColumnarResultsBuilder::build() {
+  setFieldNames({});
+  if (m_column != 0) {
+    throw MessageException(
+        "ColumnarResults: number of values has to be exactly divisible by "
+        "field count");
+  }
+  m_results->m_rows = m_row;
+  std::shared_ptr<ColumnarResults> results(std::move(m_results));
+  reset();
+  return results;
+}
+
+void ColumnarResultsBuilder::reset() {
+  m_results.reset(new ColumnarResults());
+  m_dictionaries.clear();
+  m_column = 0;
+  m_row = 0;
+}
+
+ColumnarResults::Column& ColumnarResultsBuilder::nextColumn() {
+  setFieldNames({});
+  return m_results->m_columns[m_column];
+}
+
+void ColumnarResultsBuilder::advance() {
+  auto& column = m_results->m_columns[m_column];
+  if (!column.nulls.empty() && column.nulls.size() == m_row) {
+    column.nulls.push_back(0);
+  }
+  if (++m_column == m_results->m_columns.size()) {
+    m_column = 0;
+    ++m_row;
+  }
+}
+
+void ColumnarResultsBuilder::addNull() {
+  auto& column = nextColumn();
+  if (column.nulls.empty()) {
+    column.nulls.assign(m_row, 0);
+  }
+  column.nulls.push_back(1);
+  switch (column.type) {
+    case ColumnType::Null:
+      break;
+    case ColumnType::Boolean:
+    case ColumnType::Byte:
+      column.int8s.push_back(0);
+      break;
+    case ColumnType::Int16:
+      column.int16s.push_back(0);
+      break;
+    case ColumnType::Int32:
+      column.int32s.push_back(0);
+      break;
+    case ColumnType::Int64:
+    case ColumnType::Date:
+      column.int64s.push_back(0);
+      break;
+    case ColumnType::Float:
+      column.floats.push_back(0);
+      break;
+    case ColumnType::Double:
+      column.doubles.push_back(0);
+      break;
+    case ColumnType::String:
+      column.codes.push_back(-1);
+      break;
+    case ColumnType::Object:
+      column.objects.push_back(nullptr);
+      break;
+  }
+  advance();
+}
+
+void ColumnarResultsBuilder::addInt8(ColumnType type, int8_t value) {
+  auto& column = nextColumn();
+  if (!prepare(column, type)) {
+    if (type == ColumnType::Boolean) {
+      addObject(CacheableBoolean::create(value != 0));
+    } else {
+      addObject(CacheableByte::create(value));
+    }
+    return;
+  }
+  column.int8s.push_back(value);
+  advance();
+}
+
+void ColumnarResultsBuilder::addInt16(int16_t value) {
+  auto& column = nextColumn();
+  if (!prepare(column, ColumnType::Int16)) {
+    addObject(CacheableInt16::create(value));
+    return;
+  }
+  column.int16s.push_back(value);
+  advance();
+}
+
+void ColumnarResultsBuilder::addInt32(int32_t value) {
+  auto& column = nextColumn();
+  if (!prepare(column, ColumnType::Int32)) {
+    addObject(CacheableInt32::create(value));
+    return;
+  }
+  column.int32s.push_back(value);
+  advance();
+}
+
+void ColumnarResultsBuilder::addInt64(ColumnType type, int64_t value) {
+  auto& column = nextColumn();
+  if (!prepare(column, type)) {
+    if (type == ColumnType::Date) {
+      addObject(CacheableDate::create(CacheableDate::duration(value)));
+    } else {
+      addObject(CacheableInt64::create(value));
+    }
+    return;
+  }
+  column.int64s.push_back(value);
+  advance();
+}
+
+void ColumnarResultsBuilder::addFloat(float value) {
+  auto& column = nextColumn();
+  if (!prepare(column, ColumnType::Float)) {
+    addObject(CacheableFloat::create(value));
+    return;
+  }
+  column.floats.push_back(value);
+  advance();
+}
+
+void ColumnarResultsBuilder::addDouble(double value) {
+  auto& column = nextColumn();
+  if (!prepare(column, ColumnType::Double)) {
+    addObject(CacheableDouble::create(value));
+    return;
+  }
+  column.doubles.push_back(value);
+  advance();
+}
+
+void ColumnarResultsBuilder::addString(std::string value) {
+  auto& column = nextColumn();
+  if (!prepare(column, ColumnType::String)) {
+    addObject(CacheableString::create(std::move(value)));
+    return;
+  }
+  auto& dictionary = m_dictionaries[m_column];
+  auto found = dictionary.find(value);
+  if (found == dictionary.end()) {
+    auto code = static_cast<int32_t>(column.dictionary.size());
+    found = dictionary.emplace(value, code).first;
+    column.dictionary.push_back(std::move(value));
+  }
+  column.codes.push_back(found->second);
+  advance();
+}
+
+void ColumnarResultsBuilder::addObject(
+    const std::shared_ptr<Cacheable>& value) {
+  auto& column = nextColumn();
+  if (column.type != ColumnType::Object) {
+    toObjects(column);
+  }
+  column.objects.push_back(value);
+  advance();
+}
+
+bool ColumnarResultsBuilder::prepare(Column& column, ColumnType type) {
+  if (column.type == type) {
+    return true;
+  } else if (column.type == ColumnType::Object) {
+    return false;
+  } else if (column.type != ColumnType::Null) {
+    // mixed types can only be represented as objects
+    toObjects(column);
+    return false;
+  }
+
+  // all previous rows are null; fill them with the type's default
+  switch (type) {
+    case ColumnType::Boolean:
+    case ColumnType::Byte:
+      column.int8s.assign(m_row, 0);
+      break;
+    case ColumnType::Int16:
+      column.int16s.assign(m_row, 0);
+      break;
+    case ColumnType::Int32:
+      column.int32s.assign(m_row, 0);
+      break;
+    case ColumnType::Int64:
+    case ColumnType::Date:
+      column.int64s.assign(m_row, 0);
+      break;
+    case ColumnType::Float:
+      column.floats.assign(m_row, 0);
+      break;
+    case ColumnType::Double:
+      column.doubles.assign(m_row, 0);
+      break;
+    case ColumnType::String:
+      column.codes.assign(m_row, -1);
+      break;
+    default:
+      break;
+  }
+  column.type = type;
+  return true;
+}
+
+void ColumnarResultsBuilder::toObjects(Column& column) {
+  std::vector<std::shared_ptr<Cacheable>> objects;
+  objects.reserve(m_row + 1);
+  for (size_t row = 0; row < m_row; ++row) {
+    bool isNull = column.type == ColumnType::Null ||
+                  (!column.nulls.empty() && column.nulls[row]);
+    objects.push_back(isNull ? nullptr : ColumnarResults::box(column, row));
+  }
+
+  Column converted;
+  converted.name = std::move(column.name);
+  converted.type = ColumnType::Object;
+  converted.nulls = std::move(column.nulls);
+  converted.objects = std::move(objects);
+  column = std::move(converted);
+  m_dictionaries[m_column].clear();
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
@@ -0,0 +1,90 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_COLUMNARRESULTSBUILDER_H_
+#define GEODE_COLUMNARRESULTSBUILDER_H_
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <geode/ColumnarResults.hpp>
+#include <geode/DataInput.hpp>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * Fills a ColumnarResults one cell at a time in row-major order. Cells are
+ * either decoded straight from the wire, so primitives and strings never
+ * become objects, or added as already deserialized values.
+ */
+class ColumnarResultsBuilder {
+ public:
+  ColumnarResultsBuilder();
+
+  /**
+   * Sets the column names. Must be called before the first cell; no names
+   * mean a single column named "result".
+   */
+  void setFieldNames(const std::vector<std::string>& fieldNames);
+
+  /** Decodes the next serialized value from input into the next cell. */
+  void readCell(DataInput& input);
+
+  void addCell(const std::shared_ptr<Cacheable>& value);
+
+  /**
+   * @throws MessageException if the cells do not fill whole rows.
+   */
+  std::shared_ptr<ColumnarResults> build();
+
+  /** Discards all cells and column names added so far. */
+  void reset();
+
+ private:
+  typedef ColumnarResults::Column Column;
+  typedef ColumnarResults::ColumnType ColumnType;
+
+  Column& nextColumn();
+  void advance();
+  void addNull();
+  void addInt8(ColumnType type, int8_t value);
+  void addInt16(int16_t value);
+  void addInt32(int32_t value);
+  void addInt64(ColumnType type, int64_t value);
+  void addFloat(float value);
+  void addDouble(double value);
+  void addString(std::string value);
+  void addObject(const std::shared_ptr<Cacheable>& value);
+  bool prepare(Column& column, ColumnType type);
+  void toObjects(Column& column);
+
+  std::unique_ptr<ColumnarResults> m_results;
+  std::vector<std::unordered_map<std::string, int32_t>> m_dictionaries;
+  size_t m_column;
+  size_t m_row;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_COLUMNARRESULTSBUILDER_H_
@@ -0,0 +1,155 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CompressedValue.hpp"
+
+#include <algorithm>
+
+#include <geode/DataInput.hpp>
+#include <geode/DataOutput.hpp>
+
+#include "CacheImpl.hpp"
+#include "CacheableToken.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+namespace {
+// "GCZ" and the format version, followed by the hash of the compressed bytes
+const int8_t kMarker[] = {0x47, 0x43, 0x5a, 0x01};
+const size_t kMarkerLength = sizeof(kMarker);
+const size_t kHeaderLength = kMarkerLength + sizeof(int64_t);
+}  // namespace
+
+CompressedValue::CompressedValue(std::vector<int8_t> bytes,
+                                 std::shared_ptr<Compressor> compressor,
+                                 const CacheImpl* cache)
+    : m_bytes(std::move(bytes)),
+      m_compressor(std::move(compressor)),
+      m_cache(cache) {}
+
+std::shared_ptr<Cacheable> CompressedValue::create(
+    const std::shared_ptr<Cacheable>& value,
+    const std::shared_ptr<Compressor>& compressor, size_t threshold,
+    const CacheImpl* cache) {
+  if (compressor == nullptr || value == nullptr ||
+      CacheableToken::isToken(value) || isCompressed(value)) {
+    return value;
+  }
+
+  // a byte array that could pass for a compressed value is always wrapped
+  auto bytes = std::dynamic_pointer_cast<CacheableBytes>(value);
+  auto mustWrap = bytes != nullptr && hasMarker(bytes->value());
+
+  auto output = cache->createDataOutput();
+  output.writeObject(value);
+  if (output.getBufferLength() < threshold && !mustWrap) {
+    return value;
+  }
+  auto serialized = reinterpret_cast<const int8_t*>(output.getBuffer());
+  auto compressed = compressor->compress(std::vector<int8_t>(
+      serialized, serialized + output.getBufferLength()));
+  if (compressed.size() >= output.getBufferLength() && !mustWrap) {
+    return value;
+  }
+  auto result = std::make_shared<CompressedValue>(std::move(compressed),
+                                                  compressor, cache);
+  result->m_value = value;
+  return result;
+}
+
+std::shared_ptr<CompressedValue> CompressedValue::fromBytes(
+    const CacheableBytes& bytes, const std::shared_ptr<Compressor>& compressor,
+    const CacheImpl* cache) {
+  const auto& value = bytes.value();
+  if (compressor == nullptr || !hasMarker(value)) {
+    return nullptr;
+  }
+  uint64_t sentHash = 0;
+  for (auto i = kMarkerLength; i < kHeaderLength; i++) {
+    sentHash = (sentHash << 8) | static_cast<uint8_t>(value[i]);
+  }
+  if (static_cast<int64_t>(sentHash) !=
+      hash(value.begin() + kHeaderLength, value.end())) {
+    return nullptr;
+  }
+  return std::make_shared<CompressedValue>(
+      std::vector<int8_t>(value.begin() + kHeaderLength, value.end()),
+      compressor, cache);
+}
+
+std::shared_ptr<Cacheable> CompressedValue::decompress() const {
+  std::lock_guard<std::mutex> guard(m_mutex);
+  if (auto value = m_value.lock()) {
+    return value;
+  }
+  auto value = decompressCopy();
+  m_value = value;
+  return value;
+}
+
+bool CompressedValue::holds(const std::shared_ptr<Cacheable>& value) const {
+  std::lock_guard<std::mutex> guard(m_mutex);
+  return value != nullptr && m_value.lock() == value;
+}
+
+std::shared_ptr<Cacheable> CompressedValue::decompressCopy() const {
+  auto serialized = m_compressor->decompress(m_bytes);
+  auto input = m_cache->createDataInput(
+      reinterpret_cast<const uint8_t*>(serialized.data()), serialized.size());
+  std::shared_ptr<Cacheable> value;
+  input.readObject(value);
+  return value;
+}
+
+std::shared_ptr<CacheableBytes> CompressedValue::toBytes() const {
+  std::vector<int8_t> bytes(kMarker, kMarker + kMarkerLength);
+  auto hash = CompressedValue::hash(m_bytes.begin(), m_bytes.end());
+  for (auto shift = 56; shift >= 0; shift -= 8) {
+    bytes.push_back(static_cast<int8_t>(hash >> shift));
+  }
+  bytes.insert(bytes.end(), m_bytes.begin(), m_bytes.end());
+  return CacheableBytes::create(std::move(bytes));
+}
+
+bool CompressedValue::hasMarker(const std::vector<int8_t>& bytes) {
+  return bytes.size() >= kHeaderLength &&
+         std::equal(kMarker, kMarker + kMarkerLength, bytes.begin());
+}
+
+int64_t CompressedValue::hash(std::vector<int8_t>::const_iterator begin,
+                              std::vector<int8_t>::const_iterator end) {
+  // 64 bit FNV-1a
+  uint64_t hash = 14695981039346656037ULL;
+  for (auto i = begin; i != end; ++i) {
+    hash = (hash ^ static_cast<uint8_t>(*i)) * 1099511628211ULL;
+  }
+  return static_cast<int64_t>(hash);
+}
+
+size_t CompressedValue::objectSize() const {
+  return sizeof(CompressedValue) + m_bytes.capacity();
+}
+
+std::string CompressedValue::toString() const {
+  return "CompressedValue(" + std::to_string(m_bytes.size()) + " bytes)";
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
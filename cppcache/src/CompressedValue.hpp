@@ -0,0 +1,125 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_COMPRESSEDVALUE_H_
+#define GEODE_COMPRESSEDVALUE_H_
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+#include <geode/CacheableBuiltins.hpp>
+#include <geode/Compressor.hpp>
+#include <geode/Serializable.hpp>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+class CacheImpl;
+
+/**
+ * @class CompressedValue CompressedValue.hpp
+ *
+ * A value held in its compressed serialized form, for regions that have a
+ * Compressor. Map entries store values of this type in place of the value
+ * itself and decompress it when the value is read. Reads that overlap share
+ * one decompressed copy, which is not kept once no reader holds it; the
+ * value a compressed value was created from counts as that copy.
+ *
+ * On the wire a compressed value is a byte array starting with a four byte
+ * marker and a hash of the compressed bytes, which the server stores as it
+ * is. A byte array value that starts with the marker is always compressed,
+ * so no byte array sent by such a region is mistaken for a compressed value.
+ * Byte arrays written by other clients are only taken for compressed values
+ * when both the marker and the hash match.
+ */
+class CompressedValue : public Serializable {
+ public:
+  CompressedValue(std::vector<int8_t> bytes,
+                  std::shared_ptr<Compressor> compressor,
+                  const CacheImpl* cache);
+  ~CompressedValue() noexcept override = default;
+
+  /**
+   * Returns value compressed if it serializes to at least threshold bytes
+   * and compressing makes it smaller; otherwise returns value itself.
+   */
+  static std::shared_ptr<Cacheable> create(
+      const std::shared_ptr<Cacheable>& value,
+      const std::shared_ptr<Compressor>& compressor, size_t threshold,
+      const CacheImpl* cache);
+
+  /**
+   * Returns the value compressed by bytes' sender, or nullptr if bytes does
+   * not hold a compressed value.
+   */
+  static std::shared_ptr<CompressedValue> fromBytes(
+      const CacheableBytes& bytes,
+      const std::shared_ptr<Compressor>& compressor, const CacheImpl* cache);
+
+  static bool isCompressed(const std::shared_ptr<Cacheable>& value) {
+    return value != nullptr && typeid(*value) == typeid(CompressedValue);
+  }
+
+  /**
+   * Returns the value, shared with any other reader still holding it.
+   */
+  std::shared_ptr<Cacheable> decompress() const;
+
+  /**
+   * Returns true if value is the copy decompress would return, without
+   * decompressing.
+   */
+  bool holds(const std::shared_ptr<Cacheable>& value) const;
+
+  /**
+   * Returns a copy of the value that no other reader holds, for changing it.
+   */
+  std::shared_ptr<Cacheable> decompressCopy() const;
+
+  /**
+   * Returns the form sent to the server.
+   */
+  std::shared_ptr<CacheableBytes> toBytes() const;
+
+  size_t objectSize() const override;
+
+  std::string toString() const override;
+
+ private:
+  static bool hasMarker(const std::vector<int8_t>& bytes);
+
+  static int64_t hash(std::vector<int8_t>::const_iterator begin,
+                      std::vector<int8_t>::const_iterator end);
+
+  std::vector<int8_t> m_bytes;
+  std::shared_ptr<Compressor> m_compressor;
+  const CacheImpl* m_cache;
+  mutable std::mutex m_mutex;
+  mutable std::weak_ptr<Cacheable> m_value;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_COMPRESSEDVALUE_H_
@@ -176,6 +176,19 @@ void ConcurrentEntriesMap::getValues(
   }
 }
 
+void ConcurrentEntriesMap::forEachEntry(const EntryVisitor& visitor) const {
+  MapSegment::key_value_list entries;
+  for (int index = 0; index < m_concurrency; ++index) {
+    entries.clear();
+    m_segments[index].getKeyValues(entries);
+    for (const auto& entry : entries) {
+      if (!visitor(entry.first, entry.second)) {
+        return;
+      }
+    }
+  }
+}
+
 uint32_t ConcurrentEntriesMap::size() const { return m_size; }
 
 int ConcurrentEntriesMap::addTrackerForEntry(
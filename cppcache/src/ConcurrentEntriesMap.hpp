@@ -149,6 +149,8 @@ class APACHE_GEODE_EXPORT ConcurrentEntriesMap : public EntriesMap {
    */
   virtual void getValues(std::vector<std::shared_ptr<Cacheable>>& result) const;
 
+  void forEachEntry(const EntryVisitor& visitor) const override;
+
   /**
    * @brief return the number of entries in the map.
    */
@@ -21,6 +21,9 @@
 #define GEODE_CONNECTOR_H_
 
 #include <chrono>
+#include <functional>
+
+#include <boost/system/error_code.hpp>
 
 #include <geode/internal/geode_globals.hpp>
 
@@ -39,6 +42,13 @@ constexpr std::chrono::milliseconds DEFAULT_WRITE_TIMEOUT = DEFAULT_TIMEOUT;
 
 class Connector {
  public:
+  /**
+   * Called once an asynchronous send or receive has finished, with the error,
+   * if any, and the number of bytes transferred.
+   */
+  typedef std::function<void(const boost::system::error_code &, std::size_t)>
+      Completion;
+
   Connector() = default;
   virtual ~Connector() = default;
 
@@ -111,6 +121,28 @@ class Connector {
   virtual size_t send(const char *b, size_t len,
                       std::chrono::milliseconds timeout) = 0;
 
+  /**
+   * Starts reading exactly <code>len</code> bytes into <code>b</code> and
+   * returns immediately. <code>handler</code> is called once they have been
+   * read or the read failed. With a shared IoEngine the handler runs on a
+   * reactor thread; otherwise the read is carried out on the calling thread
+   * and the handler is called before this returns. The buffer must stay valid
+   * until the handler has been called.
+   */
+  virtual void asyncReceive(char *b, size_t len, Completion handler) = 0;
+
+  /**
+   * Starts writing <code>len</code> bytes from <code>b</code> and returns
+   * immediately. <code>handler</code> is called as for asyncReceive.
+   */
+  virtual void asyncSend(const char *b, size_t len, Completion handler) = 0;
+
+  /**
+   * Makes a send or receive in progress on another thread fail at once, as
+   * does every later one. The connection cannot be used afterwards.
+   */
+  virtual void cancel() = 0;
+
   /**
    * Returns local port for this TCP connection
    */
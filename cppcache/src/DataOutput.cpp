@@ -21,6 +21,7 @@
 
 #include "CacheImpl.hpp"
 #include "CacheRegionHelper.hpp"
+#include "DataOutputBufferPool.hpp"
 #include "SerializationRegistry.hpp"
 #include "util/JavaModifiedUtf8.hpp"
 #include "util/Log.hpp"
@@ -30,95 +31,39 @@ namespace apache {
 namespace geode {
 namespace client {
 
-static std::recursive_mutex globalBigBufferMutex;
-size_t DataOutput::m_highWaterMark = 50 * 1024 * 1024;
 size_t DataOutput::m_lowWaterMark = 8192;
 
-/** This represents a allocation in this thread local pool. */
-class BufferDesc {
- public:
-  uint8_t* m_buf;
-  size_t m_size;
-
-  BufferDesc(uint8_t* buf, size_t size) : m_buf(buf), m_size(size) {}
-
-  BufferDesc() : m_buf(nullptr), m_size(0) {}
-
-  ~BufferDesc() {}
-
-  BufferDesc& operator=(const BufferDesc& other) {
-    if (this != &other) {
-      m_buf = other.m_buf;
-      m_size = other.m_size;
-    }
-    return *this;
-  }
-
-  BufferDesc(const BufferDesc& other)
-      : m_buf(other.m_buf), m_size(other.m_size) {}
-};
-
-/** Thread local pool of buffers for DataOutput objects. */
-class TSSDataOutput {
- private:
-  std::vector<BufferDesc> m_buffers;
-
- public:
-  TSSDataOutput();
-  ~TSSDataOutput();
-
-  uint8_t* getBuffer(size_t* size) {
-    if (!m_buffers.empty()) {
-      BufferDesc desc = m_buffers.back();
-      m_buffers.pop_back();
-      *size = desc.m_size;
-      return desc.m_buf;
-    } else {
-      uint8_t* buf;
-      *size = 8192;
-      buf = static_cast<uint8_t*>(std::malloc(8192 * sizeof(uint8_t)));
-      if (buf == nullptr) {
-        throw OutOfMemoryException("Out of Memory while resizing buffer");
-      }
-      return buf;
-    }
-  }
-
-  void poolBuffer(uint8_t* buf, size_t size) {
-    BufferDesc desc(buf, size);
-    m_buffers.push_back(desc);
-  }
-
-  static thread_local TSSDataOutput threadLocalBufferPool;
-};
-
-TSSDataOutput::TSSDataOutput() : m_buffers() {
-  m_buffers.reserve(10);
-  LOGDEBUG("DATAOUTPUT poolsize is %zu", m_buffers.size());
+DataOutput::DataOutput(const CacheImpl* cache, Pool* pool)
+    : m_size(0), m_cache(cache), m_pool(pool) {
+  m_bytes.reset(DataOutput::checkoutBuffer(m_lowWaterMark, &m_size));
+  m_buf = m_bytes.get();
 }
 
-TSSDataOutput::~TSSDataOutput() {
-  while (!m_buffers.empty()) {
-    BufferDesc desc = m_buffers.back();
-    m_buffers.pop_back();
-    std::free(desc.m_buf);
-  }
+uint8_t* DataOutput::checkoutBuffer(size_t minSize, size_t* size) {
+  return DataOutputBufferPool::checkout(minSize, size);
 }
 
-thread_local TSSDataOutput TSSDataOutput::threadLocalBufferPool;
-
-DataOutput::DataOutput(const CacheImpl* cache, Pool* pool)
-    : m_size(0), m_haveBigBuffer(false), m_cache(cache), m_pool(pool) {
-  m_bytes.reset(DataOutput::checkoutBuffer(&m_size));
-  m_buf = m_bytes.get();
+void DataOutput::checkinBuffer(uint8_t* buffer, size_t size) {
+  DataOutputBufferPool::checkin(buffer, size);
 }
 
-uint8_t* DataOutput::checkoutBuffer(size_t* size) {
-  return TSSDataOutput::threadLocalBufferPool.getBuffer(size);
+void DataOutput::growBuffer(size_t minSize) {
+  const size_t offset = m_buf - m_bytes.get();
+  size_t newSize;
+  auto bytes = DataOutputBufferPool::grow(m_bytes.get(), m_size, offset,
+                                          minSize, &newSize);
+  m_bytes.release();
+  m_bytes.reset(bytes);
+  m_size = newSize;
+  m_buf = m_bytes.get() + offset;
 }
 
-void DataOutput::checkinBuffer(uint8_t* buffer, size_t size) {
-  TSSDataOutput::threadLocalBufferPool.poolBuffer(buffer, size);
+void DataOutput::shrinkBuffer() {
+  size_t newSize;
+  auto bytes = checkoutBuffer(m_lowWaterMark, &newSize);
+  checkinBuffer(m_bytes.release(), m_size);
+  m_bytes.reset(bytes);
+  m_size = newSize;
 }
 
 void DataOutput::writeObjectInternal(const std::shared_ptr<Serializable>& ptr,
@@ -126,10 +71,6 @@ void DataOutput::writeObjectInternal(const std::shared_ptr<Serializable>& ptr,
   getSerializationRegistry().serialize(ptr, *this, isDelta);
 }
 
-void DataOutput::acquireLock() { globalBigBufferMutex.lock(); }
-
-void DataOutput::releaseLock() { globalBigBufferMutex.unlock(); }
-
 const SerializationRegistry& DataOutput::getSerializationRegistry() const {
   return *m_cache->getSerializationRegistry();
 }
@@ -0,0 +1,183 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "DataOutputBufferPool.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include <geode/ExceptionTypes.hpp>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+constexpr size_t DataOutputBufferPool::MIN_BUFFER_SIZE;
+constexpr size_t DataOutputBufferPool::MAX_BUFFER_SIZE;
+
+namespace {
+
+constexpr size_t SIZE_CLASSES = 13;  // 4K, 8K, ... 16M
+constexpr size_t MAX_CACHED_PER_CLASS = 8;
+constexpr size_t MAX_CACHED_BYTES_PER_THREAD = 32 * 1024 * 1024;
+
+static_assert((DataOutputBufferPool::MIN_BUFFER_SIZE << (SIZE_CLASSES - 1)) ==
+                  DataOutputBufferPool::MAX_BUFFER_SIZE,
+              "size classes must span MIN_BUFFER_SIZE to MAX_BUFFER_SIZE");
+
+std::atomic<uint64_t> g_hits(0);
+std::atomic<uint64_t> g_misses(0);
+std::atomic<uint64_t> g_recycled(0);
+std::atomic<uint64_t> g_discarded(0);
+
+inline void increment(std::atomic<uint64_t>& counter) {
+  counter.fetch_add(1, std::memory_order_relaxed);
+}
+
+/** Returns the size class for a request, or SIZE_CLASSES if oversized. */
+inline size_t sizeClassOf(size_t size) {
+  size_t sizeClass = 0;
+  size_t capacity = DataOutputBufferPool::MIN_BUFFER_SIZE;
+  while (capacity < size && sizeClass < SIZE_CLASSES) {
+    capacity <<= 1;
+    ++sizeClass;
+  }
+  return sizeClass;
+}
+
+inline size_t capacityOf(size_t sizeClass) {
+  return DataOutputBufferPool::MIN_BUFFER_SIZE << sizeClass;
+}
+
+uint8_t* allocate(size_t size) {
+  auto buffer = static_cast<uint8_t*>(std::malloc(size * sizeof(uint8_t)));
+  if (buffer == nullptr) {
+    throw OutOfMemoryException("Out of Memory while allocating buffer");
+  }
+  return buffer;
+}
+
+/** Idle buffers owned by one thread. */
+class ThreadCache {
+ public:
+  ThreadCache() : m_cachedBytes(0) {}
+
+  ~ThreadCache() noexcept {
+    for (auto& buffers : m_buffers) {
+      for (auto buffer : buffers) {
+        std::free(buffer);
+      }
+    }
+  }
+
+  uint8_t* take(size_t sizeClass) {
+    auto& buffers = m_buffers[sizeClass];
+    if (buffers.empty()) {
+      return nullptr;
+    }
+    auto buffer = buffers.back();
+    buffers.pop_back();
+    m_cachedBytes -= capacityOf(sizeClass);
+    return buffer;
+  }
+
+  bool put(size_t sizeClass, uint8_t* buffer) {
+    auto& buffers = m_buffers[sizeClass];
+    const auto capacity = capacityOf(sizeClass);
+    if (buffers.size() >= MAX_CACHED_PER_CLASS ||
+        m_cachedBytes + capacity > MAX_CACHED_BYTES_PER_THREAD) {
+      return false;
+    }
+    buffers.push_back(buffer);
+    m_cachedBytes += capacity;
+    return true;
+  }
+
+  static thread_local ThreadCache threadCache;
+
+ private:
+  std::array<std::vector<uint8_t*>, SIZE_CLASSES> m_buffers;
+  size_t m_cachedBytes;
+};
+
+thread_local ThreadCache ThreadCache::threadCache;
+
+}  // namespace
+
+uint8_t* DataOutputBufferPool::checkout(size_t minSize, size_t* size) {
+  const auto sizeClass = sizeClassOf(minSize);
+  if (sizeClass >= SIZE_CLASSES) {
+    increment(g_misses);
+    *size = capacityFor(minSize);
+    return allocate(*size);
+  }
+
+  *size = capacityOf(sizeClass);
+  if (auto buffer = ThreadCache::threadCache.take(sizeClass)) {
+    increment(g_hits);
+    return buffer;
+  }
+  increment(g_misses);
+  return allocate(*size);
+}
+
+void DataOutputBufferPool::checkin(uint8_t* buffer, size_t size) {
+  if (buffer == nullptr) {
+    return;
+  }
+  const auto sizeClass = sizeClassOf(size);
+  if (sizeClass < SIZE_CLASSES && capacityOf(sizeClass) == size &&
+      ThreadCache::threadCache.put(sizeClass, buffer)) {
+    increment(g_recycled);
+    return;
+  }
+  increment(g_discarded);
+  std::free(buffer);
+}
+
+uint8_t* DataOutputBufferPool::grow(uint8_t* buffer, size_t size, size_t used,
+                                    size_t minSize, size_t* newSize) {
+  auto grown = checkout(minSize, newSize);
+  std::memcpy(grown, buffer, used);
+  checkin(buffer, size);
+  return grown;
+}
+
+size_t DataOutputBufferPool::capacityFor(size_t minSize) {
+  const auto sizeClass = sizeClassOf(minSize);
+  if (sizeClass < SIZE_CLASSES) {
+    return capacityOf(sizeClass);
+  }
+  // oversized buffers are only rounded up to a whole number of pages
+  return (minSize + MIN_BUFFER_SIZE - 1) & ~(MIN_BUFFER_SIZE - 1);
+}
+
+DataOutputBufferPool::Statistics DataOutputBufferPool::getStatistics() {
+  Statistics statistics;
+  statistics.hits = g_hits.load(std::memory_order_relaxed);
+  statistics.misses = g_misses.load(std::memory_order_relaxed);
+  statistics.recycled = g_recycled.load(std::memory_order_relaxed);
+  statistics.discarded = g_discarded.load(std::memory_order_relaxed);
+  return statistics;
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
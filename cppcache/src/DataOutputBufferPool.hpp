@@ -0,0 +1,92 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_DATAOUTPUTBUFFERPOOL_H_
+#define GEODE_DATAOUTPUTBUFFERPOOL_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include <geode/internal/geode_globals.hpp>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * Size classed pool of serialization buffers used by DataOutput.
+ *
+ * Buffer sizes are rounded up to a power of two between MIN_BUFFER_SIZE and
+ * MAX_BUFFER_SIZE. Idle buffers are cached per thread, per size class, so
+ * checking a buffer in or out never takes a lock. Buffers larger than
+ * MAX_BUFFER_SIZE are allocated and freed directly.
+ */
+class APACHE_GEODE_EXPORT DataOutputBufferPool {
+ public:
+  static constexpr size_t MIN_BUFFER_SIZE = 4 * 1024;
+  static constexpr size_t MAX_BUFFER_SIZE = 16 * 1024 * 1024;
+
+  /** Counters describing how well the pool is serving requests. */
+  struct Statistics {
+    /** Checkouts served from a thread cache. */
+    uint64_t hits;
+    /** Checkouts that had to allocate. */
+    uint64_t misses;
+    /** Buffers returned to a thread cache. */
+    uint64_t recycled;
+    /** Buffers freed because they were oversized or the cache was full. */
+    uint64_t discarded;
+  };
+
+  DataOutputBufferPool() = delete;
+
+  /**
+   * Returns a buffer of at least <code>minSize</code> bytes, storing its
+   * actual capacity in <code>size</code>.
+   *
+   * @throws OutOfMemoryException if the buffer could not be allocated
+   */
+  static uint8_t* checkout(size_t minSize, size_t* size);
+
+  /**
+   * Returns a buffer obtained from {@link checkout} to the calling thread's
+   * cache, or frees it if the cache for its size class is full.
+   */
+  static void checkin(uint8_t* buffer, size_t size);
+
+  /**
+   * Returns a buffer of at least <code>minSize</code> bytes holding the
+   * first <code>used</code> bytes of <code>buffer</code>, which is checked
+   * back in.
+   */
+  static uint8_t* grow(uint8_t* buffer, size_t size, size_t used,
+                       size_t minSize, size_t* newSize);
+
+  /** Capacity of the buffer that would be handed out for a request. */
+  static size_t capacityFor(size_t minSize);
+
+  /** Process wide totals across all threads. */
+  static Statistics getStatistics();
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_DATAOUTPUTBUFFERPOOL_H_
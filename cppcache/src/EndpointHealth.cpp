@@ -0,0 +1,166 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "EndpointHealth.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+namespace {
+
+// consecutive failures that open the circuit
+constexpr uint32_t DEFAULT_FAILURE_THRESHOLD = 5;
+// error rate that opens the circuit, once MIN_SAMPLES requests were seen
+constexpr double DEFAULT_ERROR_RATE_THRESHOLD = 0.5;
+constexpr uint32_t MIN_SAMPLES = 20;
+// how long an open circuit keeps requests away before a trial request
+constexpr std::chrono::seconds DEFAULT_OPEN_INTERVAL{10};
+// weight of the newest sample in the moving averages
+constexpr double ERROR_RATE_WEIGHT = 0.1;
+constexpr double LATENCY_WEIGHT = 0.2;
+// how much a server's cost grows with its error rate
+constexpr double ERROR_RATE_PENALTY = 4.0;
+
+}  // namespace
+
+EndpointHealth::EndpointHealth()
+    : EndpointHealth(DEFAULT_FAILURE_THRESHOLD, DEFAULT_ERROR_RATE_THRESHOLD,
+                     DEFAULT_OPEN_INTERVAL) {}
+
+EndpointHealth::EndpointHealth(uint32_t failureThreshold,
+                               double errorRateThreshold,
+                               std::chrono::milliseconds openInterval)
+    : m_failureThreshold(failureThreshold),
+      m_errorRateThreshold(errorRateThreshold),
+      m_openInterval(openInterval),
+      m_open(false),
+      m_consecutiveFailures(0),
+      m_samples(0),
+      m_errorRate(0.0),
+      m_latency(0.0) {}
+
+bool EndpointHealth::recordSuccess(clock::time_point now) {
+  std::lock_guard<decltype(m_mutex)> guard(m_mutex);
+  if (m_samples < MIN_SAMPLES) {
+    ++m_samples;
+  }
+  m_errorRate -= ERROR_RATE_WEIGHT * m_errorRate;
+  m_consecutiveFailures = 0;
+
+  // replies to requests sent before the circuit opened leave it open
+  if (getStateLocked(now) == State::HALF_OPEN) {
+    m_open = false;
+    return true;
+  }
+  return false;
+}
+
+bool EndpointHealth::recordFailure(clock::time_point now) {
+  std::lock_guard<decltype(m_mutex)> guard(m_mutex);
+  if (m_samples < MIN_SAMPLES) {
+    ++m_samples;
+  }
+  m_errorRate += ERROR_RATE_WEIGHT * (1.0 - m_errorRate);
+  ++m_consecutiveFailures;
+
+  switch (getStateLocked(now)) {
+    case State::CLOSED:
+      if (m_consecutiveFailures >= m_failureThreshold ||
+          (m_samples >= MIN_SAMPLES && m_errorRate >= m_errorRateThreshold)) {
+        open(now);
+        return true;
+      }
+      return false;
+    case State::HALF_OPEN:
+      open(now);
+      return true;
+    case State::OPEN:
+      break;
+  }
+  return false;
+}
+
+void EndpointHealth::recordLatency(std::chrono::microseconds latency) {
+  auto micros = static_cast<double>(latency.count());
+
+  std::lock_guard<decltype(m_mutex)> guard(m_mutex);
+  if (m_latency == 0.0) {
+    m_latency = micros;
+  } else {
+    m_latency += LATENCY_WEIGHT * (micros - m_latency);
+  }
+}
+
+bool EndpointHealth::allowRequest(clock::time_point now) {
+  if (!m_open) {
+    return true;
+  }
+
+  std::lock_guard<decltype(m_mutex)> guard(m_mutex);
+  auto state = getStateLocked(now);
+  if (state == State::CLOSED) {
+    return true;
+  } else if (state == State::OPEN || now < m_trialUntil) {
+    return false;
+  }
+  m_trialUntil = now + m_openInterval;
+  return true;
+}
+
+EndpointHealth::State EndpointHealth::getState(clock::time_point now) {
+  if (!m_open) {
+    return State::CLOSED;
+  }
+
+  std::lock_guard<decltype(m_mutex)> guard(m_mutex);
+  return getStateLocked(now);
+}
+
+double EndpointHealth::getErrorRate() {
+  std::lock_guard<decltype(m_mutex)> guard(m_mutex);
+  return m_errorRate;
+}
+
+std::chrono::microseconds EndpointHealth::getLatency() {
+  std::lock_guard<decltype(m_mutex)> guard(m_mutex);
+  return std::chrono::microseconds(static_cast<int64_t>(m_latency));
+}
+
+double EndpointHealth::getScore() {
+  std::lock_guard<decltype(m_mutex)> guard(m_mutex);
+  return m_latency * (1.0 + ERROR_RATE_PENALTY * m_errorRate);
+}
+
+EndpointHealth::State EndpointHealth::getStateLocked(
+    clock::time_point now) const {
+  if (!m_open) {
+    return State::CLOSED;
+  }
+  return now < m_openUntil ? State::OPEN : State::HALF_OPEN;
+}
+
+void EndpointHealth::open(clock::time_point now) {
+  m_open = true;
+  m_openUntil = now + m_openInterval;
+  m_trialUntil = m_openUntil;
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
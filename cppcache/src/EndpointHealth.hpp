@@ -0,0 +1,112 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#ifndef GEODE_ENDPOINTHEALTH_H_
+#define GEODE_ENDPOINTHEALTH_H_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * @class EndpointHealth EndpointHealth.hpp
+ *
+ * Health of one server as seen by a pool: moving averages of its error rate
+ * and reply latency, and a circuit breaker. The circuit opens after a run of
+ * failures or when the error rate gets too high, and requests then avoid the
+ * server. Once the open interval has passed the circuit is half-open and
+ * lets one trial request through per interval; a success closes it again and
+ * a failure reopens it.
+ */
+class EndpointHealth {
+ public:
+  enum class State { CLOSED, OPEN, HALF_OPEN };
+
+  using clock = std::chrono::steady_clock;
+
+  EndpointHealth();
+
+  EndpointHealth(uint32_t failureThreshold, double errorRateThreshold,
+                 std::chrono::milliseconds openInterval);
+
+  EndpointHealth(const EndpointHealth&) = delete;
+  EndpointHealth& operator=(const EndpointHealth&) = delete;
+
+  /**
+   * Records a request the server answered. Only closes a half-open circuit.
+   * @return true if this closed the circuit
+   */
+  bool recordSuccess(clock::time_point now = clock::now());
+
+  /**
+   * Records a request that failed or timed out on the server.
+   * @return true if this opened the circuit
+   */
+  bool recordFailure(clock::time_point now = clock::now());
+
+  /** Records how long the server took to answer, or to time out. */
+  void recordLatency(std::chrono::microseconds latency);
+
+  /**
+   * Returns true if a request may be sent to the server. While the circuit
+   * is half-open this lets one trial request through per open interval.
+   */
+  bool allowRequest(clock::time_point now = clock::now());
+
+  State getState(clock::time_point now = clock::now());
+
+  double getErrorRate();
+
+  std::chrono::microseconds getLatency();
+
+  /**
+   * Returns a cost for sending a request to the server; lower is better.
+   * Grows with the average latency and the error rate.
+   */
+  double getScore();
+
+ private:
+  State getStateLocked(clock::time_point now) const;
+  void open(clock::time_point now);
+
+  const uint32_t m_failureThreshold;
+  const double m_errorRateThreshold;
+  const clock::duration m_openInterval;
+
+  std::mutex m_mutex;
+  std::atomic<bool> m_open;
+  clock::time_point m_openUntil;
+  clock::time_point m_trialUntil;
+  uint32_t m_consecutiveFailures;
+  uint32_t m_samples;
+  double m_errorRate;
+  double m_latency;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_ENDPOINTHEALTH_H_
@@ -22,6 +22,7 @@
 
 // This needs to be ace free so that the region can include it.
 
+#include <functional>
 #include <memory>
 
 #include <geode/CacheableKey.hpp>
@@ -126,6 +127,17 @@ class APACHE_GEODE_EXPORT EntriesMap {
   virtual void getValues(
       std::vector<std::shared_ptr<Cacheable>>& result) const = 0;
 
+  typedef std::function<bool(const std::shared_ptr<CacheableKey>&,
+                             const std::shared_ptr<Cacheable>&)>
+      EntryVisitor;
+
+  /**
+   * @brief call visitor with each key and its value, nullptr for an invalid
+   * entry, until it returns false. Entries are copied out one segment at a
+   * time and visited without the segment locked.
+   */
+  virtual void forEachEntry(const EntryVisitor& visitor) const = 0;
+
   /** @brief return the number of entries in the map. */
   virtual uint32_t size() const = 0;
 
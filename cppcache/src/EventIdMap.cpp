@@ -17,10 +17,36 @@
 
 #include "EventIdMap.hpp"
 
+#include <cstring>
+
 namespace apache {
 namespace geode {
 namespace client {
 
+constexpr size_t EventIdMap::SHARDS;
+
+EventIdMap::SourceRef::SourceRef(const char* memId, int32_t memIdLen,
+                                 int64_t thrId)
+    : memId(memId), memIdLen(memIdLen > 0 ? memIdLen : 0), thrId(thrId) {
+  // FNV-1a over the member id and thread id
+  uint64_t value = 14695981039346656037ULL;
+  for (int32_t i = 0; i < this->memIdLen; i++) {
+    value ^= static_cast<uint8_t>(memId[i]);
+    value *= 1099511628211ULL;
+  }
+  for (size_t i = 0; i < sizeof(thrId); i++) {
+    value ^= static_cast<uint8_t>(static_cast<uint64_t>(thrId) >> (8 * i));
+    value *= 1099511628211ULL;
+  }
+  hash = static_cast<size_t>(value);
+}
+
+bool EventIdMap::SourceRef::EqualTo::operator()(const SourceRef& lhs,
+                                                const SourceRef& rhs) const {
+  return lhs.thrId == rhs.thrId && lhs.memIdLen == rhs.memIdLen &&
+         memcmp(lhs.memId, rhs.memId, lhs.memIdLen) == 0;
+}
+
 EventIdMap::~EventIdMap() { clear(); }
 
 void EventIdMap::init(std::chrono::milliseconds expirySecs) {
@@ -28,9 +54,20 @@ void EventIdMap::init(std::chrono::milliseconds expirySecs) {
 }
 
 void EventIdMap::clear() {
-  std::lock_guard<decltype(m_lock)> guard(m_lock);
+  for (auto& shard : m_shards) {
+    std::lock_guard<decltype(shard.lock)> guard(shard.lock);
 
-  m_map.clear();
+    shard.map.clear();
+  }
+}
+
+EventIdMap::SourceRef EventIdMap::refOf(EventSource& source) {
+  return SourceRef(source.getMemId(), source.getMemIdLen(), source.getThrId());
+}
+
+EventIdMap::Shard& EventIdMap::shardOf(const SourceRef& ref) {
+  // the low bits pick the bucket inside the shard's map
+  return m_shards[(ref.hash >> 16) % SHARDS];
 }
 
 EventIdMapEntry EventIdMap::make(std::shared_ptr<EventId> eventid) {
@@ -42,10 +79,12 @@ EventIdMapEntry EventIdMap::make(std::shared_ptr<EventId> eventid) {
 
 bool EventIdMap::isDuplicate(std::shared_ptr<EventSource> key,
                              std::shared_ptr<EventSequence> value) {
-  std::lock_guard<decltype(m_lock)> guard(m_lock);
+  const auto ref = refOf(*key);
+  auto& shard = shardOf(ref);
+  std::lock_guard<decltype(shard.lock)> guard(shard.lock);
 
-  const auto& entry = m_map.find(key);
-  if (entry != m_map.end() && ((*value) <= (*(entry->second)))) {
+  const auto& entry = shard.map.find(ref);
+  if (entry != shard.map.end() && ((*value) <= entry->second.sequence)) {
     return true;
   }
   return false;
@@ -53,30 +92,48 @@ bool EventIdMap::isDuplicate(std::shared_ptr<EventSource> key,
 
 bool EventIdMap::put(std::shared_ptr<EventSource> key,
                      std::shared_ptr<EventSequence> value, bool onlynew) {
-  std::lock_guard<decltype(m_lock)> guard(m_lock);
+  return put(refOf(*key), key, *value, onlynew);
+}
 
-  value->touch(m_expiry);
+bool EventIdMap::put(const EventId& eventId, bool onlynew) {
+  return put(SourceRef(eventId.getMemId(), eventId.getMemIdLen(),
+                       eventId.getThrId()),
+             nullptr, EventSequence(eventId.getSeqNum()), onlynew);
+}
 
-  const auto& entry = m_map.find(key);
-  if (entry != m_map.end()) {
-    if (onlynew && ((*value) <= (*(entry->second)))) {
+bool EventIdMap::put(const SourceRef& ref, std::shared_ptr<EventSource> source,
+                     const EventSequence& value, bool onlynew) {
+  auto& shard = shardOf(ref);
+  std::lock_guard<decltype(shard.lock)> guard(shard.lock);
+
+  const auto& entry = shard.map.find(ref);
+  if (entry != shard.map.end()) {
+    if (onlynew && (value <= entry->second.sequence)) {
       return false;
-    } else {
-      m_map[key] = value;
-      return true;
     }
-  } else {
-    m_map[key] = value;
+    entry->second.sequence = value;
+    entry->second.sequence.touch(m_expiry);
     return true;
   }
+
+  // first event from this source; the stored key points into the source
+  if (!source) {
+    source = std::make_shared<EventSource>(ref.memId, ref.memIdLen, ref.thrId);
+  }
+  Entry added{source, value};
+  added.sequence.touch(m_expiry);
+  shard.map.emplace(refOf(*source), std::move(added));
+  return true;
 }
 
 bool EventIdMap::touch(std::shared_ptr<EventSource> key) {
-  std::lock_guard<decltype(m_lock)> guard(m_lock);
+  const auto ref = refOf(*key);
+  auto& shard = shardOf(ref);
+  std::lock_guard<decltype(shard.lock)> guard(shard.lock);
 
-  const auto& entry = m_map.find(key);
-  if (entry != m_map.end()) {
-    entry->second->touch(m_expiry);
+  const auto& entry = shard.map.find(ref);
+  if (entry != shard.map.end()) {
+    entry->second.sequence.touch(m_expiry);
     return true;
   } else {
     return false;
@@ -84,46 +141,46 @@ bool EventIdMap::touch(std::shared_ptr<EventSource> key) {
 }
 
 bool EventIdMap::remove(std::shared_ptr<EventSource> key) {
-  std::lock_guard<decltype(m_lock)> guard(m_lock);
+  const auto ref = refOf(*key);
+  auto& shard = shardOf(ref);
+  std::lock_guard<decltype(shard.lock)> guard(shard.lock);
 
-  const auto& entry = m_map.find(key);
-
-  if (entry != m_map.end()) {
-    m_map.erase(key);
-    return true;
-  } else {
-    return false;
-  }
+  return shard.map.erase(ref) > 0;
 }
 
 // side-effect: sets acked flags to true
 EventIdMapEntryList EventIdMap::getUnAcked() {
-  std::lock_guard<decltype(m_lock)> guard(m_lock);
-
   EventIdMapEntryList entries;
 
-  for (const auto& entry : m_map) {
-    if (entry.second->getAcked()) {
-      continue;
-    }
+  for (auto& shard : m_shards) {
+    std::lock_guard<decltype(shard.lock)> guard(shard.lock);
 
-    entry.second->setAcked(true);
-    entries.push_back(std::make_pair(entry.first, entry.second));
+    for (auto& entry : shard.map) {
+      if (entry.second.sequence.getAcked()) {
+        continue;
+      }
+
+      entry.second.sequence.setAcked(true);
+      entries.push_back(std::make_pair(
+          entry.second.source,
+          std::make_shared<EventSequence>(entry.second.sequence)));
+    }
   }
 
   return entries;
 }
 
 uint32_t EventIdMap::clearAckedFlags(EventIdMapEntryList& entries) {
-  std::lock_guard<decltype(m_lock)> guard(m_lock);
-
   uint32_t cleared = 0;
 
   for (const auto& item : entries) {
-    const auto& entry = m_map.find((item).first);
+    const auto ref = refOf(*item.first);
+    auto& shard = shardOf(ref);
+    std::lock_guard<decltype(shard.lock)> guard(shard.lock);
 
-    if (entry != m_map.end()) {
-      entry->second->setAcked(false);
+    const auto& entry = shard.map.find(ref);
+    if (entry != shard.map.end()) {
+      entry->second.sequence.setAcked(false);
       cleared++;
     }
   }
@@ -132,25 +189,22 @@ uint32_t EventIdMap::clearAckedFlags(EventIdMapEntryList& entries) {
 }
 
 uint32_t EventIdMap::expire(bool onlyacked) {
-  std::lock_guard<decltype(m_lock)> guard(m_lock);
-
   uint32_t expired = 0;
-
-  EventIdMapEntryList entries;
-
-  for (const auto& entry : m_map) {
-    if (onlyacked && !entry.second->getAcked()) {
-      continue;
+  const auto now = EventSequence::clock::now();
+
+  for (auto& shard : m_shards) {
+    std::lock_guard<decltype(shard.lock)> guard(shard.lock);
+
+    for (auto entry = shard.map.begin(); entry != shard.map.end();) {
+      auto& sequence = entry->second.sequence;
+      if ((!onlyacked || sequence.getAcked()) &&
+          sequence.getDeadline() < now) {
+        entry = shard.map.erase(entry);
+        expired++;
+      } else {
+        ++entry;
+      }
     }
-
-    if (entry.second->getDeadline() < EventSequence::clock::now()) {
-      entries.push_back(std::make_pair(entry.first, entry.second));
-    }
-  }
-
-  for (auto&& expiry : entries) {
-    m_map.erase(expiry.first);
-    expired++;
   }
 
   return expired;
@@ -20,6 +20,7 @@
 #ifndef GEODE_EVENTIDMAP_H_
 #define GEODE_EVENTIDMAP_H_
 
+#include <array>
 #include <chrono>
 #include <functional>
 #include <memory>
@@ -44,28 +45,109 @@ typedef std::pair<std::shared_ptr<EventSource>, std::shared_ptr<EventSequence>>
     EventIdMapEntry;
 typedef std::vector<EventIdMapEntry> EventIdMapEntryList;
 
+/** @class EventSequence
+ *
+ * EventSequence is the combination of SequenceNum from EventId, a timestamp and
+ * a flag indicating whether or not it is ACKed
+ */
+class APACHE_GEODE_EXPORT EventSequence {
+ public:
+  using clock = std::chrono::steady_clock;
+  using time_point = clock::time_point;
+
+ private:
+  int64_t m_seqNum;
+  bool m_acked;
+  time_point m_deadline;  // current time plus the expiration delay (age)
+
+  void init();
+
+ public:
+  void clear();
+
+  EventSequence();
+  explicit EventSequence(int64_t seqNum);
+  ~EventSequence();
+
+  // update deadline
+  void touch(std::chrono::milliseconds ageSecs);
+  // update deadline, clear acked flag and set seqNum
+  void touch(int64_t seqNum, std::chrono::milliseconds ageSecs);
+
+  // Accessors:
+
+  int64_t getSeqNum();
+  void setSeqNum(int64_t seqNum);
+
+  bool getAcked();
+  void setAcked(bool acked);
+
+  time_point getDeadline();
+  void setDeadline(time_point deadline);
+
+  bool operator<=(const EventSequence &rhs) const;
+};
 /** @class EventIdMap EventIdMap.hpp
  *
  * This is the class that encapsulates a HashMap and
  * provides the operations for duplicate checking and
  * expiry of idle event IDs from notifications.
+ *
+ * The map is split into shards by event source, each with its own lock, so
+ * subscription events from different sources do not contend.
  */
 class APACHE_GEODE_EXPORT EventIdMap {
  private:
-  typedef std::unordered_map<std::shared_ptr<EventSource>,
-                             std::shared_ptr<EventSequence>,
-                             dereference_hash<std::shared_ptr<EventSource>>,
-                             dereference_equal_to<std::shared_ptr<EventSource>>>
+  /**
+   * Identifies an event source by pointing at its member id and thread id.
+   * Lookups point into the EventId itself so checking an event allocates
+   * nothing; stored keys point into the entry's EventSource.
+   */
+  struct SourceRef {
+    SourceRef(const char *memId, int32_t memIdLen, int64_t thrId);
+
+    const char *memId;
+    int32_t memIdLen;
+    int64_t thrId;
+    size_t hash;
+
+    struct Hash {
+      size_t operator()(const SourceRef &ref) const { return ref.hash; }
+    };
+
+    struct EqualTo {
+      bool operator()(const SourceRef &lhs, const SourceRef &rhs) const;
+    };
+  };
+
+  struct Entry {
+    std::shared_ptr<EventSource> source;
+    EventSequence sequence;
+  };
+
+  typedef std::unordered_map<SourceRef, Entry, SourceRef::Hash,
+                             SourceRef::EqualTo>
       map_type;
 
+  struct Shard {
+    std::mutex lock;
+    map_type map;
+  };
+
+  static constexpr size_t SHARDS = 16;
+
   std::chrono::milliseconds m_expiry;
-  map_type m_map;
-  std::recursive_mutex m_lock;
+  std::array<Shard, SHARDS> m_shards;
 
   // hidden
   EventIdMap(const EventIdMap &);
   EventIdMap &operator=(const EventIdMap &);
 
+  static SourceRef refOf(EventSource &source);
+  Shard &shardOf(const SourceRef &ref);
+  bool put(const SourceRef &ref, std::shared_ptr<EventSource> source,
+           const EventSequence &value, bool onlynew);
+
  public:
   EventIdMap() : m_expiry(0) {}
 
@@ -93,6 +175,13 @@ class APACHE_GEODE_EXPORT EventIdMap {
   bool put(std::shared_ptr<EventSource> key,
            std::shared_ptr<EventSequence> value, bool onlynew = false);
 
+  /** Put the sequence number of an event under its source. Only allocates
+   * when the source has not been seen before.
+   * @param onlynew Only put if the sequence id does not exist or is higher
+   * @return true if the entry was updated or inserted otherwise false
+   */
+  bool put(const EventId &eventId, bool onlynew = false);
+
   /** Update the deadline for the entry
    * @return true if the entry exists else false
    */
@@ -104,7 +193,8 @@ class APACHE_GEODE_EXPORT EventIdMap {
   bool remove(std::shared_ptr<EventSource> key);
 
   /** Collect all map entries who acked flag is false and set their acked flags
-   * to true */
+   * to true. The sequences returned are copies taken at the time of the call.
+   */
   EventIdMapEntryList getUnAcked();
 
   /** Clear all acked flags in the list and return the number of entries cleared
@@ -122,48 +212,6 @@ class APACHE_GEODE_EXPORT EventIdMap {
   uint32_t expire(bool onlyacked);
 };
 
-/** @class EventSequence
- *
- * EventSequence is the combination of SequenceNum from EventId, a timestamp and
- * a flag indicating whether or not it is ACKed
- */
-class APACHE_GEODE_EXPORT EventSequence {
- public:
-  using clock = std::chrono::steady_clock;
-  using time_point = clock::time_point;
-
- private:
-  int64_t m_seqNum;
-  bool m_acked;
-  time_point m_deadline;  // current time plus the expiration delay (age)
-
-  void init();
-
- public:
-  void clear();
-
-  EventSequence();
-  explicit EventSequence(int64_t seqNum);
-  ~EventSequence();
-
-  // update deadline
-  void touch(std::chrono::milliseconds ageSecs);
-  // update deadline, clear acked flag and set seqNum
-  void touch(int64_t seqNum, std::chrono::milliseconds ageSecs);
-
-  // Accessors:
-
-  int64_t getSeqNum();
-  void setSeqNum(int64_t seqNum);
-
-  bool getAcked();
-  void setAcked(bool acked);
-
-  time_point getDeadline();
-  void setDeadline(time_point deadline);
-
-  bool operator<=(const EventSequence &rhs) const;
-};
 }  // namespace client
 }  // namespace geode
 }  // namespace apache
@@ -21,6 +21,7 @@
 
 #include <geode/DefaultResultCollector.hpp>
 #include <geode/ExceptionTypes.hpp>
+#include <geode/StreamingResultCollector.hpp>
 #include <geode/internal/geode_globals.hpp>
 
 #include "NoResult.hpp"
@@ -95,6 +96,26 @@ std::shared_ptr<ResultCollector> ExecutionImpl::execute(
 
 std::shared_ptr<ResultCollector> ExecutionImpl::execute(
     const std::string& func, std::chrono::milliseconds timeout) {
+  auto streaming = std::dynamic_pointer_cast<StreamingResultCollector>(m_rc);
+  if (streaming == nullptr) {
+    return executeFunction(func, timeout);
+  }
+
+  // a streaming consumer waits on the collector rather than on this call, so
+  // make sure it always learns how the execution ended
+  streaming->setTimeout(timeout);
+  try {
+    auto rc = executeFunction(func, timeout);
+    streaming->endResults();
+    return rc;
+  } catch (...) {
+    streaming->setException(std::current_exception());
+    throw;
+  }
+}
+
+std::shared_ptr<ResultCollector> ExecutionImpl::executeFunction(
+    const std::string& func, std::chrono::milliseconds timeout) {
   LOGDEBUG("ExecutionImpl::execute: ");
   GuardUserAttributes gua;
   if (m_authenticatedView != nullptr) {
@@ -16,6 +16,8 @@
  */
 #include "ExpiryTaskManager.hpp"
 
+#include <geode/ExceptionTypes.hpp>
+
 #include "DistributedSystem.hpp"
 #include "DistributedSystemImpl.hpp"
 #include "config.h"
@@ -51,11 +53,17 @@ ExpiryTaskManager::ExpiryTaskManager() : m_reactorEventLoopRunning(false) {
 }
 
 int ExpiryTaskManager::resetTask(ExpiryTaskManager::id_type id, uint32_t sec) {
+  if (m_timingWheel) {
+    return m_timingWheel->reset(id, std::chrono::seconds(sec));
+  }
   ACE_Time_Value interval(sec);
   return m_reactor->reset_timer_interval(id, interval);
 }
 
 int ExpiryTaskManager::cancelTask(ExpiryTaskManager::id_type id) {
+  if (m_timingWheel) {
+    return m_timingWheel->cancel(id);
+  }
   return m_reactor->cancel_timer(id, nullptr, 0);
 }
 
@@ -67,8 +75,12 @@ int ExpiryTaskManager::svc() {
     m_reactorEventLoopRunning = true;
     m_condition.notify_all();
   }
-  m_reactor->owner(ACE_OS::thr_self());
-  m_reactor->run_reactor_event_loop();
+  if (m_timingWheel) {
+    m_timingWheel->run();
+  } else {
+    m_reactor->owner(ACE_OS::thr_self());
+    m_reactor->run_reactor_event_loop();
+  }
   LOGFINE("ExpiryTaskManager thread has stopped.");
   return 0;
 }
@@ -77,7 +89,11 @@ void ExpiryTaskManager::stopExpiryTaskManager() {
   std::unique_lock<std::mutex> lock(m_mutex);
 
   if (m_reactorEventLoopRunning) {
-    m_reactor->end_reactor_event_loop();
+    if (m_timingWheel) {
+      m_timingWheel->stop();
+    } else {
+      m_reactor->end_reactor_event_loop();
+    }
     this->wait();
     m_reactorEventLoopRunning = false;
     m_condition.notify_all();
@@ -90,6 +106,19 @@ void ExpiryTaskManager::begin() {
   m_condition.wait(lock, [this] { return m_reactorEventLoopRunning; });
 }
 
+void ExpiryTaskManager::enableTimingWheel(std::chrono::milliseconds tick) {
+  using ::apache::geode::internal::chrono::duration::to_string;
+
+  std::unique_lock<std::mutex> lock(m_mutex);
+  if (m_reactorEventLoopRunning) {
+    throw IllegalStateException(
+        "ExpiryTaskManager: timing wheel must be enabled before begin()");
+  }
+  m_timingWheel = std::unique_ptr<TimingWheel>(new TimingWheel(tick));
+  LOGFINE("ExpiryTaskManager using timing wheel with %s ticks",
+          to_string(tick).c_str());
+}
+
 ExpiryTaskManager::~ExpiryTaskManager() {
   stopExpiryTaskManager();
 
@@ -34,6 +34,7 @@
 #include <geode/internal/geode_globals.hpp>
 
 #include "ReadWriteLock.hpp"
+#include "TimingWheel.hpp"
 #include "util/Log.hpp"
 
 namespace apache {
@@ -45,6 +46,11 @@ namespace client {
  *
  * This class starts a reactor's event loop for taking care of expiry
  * tasks. The scheduling of event also happens through this manager.
+ *
+ * When enableTimingWheel() is called before begin(), tasks are kept in a
+ * TimingWheel driven by the manager's thread instead of the reactor's timer
+ * heap. This trades exact deadlines for constant time scheduling, which
+ * matters when many entries with expiration are created and destroyed.
  */
 class APACHE_GEODE_EXPORT ExpiryTaskManager : public ACE_Task_Base {
  public:
@@ -247,6 +253,16 @@ class APACHE_GEODE_EXPORT ExpiryTaskManager : public ACE_Task_Base {
         "ExpiryTaskManager: expTime %s, interval %s, cancelExistingTask %d",
         to_string(expTime).c_str(), to_string(interval).c_str(),
         cancelExistingTask);
+    if (m_timingWheel) {
+      if (cancelExistingTask) {
+        m_timingWheel->cancel(handler, true);
+      }
+      return m_timingWheel->schedule(
+          handler,
+          std::chrono::duration_cast<TimingWheel::clock::duration>(expTime),
+          std::chrono::duration_cast<TimingWheel::clock::duration>(interval));
+    }
+
     if (cancelExistingTask) {
       m_reactor->cancel_timer(handler, 1);
     }
@@ -269,6 +285,11 @@ class APACHE_GEODE_EXPORT ExpiryTaskManager : public ACE_Task_Base {
 
   template <class Rep, class Period>
   int resetTask(id_type id, std::chrono::duration<Rep, Period> duration) {
+    if (m_timingWheel) {
+      return m_timingWheel->reset(
+          id,
+          std::chrono::duration_cast<TimingWheel::clock::duration>(duration));
+    }
     ACE_Time_Value interval(duration);
     return m_reactor->reset_timer_interval(id, interval);
   }
@@ -295,6 +316,12 @@ class APACHE_GEODE_EXPORT ExpiryTaskManager : public ACE_Task_Base {
   /** activate the thread and wait for it to be running. */
   void begin();
 
+  /**
+   * Schedule tasks on a timing wheel advancing every tick instead of the
+   * reactor's timer heap. Must be called before begin().
+   */
+  void enableTimingWheel(std::chrono::milliseconds tick);
+
  private:
   ACE_Reactor* m_reactor;
 
@@ -306,6 +333,10 @@ class APACHE_GEODE_EXPORT ExpiryTaskManager : public ACE_Task_Base {
   std::condition_variable m_condition;
 
   std::unique_ptr<GF_Timer_Heap_ImmediateReset> m_timer;
+  std::unique_ptr<TimingWheel> m_timingWheel;
+
+  static_assert(std::is_same<id_type, TimingWheel::id_type>::value,
+                "timing wheel ids must match reactor timer ids");
 };
 }  // namespace client
 }  // namespace geode
@@ -0,0 +1,138 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "FileTraceExporter.hpp"
+
+#include <cinttypes>
+#include <cstdio>
+
+#include <geode/ExceptionTypes.hpp>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+namespace {
+
+void appendHex(std::string& out, uint64_t value) {
+  char buffer[17];
+  std::snprintf(buffer, sizeof(buffer), "%016" PRIx64, value);
+  out += buffer;
+}
+
+void appendString(std::string& out, const std::string& value) {
+  out += '"';
+  for (auto c : value) {
+    switch (c) {
+      case '"':
+        out += "\\\"";
+        break;
+      case '\\':
+        out += "\\\\";
+        break;
+      case '\n':
+        out += "\\n";
+        break;
+      case '\r':
+        out += "\\r";
+        break;
+      case '\t':
+        out += "\\t";
+        break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          char buffer[7];
+          std::snprintf(buffer, sizeof(buffer), "\\u%04x", c);
+          out += buffer;
+        } else {
+          out += c;
+        }
+    }
+  }
+  out += '"';
+}
+
+}  // namespace
+
+FileTraceExporter::FileTraceExporter(const std::string& path)
+    : m_file(path, std::ios::out | std::ios::app) {
+  if (!m_file) {
+    throw IllegalArgumentException("FileTraceExporter: unable to open " +
+                                   path);
+  }
+}
+
+FileTraceExporter::~FileTraceExporter() = default;
+
+void FileTraceExporter::exportSpans(const std::vector<TraceSpan>& spans) {
+  for (const auto& span : spans) {
+    m_file << toJson(span) << '\n';
+  }
+  m_file.flush();
+}
+
+void FileTraceExporter::shutdown() { m_file.close(); }
+
+std::string FileTraceExporter::toJson(const TraceSpan& span) {
+  using std::chrono::duration_cast;
+  using std::chrono::nanoseconds;
+
+  auto start = duration_cast<nanoseconds>(span.start.time_since_epoch());
+  auto end = start + span.duration;
+
+  std::string json = "{\"traceId\":\"";
+  appendHex(json, span.traceIdHigh);
+  appendHex(json, span.traceIdLow);
+  json += "\",\"spanId\":\"";
+  appendHex(json, span.spanId);
+  json += '"';
+  if (span.parentSpanId != 0) {
+    json += ",\"parentSpanId\":\"";
+    appendHex(json, span.parentSpanId);
+    json += '"';
+  }
+  json += ",\"name\":";
+  appendString(json, span.name);
+  // OTLP JSON encodes 64 bit integers as strings
+  json += ",\"startTimeUnixNano\":\"";
+  json += std::to_string(start.count());
+  json += "\",\"endTimeUnixNano\":\"";
+  json += std::to_string(end.count());
+  json += "\",\"attributes\":[";
+  bool first = true;
+  for (const auto& attribute : span.attributes) {
+    if (!first) {
+      json += ',';
+    }
+    first = false;
+    json += "{\"key\":";
+    appendString(json, attribute.first);
+    json += ",\"value\":{\"stringValue\":";
+    appendString(json, attribute.second);
+    json += "}}";
+  }
+  // status codes: 1 is OK, 2 is ERROR
+  json += "],\"status\":{\"code\":";
+  json += span.error ? '2' : '1';
+  json += "}}";
+  return json;
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
@@ -0,0 +1,60 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#ifndef GEODE_FILETRACEEXPORTER_H_
+#define GEODE_FILETRACEEXPORTER_H_
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <geode/TraceExporter.hpp>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * @class FileTraceExporter FileTraceExporter.hpp
+ *
+ * Appends spans to a file, one JSON object per line, using the field names
+ * of the OpenTelemetry (OTLP) JSON encoding so the file can be replayed into
+ * a collector or inspected without one.
+ */
+class FileTraceExporter : public TraceExporter {
+ public:
+  explicit FileTraceExporter(const std::string& path);
+  ~FileTraceExporter() override;
+
+  void exportSpans(const std::vector<TraceSpan>& spans) override;
+
+  void shutdown() override;
+
+  static std::string toJson(const TraceSpan& span);
+
+ private:
+  std::ofstream m_file;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_FILETRACEEXPORTER_H_
@@ -0,0 +1,67 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "IoEngine.hpp"
+
+#include <geode/ExceptionTypes.hpp>
+
+#include "DistributedSystemImpl.hpp"
+#include "util/Log.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+IoEngine::IoEngine(size_t threads)
+    : m_ioContext(static_cast<int>(threads)),
+      m_work(boost::asio::make_work_guard(m_ioContext)) {
+  if (threads == 0) {
+    throw IllegalArgumentException(
+        "IoEngine: at least one reactor thread is required");
+  }
+  m_threads.reserve(threads);
+  for (size_t i = 0; i < threads; ++i) {
+    m_threads.emplace_back([this] { run(); });
+  }
+  LOGFINE("IoEngine started with %zu reactor threads", threads);
+}
+
+IoEngine::~IoEngine() noexcept {
+  m_work.reset();
+  m_ioContext.stop();
+  for (auto& thread : m_threads) {
+    if (thread.joinable()) {
+      thread.join();
+    }
+  }
+}
+
+void IoEngine::run() {
+  DistributedSystemImpl::setThreadName("NC IoEngine");
+  while (!m_ioContext.stopped()) {
+    try {
+      m_ioContext.run();
+    } catch (const std::exception& ex) {
+      LOGERROR("IoEngine: unexpected exception in reactor thread: %s",
+               ex.what());
+    }
+  }
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
@@ -0,0 +1,71 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_IOENGINE_H_
+#define GEODE_IOENGINE_H_
+
+#include <thread>
+#include <vector>
+
+#include <boost/asio/executor_work_guard.hpp>
+#include <boost/asio/io_context.hpp>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * @class IoEngine IoEngine.hpp
+ *
+ * A small, fixed set of reactor threads running one io_context that can be
+ * shared by several connections. Connections register their sockets with
+ * the shared io_context; their completion handlers then run on the reactor
+ * threads, and a thread blocked on a send or receive waits for its handler
+ * instead of running a reactor of its own.
+ *
+ * The cache does not create one yet. Server requests block their caller
+ * until the reply arrives, so an engine would add thread switches without
+ * saving threads until TcrConnection uses asyncSend and asyncReceive.
+ */
+class IoEngine {
+ public:
+  explicit IoEngine(size_t threads);
+  ~IoEngine() noexcept;
+
+  IoEngine(const IoEngine&) = delete;
+  IoEngine& operator=(const IoEngine&) = delete;
+
+  boost::asio::io_context& getIoContext() { return m_ioContext; }
+
+  size_t getThreadCount() const { return m_threads.size(); }
+
+ private:
+  void run();
+
+  boost::asio::io_context m_ioContext;
+  boost::asio::executor_work_guard<boost::asio::io_context::executor_type>
+      m_work;
+  std::vector<std::thread> m_threads;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_IOENGINE_H_
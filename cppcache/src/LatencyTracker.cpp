@@ -0,0 +1,84 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "LatencyTracker.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+namespace {
+
+// new samples needed before the percentiles are recomputed
+constexpr size_t RECOMPUTE_INTERVAL = 16;
+
+}  // namespace
+
+LatencyTracker::LatencyTracker(size_t window)
+    : m_next(0),
+      m_sinceComputed(0),
+      m_percentiles{0, std::chrono::microseconds::zero(),
+                    std::chrono::microseconds::zero()} {
+  m_samples.reserve(std::max<size_t>(window, 1));
+}
+
+void LatencyTracker::record(std::chrono::microseconds latency) {
+  auto micros = static_cast<uint32_t>(
+      std::min<std::chrono::microseconds::rep>(
+          std::max<std::chrono::microseconds::rep>(latency.count(), 0),
+          std::numeric_limits<uint32_t>::max()));
+
+  std::lock_guard<decltype(m_mutex)> guard(m_mutex);
+  if (m_samples.size() < m_samples.capacity()) {
+    m_samples.push_back(micros);
+  } else {
+    m_samples[m_next] = micros;
+    m_next = (m_next + 1) % m_samples.size();
+  }
+  ++m_sinceComputed;
+}
+
+LatencyTracker::Percentiles LatencyTracker::getPercentiles() {
+  std::lock_guard<decltype(m_mutex)> guard(m_mutex);
+  if (m_sinceComputed >= RECOMPUTE_INTERVAL ||
+      (m_sinceComputed > 0 && m_percentiles.samples < RECOMPUTE_INTERVAL)) {
+    computePercentiles();
+  }
+  return m_percentiles;
+}
+
+void LatencyTracker::computePercentiles() {
+  auto sorted = m_samples;
+  auto at = [&sorted](double quantile) {
+    auto rank = static_cast<size_t>(quantile * (sorted.size() - 1) + 0.5);
+    std::nth_element(sorted.begin(), sorted.begin() + rank, sorted.end());
+    return std::chrono::microseconds(sorted[rank]);
+  };
+
+  m_percentiles.samples = sorted.size();
+  m_percentiles.p95 = at(0.95);
+  m_percentiles.p99 = at(0.99);
+  m_sinceComputed = 0;
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
@@ -0,0 +1,75 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#ifndef GEODE_LATENCYTRACKER_H_
+#define GEODE_LATENCYTRACKER_H_
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * @class LatencyTracker LatencyTracker.hpp
+ *
+ * Keeps the most recent request latencies seen from one server and derives
+ * percentiles from them. Percentiles are recomputed only after a number of
+ * new samples have arrived, so reading them is cheap.
+ */
+class LatencyTracker {
+ public:
+  struct Percentiles {
+    size_t samples;
+    std::chrono::microseconds p95;
+    std::chrono::microseconds p99;
+  };
+
+  explicit LatencyTracker(size_t window = 256);
+
+  LatencyTracker(const LatencyTracker&) = delete;
+  LatencyTracker& operator=(const LatencyTracker&) = delete;
+
+  void record(std::chrono::microseconds latency);
+
+  /**
+   * Returns the percentiles over the window. <code>samples</code> is the
+   * number of latencies they were computed from, at most the window size.
+   */
+  Percentiles getPercentiles();
+
+ private:
+  void computePercentiles();
+
+  std::mutex m_mutex;
+  std::vector<uint32_t> m_samples;
+  size_t m_next;
+  size_t m_sinceComputed;
+  Percentiles m_percentiles;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_LATENCYTRACKER_H_
@@ -0,0 +1,158 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "LocalQuery.hpp"
+
+#include <geode/ExceptionTypes.hpp>
+#include <geode/Region.hpp>
+#include <geode/RegionEntry.hpp>
+#include <geode/internal/chrono/duration.hpp>
+
+#include "CacheImpl.hpp"
+#include "LocalRegion.hpp"
+#include "query/IndexManager.hpp"
+#include "query/Parser.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+namespace {
+
+class RegionQuerySource : public query::QuerySource {
+ public:
+  RegionQuerySource(std::shared_ptr<Region> region,
+                    std::chrono::milliseconds timeout)
+      : m_region(std::move(region)),
+        m_timeout(timeout),
+        m_deadline(std::chrono::steady_clock::now() + timeout) {}
+
+  ~RegionQuerySource() noexcept override = default;
+
+  void forEach(const Visitor& visitor) override {
+    auto localRegion = std::dynamic_pointer_cast<LocalRegion>(m_region);
+    if (localRegion == nullptr) {
+      for (const auto& entry : m_region->entries(false)) {
+        if (!visitor(entry->getKey(), entry->getValue())) {
+          break;
+        }
+      }
+      return;
+    }
+
+    uint32_t visited = 0;
+    localRegion->forEachEntry(
+        [&](const std::shared_ptr<CacheableKey>& key,
+            const std::shared_ptr<Cacheable>& value) {
+          // reading the clock for every entry would cost more than most
+          // WHERE clauses
+          if (++visited % 1024 == 0 &&
+              std::chrono::steady_clock::now() > m_deadline) {
+            throw TimeoutException(
+                "LocalQuery::execute: query on " + m_region->getFullPath() +
+                " timed out after " +
+                apache::geode::internal::chrono::duration::to_string(
+                    m_timeout));
+          }
+          return visitor(key, value);
+        });
+  }
+
+  bool get(const std::shared_ptr<CacheableKey>& key,
+           std::shared_ptr<Serializable>& value) override {
+    auto entry = m_region->getEntry(key);
+    if (entry == nullptr) {
+      return false;
+    }
+    value = entry->getValue();
+    return true;
+  }
+
+  std::shared_ptr<const query::Index> findIndex(
+      const std::vector<std::string>& path, bool sorted) override {
+    if (auto localRegion = std::dynamic_pointer_cast<LocalRegion>(m_region)) {
+      return localRegion->getIndexManager().find(path, sorted);
+    }
+    return nullptr;
+  }
+
+ private:
+  std::shared_ptr<Region> m_region;
+  const std::chrono::milliseconds m_timeout;
+  const std::chrono::steady_clock::time_point m_deadline;
+};
+
+}  // namespace
+
+LocalQuery::LocalQuery(std::string querystr, CacheImpl* cache)
+    : m_queryString(std::move(querystr)), m_cache(cache) {}
+
+std::shared_ptr<SelectResults> LocalQuery::execute(
+    std::chrono::milliseconds timeout) {
+  return execute(nullptr, timeout);
+}
+
+std::shared_ptr<SelectResults> LocalQuery::execute(
+    std::shared_ptr<CacheableVector> paramList,
+    std::chrono::milliseconds timeout) {
+  auto select = statement();
+
+  auto region = m_cache->getRegion(select->regionPath);
+  if (region == nullptr) {
+    throw QueryException("Region /" + select->regionPath +
+                         " not found in query " + m_queryString);
+  }
+
+  RegionQuerySource source(region, timeout);
+  return select->execute(source, paramList);
+}
+
+void LocalQuery::executeStreaming(const ResultsHandler& handler,
+                                  std::shared_ptr<CacheableVector> paramList,
+                                  std::chrono::milliseconds timeout) {
+  if (!handler) {
+    throw IllegalArgumentException(
+        "LocalQuery::executeStreaming: handler is empty");
+  }
+  auto results = execute(paramList, timeout);
+  if (results->size() > 0) {
+    handler(results);
+  }
+}
+
+const std::string& LocalQuery::getQueryString() const {
+  return m_queryString;
+}
+
+void LocalQuery::compile() { statement(); }
+
+bool LocalQuery::isCompiled() {
+  std::lock_guard<std::mutex> guard(m_mutex);
+  return m_statement != nullptr;
+}
+
+std::shared_ptr<const query::SelectStatement> LocalQuery::statement() {
+  std::lock_guard<std::mutex> guard(m_mutex);
+  if (!m_statement) {
+    m_statement = query::Parser(m_queryString).parse();
+  }
+  return m_statement;
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
@@ -0,0 +1,82 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_LOCALQUERY_H_
+#define GEODE_LOCALQUERY_H_
+
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include <geode/Query.hpp>
+#include <geode/internal/geode_globals.hpp>
+
+#include "query/SelectStatement.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+class CacheImpl;
+
+/**
+ * Query evaluated against the local entries of a single region. Created by
+ * LocalQueryService. A query that scans the region fails with
+ * TimeoutException once it has run for longer than its timeout.
+ */
+class APACHE_GEODE_EXPORT LocalQuery : public Query {
+ public:
+  LocalQuery(std::string querystr, CacheImpl* cache);
+
+  ~LocalQuery() noexcept override = default;
+
+  std::shared_ptr<SelectResults> execute(
+      std::chrono::milliseconds timeout =
+          DEFAULT_QUERY_RESPONSE_TIMEOUT) override;
+
+  std::shared_ptr<SelectResults> execute(
+      std::shared_ptr<CacheableVector> paramList = nullptr,
+      std::chrono::milliseconds timeout =
+          DEFAULT_QUERY_RESPONSE_TIMEOUT) override;
+
+  void executeStreaming(const ResultsHandler& handler,
+                        std::shared_ptr<CacheableVector> paramList = nullptr,
+                        std::chrono::milliseconds timeout =
+                            DEFAULT_QUERY_RESPONSE_TIMEOUT) override;
+
+  const std::string& getQueryString() const override;
+
+  void compile() override;
+
+  bool isCompiled() override;
+
+ private:
+  std::shared_ptr<const query::SelectStatement> statement();
+
+  std::string m_queryString;
+  CacheImpl* m_cache;
+  std::mutex m_mutex;
+  std::shared_ptr<const query::SelectStatement> m_statement;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_LOCALQUERY_H_
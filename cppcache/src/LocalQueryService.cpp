@@ -0,0 +1,149 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "LocalQueryService.hpp"
+
+#include <geode/ExceptionTypes.hpp>
+
+#include "CacheImpl.hpp"
+#include "LocalQuery.hpp"
+#include "LocalRegion.hpp"
+#include "query/IndexManager.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+namespace {
+
+[[noreturn]] void throwCqNotSupported() {
+  throw UnsupportedOperationException(
+      "Continuous queries are not supported by the local query service");
+}
+
+}  // namespace
+
+LocalQueryService::LocalQueryService(CacheImpl* cache) : m_cache(cache) {}
+
+std::shared_ptr<Query> LocalQueryService::newQuery(std::string querystring) {
+  return std::make_shared<LocalQuery>(std::move(querystring), m_cache);
+}
+
+std::shared_ptr<CqQuery> LocalQueryService::newCq(
+    std::string, const std::shared_ptr<CqAttributes>&, bool) {
+  throwCqNotSupported();
+}
+
+std::shared_ptr<CqQuery> LocalQueryService::newCq(
+    std::string, std::string, const std::shared_ptr<CqAttributes>&, bool) {
+  throwCqNotSupported();
+}
+
+void LocalQueryService::closeCqs() { throwCqNotSupported(); }
+
+QueryService::query_container_type LocalQueryService::getCqs() const {
+  throwCqNotSupported();
+}
+
+std::shared_ptr<CqQuery> LocalQueryService::getCq(const std::string&) const {
+  throwCqNotSupported();
+}
+
+void LocalQueryService::executeCqs() { throwCqNotSupported(); }
+
+void LocalQueryService::stopCqs() { throwCqNotSupported(); }
+
+std::shared_ptr<CqServiceStatistics> LocalQueryService::getCqServiceStatistics()
+    const {
+  throwCqNotSupported();
+}
+
+std::shared_ptr<CacheableArrayList>
+LocalQueryService::getAllDurableCqsFromServer() const {
+  throwCqNotSupported();
+}
+
+void LocalQueryService::createIndex(const std::string& name,
+                                    const std::string& indexedExpression,
+                                    const std::string& regionPath) {
+  addIndex(name, true, indexedExpression, regionPath);
+}
+
+void LocalQueryService::createHashIndex(const std::string& name,
+                                        const std::string& indexedExpression,
+                                        const std::string& regionPath) {
+  addIndex(name, false, indexedExpression, regionPath);
+}
+
+bool LocalQueryService::removeIndex(const std::string& name) {
+  std::lock_guard<decltype(m_indexMutex)> guard(m_indexMutex);
+  auto found = m_indexRegions.find(name);
+  if (found == m_indexRegions.end()) {
+    return false;
+  }
+  auto regionPath = found->second;
+  m_indexRegions.erase(found);
+
+  auto region = std::dynamic_pointer_cast<LocalRegion>(
+      m_cache->getRegion(regionPath));
+  if (region) {
+    region->getIndexManager().remove(name);
+  }
+  LOGFINE("LocalQueryService: removed index " + name);
+  return true;
+}
+
+void LocalQueryService::addIndex(const std::string& name, bool sorted,
+                                 const std::string& indexedExpression,
+                                 const std::string& regionPath) {
+  auto index = std::make_shared<query::Index>(
+      name, sorted ? query::Index::Type::Sorted : query::Index::Type::Hash,
+      indexedExpression, regionPath);
+
+  auto region = std::dynamic_pointer_cast<LocalRegion>(
+      m_cache->getRegion(index->regionPath()));
+  if (region == nullptr) {
+    throw IllegalArgumentException("Index " + name + ": region /" +
+                                   index->regionPath() + " not found");
+  }
+  if (!region->getAttributes().getCachingEnabled()) {
+    throw IllegalStateException("Index " + name + ": region " +
+                                region->getFullPath() +
+                                " does not cache data locally");
+  }
+
+  std::lock_guard<decltype(m_indexMutex)> guard(m_indexMutex);
+  if (m_indexRegions.find(name) != m_indexRegions.end()) {
+    throw IllegalArgumentException("Index " + name + " already exists");
+  }
+
+  // Register first so concurrent updates are applied, then add the entries
+  // already cached without overwriting anything those updates indexed.
+  region->getIndexManager().add(index);
+  for (const auto& entry : region->entries(false)) {
+    index->update(entry->getKey(), entry->getValue(), true);
+  }
+  m_indexRegions.emplace(name, region->getFullPath());
+
+  LOGFINE("LocalQueryService: created %s index %s on %s with %zu entries",
+          sorted ? "sorted" : "hash", name.c_str(),
+          region->getFullPath().c_str(), index->size());
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
@@ -0,0 +1,97 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_LOCALQUERYSERVICE_H_
+#define GEODE_LOCALQUERYSERVICE_H_
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include <geode/QueryService.hpp>
+#include <geode/internal/geode_globals.hpp>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+class CacheImpl;
+class LocalRegion;
+
+/**
+ * QueryService that evaluates queries against the entries cached locally in
+ * this client instead of sending them to a server. Continuous queries are
+ * server side only and are not supported.
+ */
+class APACHE_GEODE_EXPORT LocalQueryService : public QueryService {
+ public:
+  explicit LocalQueryService(CacheImpl* cache);
+  virtual ~LocalQueryService() = default;
+
+  std::shared_ptr<Query> newQuery(std::string querystring) override;
+
+  std::shared_ptr<CqQuery> newCq(std::string querystr,
+                                 const std::shared_ptr<CqAttributes>& cqAttr,
+                                 bool isDurable = false) override;
+
+  std::shared_ptr<CqQuery> newCq(std::string name, std::string querystr,
+                                 const std::shared_ptr<CqAttributes>& cqAttr,
+                                 bool isDurable = false) override;
+
+  void closeCqs() override;
+
+  QueryService::query_container_type getCqs() const override;
+
+  std::shared_ptr<CqQuery> getCq(const std::string& name) const override;
+
+  void executeCqs() override;
+
+  void stopCqs() override;
+
+  std::shared_ptr<CqServiceStatistics> getCqServiceStatistics() const override;
+
+  std::shared_ptr<CacheableArrayList> getAllDurableCqsFromServer()
+      const override;
+
+  void createIndex(const std::string& name,
+                   const std::string& indexedExpression,
+                   const std::string& regionPath) override;
+
+  void createHashIndex(const std::string& name,
+                       const std::string& indexedExpression,
+                       const std::string& regionPath) override;
+
+  bool removeIndex(const std::string& name) override;
+
+ private:
+  void addIndex(const std::string& name, bool sorted,
+                const std::string& indexedExpression,
+                const std::string& regionPath);
+
+  CacheImpl* m_cache;
+  std::mutex m_indexMutex;
+  std::map<std::string, std::string> m_indexRegions;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_LOCALQUERYSERVICE_H_
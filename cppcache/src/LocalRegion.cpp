@@ -34,8 +34,10 @@
 #include "SerializableHelper.hpp"
 #include "TXState.hpp"
 #include "TcrConnectionManager.hpp"
+#include "Tracer.hpp"
 #include "Utils.hpp"
 #include "VersionTag.hpp"
+#include "query/IndexManager.hpp"
 #include "util/Log.hpp"
 #include "util/bounds.hpp"
 #include "util/exception.hpp"
@@ -63,7 +65,8 @@ LocalRegion::LocalRegion(const std::string& name, CacheImpl* cacheImpl,
       m_isPRSingleHopEnabled(false),
       m_attachedPool(nullptr),
       m_enableTimeStatistics(enableTimeStatistics),
-      m_persistenceManager(nullptr) {
+      m_persistenceManager(nullptr),
+      m_indexManager(new query::IndexManager()) {
   if (m_parentRegion != nullptr) {
     ((m_fullPath = m_parentRegion->getFullPath()) += "/") += m_name;
   } else {
@@ -327,11 +330,16 @@ void LocalRegion::getEntry(const std::shared_ptr<CacheableKey>& key,
 std::shared_ptr<Cacheable> LocalRegion::get(
     const std::shared_ptr<CacheableKey>& key,
     const std::shared_ptr<Serializable>& aCallbackArgument) {
+  TraceScope trace(m_cacheImpl->getTracer(), "Region::get");
+  trace.setAttribute("region", m_fullPath);
   std::shared_ptr<Cacheable> rptr;
   int64_t sampleStartNanos = startStatOpTime();
   GfErrType err = getNoThrow(key, rptr, aCallbackArgument);
   updateStatOpTime(m_regionStats->getStat(), m_regionStats->getGetTimeId(),
                    sampleStartNanos);
+  if (err != GF_NOERR) {
+    trace.setError();
+  }
 
   // rptr = handleReplay(err, rptr);
 
@@ -343,6 +351,8 @@ std::shared_ptr<Cacheable> LocalRegion::get(
 void LocalRegion::put(const std::shared_ptr<CacheableKey>& key,
                       const std::shared_ptr<Cacheable>& value,
                       const std::shared_ptr<Serializable>& aCallbackArgument) {
+  TraceScope trace(m_cacheImpl->getTracer(), "Region::put");
+  trace.setAttribute("region", m_fullPath);
   std::shared_ptr<Cacheable> oldValue;
   int64_t sampleStartNanos = startStatOpTime();
   std::shared_ptr<VersionTag> versionTag;
@@ -350,6 +360,9 @@ void LocalRegion::put(const std::shared_ptr<CacheableKey>& key,
                              CacheEventFlags::NORMAL, versionTag);
   updateStatOpTime(m_regionStats->getStat(), m_regionStats->getPutTimeId(),
                    sampleStartNanos);
+  if (err != GF_NOERR) {
+    trace.setError();
+  }
   //  handleReplay(err, nullptr);
   throwExceptionIfError("Region::put", err);
 }
@@ -370,10 +383,18 @@ void LocalRegion::putAll(
     const std::shared_ptr<Serializable>& aCallbackArgument) {
   util::PROTOCOL_OPERATION_TIMEOUT_BOUNDS(timeout);
 
+  TraceScope trace(m_cacheImpl->getTracer(), "Region::putAll");
+  trace.setAttribute("region", m_fullPath);
+  if (trace.isRecording()) {
+    trace.setAttribute("entries", std::to_string(map.size()));
+  }
   auto sampleStartNanos = startStatOpTime();
   auto err = putAllNoThrow(map, timeout, aCallbackArgument);
   updateStatOpTime(m_regionStats->getStat(), m_regionStats->getPutAllTimeId(),
                    sampleStartNanos);
+  if (err != GF_NOERR) {
+    trace.setError();
+  }
   // handleReplay(err, nullptr);
   throwExceptionIfError("Region::putAll", err);
 }
@@ -384,10 +405,18 @@ void LocalRegion::removeAll(
   if (keys.size() == 0) {
     throw IllegalArgumentException("Region::removeAll: zero keys provided");
   }
+  TraceScope trace(m_cacheImpl->getTracer(), "Region::removeAll");
+  trace.setAttribute("region", m_fullPath);
+  if (trace.isRecording()) {
+    trace.setAttribute("entries", std::to_string(keys.size()));
+  }
   int64_t sampleStartNanos = startStatOpTime();
   GfErrType err = removeAllNoThrow(keys, aCallbackArgument);
   updateStatOpTime(m_regionStats->getStat(),
                    m_regionStats->getRemoveAllTimeId(), sampleStartNanos);
+  if (err != GF_NOERR) {
+    trace.setError();
+  }
   throwExceptionIfError("Region::removeAll", err);
 }
 
@@ -395,9 +424,14 @@ void LocalRegion::create(
     const std::shared_ptr<CacheableKey>& key,
     const std::shared_ptr<Cacheable>& value,
     const std::shared_ptr<Serializable>& aCallbackArgument) {
+  TraceScope trace(m_cacheImpl->getTracer(), "Region::create");
+  trace.setAttribute("region", m_fullPath);
   std::shared_ptr<VersionTag> versionTag;
   GfErrType err = createNoThrow(key, value, aCallbackArgument, -1,
                                 CacheEventFlags::NORMAL, versionTag);
+  if (err != GF_NOERR) {
+    trace.setError();
+  }
   // handleReplay(err, nullptr);
   throwExceptionIfError("Region::create", err);
 }
@@ -434,10 +468,14 @@ void LocalRegion::localInvalidate(
 void LocalRegion::destroy(
     const std::shared_ptr<CacheableKey>& key,
     const std::shared_ptr<Serializable>& aCallbackArgument) {
+  TraceScope trace(m_cacheImpl->getTracer(), "Region::destroy");
+  trace.setAttribute("region", m_fullPath);
   std::shared_ptr<VersionTag> versionTag;
-
   GfErrType err = destroyNoThrow(key, aCallbackArgument, -1,
                                  CacheEventFlags::NORMAL, versionTag);
+  if (err != GF_NOERR) {
+    trace.setError();
+  }
   // handleReplay(err, nullptr);
   throwExceptionIfError("Region::destroy", err);
 }
@@ -455,6 +493,8 @@ bool LocalRegion::remove(
     const std::shared_ptr<CacheableKey>& key,
     const std::shared_ptr<Cacheable>& value,
     const std::shared_ptr<Serializable>& aCallbackArgument) {
+  TraceScope trace(m_cacheImpl->getTracer(), "Region::remove");
+  trace.setAttribute("region", m_fullPath);
   std::shared_ptr<VersionTag> versionTag;
   GfErrType err = removeNoThrow(key, value, aCallbackArgument, -1,
                                 CacheEventFlags::NORMAL, versionTag);
@@ -464,6 +504,7 @@ bool LocalRegion::remove(
   if (err == GF_NOERR) {
     result = true;
   } else if (err != GF_ENOENT && err != GF_CACHE_ENTRY_NOT_FOUND) {
+    trace.setError();
     throwExceptionIfError("Region::remove", err);
   }
 
@@ -547,6 +588,14 @@ std::vector<std::shared_ptr<Cacheable>> LocalRegion::values() {
   return values;
 }
 
+void LocalRegion::forEachEntry(const EntriesMap::EntryVisitor& visitor) {
+  CHECK_DESTROY_PENDING(TryReadGuard, LocalRegion::forEachEntry);
+
+  if (m_regionAttributes.getCachingEnabled()) {
+    m_entries->forEachEntry(visitor);
+  }
+}
+
 std::vector<std::shared_ptr<RegionEntry>> LocalRegion::entries(bool recursive) {
   CHECK_DESTROY_PENDING(TryReadGuard, LocalRegion::entries);
 
@@ -573,6 +622,11 @@ HashMapOfCacheable LocalRegion::getAll_internal(
     throw IllegalArgumentException("Region::getAll: zero keys provided");
   }
 
+  TraceScope trace(m_cacheImpl->getTracer(), "Region::getAll");
+  trace.setAttribute("region", m_fullPath);
+  if (trace.isRecording()) {
+    trace.setAttribute("entries", std::to_string(keys.size()));
+  }
   int64_t sampleStartNanos = startStatOpTime();
 
   auto values = std::make_shared<HashMapOfCacheable>();
@@ -582,12 +636,88 @@ HashMapOfCacheable LocalRegion::getAll_internal(
 
   updateStatOpTime(m_regionStats->getStat(), m_regionStats->getGetAllTimeId(),
                    sampleStartNanos);
+  if (err != GF_NOERR) {
+    trace.setError();
+  }
 
   throwExceptionIfError("Region::getAll", err);
 
   return *values;
 }
 
+void LocalRegion::getAllStreaming(
+    const std::vector<std::shared_ptr<CacheableKey>>& keys,
+    const GetAllEntryHandler& handler,
+    const std::shared_ptr<Serializable>& aCallbackArgument) {
+  if (keys.empty()) {
+    throw IllegalArgumentException(
+        "Region::getAllStreaming: zero keys provided");
+  }
+  if (!handler) {
+    throw IllegalArgumentException(
+        "Region::getAllStreaming: null entry handler provided");
+  }
+
+  int64_t sampleStartNanos = startStatOpTime();
+
+  auto exceptions = std::make_shared<HashMapOfException>();
+  GfErrType err = GF_NOERR;
+  {
+    CHECK_DESTROY_PENDING(TryReadGuard, Region::getAllStreaming);
+
+    TXState* txState = getTXState();
+    if (txState != nullptr) {
+      if (isLocalOp()) {
+        err = GF_NOTSUP;
+      } else {
+        err = getAllStreamingNoThrow_remote(&keys, exceptions, handler,
+                                            aCallbackArgument);
+        if (err == GF_NOERR) {
+          txState->setDirty();
+        }
+      }
+    } else {
+      // hand out locally cached values first and fetch the rest remotely
+      std::vector<std::shared_ptr<CacheableKey>> serverKeys;
+      bool cachingEnabled = m_regionAttributes.getCachingEnabled();
+      bool regionAccessed = false;
+      auto& cachePerfStats = m_cacheImpl->getCachePerfStats();
+
+      for (const auto& key : keys) {
+        std::shared_ptr<MapEntryImpl> me;
+        std::shared_ptr<Cacheable> value;
+        m_regionStats->incGets();
+        cachePerfStats.incGets();
+        if (cachingEnabled && m_entries->get(key, value, me) && value &&
+            !CacheableToken::isInvalid(value)) {
+          m_regionStats->incHits();
+          cachePerfStats.incHits();
+          updateAccessAndModifiedTimeForEntry(me, false);
+          regionAccessed = true;
+          handler(key, value);
+        } else {
+          serverKeys.push_back(key);
+          m_regionStats->incMisses();
+          cachePerfStats.incMisses();
+        }
+      }
+      if (regionAccessed) {
+        updateAccessAndModifiedTime(false);
+      }
+      if (!serverKeys.empty()) {
+        err = getAllStreamingNoThrow_remote(&serverKeys, exceptions, handler,
+                                            aCallbackArgument);
+      }
+      m_regionStats->incGetAll();
+    }
+  }
+
+  updateStatOpTime(m_regionStats->getStat(), m_regionStats->getGetAllTimeId(),
+                   sampleStartNanos);
+
+  throwExceptionIfError("Region::getAllStreaming", err);
+}
+
 uint32_t LocalRegion::size_remote() {
   CHECK_DESTROY_PENDING(TryReadGuard, LocalRegion::size);
   if (m_regionAttributes.getCachingEnabled()) {
@@ -1304,6 +1434,7 @@ class DestroyActions {
         }
         return err;
       }
+      m_region.updateIndexes(key, nullptr);
 
       if (oldValue != nullptr) {
         LOGDEBUG(
@@ -1505,6 +1636,7 @@ class RemoveActions {
         }
         return err;
       }
+      m_region.updateIndexes(key, nullptr);
       if (oldValue != nullptr) {
         LOGDEBUG(
             "Region::remove: region [%s] removed key [%s] having "
@@ -1735,6 +1867,7 @@ GfErrType LocalRegion::updateNoThrow(
         } else if (err != GF_NOERR) {
           return err;
         }
+        updateIndexes(key, newValue1);
       }
     } else if (err != GF_NOERR) {
       return err;
@@ -2189,7 +2322,10 @@ GfErrType LocalRegion::localClearNoThrow(
     LOGFINE("Cache writer prevented region clear");
     return GF_CACHEWRITER_ERROR;
   }
-  if (cachingEnabled == true) m_entries->clear();
+  if (cachingEnabled == true) {
+    m_entries->clear();
+    clearIndexes();
+  }
   if (!eventFlags.isNormal()) {
     err = invokeCacheListenerForRegionEvent(aCallbackArgument, eventFlags,
                                             AFTER_REGION_CLEAR);
@@ -2250,6 +2386,7 @@ GfErrType LocalRegion::invalidateLocal(
         LOGDEBUG("Region::invalidate: region [%s] invalidated key [%s]",
                  getFullPath().c_str(),
                  Utils::nullSafeToString(keyPtr).c_str());
+        updateIndexes(keyPtr, nullptr);
       }
       // entry/region expiration
       if (!eventFlags.isEvictOrExpire()) {
@@ -2302,6 +2439,7 @@ GfErrType LocalRegion::invalidateRegionNoThrow(
         }
       }
     }
+    clearIndexes();
     if (!eventFlags.isEvictOrExpire()) {
       updateAccessAndModifiedTime(true);
     }
@@ -2475,6 +2613,9 @@ GfErrType LocalRegion::putLocal(const std::string& name, bool isCreate,
           err = m_entries->put(
               key, newValue1, entry, oldValue, updateCount, destroyTracker,
               versionTag1 != nullptr ? versionTag1 : versionTag, isUpdate);
+        } else if (err == GF_NOERR) {
+          // leave the retry to the caller rather than index a missing value
+          err = GF_INVALID_DELTA;
         }
       }
       if (delta != nullptr &&
@@ -2485,6 +2626,8 @@ GfErrType LocalRegion::putLocal(const std::string& name, bool isCreate,
     if (err != GF_NOERR) {
       return err;
     }
+    // the put leaves the stored value, with any delta applied, in value
+    updateIndexes(key, value);
     LOGDEBUG("%s: region [%s] %s key [%s], value [%s]", name.c_str(),
              getFullPath().c_str(), isUpdate ? "updated" : "created",
              Utils::nullSafeToString(key).c_str(),
@@ -3072,6 +3215,13 @@ GfErrType LocalRegion::getAllNoThrow_remote(
   return GF_NOERR;
 }
 
+GfErrType LocalRegion::getAllStreamingNoThrow_remote(
+    const std::vector<std::shared_ptr<CacheableKey>>*,
+    const std::shared_ptr<HashMapOfException>&, const GetAllEntryHandler&,
+    const std::shared_ptr<Serializable>&) {
+  return GF_NOERR;
+}
+
 GfErrType LocalRegion::invalidateRegionNoThrow_remote(
     const std::shared_ptr<Serializable>&) {
   return GF_NOERR;
@@ -3183,6 +3333,17 @@ std::shared_ptr<TombstoneList> LocalRegion::getTombstoneList() {
   return m_tombstoneList;
 }
 
+void LocalRegion::updateIndexes(const std::shared_ptr<CacheableKey>& key,
+                                const std::shared_ptr<Cacheable>& value) {
+  if (!m_indexManager->empty()) {
+    auto segment = m_entries->segmentFor(key);
+    m_indexManager->update(
+        key, value, [&] { return segment->holdsValue(key, value); });
+  }
+}
+
+void LocalRegion::clearIndexes() { m_indexManager->clear(); }
+
 int64_t LocalRegion::startStatOpTime() {
   return m_enableTimeStatistics ? Utils::startStatOpTime() : 0;
 }
@@ -20,6 +20,7 @@
 #ifndef GEODE_LOCALREGION_H_
 #define GEODE_LOCALREGION_H_
 
+#include <memory>
 #include <string>
 #include <unordered_map>
 
@@ -72,6 +73,10 @@ namespace client {
   }
 #endif
 
+namespace query {
+class IndexManager;
+}  // namespace query
+
 class PutActions;
 class PutActionsTx;
 class CreateActions;
@@ -216,6 +221,12 @@ class APACHE_GEODE_EXPORT LocalRegion : public RegionInternal {
   std::vector<std::shared_ptr<Cacheable>> values() override;
   std::vector<std::shared_ptr<RegionEntry>> entries(bool recursive) override;
 
+  /**
+   * Visits the cached entries of this region, without creating a RegionEntry
+   * for each, until visitor returns false.
+   */
+  void forEachEntry(const EntriesMap::EntryVisitor& visitor);
+
   HashMapOfCacheable getAll(
       const std::vector<std::shared_ptr<CacheableKey>>& keys,
       const std::shared_ptr<Serializable>& aCallbackArgument =
@@ -226,6 +237,11 @@ class APACHE_GEODE_EXPORT LocalRegion : public RegionInternal {
       const std::shared_ptr<Serializable>& aCallbackArgument,
       bool addToLocalCache) override;
 
+  void getAllStreaming(const std::vector<std::shared_ptr<CacheableKey>>& keys,
+                       const GetAllEntryHandler& handler,
+                       const std::shared_ptr<Serializable>& aCallbackArgument =
+                           nullptr) override;
+
   void putAll(const HashMapOfCacheable& map,
               std::chrono::milliseconds timeout = DEFAULT_RESPONSE_TIMEOUT,
               const std::shared_ptr<Serializable>& aCallbackArgument =
@@ -403,6 +419,9 @@ class APACHE_GEODE_EXPORT LocalRegion : public RegionInternal {
 
   EntriesMap* getEntryMap() { return m_entries; }
 
+  /** Secondary indexes over the locally cached values of this region. */
+  query::IndexManager& getIndexManager() { return *m_indexManager; }
+
   std::shared_ptr<TombstoneList> getTombstoneList() override;
 
  protected:
@@ -457,6 +476,11 @@ class APACHE_GEODE_EXPORT LocalRegion : public RegionInternal {
           resultKeys,
       bool addToLocalCache,
       const std::shared_ptr<Serializable>& aCallbackArgument);
+  virtual GfErrType getAllStreamingNoThrow_remote(
+      const std::vector<std::shared_ptr<CacheableKey>>* keys,
+      const std::shared_ptr<HashMapOfException>& exceptions,
+      const GetAllEntryHandler& handler,
+      const std::shared_ptr<Serializable>& aCallbackArgument);
   virtual GfErrType invalidateRegionNoThrow_remote(
       const std::shared_ptr<Serializable>& aCallbackArgument);
   virtual GfErrType destroyRegionNoThrow_remote(
@@ -497,6 +521,13 @@ class APACHE_GEODE_EXPORT LocalRegion : public RegionInternal {
       const CacheEventFlags eventFlags, std::shared_ptr<VersionTag> versionTag,
       DataInput* delta = nullptr, std::shared_ptr<EventId> eventId = nullptr);
 
+  // keeps indexes in step with a changed entry; nullptr value removes it.
+  // value must be the one the entry was given, as the update is dropped
+  // once the entry holds another
+  void updateIndexes(const std::shared_ptr<CacheableKey>& key,
+                     const std::shared_ptr<Cacheable>& value);
+  void clearIndexes();
+
   int64_t startStatOpTime();
   void updateStatOpTime(Statistics* m_regionStats, int32_t statId,
                         int64_t start);
@@ -555,6 +586,7 @@ class APACHE_GEODE_EXPORT LocalRegion : public RegionInternal {
                         const bool recursive);
 
   std::shared_ptr<PersistenceManager> m_persistenceManager;
+  std::unique_ptr<query::IndexManager> m_indexManager;
 
   bool isStatisticsEnabled();
   bool useModifiedTimeForRegionExpiry();
@@ -31,6 +31,7 @@
 
 #include "CacheImpl.hpp"
 #include "CacheableToken.hpp"
+#include "CompressedValue.hpp"
 #include "ExpiryTaskManager.hpp"
 #include "RegionInternal.hpp"
 #include "VersionStamp.hpp"
@@ -215,11 +216,23 @@ class MapEntryImpl : public MapEntry,
     // If value is destroyed, then this returns nullptr
     if (CacheableToken::isDestroyed(m_value)) {
       result = nullptr;
+    } else if (CompressedValue::isCompressed(m_value)) {
+      result =
+          std::static_pointer_cast<CompressedValue>(m_value)->decompress();
     } else {
       result = m_value;
     }
   }
 
+  /**
+   * Returns the value as held, so a compressed value is not decompressed.
+   * MapSegment reads values this way under its lock and decompresses them
+   * after releasing it.
+   */
+  inline void getStoredValueI(std::shared_ptr<Cacheable>& result) const {
+    result = CacheableToken::isDestroyed(m_value) ? nullptr : m_value;
+  }
+
   inline void setValueI(const std::shared_ptr<Cacheable>& value) {
     m_value = value;
   }
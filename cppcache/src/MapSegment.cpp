@@ -55,6 +55,9 @@ void MapSegment::open(RegionInternal* region, const EntryFactory* entryFactory,
   m_expiryTaskManager = expiryTaskManager;
   m_numDestroyTrackers = destroyTrackers;
   m_concurrencyChecksEnabled = concurrencyChecksEnabled;
+  const auto& attributes = m_region->getAttributes();
+  m_compressor = attributes.getCompressor();
+  m_compressionThreshold = attributes.getCompressionThreshold();
 }
 
 void MapSegment::close() {}
@@ -74,6 +77,7 @@ GfErrType MapSegment::create(const std::shared_ptr<CacheableKey>& key,
                              std::shared_ptr<Cacheable>& oldValue,
                              int updateCount, int destroyTracker,
                              std::shared_ptr<VersionTag> versionTag) {
+  const auto storedValue = valueForCache(newValue);
   ExpiryTaskManager::id_type taskid = -1;
   TombstoneExpiryHandler* handler = nullptr;
   GfErrType err = GF_NOERR;
@@ -87,14 +91,14 @@ GfErrType MapSegment::create(const std::shared_ptr<CacheableKey>& key,
 
     const auto& find = m_map->find(key);
     if (find == m_map->end()) {
-      if ((err = putNoEntry(key, newValue, me, updateCount, destroyTracker,
+      if ((err = putNoEntry(key, storedValue, me, updateCount, destroyTracker,
                             versionTag)) != GF_NOERR) {
         return err;
       }
     } else {
       auto& entry = find->second;
       auto entryImpl = entry->getImplPtr();
-      entryImpl->getValueI(oldValue);
+      entryImpl->getStoredValueI(oldValue);
       if (oldValue == nullptr || CacheableToken::isTombstone(oldValue)) {
         // pass the version stamp
         VersionStamp versionStamp;
@@ -109,11 +113,11 @@ GfErrType MapSegment::create(const std::shared_ptr<CacheableKey>& key,
         }
         // good case; go ahead with the create
         if (oldValue == nullptr) {
-          err = putForTrackedEntry(key, newValue, entry, entryImpl, updateCount,
-                                   versionStamp);
+          err = putForTrackedEntry(key, storedValue, entry, entryImpl,
+                                   updateCount, versionStamp);
         } else {
           unguardedRemoveActualEntryWithoutCancelTask(key, handler, taskid);
-          err = putNoEntry(key, newValue, me, updateCount, destroyTracker,
+          err = putNoEntry(key, storedValue, me, updateCount, destroyTracker,
                            versionTag, &versionStamp);
         }
 
@@ -131,6 +135,7 @@ GfErrType MapSegment::create(const std::shared_ptr<CacheableKey>& key,
     m_expiryTaskManager->cancelTask(taskid);
     if (handler != nullptr) delete handler;
   }
+  oldValue = valueFromCache(oldValue);
   return err;
 }
 
@@ -144,6 +149,16 @@ GfErrType MapSegment::put(const std::shared_ptr<CacheableKey>& key,
                           int destroyTracker, bool& isUpdate,
                           std::shared_ptr<VersionTag> versionTag,
                           DataInput* delta) {
+  // a compressed region applies a delta to a copy of the value without the
+  // lock held, and puts the result only if the entry still holds that value
+  std::shared_ptr<Cacheable> deltaBase;
+  if (delta != nullptr && m_compressor != nullptr &&
+      (updateCount < 0 || m_concurrencyChecksEnabled)) {
+    auto& newValue1 = const_cast<std::shared_ptr<Cacheable>&>(newValue);
+    auto err = applyDeltaToCopy(key, newValue1, deltaBase, *delta);
+    if (err != GF_NOERR) return err;
+  }
+  const auto storedValue = valueForCache(newValue);
   ExpiryTaskManager::id_type taskid = -1;
   TombstoneExpiryHandler* handler = nullptr;
   GfErrType err = GF_NOERR;
@@ -162,13 +177,16 @@ GfErrType MapSegment::put(const std::shared_ptr<CacheableKey>& key,
       }
       // entry hence ask for full object
       isUpdate = false;
-      err = putNoEntry(key, newValue, me, updateCount, destroyTracker,
+      err = putNoEntry(key, storedValue, me, updateCount, destroyTracker,
                        versionTag);
     } else {
       auto& entry = find->second;
       auto entryImpl = entry->getImplPtr();
       std::shared_ptr<Cacheable> meOldValue;
-      entryImpl->getValueI(meOldValue);
+      entryImpl->getStoredValueI(meOldValue);
+      if (deltaBase != nullptr && meOldValue != deltaBase) {
+        return GF_INVALID_DELTA;  // updated while the delta was applied
+      }
       // pass the version stamp
       VersionStamp versionStamp;
       if (m_concurrencyChecksEnabled) {
@@ -188,12 +206,13 @@ GfErrType MapSegment::put(const std::shared_ptr<CacheableKey>& key,
       }
       if (CacheableToken::isTombstone(meOldValue)) {
         unguardedRemoveActualEntryWithoutCancelTask(key, handler, taskid);
-        err = putNoEntry(key, newValue, me, updateCount, destroyTracker,
+        err = putNoEntry(key, storedValue, me, updateCount, destroyTracker,
                          versionTag, &versionStamp);
         meOldValue = nullptr;
         isUpdate = false;
-      } else if ((err = putForTrackedEntry(key, newValue, entry, entryImpl,
-                                           updateCount, versionStamp, delta)) ==
+      } else if ((err = putForTrackedEntry(
+                      key, storedValue, entry, entryImpl, updateCount,
+                      versionStamp, deltaBase == nullptr ? delta : nullptr)) ==
                  GF_NOERR) {
         me = entryImpl;
         oldValue = meOldValue;
@@ -205,6 +224,7 @@ GfErrType MapSegment::put(const std::shared_ptr<CacheableKey>& key,
     m_expiryTaskManager->cancelTask(taskid);
     if (handler != nullptr) delete handler;
   }
+  oldValue = valueFromCache(oldValue);
   return err;
 }
 
@@ -213,47 +233,51 @@ GfErrType MapSegment::invalidate(const std::shared_ptr<CacheableKey>& key,
                                  std::shared_ptr<Cacheable>& oldValue,
                                  std::shared_ptr<VersionTag> versionTag,
                                  bool& isTokenAdded) {
-  std::lock_guard<decltype(m_spinlock)> lk(m_spinlock);
   isTokenAdded = false;
   GfErrType err = GF_NOERR;
+  {
+    std::lock_guard<decltype(m_spinlock)> lk(m_spinlock);
 
-  const auto& find = m_map->find(key);
-  if (find != m_map->end()) {
-    auto entry = find->second;
-    VersionStamp versionStamp;
-    if (m_concurrencyChecksEnabled) {
-      versionStamp = entry->getVersionStamp();
-      if (versionTag) {
-        err = versionStamp.processVersionTag(m_region, key, versionTag, false);
-        if (err != GF_NOERR) return err;
-        versionStamp.setVersions(versionTag);
+    const auto& find = m_map->find(key);
+    if (find != m_map->end()) {
+      auto entry = find->second;
+      VersionStamp versionStamp;
+      if (m_concurrencyChecksEnabled) {
+        versionStamp = entry->getVersionStamp();
+        if (versionTag) {
+          err =
+              versionStamp.processVersionTag(m_region, key, versionTag, false);
+          if (err != GF_NOERR) return err;
+          versionStamp.setVersions(versionTag);
+        }
       }
-    }
-    auto entryImpl = entry->getImplPtr();
-    entryImpl->getValueI(oldValue);
-    if (CacheableToken::isTombstone(oldValue)) {
-      oldValue = nullptr;
-      return GF_CACHE_ENTRY_NOT_FOUND;
-    }
-    entryImpl->setValueI(CacheableToken::invalid());
-    if (m_concurrencyChecksEnabled) {
-      entryImpl->getVersionStamp().setVersions(versionStamp);
-    }
-    (void)incrementUpdateCount(key, entry);
-    if (oldValue != nullptr) {
-      me = entryImpl;
-    }
-  } else {
-    // create new entry for the key if concurrencychecksEnabled is true
-    if (m_concurrencyChecksEnabled) {
-      if ((err = putNoEntry(key, CacheableToken::invalid(), me, -1, -1,
-                            versionTag)) != GF_NOERR) {
-        return err;
+      auto entryImpl = entry->getImplPtr();
+      entryImpl->getStoredValueI(oldValue);
+      if (CacheableToken::isTombstone(oldValue)) {
+        oldValue = nullptr;
+        return GF_CACHE_ENTRY_NOT_FOUND;
       }
-      isTokenAdded = true;
+      entryImpl->setValueI(CacheableToken::invalid());
+      if (m_concurrencyChecksEnabled) {
+        entryImpl->getVersionStamp().setVersions(versionStamp);
+      }
+      (void)incrementUpdateCount(key, entry);
+      if (oldValue != nullptr) {
+        me = entryImpl;
+      }
+    } else {
+      // create new entry for the key if concurrencychecksEnabled is true
+      if (m_concurrencyChecksEnabled) {
+        if ((err = putNoEntry(key, CacheableToken::invalid(), me, -1, -1,
+                              versionTag)) != GF_NOERR) {
+          return err;
+        }
+        isTokenAdded = true;
+      }
+      err = GF_CACHE_ENTRY_NOT_FOUND;
     }
-    err = GF_CACHE_ENTRY_NOT_FOUND;
   }
+  oldValue = valueFromCache(oldValue);
   return err;
 }
 
@@ -282,9 +306,9 @@ GfErrType MapSegment::removeWhenConcurrencyEnabled(
       }
       versionStamp.setVersions(versionTag);
     }
-    // Get the old value for returning
+    // Get the old value for returning, decompressed by the caller
     auto entryImpl = entry->getImplPtr();
-    entryImpl->getValueI(oldValue);
+    entryImpl->getStoredValueI(oldValue);
 
     if (oldValue) me = entryImpl;
 
@@ -348,37 +372,40 @@ GfErrType MapSegment::remove(const std::shared_ptr<CacheableKey>& key,
       m_expiryTaskManager->cancelTask(id);
       delete handler;
     }
+    oldValue = valueFromCache(oldValue);
     return err;
   }
 
-  std::lock_guard<decltype(m_spinlock)> lk(m_spinlock);
-  auto&& iter = m_map->find(key);
+  {
+    std::lock_guard<decltype(m_spinlock)> lk(m_spinlock);
+    auto&& iter = m_map->find(key);
 
-  if (iter == m_map->end()) {
-    // didn't unbind, probably no entry...
-    oldValue = nullptr;
-    volatile int destroyTrackers = *m_numDestroyTrackers;
-    if (destroyTrackers > 0) {
-      m_destroyedKeys[key] = destroyTrackers + 1;
+    if (iter == m_map->end()) {
+      // didn't unbind, probably no entry...
+      oldValue = nullptr;
+      volatile int destroyTrackers = *m_numDestroyTrackers;
+      if (destroyTrackers > 0) {
+        m_destroyedKeys[key] = destroyTrackers + 1;
+      }
+      return GF_CACHE_ENTRY_NOT_FOUND;
     }
-    return GF_CACHE_ENTRY_NOT_FOUND;
-  }
 
-  auto entry = iter->second;
-  m_map->erase(iter);
+    auto entry = iter->second;
+    m_map->erase(iter);
 
-  if (updateCount >= 0 && updateCount != entry->getUpdateCount()) {
-    // this is the case when entry has been updated while being tracked
-    return GF_CACHE_ENTRY_UPDATED;
-  }
+    if (updateCount >= 0 && updateCount != entry->getUpdateCount()) {
+      // this is the case when entry has been updated while being tracked
+      return GF_CACHE_ENTRY_UPDATED;
+    }
 
-  auto entryImpl = entry->getImplPtr();
-  entryImpl->getValueI(oldValue);
-  if (CacheableToken::isTombstone(oldValue)) oldValue = nullptr;
-  if (oldValue) {
-    me = entryImpl;
+    auto entryImpl = entry->getImplPtr();
+    entryImpl->getStoredValueI(oldValue);
+    if (CacheableToken::isTombstone(oldValue)) oldValue = nullptr;
+    if (oldValue) {
+      me = entryImpl;
+    }
   }
-
+  oldValue = valueFromCache(oldValue);
   return GF_NOERR;
 }
 
@@ -414,25 +441,28 @@ bool MapSegment::removeActualEntry(const std::shared_ptr<CacheableKey>& key,
 bool MapSegment::getEntry(const std::shared_ptr<CacheableKey>& key,
                           std::shared_ptr<MapEntryImpl>& result,
                           std::shared_ptr<Cacheable>& value) {
-  std::lock_guard<decltype(m_spinlock)> lk(m_spinlock);
+  {
+    std::lock_guard<decltype(m_spinlock)> lk(m_spinlock);
 
-  const auto& find = m_map->find(key);
-  if (find == m_map->end()) {
-    result = nullptr;
-    value = nullptr;
-    return false;
-  }
-  auto entry = find->second;
+    const auto& find = m_map->find(key);
+    if (find == m_map->end()) {
+      result = nullptr;
+      value = nullptr;
+      return false;
+    }
+    auto entry = find->second;
 
-  // If the value is a tombstone return not found
-  auto mePtr = entry->getImplPtr();
-  mePtr->getValueI(value);
-  if (value == nullptr || CacheableToken::isTombstone(value)) {
-    result = nullptr;
-    value = nullptr;
-    return false;
+    // If the value is a tombstone return not found
+    auto mePtr = entry->getImplPtr();
+    mePtr->getStoredValueI(value);
+    if (value == nullptr || CacheableToken::isTombstone(value)) {
+      result = nullptr;
+      value = nullptr;
+      return false;
+    }
+    result = mePtr;
   }
-  result = mePtr;
+  value = valueFromCache(value);
   return true;
 }
 
@@ -451,12 +481,31 @@ bool MapSegment::containsKey(const std::shared_ptr<CacheableKey>& key) {
   // If the value is a tombstone return not found
   std::shared_ptr<Cacheable> value;
   auto mePtr1 = mePtr->getImplPtr();
-  mePtr1->getValueI(value);
+  mePtr1->getStoredValueI(value);
   if (value != nullptr && CacheableToken::isTombstone(value)) return false;
 
   return true;
 }
 
+bool MapSegment::holdsValue(const std::shared_ptr<CacheableKey>& key,
+                            const std::shared_ptr<Cacheable>& value) {
+  std::shared_ptr<Cacheable> stored;
+  {
+    std::lock_guard<decltype(m_spinlock)> lk(m_spinlock);
+    const auto& find = m_map->find(key);
+    if (find != m_map->end()) {
+      find->second->getImplPtr()->getStoredValueI(stored);
+    }
+  }
+  if (value == nullptr) {
+    return stored == nullptr || (CacheableToken::isToken(stored) &&
+                                 !CacheableToken::isOverflowed(stored));
+  }
+  return stored == value ||
+         (CompressedValue::isCompressed(stored) &&
+          std::static_pointer_cast<CompressedValue>(stored)->holds(value));
+}
+
 /**
  * @brief return the all the keys in the provided list.
  */
@@ -465,7 +514,7 @@ void MapSegment::getKeys(std::vector<std::shared_ptr<CacheableKey>>& result) {
 
   for (const auto& kv : *m_map) {
     std::shared_ptr<Cacheable> valuePtr;
-    kv.second->getImplPtr()->getValueI(valuePtr);
+    kv.second->getImplPtr()->getStoredValueI(valuePtr);
     if (!CacheableToken::isTombstone(valuePtr)) {
       result.push_back(kv.first);
     }
@@ -476,45 +525,94 @@ void MapSegment::getKeys(std::vector<std::shared_ptr<CacheableKey>>& result) {
  * @brief return all the entries in the provided list.
  */
 void MapSegment::getEntries(std::vector<std::shared_ptr<RegionEntry>>& result) {
-  std::lock_guard<decltype(m_spinlock)> lk(m_spinlock);
+  key_value_list keyValues;
+  {
+    std::lock_guard<decltype(m_spinlock)> lk(m_spinlock);
 
-  for (const auto& kv : *m_map) {
-    std::shared_ptr<CacheableKey> keyPtr;
-    std::shared_ptr<Cacheable> valuePtr;
-    auto me = kv.second->getImplPtr();
-    me->getValueI(valuePtr);
-    if (valuePtr && !CacheableToken::isTombstone(valuePtr)) {
-      if (CacheableToken::isInvalid(valuePtr)) {
-        valuePtr = nullptr;
+    for (const auto& kv : *m_map) {
+      std::shared_ptr<CacheableKey> keyPtr;
+      std::shared_ptr<Cacheable> valuePtr;
+      auto me = kv.second->getImplPtr();
+      me->getStoredValueI(valuePtr);
+      if (valuePtr && !CacheableToken::isTombstone(valuePtr)) {
+        if (CacheableToken::isInvalid(valuePtr)) {
+          valuePtr = nullptr;
+        }
+        me->getKeyI(keyPtr);
+        keyValues.emplace_back(std::move(keyPtr), std::move(valuePtr));
       }
-      me->getKeyI(keyPtr);
-      auto rePtr = m_region->createRegionEntry(keyPtr, valuePtr);
-      result.push_back(rePtr);
     }
   }
+  for (const auto& kv : keyValues) {
+    result.push_back(
+        m_region->createRegionEntry(kv.first, valueFromCache(kv.second)));
+  }
+}
+
+void MapSegment::getKeyValues(key_value_list& result) {
+  auto begin = result.size();
+  {
+    std::lock_guard<decltype(m_spinlock)> lk(m_spinlock);
+
+    for (const auto& kv : *m_map) {
+      std::shared_ptr<Cacheable> valuePtr;
+      kv.second->getImplPtr()->getStoredValueI(valuePtr);
+      if (valuePtr && !CacheableToken::isTombstone(valuePtr)) {
+        if (CacheableToken::isInvalid(valuePtr)) {
+          valuePtr = nullptr;
+        }
+        result.emplace_back(kv.first, std::move(valuePtr));
+      }
+    }
+  }
+  for (auto i = begin; i < result.size(); ++i) {
+    result[i].second = valueFromCache(result[i].second);
+  }
 }
 
 /**
  * @brief return all values in the provided list.
  */
 void MapSegment::getValues(std::vector<std::shared_ptr<Cacheable>>& result) {
-  std::lock_guard<decltype(m_spinlock)> lk(m_spinlock);
-  for (const auto& kv : *m_map) {
-    auto& entry = kv.second;
-    std::shared_ptr<Cacheable> value;
-    entry->getValue(value);
-    auto entryImpl = entry->getImplPtr();
+  auto begin = result.size();
+  std::vector<std::pair<std::shared_ptr<CacheableKey>,
+                        std::shared_ptr<MapEntryImpl>>>
+      overflowed;
+  {
+    std::lock_guard<decltype(m_spinlock)> lk(m_spinlock);
+    for (const auto& kv : *m_map) {
+      auto& entry = kv.second;
+      std::shared_ptr<Cacheable> value;
+      auto entryImpl = entry->getImplPtr();
+      entryImpl->getStoredValueI(value);
 
-    if (value && !CacheableToken::isInvalid(value) &&
-        !CacheableToken::isDestroyed(value) &&
-        !CacheableToken::isTombstone(value)) {
-      if (CacheableToken::isOverflowed(value)) {  // get Value from disc.
-        auto& key = kv.first;
-        value = getFromDisc(key, entryImpl);
-        entryImpl->setValueI(value);
+      if (value && !CacheableToken::isInvalid(value) &&
+          !CacheableToken::isTombstone(value)) {
+        if (CacheableToken::isOverflowed(value)) {
+          overflowed.emplace_back(kv.first, std::move(entryImpl));
+        } else {
+          result.push_back(std::move(value));
+        }
+      }
+    }
+  }
+  for (auto i = begin; i < result.size(); ++i) {
+    result[i] = valueFromCache(result[i]);
+  }
+  // read overflowed values back from disc, keeping them unless the entry
+  // changed meanwhile
+  for (auto& keyEntry : overflowed) {
+    auto value = getFromDisc(keyEntry.first, keyEntry.second);
+    auto storedValue = valueForCache(value);
+    {
+      std::lock_guard<decltype(m_spinlock)> lk(m_spinlock);
+      std::shared_ptr<Cacheable> current;
+      keyEntry.second->getStoredValueI(current);
+      if (CacheableToken::isOverflowed(current)) {
+        keyEntry.second->setValueI(storedValue);
       }
-      result.push_back(value);
     }
+    result.push_back(std::move(value));
   }
 }
 
@@ -526,46 +624,49 @@ int MapSegment::addTrackerForEntry(const std::shared_ptr<CacheableKey>& key,
                                    bool addIfAbsent, bool failIfPresent,
                                    bool incUpdateCount) {
   if (m_concurrencyChecksEnabled) return -1;
-  std::lock_guard<decltype(m_spinlock)> lk(m_spinlock);
-  std::shared_ptr<MapEntry> entry;
-  std::shared_ptr<MapEntry> newEntry;
-  const auto& find = m_map->find(key);
-  if (find == m_map->end()) {
-    oldValue = nullptr;
-    if (addIfAbsent) {
-      std::shared_ptr<MapEntryImpl> entryImpl;
-      // add a new entry with value as destroyed
-      m_entryFactory->newMapEntry(m_expiryTaskManager, key, entryImpl);
-      entryImpl->setValueI(CacheableToken::destroyed());
-      entry = entryImpl;
-      newEntry = entryImpl;
-    } else {
-      // return -1 without adding an entry
-      return -1;
-    }
-  } else {
-    entry = find->second;
-    entry->getValue(oldValue);
-    if (failIfPresent) {
-      // return -1 without adding an entry; the callee should check on
-      // oldValue to distinguish this case from "addIfAbsent==false" case
-      return -1;
-    }
-  }
-  int updateCount;
-  if (incUpdateCount) {
-    (void)entry->addTracker(newEntry);
-    updateCount = entry->incrementUpdateCount(newEntry);
-  } else {
-    updateCount = entry->addTracker(newEntry);
-  }
-  if (newEntry) {
+  int updateCount = -1;
+  {
+    std::lock_guard<decltype(m_spinlock)> lk(m_spinlock);
+    std::shared_ptr<MapEntry> entry;
+    std::shared_ptr<MapEntry> newEntry;
+    const auto& find = m_map->find(key);
     if (find == m_map->end()) {
-      m_map->emplace(key, newEntry);
+      oldValue = nullptr;
+      if (addIfAbsent) {
+        std::shared_ptr<MapEntryImpl> entryImpl;
+        // add a new entry with value as destroyed
+        m_entryFactory->newMapEntry(m_expiryTaskManager, key, entryImpl);
+        entryImpl->setValueI(CacheableToken::destroyed());
+        entry = entryImpl;
+        newEntry = entryImpl;
+      } else {
+        // return -1 without adding an entry
+        return -1;
+      }
     } else {
-      find->second = newEntry;
+      entry = find->second;
+      entry->getImplPtr()->getStoredValueI(oldValue);
+    }
+    // when failIfPresent finds an entry return -1 without adding a tracker;
+    // the callee should check on oldValue to distinguish this case from
+    // "addIfAbsent==false" case
+    if (find == m_map->end() || !failIfPresent) {
+      if (incUpdateCount) {
+        (void)entry->addTracker(newEntry);
+        updateCount = entry->incrementUpdateCount(newEntry);
+      } else {
+        updateCount = entry->addTracker(newEntry);
+      }
+      if (newEntry) {
+        if (find == m_map->end()) {
+          m_map->emplace(key, newEntry);
+        } else {
+          find->second = newEntry;
+        }
+      }
     }
   }
+  oldValue = valueFromCache(oldValue);
   return updateCount;
 }
 
@@ -625,6 +726,63 @@ void MapSegment::rehash() {
   m_map->reserve(newMapSize);
   m_rehashCount++;
 }
+ThinClientPoolDM* MapSegment::notificationPoolDM() const {
+  auto* thinClientRegion = dynamic_cast<ThinClientRegion*>(m_region);
+  if (thinClientRegion == nullptr) return nullptr;
+  return dynamic_cast<ThinClientPoolDM*>(thinClientRegion->getDistMgr());
+}
+
+GfErrType MapSegment::applyDeltaToCopy(
+    const std::shared_ptr<CacheableKey>& key,
+    std::shared_ptr<Cacheable>& newValue, std::shared_ptr<Cacheable>& base,
+    DataInput& delta) {
+  std::shared_ptr<Cacheable> oldValue;
+  {
+    std::lock_guard<decltype(m_spinlock)> lk(m_spinlock);
+    const auto& find = m_map->find(key);
+    if (find == m_map->end()) {
+      return GF_INVALID_DELTA;  // no entry, hence ask for the full object
+    }
+    auto entryImpl = find->second->getImplPtr();
+    entryImpl->getStoredValueI(base);
+    oldValue = base;
+    if (CacheableToken::isOverflowed(oldValue)) {  // get Value from disc.
+      oldValue = getFromDisc(key, entryImpl);
+    }
+  }
+
+  auto m_poolDM = notificationPoolDM();
+  if (oldValue == nullptr || CacheableToken::isToken(oldValue)) {
+    if (m_poolDM) {
+      m_poolDM->updateNotificationStats(false, std::chrono::nanoseconds(0));
+    }
+    return GF_INVALID_DELTA;
+  }
+
+  using clock = std::chrono::steady_clock;
+
+  // the entry keeps its value until the put, so the delta always goes to a
+  // copy, whether or not cloning is enabled
+  std::shared_ptr<Delta> valueWithDelta;
+  if (CompressedValue::isCompressed(oldValue)) {
+    valueWithDelta = std::dynamic_pointer_cast<Delta>(
+        std::static_pointer_cast<CompressedValue>(oldValue)->decompressCopy());
+  } else {
+    valueWithDelta = std::dynamic_pointer_cast<Delta>(oldValue)->clone();
+  }
+  try {
+    auto currTimeBefore = clock::now();
+    valueWithDelta->fromDelta(delta);
+    if (m_poolDM) {
+      m_poolDM->updateNotificationStats(true, clock::now() - currTimeBefore);
+    }
+  } catch (InvalidDeltaException&) {
+    return GF_INVALID_DELTA;
+  }
+  newValue = std::dynamic_pointer_cast<Serializable>(valueWithDelta);
+  return GF_NOERR;
+}
+
 std::shared_ptr<Cacheable> MapSegment::getFromDisc(
     std::shared_ptr<CacheableKey> key,
     std::shared_ptr<MapEntryImpl>& entryImpl) {
@@ -641,16 +799,10 @@ GfErrType MapSegment::putForTrackedEntry(
   if (updateCount < 0 || m_concurrencyChecksEnabled) {
     // for a non-tracked put (e.g. from notification) go ahead with the
     // create/update and increment the update counter
-    auto* thinClientRegion = dynamic_cast<ThinClientRegion*>(m_region);
-    ThinClientPoolDM* m_poolDM = nullptr;
-    if (thinClientRegion) {
-      m_poolDM =
-          dynamic_cast<ThinClientPoolDM*>(thinClientRegion->getDistMgr());
-    }
-
     if (delta != nullptr) {
+      auto m_poolDM = notificationPoolDM();
       std::shared_ptr<Cacheable> oldValue;
-      entryImpl->getValueI(oldValue);
+      entryImpl->getStoredValueI(oldValue);
       if (oldValue == nullptr || CacheableToken::isDestroyed(oldValue) ||
           CacheableToken::isInvalid(oldValue) ||
           CacheableToken::isTombstone(oldValue)) {
@@ -695,8 +847,7 @@ GfErrType MapSegment::putForTrackedEntry(
             m_poolDM->updateNotificationStats(true,
                                               clock::now() - currTimeBefore);
           }
-          entryImpl->setValueI(
-              std::dynamic_pointer_cast<Serializable>(valueWithDelta));
+          entryImpl->setValueI(newValue1);
         }
       } catch (InvalidDeltaException&) {
         return GF_INVALID_DELTA;
@@ -750,7 +901,7 @@ GfErrType MapSegment::isTombstone(std::shared_ptr<CacheableKey> key,
     return GF_NOERR;
   }
 
-  mePtr->getValueI(value);
+  mePtr->getStoredValueI(value);
   if (!value) {
     result = false;
     return GF_NOERR;
@@ -23,9 +23,11 @@
 #include <memory>
 #include <mutex>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <geode/CacheableKey.hpp>
+#include <geode/Compressor.hpp>
 #include <geode/Delta.hpp>
 #include <geode/RegionEntry.hpp>
 #include <geode/internal/geode_globals.hpp>
@@ -41,6 +43,7 @@ namespace geode {
 namespace client {
 
 class RegionInternal;
+class ThinClientPoolDM;
 typedef std::unordered_map<std::shared_ptr<CacheableKey>,
                            std::shared_ptr<MapEntry>,
                            dereference_hash<std::shared_ptr<CacheableKey>>,
@@ -74,6 +77,28 @@ class APACHE_GEODE_EXPORT MapSegment {
   void rehash();
   std::shared_ptr<TombstoneList> m_tombstoneList;
 
+  // the region's compressor, if any, and the smallest serialized value it
+  // is applied to
+  std::shared_ptr<Compressor> m_compressor;
+  size_t m_compressionThreshold;
+
+  // the form in which value is held by a map entry; compressing can take a
+  // while, so this is called before m_spinlock is taken
+  inline std::shared_ptr<Cacheable> valueForCache(
+      const std::shared_ptr<Cacheable>& value) const {
+    if (m_compressor == nullptr) return value;
+    return CompressedValue::create(value, m_compressor, m_compressionThreshold,
+                                   m_region->getCacheImpl());
+  }
+
+  // the value held by a map entry as the region sees it; called after
+  // m_spinlock is released
+  static inline std::shared_ptr<Cacheable> valueFromCache(
+      const std::shared_ptr<Cacheable>& value) {
+    if (!CompressedValue::isCompressed(value)) return value;
+    return std::static_pointer_cast<CompressedValue>(value)->decompress();
+  }
+
   // increment update counter of the given entry and return true if entry
   // was rebound
   inline bool incrementUpdateCount(const std::shared_ptr<CacheableKey>& key,
@@ -106,7 +131,7 @@ class APACHE_GEODE_EXPORT MapSegment {
       if (entryImpl == nullptr) {
         entryImpl = entry->getImplPtr();
       }
-      entryImpl->getValueI(value);
+      entryImpl->getStoredValueI(value);
       if (value == nullptr) {
         // get rid of an entry marked as destroyed
         m_map->erase(key);
@@ -119,6 +144,7 @@ class APACHE_GEODE_EXPORT MapSegment {
     }
   }
 
+  // newValue is held as given, so it has been through valueForCache
   inline GfErrType putNoEntry(const std::shared_ptr<CacheableKey>& key,
                               const std::shared_ptr<Cacheable>& newValue,
                               std::shared_ptr<MapEntryImpl>& newEntry,
@@ -152,6 +178,8 @@ class APACHE_GEODE_EXPORT MapSegment {
     return GF_NOERR;
   }
 
+  // as for putNoEntry, newValue has been through valueForCache; a delta is
+  // only passed for regions without a compressor
   GfErrType putForTrackedEntry(const std::shared_ptr<CacheableKey>& key,
                                const std::shared_ptr<Cacheable>& newValue,
                                std::shared_ptr<MapEntry>& entry,
@@ -159,6 +187,13 @@ class APACHE_GEODE_EXPORT MapSegment {
                                int updateCount, VersionStamp& versionStamp,
                                DataInput* delta = nullptr);
 
+  GfErrType applyDeltaToCopy(const std::shared_ptr<CacheableKey>& key,
+                             std::shared_ptr<Cacheable>& newValue,
+                             std::shared_ptr<Cacheable>& base,
+                             DataInput& delta);
+
+  ThinClientPoolDM* notificationPoolDM() const;
+
   std::shared_ptr<Cacheable> getFromDisc(
       std::shared_ptr<CacheableKey> key,
       std::shared_ptr<MapEntryImpl>& entryImpl);
@@ -182,7 +217,8 @@ class APACHE_GEODE_EXPORT MapSegment {
         m_concurrencyChecksEnabled(false),
         m_numDestroyTrackers(nullptr),
         m_rehashCount(0),
-        m_tombstoneList(nullptr) {}
+        m_tombstoneList(nullptr),
+        m_compressionThreshold(0) {}
 
   ~MapSegment();
 
@@ -252,6 +288,13 @@ class APACHE_GEODE_EXPORT MapSegment {
    */
   bool containsKey(const std::shared_ptr<CacheableKey>& key);
 
+  /**
+   * @brief return true if the entry for key holds value, the one put for it
+   * rather than an equal one; for a nullptr value, true if key has no value.
+   */
+  bool holdsValue(const std::shared_ptr<CacheableKey>& key,
+                  const std::shared_ptr<Cacheable>& value);
+
   /**
    * @brief return the all the keys in the provided list.
    */
@@ -267,6 +310,16 @@ class APACHE_GEODE_EXPORT MapSegment {
    */
   void getValues(std::vector<std::shared_ptr<Cacheable>>& result);
 
+  typedef std::vector<
+      std::pair<std::shared_ptr<CacheableKey>, std::shared_ptr<Cacheable>>>
+      key_value_list;
+
+  /**
+   * @brief return each key with its value, nullptr for an invalid entry, in
+   * the provided list.
+   */
+  void getKeyValues(key_value_list& result);
+
   inline uint32_t rehashCount() { return m_rehashCount; }
 
   int addTrackerForEntry(const std::shared_ptr<CacheableKey>& key,
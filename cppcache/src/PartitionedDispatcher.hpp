@@ -0,0 +1,228 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_PARTITIONEDDISPATCHER_H_
+#define GEODE_PARTITIONEDDISPATCHER_H_
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "AppDomainContext.hpp"
+#include "DistributedSystemImpl.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * @class PartitionedDispatcher PartitionedDispatcher.hpp
+ *
+ * Hands items to a fixed set of worker threads, one bounded queue per
+ * worker. The caller picks the partition with a hash, so items with the same
+ * hash are handled one at a time in the order they were dispatched while
+ * items with different hashes are handled in parallel. When a partition's
+ * queue is full dispatch() blocks until the worker catches up.
+ */
+template <class T>
+class PartitionedDispatcher {
+ public:
+  typedef std::function<void(T&)> Handler;
+
+  struct Statistics {
+    /** items handed to workers */
+    uint64_t dispatched;
+    /** dispatches that had to wait for queue space */
+    uint64_t blocked;
+    /** total time spent waiting for queue space */
+    std::chrono::nanoseconds blockedTime;
+    /** deepest any partition's queue has been */
+    size_t maxQueueDepth;
+  };
+
+  PartitionedDispatcher(size_t partitions, size_t queueCapacity,
+                        Handler handler, const char* threadName)
+      : m_queueCapacity(queueCapacity > 0 ? queueCapacity : 1),
+        m_handler(std::move(handler)),
+        m_threadName(threadName),
+        m_appDomainContext(createAppDomainContext()),
+        m_dispatched(0),
+        m_blocked(0),
+        m_blockedNanos(0),
+        m_maxQueueDepth(0) {
+    if (partitions == 0) {
+      partitions = 1;
+    }
+    m_partitions.reserve(partitions);
+    for (size_t i = 0; i < partitions; i++) {
+      m_partitions.emplace_back(new Partition());
+    }
+    for (auto& partition : m_partitions) {
+      auto worker = partition.get();
+      partition->thread = std::thread([this, worker] {
+        if (m_appDomainContext) {
+          m_appDomainContext->run([this, worker] { run(*worker); });
+        } else {
+          run(*worker);
+        }
+      });
+    }
+  }
+
+  /**
+   * Handles everything already dispatched, then joins the workers.
+   */
+  ~PartitionedDispatcher() { stop(); }
+
+  PartitionedDispatcher(const PartitionedDispatcher&) = delete;
+  PartitionedDispatcher& operator=(const PartitionedDispatcher&) = delete;
+
+  void dispatch(size_t hash, T item) {
+    auto& partition = *m_partitions[hash % m_partitions.size()];
+    std::unique_lock<std::mutex> lock(partition.mutex);
+    if (partition.queue.size() >= m_queueCapacity) {
+      const auto start = std::chrono::steady_clock::now();
+      partition.notFull.wait(lock, [this, &partition] {
+        return partition.queue.size() < m_queueCapacity;
+      });
+      m_blocked.fetch_add(1, std::memory_order_relaxed);
+      m_blockedNanos.fetch_add(
+          std::chrono::duration_cast<std::chrono::nanoseconds>(
+              std::chrono::steady_clock::now() - start)
+              .count(),
+          std::memory_order_relaxed);
+    }
+    partition.queue.push_back(std::move(item));
+    const auto depth = partition.queue.size();
+    lock.unlock();
+    partition.notEmpty.notify_one();
+
+    m_dispatched.fetch_add(1, std::memory_order_relaxed);
+    auto maxDepth = m_maxQueueDepth.load(std::memory_order_relaxed);
+    while (depth > maxDepth &&
+           !m_maxQueueDepth.compare_exchange_weak(maxDepth, depth,
+                                                  std::memory_order_relaxed)) {
+    }
+  }
+
+  /**
+   * Blocks until every item dispatched so far has been handled.
+   */
+  void drain() {
+    for (auto& partition : m_partitions) {
+      std::unique_lock<std::mutex> lock(partition->mutex);
+      partition->notFull.wait(lock, [&partition] {
+        return partition->queue.empty() && !partition->busy;
+      });
+    }
+  }
+
+  void stop() {
+    for (auto& partition : m_partitions) {
+      std::lock_guard<std::mutex> guard(partition->mutex);
+      partition->stopped = true;
+      partition->notEmpty.notify_all();
+    }
+    for (auto& partition : m_partitions) {
+      if (partition->thread.joinable()) {
+        partition->thread.join();
+      }
+    }
+  }
+
+  size_t partitions() const { return m_partitions.size(); }
+
+  Statistics getStatistics() const {
+    Statistics statistics;
+    statistics.dispatched = m_dispatched.load(std::memory_order_relaxed);
+    statistics.blocked = m_blocked.load(std::memory_order_relaxed);
+    statistics.blockedTime = std::chrono::nanoseconds(
+        m_blockedNanos.load(std::memory_order_relaxed));
+    statistics.maxQueueDepth = m_maxQueueDepth.load(std::memory_order_relaxed);
+    return statistics;
+  }
+
+ private:
+  struct Partition {
+    Partition() : busy(false), stopped(false) {}
+
+    std::mutex mutex;
+    std::condition_variable notEmpty;
+    std::condition_variable notFull;
+    std::deque<T> queue;
+    bool busy;
+    bool stopped;
+    std::thread thread;
+  };
+
+  void run(Partition& partition) {
+    DistributedSystemImpl::setThreadName(m_threadName);
+    std::unique_lock<std::mutex> lock(partition.mutex);
+    while (true) {
+      partition.notEmpty.wait(lock, [&partition] {
+        return partition.stopped || !partition.queue.empty();
+      });
+      if (partition.queue.empty()) {
+        break;
+      }
+
+      auto item = std::move(partition.queue.front());
+      partition.queue.pop_front();
+      partition.busy = true;
+      lock.unlock();
+      partition.notFull.notify_all();
+
+      try {
+        m_handler(item);
+      } catch (...) {
+        // the handler reports its own failures
+      }
+
+      lock.lock();
+      partition.busy = false;
+      if (partition.queue.empty()) {
+        partition.notFull.notify_all();
+      }
+    }
+  }
+
+  const size_t m_queueCapacity;
+  const Handler m_handler;
+  const char* m_threadName;
+  std::unique_ptr<AppDomainContext> m_appDomainContext;
+  std::vector<std::unique_ptr<Partition>> m_partitions;
+
+  std::atomic<uint64_t> m_dispatched;
+  std::atomic<uint64_t> m_blocked;
+  std::atomic<int64_t> m_blockedNanos;
+  std::atomic<size_t> m_maxQueueDepth;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_PARTITIONEDDISPATCHER_H_
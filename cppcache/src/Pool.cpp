@@ -125,6 +125,10 @@ bool Pool::getPRSingleHopEnabled() const {
   return m_attrs->getPRSingleHopEnabled();
 }
 
+bool Pool::getLatencyAwareReads() const {
+  return m_attrs->getLatencyAwareReads();
+}
+
 int Pool::getPendingEventCount() const {
   const auto poolHADM = dynamic_cast<const ThinClientPoolHADM*>(this);
   if (nullptr == poolHADM || poolHADM->isReadyForEvent()) {
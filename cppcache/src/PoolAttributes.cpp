@@ -44,6 +44,7 @@ PoolAttributes::PoolAttributes()
       m_subsEnabled(PoolFactory::DEFAULT_SUBSCRIPTION_ENABLED),
       m_multiuserSecurityMode(PoolFactory::DEFAULT_MULTIUSER_SECURE_MODE),
       m_isPRSingleHopEnabled(PoolFactory::DEFAULT_PR_SINGLE_HOP_ENABLED),
+      m_latencyAwareReads(PoolFactory::DEFAULT_LATENCY_AWARE_READS),
       m_serverGrp(PoolFactory::DEFAULT_SERVER_GROUP),
       m_sniProxyPort(0) {}
 
@@ -164,6 +164,10 @@ class PoolAttributes {
 
   void setPRSingleHopEnabled(bool enabled) { m_isPRSingleHopEnabled = enabled; }
 
+  bool getLatencyAwareReads() const { return m_latencyAwareReads; }
+
+  void setLatencyAwareReads(bool enabled) { m_latencyAwareReads = enabled; }
+
   bool getMultiuserSecureModeEnabled() const { return m_multiuserSecurityMode; }
 
   void setMultiuserSecureModeEnabled(bool multiuserSecureMode) {
@@ -197,6 +201,7 @@ class PoolAttributes {
   bool m_subsEnabled;
   bool m_multiuserSecurityMode;
   bool m_isPRSingleHopEnabled;
+  bool m_latencyAwareReads;
 
   std::string m_serverGrp;
   std::vector<std::string> m_initLocList;
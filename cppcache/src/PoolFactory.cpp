@@ -236,6 +236,12 @@ PoolFactory& PoolFactory::setPRSingleHopEnabled(bool enabled) {
   m_attrs->setPRSingleHopEnabled(enabled);
   return *this;
 }
+
+PoolFactory& PoolFactory::setLatencyAwareReads(bool enabled) {
+  m_attrs->setLatencyAwareReads(enabled);
+  return *this;
+}
+
 std::shared_ptr<Pool> PoolFactory::create(std::string name) {
   std::shared_ptr<ThinClientPoolDM> poolDM;
 
@@ -31,7 +31,7 @@ PoolStats::PoolStats(StatisticsFactory* factory, const std::string& poolName) {
   auto statsType = factory->findType(STATS_NAME);
 
   if (statsType == nullptr) {
-    std::vector<std::shared_ptr<StatisticDescriptor>> stats(27);
+    std::vector<std::shared_ptr<StatisticDescriptor>> stats(34);
 
     stats[0] = factory->createIntGauge(
         "locators", "Current number of locators discovered", "locators");
@@ -120,6 +120,36 @@ PoolStats::PoolStats(StatisticsFactory* factory, const std::string& poolName) {
     stats[26] = factory->createLongCounter(
         "queryExecutionTime",
         "Total time spent while processing queryExecution", "nanoseconds");
+    stats[27] = factory->createIntGauge(
+        "openCircuits",
+        "Current number of servers whose circuit breaker keeps requests away",
+        "servers");
+    stats[28] = factory->createIntGauge(
+        "halfOpenCircuits",
+        "Current number of servers whose circuit breaker lets trial requests "
+        "through",
+        "servers");
+    stats[29] = factory->createIntCounter(
+        "circuitOpens",
+        "Total number of times a server's circuit breaker has opened",
+        "opens");
+    stats[30] = factory->createLongCounter(
+        "notificationsDispatched",
+        "Total number of subscription events handed to dispatch threads",
+        "events");
+    stats[31] = factory->createIntCounter(
+        "notificationDispatchWaits",
+        "Total number of times the subscription reader waited for a full "
+        "dispatch queue",
+        "waits");
+    stats[32] = factory->createLongCounter(
+        "notificationDispatchWaitTime",
+        "Total time (nanoseconds) the subscription reader spent waiting for "
+        "dispatch queue space",
+        "nanoseconds");
+    stats[33] = factory->createIntGauge(
+        "notificationDispatchMaxQueueDepth",
+        "Deepest any subscription dispatch queue has been", "events");
 
     statsType = factory->createType(STATS_NAME, STATS_DESC, std::move(stats));
   }
@@ -151,6 +181,17 @@ PoolStats::PoolStats(StatisticsFactory* factory, const std::string& poolName) {
       statsType->nameToId("processedDeltaMessagesTime");
   m_queryExecutionsId = statsType->nameToId("queryExecutions");
   m_queryExecutionTimeId = statsType->nameToId("queryExecutionTime");
+  m_openCircuitsId = statsType->nameToId("openCircuits");
+  m_halfOpenCircuitsId = statsType->nameToId("halfOpenCircuits");
+  m_circuitOpensId = statsType->nameToId("circuitOpens");
+  m_notificationsDispatchedId =
+      statsType->nameToId("notificationsDispatched");
+  m_notificationDispatchWaitsId =
+      statsType->nameToId("notificationDispatchWaits");
+  m_notificationDispatchWaitTimeId =
+      statsType->nameToId("notificationDispatchWaitTime");
+  m_notificationDispatchMaxQueueDepthId =
+      statsType->nameToId("notificationDispatchMaxQueueDepth");
 
   m_poolStats = factory->createAtomicStatistics(statsType, poolName.c_str());
 
@@ -181,6 +222,13 @@ PoolStats::PoolStats(StatisticsFactory* factory, const std::string& poolName) {
   getStats()->setInt(m_processedDeltaMessagesTimeId, 0);
   getStats()->setInt(m_queryExecutionsId, 0);
   getStats()->setLong(m_queryExecutionTimeId, 0);
+  getStats()->setInt(m_openCircuitsId, 0);
+  getStats()->setInt(m_halfOpenCircuitsId, 0);
+  getStats()->setInt(m_circuitOpensId, 0);
+  getStats()->setLong(m_notificationsDispatchedId, 0);
+  getStats()->setInt(m_notificationDispatchWaitsId, 0);
+  getStats()->setLong(m_notificationDispatchWaitTimeId, 0);
+  getStats()->setInt(m_notificationDispatchMaxQueueDepthId, 0);
 }
 
 PoolStats::~PoolStats() {
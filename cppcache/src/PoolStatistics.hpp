@@ -19,6 +19,7 @@
 #ifndef GEODE_POOLSTATISTICS_H_
 #define GEODE_POOLSTATISTICS_H_
 
+#include <atomic>
 #include <string>
 
 #include <geode/internal/geode_globals.hpp>
@@ -130,6 +131,42 @@ class PoolStats {
   void incQueryExecutionTimeId(int64_t value) {  // counter
     getStats()->incLong(m_queryExecutionTimeId, value);
   }
+  void setOpenCircuits(int32_t curVal) {
+    getStats()->setInt(m_openCircuitsId, curVal);
+  }
+  void setHalfOpenCircuits(int32_t curVal) {
+    getStats()->setInt(m_halfOpenCircuitsId, curVal);
+  }
+  void incCircuitOpens() {  // counter
+    getStats()->incInt(m_circuitOpensId, 1);
+  }
+  void incNotificationsDispatched(int64_t value) {  // counter
+    getStats()->incLong(m_notificationsDispatchedId, value);
+  }
+  void incNotificationDispatchWaits(int32_t value) {  // counter
+    getStats()->incInt(m_notificationDispatchWaitsId, value);
+  }
+  void incNotificationDispatchWaitTime(int64_t value) {  // counter
+    getStats()->incLong(m_notificationDispatchWaitTimeId, value);
+  }
+  // the subscription channels of all the pool's servers report here
+  void raiseNotificationDispatchMaxQueueDepth(int32_t depth) {  // gauge
+    auto max = m_notificationDispatchMaxQueueDepth.load();
+    while (depth > max) {
+      if (m_notificationDispatchMaxQueueDepth.compare_exchange_weak(max,
+                                                                    depth)) {
+        // publish again if another channel raised the maximum meanwhile, so
+        // the gauge is never left with a lower depth
+        for (auto published = depth;;) {
+          getStats()->setInt(m_notificationDispatchMaxQueueDepthId, published);
+          max = m_notificationDispatchMaxQueueDepth.load();
+          if (max == published) break;
+          published = max;
+        }
+        return;
+      }
+    }
+  }
   inline apache::geode::statistics::Statistics* getStats() {
     return m_poolStats;
   }
@@ -170,6 +207,14 @@ class PoolStats {
   int32_t m_processedDeltaMessagesTimeId;
   int32_t m_queryExecutionsId;
   int32_t m_queryExecutionTimeId;
+  int32_t m_openCircuitsId;
+  int32_t m_halfOpenCircuitsId;
+  int32_t m_circuitOpensId;
+  int32_t m_notificationsDispatchedId;
+  int32_t m_notificationDispatchWaitsId;
+  int32_t m_notificationDispatchWaitTimeId;
+  int32_t m_notificationDispatchMaxQueueDepthId;
+  std::atomic<int32_t> m_notificationDispatchMaxQueueDepth{0};
 
   static constexpr const char* STATS_NAME = "PoolStatistics";
   static constexpr const char* STATS_DESC = "Statistics for this pool";
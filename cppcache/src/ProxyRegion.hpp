@@ -531,6 +531,14 @@ class APACHE_GEODE_EXPORT ProxyRegion final : public Region {
     return m_realRegion->getAll_internal(keys, aCallbackArgument, false);
   }
 
+  void getAllStreaming(
+      const std::vector<std::shared_ptr<CacheableKey>>& keys,
+      const GetAllEntryHandler& handler,
+      const std::shared_ptr<Serializable>& aCallbackArgument = nullptr) final {
+    GuardUserAttributes gua(m_authenticatedView);
+    m_realRegion->getAllStreaming(keys, handler, aCallbackArgument);
+  }
+
   std::shared_ptr<SelectResults> query(
       const std::string& predicate, std::chrono::milliseconds timeout =
                                         DEFAULT_QUERY_RESPONSE_TIMEOUT) final {
@@ -565,6 +573,11 @@ class APACHE_GEODE_EXPORT ProxyRegion final : public Region {
     return m_realRegion->getPool();
   }
 
+  void flush() final {
+    GuardUserAttributes gua(m_authenticatedView);
+    m_realRegion->flush();
+  }
+
   ProxyRegion(AuthenticatedView& authenticatedView,
               const std::shared_ptr<RegionInternal>& realRegion)
       : Region(authenticatedView.m_cacheImpl) {
@@ -0,0 +1,46 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <geode/QueryService.hpp>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+void QueryService::createIndex(const std::string&, const std::string&,
+                               const std::string&) {
+  throw UnsupportedOperationException(
+      "QueryService::createIndex: indexes are only supported by the local "
+      "query service");
+}
+
+void QueryService::createHashIndex(const std::string&, const std::string&,
+                                   const std::string&) {
+  throw UnsupportedOperationException(
+      "QueryService::createHashIndex: indexes are only supported by the "
+      "local query service");
+}
+
+bool QueryService::removeIndex(const std::string&) {
+  throw UnsupportedOperationException(
+      "QueryService::removeIndex: indexes are only supported by the local "
+      "query service");
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
@@ -0,0 +1,103 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ReceiveBufferPool.hpp"
+
+#include <iterator>
+#include <mutex>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+class ReceiveBufferPool::Slabs {
+ public:
+  Slabs(size_t maxPooledBuffers, size_t maxPooledBufferSize)
+      : m_maxPooledBuffers(maxPooledBuffers),
+        m_maxPooledBufferSize(maxPooledBufferSize) {}
+
+  std::unique_ptr<std::vector<uint8_t>> take(size_t size) {
+    std::lock_guard<decltype(m_mutex)> guard(m_mutex);
+    if (m_free.empty()) {
+      return std::unique_ptr<std::vector<uint8_t>>(new std::vector<uint8_t>());
+    }
+
+    // prefer the most recently released buffer that is already large enough
+    // so that the common case neither allocates nor touches cold memory
+    auto found = m_free.rbegin();
+    for (auto iter = m_free.rbegin(); iter != m_free.rend(); ++iter) {
+      if ((*iter)->capacity() >= size) {
+        found = iter;
+        break;
+      }
+    }
+    auto buffer = std::move(*found);
+    m_free.erase(std::next(found).base());
+    return buffer;
+  }
+
+  void recycle(std::vector<uint8_t>* buffer) {
+    std::unique_ptr<std::vector<uint8_t>> owned(buffer);
+    if (owned->capacity() > m_maxPooledBufferSize) {
+      return;
+    }
+    std::lock_guard<decltype(m_mutex)> guard(m_mutex);
+    if (m_free.size() < m_maxPooledBuffers) {
+      m_free.push_back(std::move(owned));
+    }
+  }
+
+  size_t pooled() const {
+    std::lock_guard<decltype(m_mutex)> guard(m_mutex);
+    return m_free.size();
+  }
+
+ private:
+  const size_t m_maxPooledBuffers;
+  const size_t m_maxPooledBufferSize;
+  mutable std::mutex m_mutex;
+  std::vector<std::unique_ptr<std::vector<uint8_t>>> m_free;
+};
+
+ReceiveBufferPool::ReceiveBufferPool(size_t maxPooledBuffers,
+                                     size_t maxPooledBufferSize)
+    : m_slabs(std::make_shared<Slabs>(maxPooledBuffers, maxPooledBufferSize)) {
+}
+
+std::shared_ptr<std::vector<uint8_t>> ReceiveBufferPool::acquire(
+    size_t size) {
+  auto buffer = m_slabs->take(size);
+  // a recycled buffer keeps its previous size so only newly exposed bytes
+  // get value initialized
+  buffer->resize(size);
+
+  std::weak_ptr<Slabs> slabs = m_slabs;
+  return std::shared_ptr<std::vector<uint8_t>>(
+      buffer.release(), [slabs](std::vector<uint8_t>* released) {
+        if (auto owner = slabs.lock()) {
+          owner->recycle(released);
+        } else {
+          delete released;
+        }
+      });
+}
+
+size_t ReceiveBufferPool::pooled() const { return m_slabs->pooled(); }
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
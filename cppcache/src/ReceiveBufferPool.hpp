@@ -0,0 +1,76 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_RECEIVEBUFFERPOOL_H_
+#define GEODE_RECEIVEBUFFERPOOL_H_
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <geode/internal/geode_globals.hpp>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * Reference counted buffer holding bytes received from a server. Chunk
+ * contexts and the DataInput instances reading them share the buffer rather
+ * than copying it.
+ */
+typedef std::shared_ptr<const std::vector<uint8_t>> ReceiveBuffer;
+
+/**
+ * Thread safe pool that recycles the storage of receive buffers. Buffers
+ * handed out by {@link acquire} return their storage to the pool when the
+ * last reference is released, possibly on another thread, so steady state
+ * message and chunk reads do not allocate.
+ */
+class APACHE_GEODE_EXPORT ReceiveBufferPool {
+ public:
+  ReceiveBufferPool(size_t maxPooledBuffers, size_t maxPooledBufferSize);
+
+  ~ReceiveBufferPool() noexcept = default;
+
+  ReceiveBufferPool(const ReceiveBufferPool&) = delete;
+  ReceiveBufferPool& operator=(const ReceiveBufferPool&) = delete;
+
+  /**
+   * Returns a buffer of exactly <code>size</code> bytes, reusing pooled
+   * storage when available. The contents are unspecified.
+   */
+  std::shared_ptr<std::vector<uint8_t>> acquire(size_t size);
+
+  /** Number of idle buffers currently held by the pool. */
+  size_t pooled() const;
+
+ private:
+  class Slabs;
+
+  // Shared with the deleters of outstanding buffers so they stay valid
+  // if the pool is destroyed first.
+  std::shared_ptr<Slabs> m_slabs;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_RECEIVEBUFFERPOOL_H_
@@ -29,6 +29,8 @@ Region::~Region() noexcept = default;
 
 Cache& Region::getCache() { return *m_cacheImpl->getCache(); }
 
+void Region::flush() {}
+
 }  // namespace client
 }  // namespace geode
 }  // namespace apache
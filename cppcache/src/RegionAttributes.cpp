@@ -55,7 +55,10 @@ RegionAttributes::RegionAttributes()
       m_persistenceProperties(nullptr),
       m_persistenceManager(nullptr),
       m_isClonable(false),
-      m_isConcurrencyChecksEnabled(true) {}
+      m_isConcurrencyChecksEnabled(true),
+      m_writeBehindBatchSize(0),
+      m_writeBehindBatchInterval(100),
+      m_compressionThreshold(1024) {}
 
 RegionAttributes::~RegionAttributes() noexcept = default;
 
@@ -513,6 +516,29 @@ void RegionAttributes::setCloningEnabled(bool isClonable) {
   m_isClonable = isClonable;
 }
 
+void RegionAttributes::setWriteBehindBatchSize(uint32_t batchSize) {
+  m_writeBehindBatchSize = batchSize;
+}
+
+void RegionAttributes::setWriteBehindBatchInterval(
+    std::chrono::milliseconds interval) {
+  m_writeBehindBatchInterval = interval;
+}
+
+void RegionAttributes::setWriteBehindListener(
+    const std::shared_ptr<WriteBehindListener>& listener) {
+  m_writeBehindListener = listener;
+}
+
+void RegionAttributes::setCompressor(
+    const std::shared_ptr<Compressor>& compressor) {
+  m_compressor = compressor;
+}
+
+void RegionAttributes::setCompressionThreshold(size_t threshold) {
+  m_compressionThreshold = threshold;
+}
+
 void RegionAttributes::setConcurrencyChecksEnabled(bool enable) {
   m_isConcurrencyChecksEnabled = enable;
 }
@@ -232,6 +232,41 @@ RegionAttributesFactory& RegionAttributesFactory::setConcurrencyChecksEnabled(
   return *this;
 }
 
+RegionAttributesFactory& RegionAttributesFactory::setWriteBehindBatchSize(
+    uint32_t batchSize) {
+  m_regionAttributes.setWriteBehindBatchSize(batchSize);
+  return *this;
+}
+
+RegionAttributesFactory& RegionAttributesFactory::setWriteBehindBatchInterval(
+    std::chrono::milliseconds interval) {
+  if (interval < std::chrono::milliseconds::zero()) {
+    throw IllegalArgumentException(
+        "RegionAttributesFactory::setWriteBehindBatchInterval: interval must "
+        "not be negative");
+  }
+  m_regionAttributes.setWriteBehindBatchInterval(interval);
+  return *this;
+}
+
+RegionAttributesFactory& RegionAttributesFactory::setWriteBehindListener(
+    const std::shared_ptr<WriteBehindListener>& listener) {
+  m_regionAttributes.setWriteBehindListener(listener);
+  return *this;
+}
+
+RegionAttributesFactory& RegionAttributesFactory::setCompressor(
+    const std::shared_ptr<Compressor>& compressor) {
+  m_regionAttributes.setCompressor(compressor);
+  return *this;
+}
+
+RegionAttributesFactory& RegionAttributesFactory::setCompressionThreshold(
+    size_t threshold) {
+  m_regionAttributes.setCompressionThreshold(threshold);
+  return *this;
+}
+
 }  // namespace client
 }  // namespace geode
 }  // namespace apache
@@ -172,6 +172,35 @@ RegionFactory& RegionFactory::setConcurrencyChecksEnabled(bool enable) {
   m_regionAttributesFactory->setConcurrencyChecksEnabled(enable);
   return *this;
 }
+
+RegionFactory& RegionFactory::setWriteBehindBatchSize(uint32_t batchSize) {
+  m_regionAttributesFactory->setWriteBehindBatchSize(batchSize);
+  return *this;
+}
+
+RegionFactory& RegionFactory::setWriteBehindBatchInterval(
+    std::chrono::milliseconds interval) {
+  m_regionAttributesFactory->setWriteBehindBatchInterval(interval);
+  return *this;
+}
+
+RegionFactory& RegionFactory::setWriteBehindListener(
+    const std::shared_ptr<WriteBehindListener>& listener) {
+  m_regionAttributesFactory->setWriteBehindListener(listener);
+  return *this;
+}
+
+RegionFactory& RegionFactory::setCompressor(
+    const std::shared_ptr<Compressor>& compressor) {
+  m_regionAttributesFactory->setCompressor(compressor);
+  return *this;
+}
+
+RegionFactory& RegionFactory::setCompressionThreshold(size_t threshold) {
+  m_regionAttributesFactory->setCompressionThreshold(threshold);
+  return *this;
+}
+
 RegionFactory& RegionFactory::setLruEntriesLimit(const uint32_t entriesLimit) {
   m_regionAttributesFactory->setLruEntriesLimit(entriesLimit);
   return *this;
@@ -17,6 +17,7 @@
 
 #include "RemoteQuery.hpp"
 
+#include "ColumnarResultsBuilder.hpp"
 #include "ResultSetImpl.hpp"
 #include "StructSetImpl.hpp"
 #include "TcrConnectionManager.hpp"
@@ -62,9 +63,68 @@ std::shared_ptr<SelectResults> RemoteQuery::execute(
   return execute(timeout, "Query::execute", m_tccdm, paramList);
 }
 
+void RemoteQuery::executeStreaming(const ResultsHandler& handler,
+                                   std::shared_ptr<CacheableVector> paramList,
+                                   std::chrono::milliseconds timeout) {
+  util::PROTOCOL_OPERATION_TIMEOUT_BOUNDS(timeout);
+  if (!handler) {
+    throw IllegalArgumentException(
+        "Query::executeStreaming: null results handler provided");
+  }
+  GuardUserAttributes gua;
+  if (m_authenticatedView) {
+    gua.setAuthenticatedView(m_authenticatedView);
+  }
+
+  const char* func = "Query::executeStreaming";
+  TcrMessageReply reply(true, m_tccdm);
+  ChunkedQueryResponse resultCollector(reply);
+  resultCollector.setChunkHandler(
+      [this, func, &handler](const std::shared_ptr<CacheableVector>& values,
+                             const std::vector<std::string>& fieldNames) {
+        handler(createSelectResults(func, values, fieldNames));
+      });
+  executeChunked(timeout, func, m_tccdm, paramList, reply, resultCollector);
+}
+
+std::shared_ptr<ColumnarResults> RemoteQuery::executeColumnar(
+    std::shared_ptr<CacheableVector> paramList,
+    std::chrono::milliseconds timeout) {
+  util::PROTOCOL_OPERATION_TIMEOUT_BOUNDS(timeout);
+  GuardUserAttributes gua;
+  if (m_authenticatedView) {
+    gua.setAuthenticatedView(m_authenticatedView);
+  }
+
+  const char* func = "Query::executeColumnar";
+  TcrMessageReply reply(true, m_tccdm);
+  ChunkedQueryResponse resultCollector(reply);
+  ColumnarResultsBuilder builder;
+  resultCollector.setColumnarBuilder(&builder);
+  executeChunked(timeout, func, m_tccdm, paramList, reply, resultCollector);
+
+  LOGFINEST("%s: creating ColumnarResults for query: %s", func,
+            m_queryString.c_str());
+  return builder.build();
+}
+
 std::shared_ptr<SelectResults> RemoteQuery::execute(
     std::chrono::milliseconds timeout, const char* func, ThinClientBaseDM* tcdm,
     std::shared_ptr<CacheableVector> paramList) {
+  TcrMessageReply reply(true, tcdm);
+  ChunkedQueryResponse resultCollector(reply);
+  executeChunked(timeout, func, tcdm, paramList, reply, resultCollector);
+
+  LOGFINEST("%s: reading reply for query: %s", func, m_queryString.c_str());
+  return createSelectResults(func, resultCollector.getQueryResults(),
+                             resultCollector.getStructFieldNames());
+}
+
+void RemoteQuery::executeChunked(std::chrono::milliseconds timeout,
+                                 const char* func, ThinClientBaseDM* tcdm,
+                                 std::shared_ptr<CacheableVector> paramList,
+                                 TcrMessageReply& reply,
+                                 ChunkedQueryResponse& resultCollector) {
   auto pool = dynamic_cast<ThinClientPoolDM*>(tcdm);
   if (pool) {
     pool->getStats().incQueryExecutionId();
@@ -77,46 +137,40 @@ std::shared_ptr<SelectResults> RemoteQuery::execute(
                                   .getEnableTimeStatistics();
   int64_t sampleStartNanos =
       enableTimeStatistics ? Utils::startStatOpTime() : 0;
-  TcrMessageReply reply(true, tcdm);
-  auto resultCollector =
-      std::unique_ptr<ChunkedQueryResponse>(new ChunkedQueryResponse(reply));
   reply.setChunkedResultHandler(
-      static_cast<TcrChunkedResult*>(resultCollector.get()));
+      static_cast<TcrChunkedResult*>(&resultCollector));
   GfErrType err = executeNoThrow(timeout, reply, func, tcdm, paramList);
   throwExceptionIfError(func, err);
 
-  std::shared_ptr<SelectResults> sr;
-
-  LOGFINEST("%s: reading reply for query: %s", func, m_queryString.c_str());
-  auto&& values = resultCollector->getQueryResults();
-  auto&& fieldNameVec = resultCollector->getStructFieldNames();
-  size_t sizeOfFieldNamesVec = fieldNameVec.size();
-  if (sizeOfFieldNamesVec == 0) {
-    LOGFINEST("%s: creating ResultSet for query: %s", func,
-              m_queryString.c_str());
-    sr = std::make_shared<ResultSetImpl>(values);
-  } else {
-    if (values->size() % fieldNameVec.size() != 0) {
-      char exMsg[1024];
-      std::snprintf(exMsg, 1023,
-                    "%s: Number of values coming from "
-                    "server has to be exactly divisible by field count",
-                    func);
-      throw MessageException(exMsg);
-    } else {
-      LOGFINEST("%s: creating StructSet for query: %s", func,
-                m_queryString.c_str());
-      sr = std::make_shared<StructSetImpl>(values, fieldNameVec);
-    }
-  }
-
   /*update QueryExecutionTime stat */
   if (pool && enableTimeStatistics) {
     Utils::updateStatOpTime(pool->getStats().getStats(),
                             pool->getStats().getQueryExecutionTimeId(),
                             sampleStartNanos);
   }
-  return sr;
+}
+
+std::shared_ptr<SelectResults> RemoteQuery::createSelectResults(
+    const char* func, const std::shared_ptr<CacheableVector>& values,
+    const std::vector<std::string>& fieldNames) {
+  if (fieldNames.empty()) {
+    LOGFINEST("%s: creating ResultSet for query: %s", func,
+              m_queryString.c_str());
+    return std::make_shared<ResultSetImpl>(values);
+  }
+
+  if (values->size() % fieldNames.size() != 0) {
+    char exMsg[1024];
+    std::snprintf(exMsg, 1023,
+                  "%s: Number of values coming from "
+                  "server has to be exactly divisible by field count",
+                  func);
+    throw MessageException(exMsg);
+  }
+
+  LOGFINEST("%s: creating StructSet for query: %s", func,
+            m_queryString.c_str());
+  return std::make_shared<StructSetImpl>(values, fieldNames);
 }
 
 GfErrType RemoteQuery::executeNoThrow(
@@ -22,6 +22,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <geode/AuthenticatedView.hpp>
 #include <geode/ExceptionTypes.hpp>
@@ -37,6 +38,7 @@ namespace apache {
 namespace geode {
 namespace client {
 
+class ChunkedQueryResponse;
 class ThinClientBaseDM;
 
 class APACHE_GEODE_EXPORT RemoteQuery : public Query {
@@ -62,6 +64,16 @@ class APACHE_GEODE_EXPORT RemoteQuery : public Query {
       std::chrono::milliseconds timeout =
           DEFAULT_QUERY_RESPONSE_TIMEOUT) override;
 
+  void executeStreaming(const ResultsHandler& handler,
+                        std::shared_ptr<CacheableVector> paramList = nullptr,
+                        std::chrono::milliseconds timeout =
+                            DEFAULT_QUERY_RESPONSE_TIMEOUT) override;
+
+  std::shared_ptr<ColumnarResults> executeColumnar(
+      std::shared_ptr<CacheableVector> paramList = nullptr,
+      std::chrono::milliseconds timeout =
+          DEFAULT_QUERY_RESPONSE_TIMEOUT) override;
+
   /**
    * executes a query using a given distribution manager
    * used by Region.query() and Region.getAll()
@@ -81,6 +93,17 @@ class APACHE_GEODE_EXPORT RemoteQuery : public Query {
   void compile() override;
 
   bool isCompiled() override;
+
+ private:
+  void executeChunked(std::chrono::milliseconds timeout, const char* func,
+                      ThinClientBaseDM* tcdm,
+                      std::shared_ptr<CacheableVector> paramList,
+                      TcrMessageReply& reply,
+                      ChunkedQueryResponse& resultCollector);
+
+  std::shared_ptr<SelectResults> createSelectResults(
+      const char* func, const std::shared_ptr<CacheableVector>& values,
+      const std::vector<std::string>& fieldNames);
 };
 
 }  // namespace client
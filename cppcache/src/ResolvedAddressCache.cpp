@@ -0,0 +1,70 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "ResolvedAddressCache.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+// how long a resolution is reused before the name is resolved again
+static constexpr auto RESOLVED_ADDRESS_TTL = std::chrono::seconds(30);
+
+ResolvedAddressCache::ResolvedAddressCache(
+    std::chrono::steady_clock::duration ttl)
+    : m_ttl(ttl) {}
+
+bool ResolvedAddressCache::find(const std::string& host, uint16_t port,
+                                results_type& results) {
+  std::lock_guard<decltype(m_mutex)> guard(m_mutex);
+  auto found = m_entries.find(key(host, port));
+  if (found == m_entries.end()) {
+    return false;
+  }
+  if (found->second.expires <= std::chrono::steady_clock::now()) {
+    m_entries.erase(found);
+    return false;
+  }
+  results = found->second.results;
+  return true;
+}
+
+void ResolvedAddressCache::insert(const std::string& host, uint16_t port,
+                                  const results_type& results) {
+  std::lock_guard<decltype(m_mutex)> guard(m_mutex);
+  m_entries[key(host, port)] =
+      Entry{results, std::chrono::steady_clock::now() + m_ttl};
+}
+
+void ResolvedAddressCache::erase(const std::string& host, uint16_t port) {
+  std::lock_guard<decltype(m_mutex)> guard(m_mutex);
+  m_entries.erase(key(host, port));
+}
+
+ResolvedAddressCache& ResolvedAddressCache::instance() {
+  static ResolvedAddressCache cache(RESOLVED_ADDRESS_TTL);
+  return cache;
+}
+
+std::string ResolvedAddressCache::key(const std::string& host, uint16_t port) {
+  return host + ":" + std::to_string(port);
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
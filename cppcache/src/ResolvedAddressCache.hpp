@@ -0,0 +1,88 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#ifndef GEODE_RESOLVEDADDRESSCACHE_H_
+#define GEODE_RESOLVEDADDRESSCACHE_H_
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include <boost/asio/ip/tcp.hpp>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * Thread safe cache of host name resolutions, so that opening many
+ * connections to the same servers, for example when a pool fills up to its
+ * minimum size, resolves each server once. Entries expire after a fixed time
+ * so address changes are still picked up.
+ */
+class ResolvedAddressCache {
+ public:
+  typedef boost::asio::ip::tcp::resolver::results_type results_type;
+
+  explicit ResolvedAddressCache(std::chrono::steady_clock::duration ttl);
+
+  ResolvedAddressCache(const ResolvedAddressCache&) = delete;
+  ResolvedAddressCache& operator=(const ResolvedAddressCache&) = delete;
+
+  /**
+   * Sets results to the addresses cached for host and port, returning false
+   * if there are none or they have expired.
+   */
+  bool find(const std::string& host, uint16_t port, results_type& results);
+
+  void insert(const std::string& host, uint16_t port,
+              const results_type& results);
+
+  /**
+   * Forgets the addresses of host and port, for example after connecting to
+   * them failed.
+   */
+  void erase(const std::string& host, uint16_t port);
+
+  /**
+   * The cache shared by all connections of the process.
+   */
+  static ResolvedAddressCache& instance();
+
+ private:
+  struct Entry {
+    results_type results;
+    std::chrono::steady_clock::time_point expires;
+  };
+
+  static std::string key(const std::string& host, uint16_t port);
+
+  const std::chrono::steady_clock::duration m_ttl;
+  std::mutex m_mutex;
+  std::unordered_map<std::string, Entry> m_entries;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_RESOLVEDADDRESSCACHE_H_
@@ -54,6 +54,110 @@ namespace apache {
 namespace geode {
 namespace client {
 
+namespace {
+
+using BuiltinDeserializer = std::shared_ptr<Serializable> (*)(DataInput&);
+
+template <typename T>
+std::shared_ptr<Serializable> deserializeBuiltin(DataInput& input) {
+  auto obj = std::make_shared<T>();
+  obj->fromData(input);
+  return std::move(obj);
+}
+
+template <DSCode STRING_TYPE>
+std::shared_ptr<Serializable> deserializeBuiltinString(DataInput& input) {
+  auto obj = std::make_shared<CacheableString>(STRING_TYPE);
+  obj->fromData(input);
+  return std::move(obj);
+}
+
+/**
+ * Compile time dispatch for the builtin types registered in
+ * TheTypeMap::setup. The switch compiles to a jump table, so builtins are
+ * created and read without a map lookup, lock or type tests.
+ */
+BuiltinDeserializer getBuiltinDeserializer(DSCode dsCode) {
+  switch (dsCode) {
+    case DSCode::CacheableByte:
+      return deserializeBuiltin<CacheableByte>;
+    case DSCode::CacheableBoolean:
+      return deserializeBuiltin<CacheableBoolean>;
+    case DSCode::BooleanArray:
+      return deserializeBuiltin<BooleanArray>;
+    case DSCode::CacheableBytes:
+      return deserializeBuiltin<CacheableBytes>;
+    case DSCode::CacheableFloat:
+      return deserializeBuiltin<CacheableFloat>;
+    case DSCode::CacheableFloatArray:
+      return deserializeBuiltin<CacheableFloatArray>;
+    case DSCode::CacheableDouble:
+      return deserializeBuiltin<CacheableDouble>;
+    case DSCode::CacheableDoubleArray:
+      return deserializeBuiltin<CacheableDoubleArray>;
+    case DSCode::CacheableDate:
+      return deserializeBuiltin<CacheableDate>;
+    case DSCode::CacheableFileName:
+      return deserializeBuiltin<CacheableFileName>;
+    case DSCode::CacheableHashMap:
+      return deserializeBuiltin<CacheableHashMap>;
+    case DSCode::CacheableHashSet:
+      return deserializeBuiltin<CacheableHashSet>;
+    case DSCode::CacheableHashTable:
+      return deserializeBuiltin<CacheableHashTable>;
+    case DSCode::CacheableIdentityHashMap:
+      return deserializeBuiltin<CacheableIdentityHashMap>;
+    case DSCode::CacheableLinkedHashSet:
+      return deserializeBuiltin<CacheableLinkedHashSet>;
+    case DSCode::CacheableInt16:
+      return deserializeBuiltin<CacheableInt16>;
+    case DSCode::CacheableInt16Array:
+      return deserializeBuiltin<CacheableInt16Array>;
+    case DSCode::CacheableInt32:
+      return deserializeBuiltin<CacheableInt32>;
+    case DSCode::CacheableInt32Array:
+      return deserializeBuiltin<CacheableInt32Array>;
+    case DSCode::CacheableInt64:
+      return deserializeBuiltin<CacheableInt64>;
+    case DSCode::CacheableInt64Array:
+      return deserializeBuiltin<CacheableInt64Array>;
+    case DSCode::CacheableObjectArray:
+      return deserializeBuiltin<CacheableObjectArray>;
+    case DSCode::CacheableASCIIString:
+      return deserializeBuiltinString<DSCode::CacheableASCIIString>;
+    case DSCode::CacheableASCIIStringHuge:
+      return deserializeBuiltinString<DSCode::CacheableASCIIStringHuge>;
+    case DSCode::CacheableString:
+      return deserializeBuiltinString<DSCode::CacheableString>;
+    case DSCode::CacheableStringHuge:
+      return deserializeBuiltinString<DSCode::CacheableStringHuge>;
+    case DSCode::CacheableStringArray:
+      return deserializeBuiltin<CacheableStringArray>;
+    case DSCode::CacheableVector:
+      return deserializeBuiltin<CacheableVector>;
+    case DSCode::CacheableArrayList:
+      return deserializeBuiltin<CacheableArrayList>;
+    case DSCode::CacheableLinkedList:
+      return deserializeBuiltin<CacheableLinkedList>;
+    case DSCode::CacheableStack:
+      return deserializeBuiltin<CacheableStack>;
+    case DSCode::CacheableCharacter:
+      return deserializeBuiltin<CacheableCharacter>;
+    case DSCode::CharArray:
+      return deserializeBuiltin<CharArray>;
+    case DSCode::Properties:
+      return deserializeBuiltin<Properties>;
+    default:
+      return nullptr;
+  }
+}
+
+inline size_t dsCodeIndex(DSCode dsCode) {
+  return static_cast<uint8_t>(static_cast<int32_t>(dsCode));
+}
+
+}  // namespace
+
 void TheTypeMap::setup() {
   // Register Geode builtins here!!
   // update type ids in DSCode.hpp
@@ -224,6 +328,12 @@ std::shared_ptr<Serializable> SerializationRegistry::deserialize(
       break;
   }
 
+  if (!theTypeMap_.isDataSerializablePrimitiveRebound(dsCode)) {
+    if (auto deserializer = getBuiltinDeserializer(dsCode)) {
+      return deserializer(input);
+    }
+  }
+
   TypeFactoryMethod createType = nullptr;
 
   theTypeMap_.findDataSerializablePrimitive(dsCode, createType);
@@ -519,6 +629,11 @@ void TheTypeMap::rebindDataSerializablePrimitive(DSCode dsCode,
                                                  TypeFactoryMethod func) {
   const std::lock_guard<std::mutex> guard(dataSerializablePrimitiveMapMutex_);
   dataSerializablePrimitiveMap_[dsCode] = func;
+  dataSerializablePrimitiveRebound_[dsCodeIndex(dsCode)] = true;
+}
+
+bool TheTypeMap::isDataSerializablePrimitiveRebound(DSCode dsCode) const {
+  return dataSerializablePrimitiveRebound_[dsCodeIndex(dsCode)];
 }
 
 void TheTypeMap::bindDataSerializableFixedId(TypeFactoryMethod func) {
@@ -20,6 +20,8 @@
 #ifndef GEODE_SERIALIZATIONREGISTRY_H_
 #define GEODE_SERIALIZATIONREGISTRY_H_
 
+#include <array>
+#include <atomic>
 #include <functional>
 #include <iostream>
 #include <memory>
@@ -83,12 +85,19 @@ class TheTypeMap {
   mutable std::mutex dataSerializableMapMutex_;
   mutable std::mutex dataSerializableFixedIdMapMutex_;
   mutable std::mutex pdxSerializableMapMutex_;
+  // builtin DSCodes whose factory has been replaced, indexed by code
+  std::array<std::atomic<bool>, 256> dataSerializablePrimitiveRebound_;
 
  public:
   std::unordered_map<std::type_index, int32_t> typeToClassId_;
 
   TheTypeMap(const TheTypeMap&) = delete;
-  TheTypeMap() { setup(); }
+  TheTypeMap() {
+    for (auto& rebound : dataSerializablePrimitiveRebound_) {
+      rebound = false;
+    }
+    setup();
+  }
 
   ~TheTypeMap() noexcept = default;
 
@@ -131,6 +140,12 @@ class TheTypeMap {
 
   void rebindDataSerializablePrimitive(DSCode dsCode, TypeFactoryMethod func);
 
+  /**
+   * Whether the factory for a builtin DSCode has been replaced, in which
+   * case it must be looked up rather than dispatched at compile time.
+   */
+  bool isDataSerializablePrimitiveRebound(DSCode dsCode) const;
+
  private:
 };
 
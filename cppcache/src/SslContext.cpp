@@ -0,0 +1,182 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "SslContext.hpp"
+
+#include <openssl/ssl.h>
+
+#include <fstream>
+#include <string>
+
+#include <boost/exception/diagnostic_information.hpp>
+
+#include <geode/ExceptionTypes.hpp>
+
+#include "util/Log.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+namespace {
+
+void freeServerName(void*, void* ptr, CRYPTO_EX_DATA*, int, long, void*) {
+  delete static_cast<std::string*>(ptr);
+}
+
+// where the owning SslContext is kept on each SSL_CTX
+int contextIndex() {
+  static const int index =
+      SSL_CTX_get_ex_new_index(0, nullptr, nullptr, nullptr, nullptr);
+  return index;
+}
+
+// where the server name, owned by the SSL object, is kept on each SSL
+int serverIndex() {
+  static const int index =
+      SSL_get_ex_new_index(0, nullptr, nullptr, nullptr, freeServerName);
+  return index;
+}
+
+}  // namespace
+
+SslContext::SslContext(const std::string& pubkeyfile,
+                       const std::string& privkeyfile,
+                       const std::string& pemPassword, bool ktls)
+    : m_context(boost::asio::ssl::context::sslv23_client), m_ktls(false) {
+  try {
+    m_context.set_verify_mode(boost::asio::ssl::verify_peer);
+    m_context.load_verify_file(pubkeyfile);
+
+    m_context.set_password_callback(
+        [pemPassword](std::size_t /*max_length*/,
+                      boost::asio::ssl::context::password_purpose /*purpose*/) {
+          return pemPassword;
+        });
+
+    if (!privkeyfile.empty()) {
+      m_context.use_certificate_chain_file(privkeyfile);
+      m_context.use_private_key_file(
+          privkeyfile, boost::asio::ssl::context::file_format::pem);
+    }
+  } catch (const boost::exception& ex) {
+    std::string info = boost::diagnostic_information(ex);
+    LOGDEBUG("caught boost exception: %s", info.c_str());
+    throw SslException(info.c_str());
+  }
+
+  auto ctx = m_context.native_handle();
+  SSL_CTX_set_ex_data(ctx, contextIndex(), this);
+  // Sessions are kept here, per server, rather than in OpenSSL's internal
+  // cache, which a client cannot look up by server.
+  SSL_CTX_set_session_cache_mode(
+      ctx, SSL_SESS_CACHE_CLIENT | SSL_SESS_CACHE_NO_INTERNAL_STORE);
+  SSL_CTX_sess_set_new_cb(ctx, &SslContext::onNewSession);
+
+  if (ktls) {
+    m_ktls = ktlsSupported();
+    if (m_ktls) {
+      LOGINFO("SSL records will be offloaded to the kernel (kTLS)");
+    } else {
+      LOGINFO(
+          "kTLS is not supported by this platform; SSL records are "
+          "encrypted in user space");
+    }
+  }
+}
+
+SslContext::~SslContext() noexcept {
+  for (auto& entry : m_sessions) {
+    SSL_SESSION_free(entry.second);
+  }
+}
+
+void SslContext::prepare(SSL* ssl, const std::string& server) {
+  SSL_set_ex_data(ssl, serverIndex(), new std::string(server));
+
+  std::lock_guard<decltype(m_mutex)> guard(m_mutex);
+  auto found = m_sessions.find(server);
+  if (found != m_sessions.end()) {
+    SSL_set_session(ssl, found->second);
+  }
+}
+
+void SslContext::forget(const std::string& server) {
+  std::lock_guard<decltype(m_mutex)> guard(m_mutex);
+  auto found = m_sessions.find(server);
+  if (found != m_sessions.end()) {
+    SSL_SESSION_free(found->second);
+    m_sessions.erase(found);
+  }
+}
+
+size_t SslContext::sessionCount() {
+  std::lock_guard<decltype(m_mutex)> guard(m_mutex);
+  return m_sessions.size();
+}
+
+void SslContext::disableKtls() {
+  if (m_ktls.exchange(false)) {
+    LOGINFO(
+        "kTLS could not be enabled for a connection; SSL records are "
+        "encrypted in user space from now on");
+  }
+}
+
+bool SslContext::ktlsSupported() {
+#if defined(__linux__) && defined(SSL_OP_ENABLE_KTLS) && \
+    !defined(OPENSSL_NO_KTLS)
+  // the kernel lists the tls upper layer protocol once its module is loaded
+  std::ifstream available("/proc/sys/net/ipv4/tcp_available_ulp");
+  std::string protocol;
+  while (available >> protocol) {
+    if (protocol == "tls") {
+      return true;
+    }
+  }
+  return false;
+#else
+  return false;
+#endif
+}
+
+int SslContext::onNewSession(SSL* ssl, SSL_SESSION* session) {
+  auto context = static_cast<SslContext*>(
+      SSL_CTX_get_ex_data(SSL_get_SSL_CTX(ssl), contextIndex()));
+  auto server = static_cast<std::string*>(SSL_get_ex_data(ssl, serverIndex()));
+  if (context == nullptr || server == nullptr) {
+    return 0;
+  }
+
+  context->keep(*server, session);
+  // the reference passed in is now owned by the context
+  return 1;
+}
+
+void SslContext::keep(const std::string& server, SSL_SESSION* session) {
+  std::lock_guard<decltype(m_mutex)> guard(m_mutex);
+  auto& kept = m_sessions[server];
+  if (kept != nullptr) {
+    SSL_SESSION_free(kept);
+  }
+  kept = session;
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
@@ -0,0 +1,106 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#ifndef GEODE_SSLCONTEXT_H_
+#define GEODE_SSLCONTEXT_H_
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include <boost/asio/ssl/context.hpp>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * @class SslContext SslContext.hpp
+ *
+ * An SSL context configured once, with its trust store, key store and
+ * password, and shared by the SSL connections of a pool. It keeps the last
+ * TLS session negotiated with each server, so later connections to that
+ * server resume it with an abbreviated handshake instead of repeating the
+ * full key exchange.
+ *
+ * With kTLS requested and supported, connections hand their negotiated keys
+ * to the kernel, which then encrypts and decrypts their records.
+ */
+class SslContext {
+ public:
+  /**
+   * @throws SslException if the stores cannot be loaded
+   */
+  SslContext(const std::string& pubkeyfile, const std::string& privkeyfile,
+             const std::string& pemPassword, bool ktls = false);
+  ~SslContext() noexcept;
+
+  SslContext(const SslContext&) = delete;
+  SslContext& operator=(const SslContext&) = delete;
+
+  boost::asio::ssl::context& get() { return m_context; }
+
+  /**
+   * Prepares ssl, not yet handshaken, for a connection to server: the
+   * session last negotiated with server is offered for resumption, and the
+   * session negotiated by this connection is kept for the next one.
+   */
+  void prepare(SSL* ssl, const std::string& server);
+
+  /**
+   * Drops the session kept for server, for example after a failed handshake.
+   */
+  void forget(const std::string& server);
+
+  size_t sessionCount();
+
+  /**
+   * Whether new connections should try to offload records to the kernel.
+   */
+  bool useKtls() const { return m_ktls; }
+
+  /**
+   * Stops further offload attempts, once one connection could not offload.
+   */
+  void disableKtls();
+
+  /**
+   * Whether this OpenSSL build and the running kernel can offload TLS.
+   */
+  static bool ktlsSupported();
+
+ private:
+  static int onNewSession(SSL* ssl, SSL_SESSION* session);
+
+  void keep(const std::string& server, SSL_SESSION* session);
+
+  boost::asio::ssl::context m_context;
+  std::atomic<bool> m_ktls;
+  std::mutex m_mutex;
+  // each session holds one reference, released when replaced or forgotten
+  std::unordered_map<std::string, SSL_SESSION*> m_sessions;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_SSLCONTEXT_H_
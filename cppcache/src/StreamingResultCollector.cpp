@@ -0,0 +1,155 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <geode/ExceptionTypes.hpp>
+#include <geode/StreamingResultCollector.hpp>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+StreamingResultCollector::StreamingResultCollector(size_t capacity)
+    : m_capacity(capacity),
+      m_timeout(DEFAULT_QUERY_RESPONSE_TIMEOUT),
+      m_taken(false),
+      m_ended(false),
+      m_cancelled(false) {
+  if (capacity == 0) {
+    throw IllegalArgumentException(
+        "StreamingResultCollector: capacity must be positive");
+  }
+}
+
+StreamingResultCollector::~StreamingResultCollector() noexcept {}
+
+bool StreamingResultCollector::next(std::shared_ptr<Cacheable>& result,
+                                    std::chrono::milliseconds timeout) {
+  std::unique_lock<std::mutex> lk(m_mutex);
+  if (!m_notEmpty.wait_for(lk, timeout, [this] {
+        return m_cancelled || m_ended || !m_results.empty();
+      })) {
+    throw FunctionExecutionException(
+        "StreamingResultCollector::next: no result received within timeout");
+  }
+
+  if (m_cancelled) {
+    return false;
+  } else if (!m_results.empty()) {
+    result = std::move(m_results.front());
+    m_results.pop_front();
+    m_taken = true;
+    lk.unlock();
+    m_notFull.notify_one();
+    return true;
+  } else if (m_exception) {
+    std::rethrow_exception(m_exception);
+  }
+  return false;
+}
+
+void StreamingResultCollector::cancel() {
+  {
+    std::lock_guard<std::mutex> lk(m_mutex);
+    m_cancelled = true;
+    m_results.clear();
+  }
+  m_notEmpty.notify_all();
+  m_notFull.notify_all();
+}
+
+bool StreamingResultCollector::isCancelled() const {
+  std::lock_guard<std::mutex> lk(m_mutex);
+  return m_cancelled;
+}
+
+std::shared_ptr<CacheableVector> StreamingResultCollector::getResult(
+    std::chrono::milliseconds timeout) {
+  auto results = CacheableVector::create();
+  std::shared_ptr<Cacheable> result;
+  while (next(result, timeout)) {
+    results->push_back(std::move(result));
+  }
+  return results;
+}
+
+void StreamingResultCollector::setTimeout(std::chrono::milliseconds timeout) {
+  std::lock_guard<std::mutex> lk(m_mutex);
+  m_timeout = timeout;
+}
+
+void StreamingResultCollector::addResult(
+    const std::shared_ptr<Cacheable>& result) {
+  {
+    std::unique_lock<std::mutex> lk(m_mutex);
+    if (!m_notFull.wait_for(lk, m_timeout, [this] {
+          return m_cancelled || m_exception ||
+                 m_results.size() < m_capacity;
+        })) {
+      FunctionExecutionException ex(
+          "StreamingResultCollector::addResult: no result taken within "
+          "timeout");
+      m_exception = std::make_exception_ptr(ex);
+      m_ended = true;
+      lk.unlock();
+      m_notEmpty.notify_all();
+      m_notFull.notify_all();
+      throw ex;
+    }
+    if (m_cancelled || m_exception) {
+      return;
+    }
+    m_results.push_back(result);
+  }
+  m_notEmpty.notify_one();
+}
+
+void StreamingResultCollector::endResults() {
+  {
+    std::lock_guard<std::mutex> lk(m_mutex);
+    m_ended = true;
+  }
+  m_notEmpty.notify_all();
+}
+
+void StreamingResultCollector::clearResults() {
+  {
+    std::lock_guard<std::mutex> lk(m_mutex);
+    if (m_taken) {
+      throw FunctionExecutionException(
+          "StreamingResultCollector::clearResults: cannot retry an execution "
+          "whose results were already taken");
+    }
+    m_results.clear();
+  }
+  m_notFull.notify_all();
+}
+
+void StreamingResultCollector::setException(std::exception_ptr exception) {
+  {
+    std::lock_guard<std::mutex> lk(m_mutex);
+    // keep the first error, such as a consumer that stopped taking results
+    if (!m_exception) {
+      m_exception = exception;
+    }
+    m_ended = true;
+  }
+  m_notEmpty.notify_all();
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
@@ -78,6 +78,14 @@ const char EnableChunkHandlerThread[] = "enable-chunk-handler-thread";
 const char OnClientDisconnectClearPdxTypeIds[] =
     "on-client-disconnect-clear-pdxType-Ids";
 const char TombstoneTimeoutInMSec[] = "tombstone-timeout";
+const char ExpiryTimingWheelEnabled[] = "expiry-timing-wheel-enabled";
+const char ExpiryTimingWheelTick[] = "expiry-timing-wheel-tick";
+const char NotifyDispatchThreads[] = "notify-dispatch-threads";
+const char NotifyDispatchQueueSize[] = "notify-dispatch-queue-size";
+const char SslKtlsEnabled[] = "ssl-ktls-enabled";
+const char TracingSampleRate[] = "tracing-sample-rate";
+const char TracingFile[] = "tracing-file";
+const char TracingBufferSize[] = "tracing-buffer-size";
 const char DefaultConflateEvents[] = "server";
 
 const char DefaultDurableClientId[] = "";
@@ -127,6 +135,17 @@ constexpr auto DefaultTombstoneTimeout = std::chrono::seconds(480);
 // not disable; all region api will use chunk handler thread
 const bool DefaultEnableChunkHandlerThread = false;
 const bool DefaultOnClientDisconnectClearPdxTypeIds = false;
+const bool DefaultExpiryTimingWheelEnabled = false;
+constexpr auto DefaultExpiryTimingWheelTick = std::chrono::milliseconds(100);
+// subscription events are handled on the receiving thread
+const uint32_t DefaultNotifyDispatchThreads = 0;
+const uint32_t DefaultNotifyDispatchQueueSize = 1024;
+// records are encrypted and decrypted in user space
+const bool DefaultSslKtlsEnabled = false;
+// no operation is traced
+const double DefaultTracingSampleRate = 0.0;
+const char DefaultTracingFile[] = "";
+const uint32_t DefaultTracingBufferSize = 4096;
 
 }  // namespace
 
@@ -183,7 +202,15 @@ SystemProperties::SystemProperties(
       m_tombstoneTimeout(DefaultTombstoneTimeout),
       m_enableChunkHandlerThread(DefaultEnableChunkHandlerThread),
       m_onClientDisconnectClearPdxTypeIds(
-          DefaultOnClientDisconnectClearPdxTypeIds) {
+          DefaultOnClientDisconnectClearPdxTypeIds),
+      m_expiryTimingWheelEnabled(DefaultExpiryTimingWheelEnabled),
+      m_expiryTimingWheelTick(DefaultExpiryTimingWheelTick),
+      m_notifyDispatchThreads(DefaultNotifyDispatchThreads),
+      m_notifyDispatchQueueSize(DefaultNotifyDispatchQueueSize),
+      m_sslKtlsEnabled(DefaultSslKtlsEnabled),
+      m_tracingSampleRate(DefaultTracingSampleRate),
+      m_tracingFile(DefaultTracingFile),
+      m_tracingBufferSize(DefaultTracingBufferSize) {
   // now that defaults are set, consume files and override the defaults.
   class ProcessPropsVisitor : public Properties::Visitor {
     SystemProperties* m_sysProps;
@@ -358,6 +385,27 @@ void SystemProperties::processProperty(const std::string& property,
     m_enableChunkHandlerThread = parseBooleanProperty(property, value);
   } else if (property == OnClientDisconnectClearPdxTypeIds) {
     m_onClientDisconnectClearPdxTypeIds = parseBooleanProperty(property, value);
+  } else if (property == ExpiryTimingWheelEnabled) {
+    m_expiryTimingWheelEnabled = parseBooleanProperty(property, value);
+  } else if (property == ExpiryTimingWheelTick) {
+    parseDurationProperty(property, std::string(value),
+                          m_expiryTimingWheelTick);
+  } else if (property == NotifyDispatchThreads) {
+    m_notifyDispatchThreads = std::stoul(value);
+  } else if (property == NotifyDispatchQueueSize) {
+    m_notifyDispatchQueueSize = std::stoul(value);
+  } else if (property == SslKtlsEnabled) {
+    m_sslKtlsEnabled = parseBooleanProperty(property, value);
+  } else if (property == TracingSampleRate) {
+    m_tracingSampleRate = std::stod(value);
+    if (m_tracingSampleRate < 0.0 || m_tracingSampleRate > 1.0) {
+      throwError("SystemProperties: " + property +
+                 " must be between 0 and 1: " + value);
+    }
+  } else if (property == TracingFile) {
+    m_tracingFile = value;
+  } else if (property == TracingBufferSize) {
+    m_tracingBufferSize = std::stoul(value);
   } else {
     throwError("SystemProperties: unknown property: " + property + "=" + value);
   }
@@ -414,6 +462,12 @@ void SystemProperties::logSettings() {
   settings += "\n  enable-time-statistics = ";
   settings += getEnableTimeStatistics() ? "true" : "false";
 
+  settings += "\n  expiry-timing-wheel-enabled = ";
+  settings += expiryTimingWheelEnabled() ? "true" : "false";
+
+  settings += "\n  expiry-timing-wheel-tick = ";
+  settings += to_string(expiryTimingWheelTick());
+
   settings += "\n  heap-lru-delta = ";
   settings += std::to_string(heapLRUDelta());
 
@@ -441,6 +495,12 @@ void SystemProperties::logSettings() {
   settings += "\n  notify-ack-interval = ";
   settings += to_string(notifyAckInterval());
 
+  settings += "\n  notify-dispatch-queue-size = ";
+  settings += std::to_string(notifyDispatchQueueSize());
+
+  settings += "\n  notify-dispatch-threads = ";
+  settings += std::to_string(notifyDispatchThreads());
+
   settings += "\n  notify-dupcheck-life = ";
   settings += to_string(notifyDupCheckLife());
 
@@ -464,6 +524,9 @@ void SystemProperties::logSettings() {
   settings += "\n  ssl-keystore = ";
   settings += sslKeyStore();
 
+  settings += "\n  ssl-ktls-enabled = ";
+  settings += sslKtlsEnabled() ? "true" : "false";
+
   settings += "\n  ssl-truststore = ";
   settings += sslTrustStore();
 
@@ -482,6 +545,15 @@ void SystemProperties::logSettings() {
   settings += "\n  tombstone-timeout = ";
   settings += to_string(tombstoneTimeout());
 
+  settings += "\n  tracing-buffer-size = ";
+  settings += std::to_string(tracingBufferSize());
+
+  settings += "\n  tracing-file = ";
+  settings += tracingFile();
+
+  settings += "\n  tracing-sample-rate = ";
+  settings += std::to_string(tracingSampleRate());
+
   // *** PLEASE ADD IN ALPHABETICAL ORDER - USER VISIBLE ***
 
   LOGCONFIG(settings);
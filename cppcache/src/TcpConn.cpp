@@ -17,13 +17,19 @@
 
 #include "TcpConn.hpp"
 
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
 #include <iomanip>
 #include <iostream>
+#include <memory>
+#include <mutex>
 
-#include <boost/optional.hpp>
 #include <boost/system/error_code.hpp>
 #include <boost/system/system_error.hpp>
 
+#include "IoEngine.hpp"
+#include "ResolvedAddressCache.hpp"
 #include "util/Log.hpp"
 
 namespace {
@@ -97,6 +103,11 @@ class timeval {
 // receieve timeouts.
 typedef timeval<SOL_SOCKET, SO_SNDTIMEO> send_timeout;
 typedef timeval<SOL_SOCKET, SO_RCVTIMEO> receive_timeout;
+
+// Message headers, chunk headers and small bodies are taken from one socket
+// read of up to this many bytes. Larger reads go straight into the caller's
+// buffer.
+constexpr std::size_t READ_AHEAD_SIZE = 16 * 1024;
 }  // namespace
 
 namespace apache {
@@ -104,17 +115,28 @@ namespace geode {
 namespace client {
 TcpConn::TcpConn(const std::string ipaddr,
                  std::chrono::microseconds connect_timeout,
-                 int32_t maxBuffSizePool)
+                 int32_t maxBuffSizePool, IoEngine *ioEngine)
     : TcpConn{
           ipaddr.substr(0, ipaddr.find(':')),
           static_cast<uint16_t>(std::stoi(ipaddr.substr(ipaddr.find(':') + 1))),
-          connect_timeout, maxBuffSizePool} {}
+          connect_timeout, maxBuffSizePool, ioEngine} {}
 
 TcpConn::TcpConn(const std::string host, uint16_t port,
-                 std::chrono::microseconds timeout, int32_t maxBuffSizePool)
-    : socket_{io_context_} {
+                 std::chrono::microseconds timeout, int32_t maxBuffSizePool,
+                 IoEngine *ioEngine)
+    : io_engine_{ioEngine},
+      socket_{ioEngine ? ioEngine->getIoContext() : io_context_},
+      strand_{ioEngine ? ioEngine->getIoContext() : io_context_},
+      read_ahead_(READ_AHEAD_SIZE),
+      read_ahead_begin_(0),
+      read_ahead_end_(0) {
   auto beforeResolvePoint = std::chrono::system_clock::now();
-  auto results = resolve(host, port, timeout);
+  auto& addressCache = ResolvedAddressCache::instance();
+  boost::asio::ip::tcp::resolver::results_type results;
+  if (!addressCache.find(host, port, results)) {
+    results = resolve(host, port, timeout);
+    addressCache.insert(host, port, results);
+  }
   auto elapsedTime = std::chrono::duration<double, std::micro>(
       std::chrono::system_clock::now() - beforeResolvePoint);
 
@@ -122,7 +144,13 @@ TcpConn::TcpConn(const std::string host, uint16_t port,
   // on.
   auto connectTimeout = std::chrono::duration_cast<std::chrono::microseconds>(
       timeout - elapsedTime);
-  connect(results, connectTimeout);
+  try {
+    connect(results, connectTimeout);
+  } catch (...) {
+    // the server may have moved; resolve its name again next time
+    addressCache.erase(host, port);
+    throw;
+  }
 
   socket_.set_option(::boost::asio::ip::tcp::no_delay{true});
   socket_.set_option(
@@ -184,46 +212,130 @@ TcpConn::~TcpConn() {
 
 size_t TcpConn::receive(char *buff, const size_t len,
                         std::chrono::milliseconds timeout) {
-  std::stringstream ss;
-  ss << "Receiving " << len << " bytes from " << socket_.remote_endpoint()
-     << " -> " << socket_.local_endpoint();
-  LOGDEBUG(ss.str());
+  if (Log::debugEnabled()) {
+    std::stringstream ss;
+    ss << "Receiving " << len << " bytes from " << socket_.remote_endpoint()
+       << " -> " << socket_.local_endpoint();
+    LOGDEBUG(ss.str());
+  }
   return receive(buff, len, timeout, true);
 }
 
 size_t TcpConn::receive_nothrowiftimeout(char *buff, const size_t len,
                                          std::chrono::milliseconds timeout) {
-  std::stringstream ss;
-  ss << "Receiving an unknown number of bytes from "
-     << socket_.remote_endpoint() << " -> " << socket_.local_endpoint();
-  LOGDEBUG(ss.str());
+  if (Log::debugEnabled()) {
+    std::stringstream ss;
+    ss << "Receiving an unknown number of bytes from "
+       << socket_.remote_endpoint() << " -> " << socket_.local_endpoint();
+    LOGDEBUG(ss.str());
+  }
   return receive(buff, len, timeout, false);
 }
 
+TcpConn::Outcome TcpConn::run(const std::function<void(Completion)> &start,
+                              std::chrono::microseconds timeout,
+                              const std::function<void()> &cancel) {
+  struct State {
+    std::mutex mutex;
+    std::condition_variable completed;
+    bool done = false;
+    boost::system::error_code error;
+    std::size_t bytes = 0;
+  };
+  auto state = std::make_shared<State>();
+
+  Completion handler = [state](const boost::system::error_code &ec,
+                               std::size_t n) {
+    std::lock_guard<std::mutex> lock(state->mutex);
+    state->error = ec;
+    state->bytes = n;
+    state->done = true;
+    state->completed.notify_all();
+  };
+  std::function<void()> abort = [this, cancel] {
+    if (cancel) {
+      cancel();
+    } else {
+      boost::system::error_code ignored;
+      socket_.cancel(ignored);
+    }
+  };
+
+  boost::asio::post(strand_, [start, handler] { start(handler); });
+
+  bool timedOut;
+  if (io_engine_) {
+    std::unique_lock<std::mutex> lock(state->mutex);
+    timedOut = !state->completed.wait_for(lock, timeout,
+                                          [&state] { return state->done; });
+    if (timedOut) {
+      lock.unlock();
+      boost::asio::post(strand_, abort);
+      lock.lock();
+      // Get the abort
+      state->completed.wait(lock, [&state] { return state->done; });
+    }
+  } else {
+    io_context_.restart();
+    io_context_.run_for(timeout);
+    timedOut = !state->done;
+    if (timedOut) {
+      abort();
+      // Get the abort
+      io_context_.restart();
+      io_context_.run();
+    }
+  }
+
+  return Outcome{timedOut, state->error, state->bytes};
+}
+
 size_t TcpConn::receive(char *buff, const size_t len,
                         std::chrono::milliseconds timeout,
                         bool throwTimeoutException) {
-  boost::optional<boost::system::error_code> read_result;
-  std::size_t bytes_read = 0;
+  auto bytes_read = drainReadAhead(buff, len);
+  if (bytes_read == len) {
+    return bytes_read;
+  }
 
   auto beforeResolvePoint = std::chrono::system_clock::now();
 
+  // Whatever the socket has beyond what is needed is kept for the next call,
+  // unless the read is too large to go through the read-ahead buffer.
+  auto remaining = len - bytes_read;
+  auto direct = remaining >= read_ahead_.size();
+  auto target = direct ? buff + bytes_read : read_ahead_.data();
+  auto capacity = direct ? remaining : read_ahead_.size();
+
+  Outcome outcome;
   try {
-    prepareAsyncRead(buff, len, read_result, bytes_read);
-    io_context_.restart();
-    io_context_.run_for(timeout);
+    outcome = run(
+        [this, target, capacity, remaining](Completion done) {
+          prepareAsyncRead(target, capacity, remaining, std::move(done));
+        },
+        timeout);
   } catch (...) {
     LOGDEBUG("Throwing an unexpected read exception");
     throw;
   }
 
-  if (read_result && *read_result) {
-    LOGDEBUG("Throwing a read exception: %s", read_result->message().c_str());
-    socket_.cancel();
-    // Get the abort
-    io_context_.restart();
-    io_context_.run();
-    throw boost::system::system_error{*read_result};
+  // EOF itself occurs when there is no data available on the socket at the
+  // time of the read. It may simply imply data has yet to arrive. Do nothing.
+  // Defer to timeout rather than assume a broken connection.
+  if (!outcome.timedOut && outcome.error &&
+      outcome.error != boost::asio::error::eof &&
+      outcome.error != boost::asio::error::try_again) {
+    LOGDEBUG("Throwing a read exception: %s", outcome.error.message().c_str());
+    throw boost::system::system_error{outcome.error};
+  }
+
+  if (!outcome.timedOut) {
+    if (direct) {
+      bytes_read += outcome.bytes;
+    } else {
+      read_ahead_end_ = outcome.bytes;
+      bytes_read += drainReadAhead(buff + bytes_read, remaining);
+    }
   }
 
   if (bytes_read == 0) {
@@ -231,27 +343,15 @@ size_t TcpConn::receive(char *buff, const size_t len,
         std::chrono::system_clock::now() - beforeResolvePoint);
     if (elapsedTime < timeout) {
       LOGDEBUG("Throwing an IO exception");
-      socket_.cancel();
-      // Get the abort
-      io_context_.restart();
-      io_context_.run();
       throw boost::system::system_error{boost::asio::error::broken_pipe};
     } else {
       LOGDEBUG("Throwing an eof exception");
-      socket_.cancel();
-      // Get the abort
-      io_context_.restart();
-      io_context_.run();
       throw boost::system::system_error{boost::asio::error::eof};
     }
   }
 
   if (bytes_read != len && throwTimeoutException) {
     LOGDEBUG("Throwing a read timeout exception");
-    socket_.cancel();
-    // Get the abort
-    io_context_.restart();
-    io_context_.run();
     throw boost::system::system_error{boost::asio::error::operation_aborted};
   }
 
@@ -260,38 +360,109 @@ size_t TcpConn::receive(char *buff, const size_t len,
 
 size_t TcpConn::send(const char *buff, const size_t len,
                      std::chrono::milliseconds timeout) {
-  std::stringstream ss;
-  ss << "Sending " << len << " bytes from " << socket_.local_endpoint()
-     << " -> " << socket_.remote_endpoint();
-  LOGDEBUG(ss.str());
-
-  boost::optional<boost::system::error_code> write_result;
-  std::size_t bytes_written = 0;
+  if (Log::debugEnabled()) {
+    std::stringstream ss;
+    ss << "Sending " << len << " bytes from " << socket_.local_endpoint()
+       << " -> " << socket_.remote_endpoint();
+    LOGDEBUG(ss.str());
+  }
 
+  Outcome outcome;
   try {
-    prepareAsyncWrite(buff, len, write_result, bytes_written);
-    io_context_.restart();
-    io_context_.run_for(timeout);
+    outcome = run(
+        [this, buff, len](Completion done) {
+          prepareAsyncWrite(buff, len, std::move(done));
+        },
+        timeout);
   } catch (...) {
     LOGDEBUG("Throwing an unexpected write exception");
     throw;
   }
 
-  if (write_result && *write_result) {
-    LOGDEBUG("Throwing a write exception. %s", write_result->message().c_str());
-    throw boost::system::system_error{*write_result};
+  if (!outcome.timedOut && outcome.error &&
+      outcome.error != boost::asio::error::eof &&
+      outcome.error != boost::asio::error::try_again) {
+    LOGDEBUG("Throwing a write exception. %s",
+             outcome.error.message().c_str());
+    throw boost::system::system_error{outcome.error};
   }
 
-  if (bytes_written != len) {
+  if (outcome.timedOut || outcome.bytes != len) {
     LOGDEBUG("Throwing a write timeout exception");
-    socket_.cancel();
-    // Get the abort
-    io_context_.restart();
-    io_context_.run();
     throw boost::system::system_error{boost::asio::error::operation_aborted};
   }
 
-  return bytes_written;
+  return outcome.bytes;
+}
+
+std::size_t TcpConn::drainReadAhead(char *buff, std::size_t len) {
+  auto n = std::min(len, read_ahead_end_ - read_ahead_begin_);
+  if (n > 0) {
+    std::memcpy(buff, read_ahead_.data() + read_ahead_begin_, n);
+    read_ahead_begin_ += n;
+  }
+  if (read_ahead_begin_ == read_ahead_end_) {
+    read_ahead_begin_ = read_ahead_end_ = 0;
+  }
+  return n;
+}
+
+void TcpConn::asyncReceive(char *buff, size_t len, Completion handler) {
+  if (io_engine_) {
+    auto copied = drainReadAhead(buff, len);
+    if (copied == len) {
+      boost::asio::post(strand_, [handler, len] {
+        handler(boost::system::error_code{}, len);
+      });
+      return;
+    }
+    auto remaining = len - copied;
+    boost::asio::post(strand_, [this, buff, copied, remaining, handler] {
+      prepareAsyncRead(buff + copied, remaining, remaining,
+                       [copied, handler](const boost::system::error_code &ec,
+                                         std::size_t n) {
+                         handler(ec, copied + n);
+                       });
+    });
+    return;
+  }
+
+  boost::system::error_code ec;
+  std::size_t n = 0;
+  try {
+    n = receive(buff, len, DEFAULT_READ_TIMEOUT, true);
+  } catch (const boost::system::system_error &ex) {
+    ec = ex.code();
+  }
+  handler(ec, n);
+}
+
+void TcpConn::asyncSend(const char *buff, size_t len, Completion handler) {
+  if (io_engine_) {
+    boost::asio::post(strand_, [this, buff, len, handler] {
+      prepareAsyncWrite(buff, len, handler);
+    });
+    return;
+  }
+
+  boost::system::error_code ec;
+  std::size_t n = 0;
+  try {
+    n = send(buff, len, DEFAULT_WRITE_TIMEOUT);
+  } catch (const boost::system::system_error &ex) {
+    ec = ex.code();
+  }
+  handler(ec, n);
+}
+
+void TcpConn::cancel() {
+  // Only the kernel's side of the socket is touched, so this is safe while
+  // another thread waits on socket_.
+#if defined(_WINDOWS)
+  ::shutdown(socket_.native_handle(), SD_BOTH);
+#else
+  ::shutdown(socket_.native_handle(), SHUT_RDWR);
+#endif
 }
 
 //  Return the local port for this TCP connection.
@@ -299,124 +470,133 @@ uint16_t TcpConn::getPort() { return socket_.local_endpoint().port(); }
 
 void TcpConn::connect(boost::asio::ip::tcp::resolver::results_type r,
                       std::chrono::microseconds timeout) {
-  boost::optional<boost::system::error_code> connect_result;
-
+  Outcome outcome;
   try {
     // We must connect first so we have a valid file descriptor to set
     // options on.
-    boost::asio::async_connect(
-        socket_, r,
-        [&connect_result](const boost::system::error_code &ec,
-                          const boost::asio::ip::tcp::endpoint) {
-          connect_result = ec;
-        });
-
-    io_context_.restart();
-    io_context_.run_for(timeout);
+    outcome = run(
+        [this, &r](Completion done) {
+          boost::asio::async_connect(
+              socket_, r,
+              boost::asio::bind_executor(
+                  strand_, [done](const boost::system::error_code &ec,
+                                  const boost::asio::ip::tcp::endpoint) {
+                    done(ec, 0);
+                  }));
+        },
+        timeout);
   } catch (...) {
     LOGDEBUG("Throwing an unexpected connect exception");
     throw;
   }
 
-  if (connect_result && *connect_result) {
-    LOGDEBUG("Throwing a connect exception: %s",
-             connect_result->message().c_str());
-    throw boost::system::system_error{*connect_result};
-  }
-
-  if (!connect_result) {
+  if (outcome.timedOut) {
     LOGDEBUG("Throwing a connect timeout exception");
     throw boost::system::system_error{boost::asio::error::operation_aborted};
   }
 
+  if (outcome.error) {
+    LOGDEBUG("Throwing a connect exception: %s",
+             outcome.error.message().c_str());
+    throw boost::system::system_error{outcome.error};
+  }
+
   std::stringstream ss;
   ss << "Connected " << socket_.local_endpoint() << " -> "
      << socket_.remote_endpoint();
   LOGDEBUG(ss.str());
 }
 
+void TcpConn::reconnect(std::chrono::microseconds timeout,
+                        int32_t maxBuffSizePool) {
+  auto endpoint = socket_.remote_endpoint();
+  boost::system::error_code ignored;
+  socket_.shutdown(boost::asio::ip::tcp::socket::shutdown_both, ignored);
+  socket_.close(ignored);
+  read_ahead_begin_ = read_ahead_end_ = 0;
+
+  auto outcome = run(
+      [this, endpoint](Completion done) {
+        socket_.async_connect(
+            endpoint,
+            boost::asio::bind_executor(
+                strand_, [done](const boost::system::error_code &ec) {
+                  done(ec, 0);
+                }));
+      },
+      timeout);
+
+  if (outcome.timedOut) {
+    LOGDEBUG("Throwing a reconnect timeout exception");
+    throw boost::system::system_error{boost::asio::error::operation_aborted};
+  }
+
+  if (outcome.error) {
+    LOGDEBUG("Throwing a reconnect exception: %s",
+             outcome.error.message().c_str());
+    throw boost::system::system_error{outcome.error};
+  }
+
+  socket_.set_option(::boost::asio::ip::tcp::no_delay{true});
+  socket_.set_option(
+      ::boost::asio::socket_base::send_buffer_size{maxBuffSizePool});
+  socket_.set_option(
+      ::boost::asio::socket_base::receive_buffer_size{maxBuffSizePool});
+}
+
 boost::asio::ip::tcp::resolver::results_type TcpConn::resolve(
     const std::string host, uint16_t port, std::chrono::microseconds timeout) {
-  boost::optional<boost::system::error_code> resolve_result;
   boost::asio::ip::tcp::resolver::results_type results;
+  boost::asio::ip::tcp::resolver resolver(socket_.get_executor());
 
+  Outcome outcome;
   try {
-    boost::asio::ip::tcp::resolver resolver(io_context_);
-    resolver.async_resolve(host, std::to_string(port),
-                           [&resolve_result, &results](
-                               const boost::system::error_code &ec,
-                               boost::asio::ip::tcp::resolver::results_type r) {
-                             if (ec) {
-                               resolve_result = ec;
-                             } else {
-                               resolve_result = boost::system::error_code{};
-                               results = r;
-                             }
-                           });
-
-    io_context_.restart();
-    io_context_.run_for(timeout);
+    outcome = run(
+        [this, &resolver, &results, &host, port](Completion done) {
+          resolver.async_resolve(
+              host, std::to_string(port),
+              boost::asio::bind_executor(
+                  strand_,
+                  [&results, done](
+                      const boost::system::error_code &ec,
+                      boost::asio::ip::tcp::resolver::results_type r) {
+                    if (!ec) {
+                      results = r;
+                    }
+                    done(ec, 0);
+                  }));
+        },
+        timeout, [&resolver] { resolver.cancel(); });
   } catch (...) {
     LOGDEBUG("Throwing an unexpected resolve exception");
     throw;
   }
 
-  if (resolve_result && *resolve_result) {
-    LOGDEBUG("Throwing a resolve exception: %s",
-             resolve_result->message().c_str());
-    throw boost::system::system_error{*resolve_result};
-  }
-
-  if (!resolve_result) {
+  if (outcome.timedOut) {
     LOGDEBUG("Throwing a resolve timeout exception");
-    socket_.cancel();
-    // Get the abort
-    io_context_.restart();
-    io_context_.run();
     throw boost::system::system_error{boost::asio::error::operation_aborted};
   }
 
+  if (outcome.error) {
+    LOGDEBUG("Throwing a resolve exception: %s",
+             outcome.error.message().c_str());
+    throw boost::system::system_error{outcome.error};
+  }
+
   return results;
 }
 
-void TcpConn::prepareAsyncRead(
-    char *buff, size_t len,
-    boost::optional<boost::system::error_code> &read_result,
-    std::size_t &bytes_read) {
-  boost::asio::async_read(
-      socket_, boost::asio::buffer(buff, len),
-      [&read_result, &bytes_read](const boost::system::error_code &ec,
-                                  const size_t n) {
-        bytes_read = n;
-
-        // EOF itself occurs when there is no data available on the socket at
-        // the time of the read. It may simply imply data has yet to arrive.
-        // Do nothing. Defer to timeout rather than assume a broken
-        // connection.
-        if (ec != boost::asio::error::eof &&
-            ec != boost::asio::error::try_again) {
-          read_result = ec;
-          return;
-        }
-      });
+void TcpConn::prepareAsyncRead(char *buff, size_t len, size_t minimum,
+                               Completion handler) {
+  boost::asio::async_read(socket_, boost::asio::buffer(buff, len),
+                          boost::asio::transfer_at_least(minimum),
+                          boost::asio::bind_executor(strand_, handler));
 }
 
-void TcpConn::prepareAsyncWrite(
-    const char *buff, size_t len,
-    boost::optional<boost::system::error_code> &write_result,
-    std::size_t &bytes_written) {
-  boost::asio::async_write(
-      socket_, boost::asio::buffer(buff, len),
-      [&write_result, &bytes_written](const boost::system::error_code &ec,
-                                      const size_t n) {
-        bytes_written = n;
-
-        if (ec != boost::asio::error::eof &&
-            ec != boost::asio::error::try_again) {
-          write_result = ec;
-          return;
-        }
-      });
+void TcpConn::prepareAsyncWrite(const char *buff, size_t len,
+                                Completion handler) {
+  boost::asio::async_write(socket_, boost::asio::buffer(buff, len),
+                           boost::asio::bind_executor(strand_, handler));
 }
 
 }  // namespace client
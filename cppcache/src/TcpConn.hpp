@@ -20,8 +20,10 @@
 #ifndef GEODE_TCPCONN_H_
 #define GEODE_TCPCONN_H_
 
+#include <functional>
+#include <vector>
+
 #include <boost/asio.hpp>
-#include <boost/optional.hpp>
 
 #include <geode/internal/geode_globals.hpp>
 
@@ -30,17 +32,55 @@
 namespace apache {
 namespace geode {
 namespace client {
+
+class IoEngine;
+
 class TcpConn : public Connector {
   size_t receive(char*, size_t, std::chrono::milliseconds) override;
   size_t receive_nothrowiftimeout(char*, size_t,
                                   std::chrono::milliseconds) override;
   size_t send(const char*, size_t, std::chrono::milliseconds) override;
 
+  void asyncReceive(char*, size_t, Completion) override;
+  void asyncSend(const char*, size_t, Completion) override;
+
+  void cancel() override;
+
   uint16_t getPort() override final;
 
  protected:
+  // the shared reactor, or nullptr if this connection runs io_context_ on
+  // the thread waiting for each operation
+  IoEngine* io_engine_;
   boost::asio::io_context io_context_;
   boost::asio::ip::tcp::socket socket_;
+  // serializes the operations started on socket_ with their cancellation
+  boost::asio::io_context::strand strand_;
+
+  // bytes read from the socket ahead of the caller, waiting in
+  // [read_ahead_begin_, read_ahead_end_) to be handed out by receive
+  std::vector<char> read_ahead_;
+  std::size_t read_ahead_begin_;
+  std::size_t read_ahead_end_;
+
+  /**
+   * The result of an operation run to completion or timeout. An operation
+   * that timed out was cancelled; what it transferred is not reported.
+   */
+  struct Outcome {
+    bool timedOut;
+    boost::system::error_code error;
+    std::size_t bytes;
+  };
+
+  /**
+   * Starts an asynchronous operation on the strand and waits until its
+   * completion handler has run, cancelling it with cancel, or by cancelling
+   * socket_ if that is empty, once timeout has elapsed.
+   */
+  Outcome run(const std::function<void(Completion)>& start,
+              std::chrono::microseconds timeout,
+              const std::function<void()>& cancel = nullptr);
 
   boost::asio::ip::tcp::resolver::results_type resolve(
       const std::string hostname, uint16_t port,
@@ -49,25 +89,37 @@ class TcpConn : public Connector {
   void connect(boost::asio::ip::tcp::resolver::results_type r,
                std::chrono::microseconds connect_timeout);
 
+  /**
+   * Closes socket_ and connects it again to the same server.
+   */
+  void reconnect(std::chrono::microseconds connect_timeout,
+                 int32_t maxBuffSizePool);
+
   size_t receive(char*, size_t, std::chrono::milliseconds,
                  bool throwTimeoutException);
 
-  virtual void prepareAsyncRead(
-      char* buff, size_t len,
-      boost::optional<boost::system::error_code>& read_result,
-      std::size_t& bytes_read);
+  /**
+   * Copies up to len bytes already read ahead into buff, returning how many.
+   */
+  std::size_t drainReadAhead(char* buff, std::size_t len);
+
+  /**
+   * Reads into buff until at least minimum of its len bytes have arrived,
+   * taking whatever more the socket already has.
+   */
+  virtual void prepareAsyncRead(char* buff, size_t len, size_t minimum,
+                                Completion handler);
 
-  virtual void prepareAsyncWrite(
-      const char* buff, size_t len,
-      boost::optional<boost::system::error_code>& write_result,
-      std::size_t& bytes_written);
+  virtual void prepareAsyncWrite(const char* buff, size_t len,
+                                 Completion handler);
 
  public:
   TcpConn(const std::string ipaddr, std::chrono::microseconds connect_timeout,
-          int32_t maxBuffSizePool);
+          int32_t maxBuffSizePool, IoEngine* ioEngine = nullptr);
 
   TcpConn(const std::string hostname, uint16_t port,
-          std::chrono::microseconds connect_timeout, int32_t maxBuffSizePool);
+          std::chrono::microseconds connect_timeout, int32_t maxBuffSizePool,
+          IoEngine* ioEngine = nullptr);
 
   TcpConn(const std::string ipaddr, std::chrono::microseconds connect_timeout,
           int32_t maxBuffSizePool, std::chrono::microseconds send_timeout,
@@ -25,7 +25,6 @@
 #include <thread>
 
 #include <boost/exception/diagnostic_information.hpp>
-#include <boost/optional.hpp>
 
 #include <geode/ExceptionTypes.hpp>
 #include <geode/SystemProperties.hpp>
@@ -40,47 +39,47 @@ TcpSslConn::TcpSslConn(const std::string& hostname, uint16_t,
                        const std::string& sniProxyHostname,
                        uint16_t sniProxyPort,
                        std::chrono::microseconds connect_timeout,
-                       int32_t maxBuffSizePool, const std::string& pubkeyfile,
-                       const std::string& privkeyfile,
-                       const std::string& pemPassword)
-    : TcpConn{sniProxyHostname, sniProxyPort, connect_timeout, maxBuffSizePool},
-      ssl_context_{boost::asio::ssl::context::sslv23_client},
-      strand_(io_context_) {
-  init(pubkeyfile, privkeyfile, pemPassword, hostname);
+                       int32_t maxBuffSizePool,
+                       std::shared_ptr<SslContext> sslContext,
+                       IoEngine* ioEngine)
+    : TcpConn{sniProxyHostname, sniProxyPort, connect_timeout, maxBuffSizePool,
+              ioEngine},
+      ssl_context_{std::move(sslContext)},
+      ktls_ssl_{nullptr} {
+  init(connect_timeout, maxBuffSizePool, hostname);
 }
 
 TcpSslConn::TcpSslConn(const std::string& hostname, uint16_t port,
                        std::chrono::microseconds connect_timeout,
-                       int32_t maxBuffSizePool, const std::string& pubkeyfile,
-                       const std::string& privkeyfile,
-                       const std::string& pemPassword)
-    : TcpConn{hostname, port, connect_timeout, maxBuffSizePool},
-      ssl_context_{boost::asio::ssl::context::sslv23_client},
-      strand_(io_context_) {
-  init(pubkeyfile, privkeyfile, pemPassword);
+                       int32_t maxBuffSizePool,
+                       std::shared_ptr<SslContext> sslContext,
+                       IoEngine* ioEngine)
+    : TcpConn{hostname, port, connect_timeout, maxBuffSizePool, ioEngine},
+      ssl_context_{std::move(sslContext)},
+      ktls_ssl_{nullptr} {
+  init(connect_timeout, maxBuffSizePool);
 }
 
 TcpSslConn::TcpSslConn(const std::string& ipaddr,
                        std::chrono::microseconds connect_timeout,
-                       int32_t maxBuffSizePool, const std::string& pubkeyfile,
-                       const std::string& privkeyfile,
-                       const std::string& pemPassword)
+                       int32_t maxBuffSizePool,
+                       std::shared_ptr<SslContext> sslContext,
+                       IoEngine* ioEngine)
     : TcpSslConn{
           ipaddr.substr(0, ipaddr.find(':')),
           static_cast<uint16_t>(std::stoi(ipaddr.substr(ipaddr.find(':') + 1))),
           connect_timeout,
           maxBuffSizePool,
-          pubkeyfile,
-          privkeyfile,
-          pemPassword} {}
+          std::move(sslContext),
+          ioEngine} {}
 
 TcpSslConn::TcpSslConn(const std::string& ipaddr,
                        std::chrono::microseconds connect_timeout,
                        int32_t maxBuffSizePool,
                        const std::string& sniProxyHostname,
-                       uint16_t sniProxyPort, const std::string& pubkeyfile,
-                       const std::string& privkeyfile,
-                       const std::string& pemPassword)
+                       uint16_t sniProxyPort,
+                       std::shared_ptr<SslContext> sslContext,
+                       IoEngine* ioEngine)
     : TcpSslConn{
           ipaddr.substr(0, ipaddr.find(':')),
           static_cast<uint16_t>(std::stoi(ipaddr.substr(ipaddr.find(':') + 1))),
@@ -88,49 +87,45 @@ TcpSslConn::TcpSslConn(const std::string& ipaddr,
           sniProxyPort,
           connect_timeout,
           maxBuffSizePool,
-          pubkeyfile,
-          privkeyfile,
-          pemPassword} {}
+          std::move(sslContext),
+          ioEngine} {}
 
-void TcpSslConn::init(const std::string& pubkeyfile,
-                      const std::string& privkeyfile,
-                      const std::string& pemPassword,
+void TcpSslConn::init(std::chrono::microseconds connect_timeout,
+                      int32_t maxBuffSizePool,
                       const std::string& sniHostname) {
-  // Most of the SSL configuration provided *through* Asio is on the context.
-  // This configuration is copied into each SSL instance upon construction.
-  // That means you need to get your configuration in order before you
-  // construct the stream and connect the socket.
-  LOGDEBUG(
-      "*** TcpSslConn init, pubkeyfile = %s, pemPassword = %s, sniHostname = "
-      "%s",
-      pubkeyfile.c_str(), pemPassword.c_str(), sniHostname.c_str());
+  // The context, with its stores, is configured once and shared; each
+  // stream copies that configuration upon construction.
+  LOGDEBUG("*** TcpSslConn init, sniHostname = %s", sniHostname.c_str());
 
-  try {
-    ssl_context_.set_verify_mode(boost::asio::ssl::verify_peer);
-    ssl_context_.load_verify_file(pubkeyfile);
-
-    ssl_context_.set_password_callback(
-        [pemPassword](std::size_t /*max_length*/,
-                      boost::asio::ssl::context::password_purpose /*purpose*/) {
-          return pemPassword;
-        });
-
-    if (!privkeyfile.empty()) {
-      ssl_context_.use_certificate_chain_file(privkeyfile);
-      ssl_context_.use_private_key_file(
-          privkeyfile, boost::asio::ssl::context::file_format::pem);
-    }
+  // Sessions are resumed only with the server, and SNI name, they were
+  // negotiated with.
+  std::stringstream server;
+  server << socket_.remote_endpoint() << '/' << sniHostname;
+
+  if (ssl_context_->useKtls() &&
+      handshakeKtls(sniHostname, server.str(), connect_timeout,
+                    maxBuffSizePool)) {
+    return;
+  }
 
+  try {
     auto stream = std::unique_ptr<ssl_stream_type>(
-        new ssl_stream_type{socket_, ssl_context_});
+        new ssl_stream_type{socket_, ssl_context_->get()});
 
     SSL_set_tlsext_host_name(stream->native_handle(), sniHostname.c_str());
+    ssl_context_->prepare(stream->native_handle(), server.str());
 
-    stream->handshake(ssl_stream_type::client);
+    try {
+      stream->handshake(ssl_stream_type::client);
+    } catch (...) {
+      ssl_context_->forget(server.str());
+      throw;
+    }
 
     std::stringstream ss;
     ss << "Setup SSL " << socket_.local_endpoint() << " -> "
-       << socket_.remote_endpoint();
+       << socket_.remote_endpoint()
+       << (SSL_session_reused(stream->native_handle()) ? " (resumed)" : "");
     LOGINFO(ss.str());
 
     ss.clear();
@@ -154,48 +149,147 @@ TcpSslConn::~TcpSslConn() {
   } catch (...) {
   }
   LOGFINE(ss.str());
+
+  if (ktls_ssl_) {
+    SSL_set_shutdown(ktls_ssl_, SSL_SENT_SHUTDOWN | SSL_RECEIVED_SHUTDOWN);
+    SSL_free(ktls_ssl_);
+  } else if (socket_stream_) {
+    // No close_notify is exchanged with the server. Without this OpenSSL
+    // would mark the session as not resumable when the stream is freed.
+    SSL_set_shutdown(socket_stream_->native_handle(),
+                     SSL_SENT_SHUTDOWN | SSL_RECEIVED_SHUTDOWN);
+  }
 }
 
-void TcpSslConn::prepareAsyncRead(
-    char* buff, size_t len,
-    boost::optional<boost::system::error_code>& read_result,
-    std::size_t& bytes_read) {
-  boost::asio::async_read(
-      *socket_stream_, boost::asio::buffer(buff, len),
-      boost::asio::bind_executor(
-          strand_, [&read_result, &bytes_read](
-                       const boost::system::error_code& ec, const size_t n) {
-            bytes_read = n;
-
-            // EOF itself occurs when there is no data available on the socket
-            // at the time of the read. It may simply imply data has yet to
-            // arrive. Do nothing. Defer to timeout rather than assume a broken
-            // connection.
-            if (ec != boost::asio::error::eof &&
-                ec != boost::asio::error::try_again) {
-              read_result = ec;
-              return;
-            }
-          }));
+bool TcpSslConn::handshakeKtls(const std::string& sniHostname,
+                               const std::string& server,
+                               std::chrono::microseconds timeout,
+                               int32_t maxBuffSizePool) {
+#if defined(SSL_OP_ENABLE_KTLS) && !defined(OPENSSL_NO_KTLS)
+  auto ssl = SSL_new(ssl_context_->get().native_handle());
+  if (!ssl) {
+    throw SslException("Failed to create an SSL connection for kTLS");
+  }
+
+  SSL_set_options(ssl, SSL_OP_ENABLE_KTLS);
+  // Post-handshake messages of TLS 1.3, such as session tickets, arrive as
+  // records the kernel cannot hand to a plain read.
+  SSL_set_max_proto_version(ssl, TLS1_2_VERSION);
+  SSL_set_tlsext_host_name(ssl, sniHostname.c_str());
+  ssl_context_->prepare(ssl, server);
+  SSL_set_fd(ssl, static_cast<int>(socket_.native_handle()));
+  socket_.native_non_blocking(true);
+
+  auto deadline = std::chrono::steady_clock::now() + timeout;
+  std::string failure;
+  bool versionRefused = false;
+  while (failure.empty()) {
+    auto result = SSL_connect(ssl);
+    if (result == 1) {
+      break;
+    }
+
+    auto error = SSL_get_error(ssl, result);
+    if (error != SSL_ERROR_WANT_READ && error != SSL_ERROR_WANT_WRITE) {
+      auto code = ERR_get_error();
+      versionRefused =
+          ERR_GET_REASON(code) == SSL_R_TLSV1_ALERT_PROTOCOL_VERSION ||
+          ERR_GET_REASON(code) == SSL_R_UNSUPPORTED_PROTOCOL;
+      char reason[256];
+      ERR_error_string_n(code, reason, sizeof(reason));
+      failure = reason;
+      break;
+    }
+
+    auto remaining = std::chrono::duration_cast<std::chrono::microseconds>(
+        deadline - std::chrono::steady_clock::now());
+    if (remaining.count() <= 0) {
+      failure = "handshake timed out";
+      break;
+    }
+
+    auto wait = error == SSL_ERROR_WANT_READ
+                    ? boost::asio::ip::tcp::socket::wait_read
+                    : boost::asio::ip::tcp::socket::wait_write;
+    auto outcome = run(
+        [this, wait](Completion done) {
+          socket_.async_wait(
+              wait, boost::asio::bind_executor(
+                        strand_, [done](const boost::system::error_code& ec) {
+                          done(ec, 0);
+                        }));
+        },
+        remaining);
+    if (outcome.timedOut) {
+      failure = "handshake timed out";
+    } else if (outcome.error) {
+      failure = outcome.error.message();
+    }
+  }
+
+  if (!failure.empty() && !versionRefused) {
+    SSL_free(ssl);
+    ssl_context_->forget(server);
+    throw SslException("SSL handshake failed: " + failure);
+  }
+
+  auto reused = failure.empty() && SSL_session_reused(ssl);
+  if (versionRefused || !BIO_get_ktls_send(SSL_get_wbio(ssl)) ||
+      !BIO_get_ktls_recv(SSL_get_rbio(ssl))) {
+    // A server that requires TLS 1.3 refuses the handshake, and a cipher the
+    // kernel lacks leaves records already exchanged encrypted by OpenSSL.
+    // Either way the stream cannot take over this connection; start over on
+    // a new one.
+    if (versionRefused) {
+      ssl_context_->forget(server);
+    } else {
+      SSL_set_shutdown(ssl, SSL_SENT_SHUTDOWN | SSL_RECEIVED_SHUTDOWN);
+    }
+    SSL_free(ssl);
+    ssl_context_->disableKtls();
+    reconnect(timeout, maxBuffSizePool);
+    return false;
+  }
+
+  std::stringstream ss;
+  ss << "Setup SSL " << socket_.local_endpoint() << " -> "
+     << socket_.remote_endpoint() << " (kTLS"
+     << (reused ? ", resumed)" : ")");
+  LOGINFO(ss.str());
+
+  ktls_ssl_ = ssl;
+  return true;
+#else
+  (void)sniHostname;
+  (void)server;
+  (void)timeout;
+  (void)maxBuffSizePool;
+  return false;
+#endif
 }
 
-void TcpSslConn::prepareAsyncWrite(
-    const char* buff, size_t len,
-    boost::optional<boost::system::error_code>& write_result,
-    std::size_t& bytes_written) {
-  boost::asio::async_write(
-      *socket_stream_, boost::asio::buffer(buff, len),
-      boost::asio::bind_executor(
-          strand_, [&write_result, &bytes_written](
-                       const boost::system::error_code& ec, const size_t n) {
-            bytes_written = n;
-
-            if (ec != boost::asio::error::eof &&
-                ec != boost::asio::error::try_again) {
-              write_result = ec;
-              return;
-            }
-          }));
+void TcpSslConn::prepareAsyncRead(char* buff, size_t len, size_t minimum,
+                                  Completion handler) {
+  if (!socket_stream_) {
+    // the kernel decrypts what is read from socket_
+    TcpConn::prepareAsyncRead(buff, len, minimum, std::move(handler));
+    return;
+  }
+
+  boost::asio::async_read(*socket_stream_, boost::asio::buffer(buff, len),
+                          boost::asio::transfer_at_least(minimum),
+                          boost::asio::bind_executor(strand_, handler));
+}
+
+void TcpSslConn::prepareAsyncWrite(const char* buff, size_t len,
+                                   Completion handler) {
+  if (!socket_stream_) {
+    TcpConn::prepareAsyncWrite(buff, len, std::move(handler));
+    return;
+  }
+
+  boost::asio::async_write(*socket_stream_, boost::asio::buffer(buff, len),
+                           boost::asio::bind_executor(strand_, handler));
 }
 
 }  // namespace client
@@ -20,8 +20,11 @@
 #ifndef GEODE_TCPSSLCONN_H_
 #define GEODE_TCPSSLCONN_H_
 
+#include <memory>
+
 #include <boost/asio/ssl.hpp>
 
+#include "SslContext.hpp"
 #include "TcpConn.hpp"
 
 namespace apache {
@@ -33,47 +36,55 @@ class TcpSslConn : public TcpConn {
   using ssl_stream_type =
       boost::asio::ssl::stream<boost::asio::ip::tcp::socket&>;
 
-  boost::asio::ssl::context ssl_context_;
+  std::shared_ptr<SslContext> ssl_context_;
   std::unique_ptr<ssl_stream_type> socket_stream_;
-  boost::asio::io_context::strand strand_;
+  // the connection whose records the kernel encrypts, when offloaded, in
+  // which case socket_stream_ is empty and socket_ carries plain data
+  SSL* ktls_ssl_;
 
-  void prepareAsyncRead(char* buff, size_t len,
-                        boost::optional<boost::system::error_code>& read_result,
-                        std::size_t& bytes_read) override;
+  void prepareAsyncRead(char* buff, size_t len, size_t minimum,
+                        Completion handler) override;
 
-  void prepareAsyncWrite(
-      const char* buff, size_t len,
-      boost::optional<boost::system::error_code>& write_result,
-      std::size_t& bytes_written) override;
+  void prepareAsyncWrite(const char* buff, size_t len,
+                         Completion handler) override;
 
  public:
   TcpSslConn(const std::string& hostname, uint16_t port,
              const std::string& sniProxyHostname, uint16_t sniProxyPort,
              std::chrono::microseconds connect_timeout, int32_t maxBuffSizePool,
-             const std::string& pubkeyfile, const std::string& privkeyfile,
-             const std::string& pemPassword);
+             std::shared_ptr<SslContext> sslContext,
+             IoEngine* ioEngine = nullptr);
 
   TcpSslConn(const std::string& hostname, uint16_t port,
              std::chrono::microseconds connect_timeout, int32_t maxBuffSizePool,
-             const std::string& pubkeyfile, const std::string& privkeyfile,
-             const std::string& pemPassword);
+             std::shared_ptr<SslContext> sslContext,
+             IoEngine* ioEngine = nullptr);
 
   TcpSslConn(const std::string& ipaddr,
              std::chrono::microseconds connect_timeout, int32_t maxBuffSizePool,
-             const std::string& pubkeyfile, const std::string& privkeyfile,
-             const std::string& pemPassword);
+             std::shared_ptr<SslContext> sslContext,
+             IoEngine* ioEngine = nullptr);
 
   TcpSslConn(const std::string& ipaddr, std::chrono::microseconds waitSeconds,
              int32_t maxBuffSizePool, const std::string& sniProxyHostname,
-             uint16_t sniProxyPort, const std::string& publicKeyFile,
-             const std::string& privateKeyFile, const std::string& password);
+             uint16_t sniProxyPort, std::shared_ptr<SslContext> sslContext,
+             IoEngine* ioEngine = nullptr);
 
   ~TcpSslConn() override;
 
  private:
-  void init(const std::string& pubkeyfile, const std::string& privkeyfile,
-            const std::string& pemPassword,
+  void init(std::chrono::microseconds connect_timeout, int32_t maxBuffSizePool,
             const std::string& sniHostname = "");
+
+  /**
+   * Handshakes with OpenSSL reading and writing socket_ itself, so that it
+   * can hand the negotiated keys to the kernel. The handshake is limited to
+   * TLS 1.2. Returns false, with socket_ connected again, if the server
+   * refused TLS 1.2 or the kernel would not take the keys.
+   */
+  bool handshakeKtls(const std::string& sniHostname, const std::string& server,
+                     std::chrono::microseconds timeout,
+                     int32_t maxBuffSizePool);
 };
 }  // namespace client
 }  // namespace geode
@@ -26,6 +26,8 @@
 #include <ace/Semaphore.h>
 
 #include "AppDomainContext.hpp"
+#include "ReceiveBufferPool.hpp"
+#include "Tracer.hpp"
 #include "Utils.hpp"
 
 namespace apache {
@@ -117,52 +119,66 @@ class TcrChunkedResult {
 
 /**
  * Holds the context for a chunk including the chunk bytes, length and the
- * {@link TcrChunkedResult} object.
+ * {@link TcrChunkedResult} object. The chunk bytes are shared with the
+ * connection that received them rather than copied. The span of the operation
+ * that read the chunk is kept so that processing it on the chunk handler
+ * thread is traced as part of that operation.
  */
 class TcrChunkedContext {
  private:
-  const std::vector<uint8_t> m_chunk;
+  const ReceiveBuffer m_chunk;
   const int32_t m_len;
   const uint8_t m_isLastChunkWithSecurity;
   const CacheImpl* m_cache;
   TcrChunkedResult* m_result;
+  const TraceContext m_traceContext;
 
  public:
-  inline TcrChunkedContext(const std::vector<uint8_t> chunk, int32_t len,
+  inline TcrChunkedContext(ReceiveBuffer chunk, int32_t len,
                            TcrChunkedResult* result,
                            uint8_t isLastChunkWithSecurity,
                            const CacheImpl* cacheImpl)
-      : m_chunk(chunk),
+      : m_chunk(std::move(chunk)),
         m_len(len),
         m_isLastChunkWithSecurity(isLastChunkWithSecurity),
         m_cache(cacheImpl),
-        m_result(result) {}
+        m_result(result),
+        m_traceContext(Tracer::current()) {}
 
   inline ~TcrChunkedContext() = default;
 
-  inline const uint8_t* getBytes() const { return m_chunk.data(); }
+  inline const uint8_t* getBytes() const {
+    return m_chunk ? m_chunk->data() : nullptr;
+  }
 
-  inline size_t getLen() const { return m_chunk.size(); }
+  inline size_t getLen() const { return m_chunk ? m_chunk->size() : 0; }
 
   void handleChunk(bool inSameThread) {
-    if (m_chunk.empty()) {
+    if (getLen() == 0) {
       // this is the last chunk for some set of chunks
       m_result->finalize(inSameThread);
     } else if (!m_result->exceptionOccurred()) {
+      TraceScope trace(m_traceContext, "chunk.process");
+      if (trace.isRecording()) {
+        trace.setAttribute("bytes", std::to_string(m_len));
+      }
       try {
-        m_result->fireHandleChunk(m_chunk.data(), m_len,
+        m_result->fireHandleChunk(m_chunk->data(), m_len,
                                   m_isLastChunkWithSecurity, m_cache);
       } catch (Exception& ex) {
+        trace.setError();
         LOGERROR("HandleChunk error message %s, name = %s", ex.what(),
                  ex.getName().c_str());
         m_result->setException(std::make_shared<Exception>(ex));
       } catch (std::exception& stdEx) {
+        trace.setError();
         std::string exMsg("HandleChunk exception:: ");
         exMsg += stdEx.what();
         LOGERROR("HandleChunk exception: %s", stdEx.what());
         auto ex = std::make_shared<UnknownException>(exMsg.c_str());
         m_result->setException(ex);
       } catch (...) {
+        trace.setError();
         std::string exMsg("Unknown exception in ");
         exMsg += Utils::demangleTypeName(typeid(*m_result).name());
         exMsg +=
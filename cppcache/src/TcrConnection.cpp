@@ -31,6 +31,7 @@
 #include "TcrEndpoint.hpp"
 #include "ThinClientPoolHADM.hpp"
 #include "ThinClientRegion.hpp"
+#include "Tracer.hpp"
 #include "Utils.hpp"
 #include "Version.hpp"
 
@@ -93,7 +94,7 @@ struct FinalizeProcessChunk {
       : m_reply(reply), m_endpointMemId(endpointMemId) {}
   ~FinalizeProcessChunk() noexcept(false) {
     // Enqueue a nullptr chunk indicating a wait for processing to complete.
-    m_reply.processChunk(std::vector<uint8_t>(), 0, m_endpointMemId);
+    m_reply.processChunk(nullptr, 0, m_endpointMemId);
   }
 };
 }  // namespace
@@ -111,6 +112,7 @@ TcrConnection::TcrConnection(const TcrConnectionManager& connectionManager)
       m_port(0),
       m_chunksProcessSema(0),
       m_isBeingUsed(false),
+      m_cancelled(false),
       m_isUsed(0),
       m_poolDM(nullptr) {}
 
@@ -475,14 +477,11 @@ void TcrConnection::createConnection(const std::string& address,
     auto sniPort = m_poolDM->getSNIPort();
     if (sniHostname.empty()) {
       m_conn.reset(new TcpSslConn(address, connectTimeout, maxBuffSizePool,
-                                  systemProperties.sslTrustStore(),
-                                  systemProperties.sslKeyStore(),
-                                  systemProperties.sslKeystorePassword()));
+                                  m_poolDM->getSslContext()));
     } else {
       m_conn.reset(new TcpSslConn(
           address, connectTimeout, maxBuffSizePool, sniHostname, sniPort,
-          systemProperties.sslTrustStore(), systemProperties.sslKeyStore(),
-          systemProperties.sslKeystorePassword()));
+          m_poolDM->getSslContext()));
     }
   } else {
     m_conn.reset(new TcpConn(address, connectTimeout, maxBuffSizePool));
@@ -615,7 +614,17 @@ void TcrConnection::send(const char* buffer, size_t len,
       this, m_endpointObj->name().c_str(),
       Utils::convertBytesToString(buffer, len).c_str());
 
-  switch (sendData(buffer, len, sendTimeoutSec)) {
+  TraceScope trace("send");
+  if (trace.isRecording()) {
+    trace.setAttribute("server", m_endpointObj->name());
+    trace.setAttribute("bytes", std::to_string(len));
+  }
+  auto error = sendData(buffer, len, sendTimeoutSec);
+  if (error != CONN_NOERR) {
+    trace.setError();
+  }
+
+  switch (error) {
     case CONN_NOERR:
       break;
     case CONN_TIMEOUT:
@@ -648,7 +657,12 @@ char* TcrConnection::readMessage(size_t* recvLen,
     headerTimeout = DEFAULT_READ_TIMEOUT * DEFAULT_TIMEOUT_RETRIES;
   }
 
+  TraceScope serverWait("server.wait");
   error = receiveData(msg_header, HEADER_LENGTH, headerTimeout);
+  if (error != CONN_NOERR) {
+    serverWait.setError();
+  }
+  serverWait.end();
 
   if (error != CONN_NOERR) {
     //  the !isNotificationMessage ensures that notification channel
@@ -708,7 +722,15 @@ char* TcrConnection::readMessage(size_t* recvLen,
   if (isNotificationMessage) {
     mesgBodyTimeout = receiveTimeoutSec * DEFAULT_TIMEOUT_RETRIES;
   }
+  TraceScope receive("receive");
+  if (receive.isRecording()) {
+    receive.setAttribute("bytes", std::to_string(msgLen));
+  }
   error = receiveData(fullMessage + HEADER_LENGTH, msgLen, mesgBodyTimeout);
+  if (error != CONN_NOERR) {
+    receive.setError();
+  }
+  receive.end();
   if (error != CONN_NOERR) {
     delete[] fullMessage;
     //  the !isNotificationMessage ensures that notification channel
@@ -800,9 +822,11 @@ chunkedResponseHeader TcrConnection::readResponseHeader(
   uint8_t receiveBuffer[HEADER_LENGTH];
   chunkedResponseHeader header;
 
+  TraceScope trace("server.wait");
   auto error = receiveData(reinterpret_cast<char*>(receiveBuffer),
                            HEADER_LENGTH, timeout);
   if (error != CONN_NOERR) {
+    trace.setError();
     if (error & CONN_TIMEOUT) {
       throwException(TimeoutException(
           "TcrConnection::readResponseHeader: "
@@ -874,12 +898,19 @@ chunkHeader TcrConnection::readChunkHeader(std::chrono::microseconds timeout) {
   return header;
 }
 
-std::vector<uint8_t> TcrConnection::readChunkBody(
-    std::chrono::microseconds timeout, int32_t chunkLength) {
-  std::vector<uint8_t> chunkBody(chunkLength);
-  auto error = receiveData(reinterpret_cast<char*>(chunkBody.data()),
+ReceiveBuffer TcrConnection::readChunkBody(std::chrono::microseconds timeout,
+                                           int32_t chunkLength) {
+  auto chunkBody = m_connectionManager.getCacheImpl()
+                       ->getReceiveBufferPool()
+                       .acquire(chunkLength);
+  TraceScope trace("receive");
+  if (trace.isRecording()) {
+    trace.setAttribute("bytes", std::to_string(chunkLength));
+  }
+  auto error = receiveData(reinterpret_cast<char*>(chunkBody->data()),
                            chunkLength, timeout);
   if (error != CONN_NOERR) {
+    trace.setError();
     if (error & CONN_TIMEOUT) {
       throwException(
           TimeoutException("TcrConnection::readChunkBody: "
@@ -895,17 +926,18 @@ std::vector<uint8_t> TcrConnection::readChunkBody(
       "TcrConnection::readChunkBody: received chunk body from endpoint "
       "%s; bytes: %s",
       m_endpointObj->name().c_str(),
-      Utils::convertBytesToString(chunkBody.data(), chunkLength).c_str());
-  return chunkBody;
+      Utils::convertBytesToString(chunkBody->data(), chunkLength).c_str());
+  return std::move(chunkBody);
 }
 
 bool TcrConnection::processChunk(TcrMessageReply& reply,
                                  std::chrono::microseconds timeout,
                                  int32_t chunkLength,
                                  int8_t lastChunkAndSecurityFlags) {
-  // NOTE: this buffer is allocated by readChunkBody, and reply.processChunk
-  // takes ownership, so we don't delete it here on failure
-  std::vector<uint8_t> chunkBody = readChunkBody(timeout, chunkLength);
+  // NOTE: this buffer is taken from the cache's receive buffer pool by
+  // readChunkBody and shared, without copying, with the chunk processor; it
+  // returns to the pool once the last reference to it is released
+  auto chunkBody = readChunkBody(timeout, chunkLength);
 
   // Process the chunk; the actual processing is done by a separate thread
   // ThinClientBaseDM::m_chunkProcessor.
@@ -919,6 +951,9 @@ bool TcrConnection::processChunk(TcrMessageReply& reply,
 }
 
 void TcrConnection::close() {
+  if (m_cancelled) {
+    return;
+  }
   TcrMessage* closeMsg = TcrMessage::getCloseConnMessage(
       m_poolDM->getConnectionManager().getCacheImpl());
   try {
@@ -934,6 +969,11 @@ void TcrConnection::close() {
   }
 }
 
+void TcrConnection::cancel() {
+  m_cancelled = true;
+  m_conn->cancel();
+}
+
 std::vector<int8_t> TcrConnection::readHandshakeData(
     int32_t msgLength, std::chrono::microseconds connectTimeout) {
   ConnErrType error = CONN_NOERR;
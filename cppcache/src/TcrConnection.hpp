@@ -235,6 +235,13 @@ class TcrConnection {
    */
   void close();
 
+  /**
+   * Makes a request blocked on this connection in another thread fail at
+   * once. The connection cannot be used afterwards and is closed without
+   * telling the server.
+   */
+  void cancel();
+
   //  Durable clients: return true if server has HA queue.
   ServerQueueStatus inline getServerQueueStatus(int32_t& queueSize) {
     queueSize = m_queueSize;
@@ -282,8 +289,8 @@ class TcrConnection {
 
   chunkHeader readChunkHeader(std::chrono::microseconds timeout);
 
-  std::vector<uint8_t> readChunkBody(std::chrono::microseconds timeout,
-                                     int32_t chunkLength);
+  ReceiveBuffer readChunkBody(std::chrono::microseconds timeout,
+                              int32_t chunkLength);
 
   bool processChunk(TcrMessageReply& reply, std::chrono::microseconds timeout,
                     int32_t chunkLength, int8_t lastChunkAndSecurityFlags);
@@ -376,6 +383,7 @@ class TcrConnection {
   TcrConnection(const TcrConnection&);
   TcrConnection& operator=(const TcrConnection&);
   volatile bool m_isBeingUsed;
+  std::atomic<bool> m_cancelled;
   std::atomic<uint32_t> m_isUsed;
   ThinClientPoolDM* m_poolDM;
   std::chrono::microseconds sendWithTimeouts(
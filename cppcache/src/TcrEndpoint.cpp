@@ -18,17 +18,21 @@
 #include "TcrEndpoint.hpp"
 
 #include <chrono>
+#include <cinttypes>
 #include <thread>
 
 #include <geode/AuthInitialize.hpp>
 #include <geode/SystemProperties.hpp>
+#include <geode/internal/chrono/duration.hpp>
 
 #include "CacheImpl.hpp"
 #include "DistributedSystemImpl.hpp"
+#include "PartitionedDispatcher.hpp"
 #include "StackTrace.hpp"
 #include "TcrConnectionManager.hpp"
 #include "ThinClientPoolHADM.hpp"
 #include "ThinClientRegion.hpp"
+#include "Tracer.hpp"
 #include "Utils.hpp"
 #include "util/exception.hpp"
 
@@ -37,6 +41,7 @@ namespace geode {
 namespace client {
 
 const char* TcrEndpoint::NC_Notification = "NC Notification";
+const char* TcrEndpoint::NC_Notification_Dispatch = "NC Notify Dispatch";
 
 TcrEndpoint::TcrEndpoint(const std::string& name, CacheImpl* cacheImpl,
                          ACE_Semaphore& failoverSema,
@@ -547,6 +552,32 @@ bool TcrEndpoint::checkDupAndAdd(std::shared_ptr<EventId> eventid) {
 
 void TcrEndpoint::receiveNotification(std::atomic<bool>& isRunning) {
   LOGFINE("Started subscription channel for endpoint %s", m_name.c_str());
+
+  // events are decoded and deduplicated here; with dispatch threads they are
+  // then handled in parallel, in order per key
+  const auto& sysProp =
+      m_cacheImpl->getDistributedSystem().getSystemProperties();
+  std::unique_ptr<PartitionedDispatcher<TcrMessageReply*>> dispatcher;
+  if (sysProp.notifyDispatchThreads() > 0) {
+    dispatcher = std::unique_ptr<PartitionedDispatcher<TcrMessageReply*>>(
+        new PartitionedDispatcher<TcrMessageReply*>(
+            sysProp.notifyDispatchThreads(), sysProp.notifyDispatchQueueSize(),
+            [this](TcrMessageReply*& msg) {
+              try {
+                processNotification(msg);
+              } catch (const Exception& ex) {
+                LOGERROR(
+                    "Exception while dispatching subscription event for "
+                    "endpoint %s:: %s: %s",
+                    m_name.c_str(), ex.getName().c_str(), ex.what());
+              }
+            },
+            NC_Notification_Dispatch));
+  }
+  // the dispatcher statistics already added to the pool statistics
+  PartitionedDispatcher<TcrMessageReply*>::Statistics reported{
+      0, 0, std::chrono::nanoseconds::zero(), 0};
+
   while (isRunning) {
     TcrMessageReply* msg = nullptr;
     try {
@@ -629,32 +660,32 @@ void TcrEndpoint::receiveNotification(std::atomic<bool>& isRunning) {
 
         if (isMarker) {
           LOGFINE("Got a marker message on endpont %s", m_name.c_str());
+          if (dispatcher) {
+            dispatcher->drain();
+          }
           m_cacheImpl->processMarker();
           processMarker();
           _GEODE_SAFE_DELETE(msg);
-        } else {
-          if (!msg->hasCqPart())  // || msg->isInterestListPassed())
-          {
-            const std::string& regionFullPath = msg->getRegionName();
-            auto region = m_cacheImpl->getRegion(regionFullPath);
-
-            if (region != nullptr) {
-              static_cast<ThinClientRegion*>(region.get())
-                  ->receiveNotification(msg);
-            } else {
-              LOGWARN(
-                  "Notification for region %s that does not exist in "
-                  "client cacheImpl.",
-                  regionFullPath.c_str());
-            }
+        } else if (dispatcher) {
+          auto key = msg->getKey();
+          if (key != nullptr) {
+            auto keyedMsg = msg;
+            msg = nullptr;
+            dispatcher->dispatch(static_cast<uint32_t>(key->hashcode()),
+                                 keyedMsg);
+            const auto stats = dispatcher->getStatistics();
+            handleDispatchStats(stats.dispatched - reported.dispatched,
+                                stats.blocked - reported.blocked,
+                                stats.blockedTime - reported.blockedTime,
+                                stats.maxQueueDepth);
+            reported = stats;
           } else {
-            LOGDEBUG("receive cq notification %d", msg->getMessageType());
-            auto queryService = getQueryService();
-            if (queryService != nullptr) {
-              static_cast<RemoteQueryService*>(queryService.get())
-                  ->receiveNotification(msg);
-            }
+            // region wide events wait for all earlier key events
+            dispatcher->drain();
+            processNotification(msg);
           }
+        } else {
+          processNotification(msg);
         }
       }
     } catch (const TimeoutException&) {
@@ -696,9 +727,45 @@ void TcrEndpoint::receiveNotification(std::atomic<bool>& isRunning) {
           m_name.c_str());
     }
   }
+  if (dispatcher) {
+    dispatcher->stop();
+    const auto stats = dispatcher->getStatistics();
+    LOGFINE(
+        "Subscription dispatch for endpoint %s: %" PRIu64
+        " events on %zu threads, %" PRIu64
+        " waits for a full queue totalling %s, max queue depth %zu",
+        m_name.c_str(), stats.dispatched, dispatcher->partitions(),
+        stats.blocked,
+        apache::geode::internal::chrono::duration::to_string(stats.blockedTime)
+            .c_str(),
+        stats.maxQueueDepth);
+  }
   LOGFINE("Ended subscription channel for endpoint %s", m_name.c_str());
 }
 
+void TcrEndpoint::processNotification(TcrMessageReply* msg) {
+  if (!msg->hasCqPart()) {
+    const std::string& regionFullPath = msg->getRegionName();
+    auto region = m_cacheImpl->getRegion(regionFullPath);
+
+    if (region != nullptr) {
+      static_cast<ThinClientRegion*>(region.get())->receiveNotification(msg);
+    } else {
+      LOGWARN(
+          "Notification for region %s that does not exist in "
+          "client cacheImpl.",
+          regionFullPath.c_str());
+    }
+  } else {
+    LOGDEBUG("receive cq notification %d", msg->getMessageType());
+    auto queryService = getQueryService();
+    if (queryService != nullptr) {
+      static_cast<RemoteQueryService*>(queryService.get())
+          ->receiveNotification(msg);
+    }
+  }
+}
+
 inline bool TcrEndpoint::compareTransactionIds(int32_t reqTransId,
                                                int32_t replyTransId,
                                                std::string& failReason,
@@ -748,7 +815,6 @@ GfErrType TcrEndpoint::sendRequestConn(const TcrMessage& request,
                                        TcrConnection* conn,
                                        std::string& failReason) {
   int32_t type = request.getMessageType();
-  GfErrType error = GF_NOERR;
 
   LOGFINER("Sending request type %d to endpoint [%s] via connection [%p]", type,
            m_name.c_str(), conn);
@@ -796,26 +862,42 @@ GfErrType TcrEndpoint::sendRequestConn(const TcrMessage& request,
                                         reply.getTimeout());
     LOGDEBUG("sendRequestConn: calling sendRequestForChunkedResponse DONE");
   } else {
-    // Chk request type to request if so request.getCallBackArg flag & setCall
-    // back arg flag to true, and in response chk for this flag.
-    if (request.getMessageType() == TcrMessage::REQUEST) {
-      if (request.isCallBackArguement()) {
-        reply.setCallBackArguement(true);
-      }
-    }
     size_t dataLen;
     auto data = conn->sendRequest(request.getMsgData(), request.getMsgLength(),
                                   &dataLen, request.getTimeout(),
                                   reply.getTimeout(), request.getMessageType());
-    reply.setMessageTypeRequest(type);
-    reply.setData(
-        data, static_cast<int32_t>(dataLen), getDistributedMemberID(),
-        *(m_cacheImpl->getSerializationRegistry()),
-        *(m_cacheImpl
-              ->getMemberListForVersionStamp()));  // memory is released by
-                                                   // TcrMessage setData().
+    setReplyData(request, reply, data, dataLen);
   }
 
+  return checkReply(request, reply, conn, failReason);
+}
+
+void TcrEndpoint::setReplyData(const TcrMessage& request,
+                               TcrMessageReply& reply, const char* data,
+                               size_t len) {
+  // Chk request type to request if so request.getCallBackArg flag & setCall
+  // back arg flag to true, and in response chk for this flag.
+  if (request.getMessageType() == TcrMessage::REQUEST) {
+    if (request.isCallBackArguement()) {
+      reply.setCallBackArguement(true);
+    }
+  }
+  reply.setMessageTypeRequest(request.getMessageType());
+  TraceScope trace("deserialize");
+  reply.setData(
+      data, static_cast<int32_t>(len), getDistributedMemberID(),
+      *(m_cacheImpl->getSerializationRegistry()),
+      *(m_cacheImpl->getMemberListForVersionStamp()));  // memory is released
+                                                        // by TcrMessage
+                                                        // setData().
+}
+
+GfErrType TcrEndpoint::checkReply(const TcrMessage& request,
+                                  TcrMessageReply& reply, TcrConnection* conn,
+                                  std::string& failReason) {
+  int32_t type = request.getMessageType();
+  GfErrType error = GF_NOERR;
+
   // reset idle timeout of the connection for pool connection manager
   if (type != TcrMessage::PING) {
     conn->touch();
@@ -1275,6 +1357,9 @@ void TcrEndpoint::closeFailedConnection(TcrConnection*& conn) {
 
 void TcrEndpoint::handleNotificationStats(int64_t) {}
 
+void TcrEndpoint::handleDispatchStats(uint64_t, uint64_t,
+                                      std::chrono::nanoseconds, size_t) {}
+
 }  // namespace client
 }  // namespace geode
 }  // namespace apache
@@ -21,6 +21,7 @@
 #define GEODE_TCRENDPOINT_H_
 
 #include <atomic>
+#include <chrono>
 #include <list>
 #include <memory>
 #include <mutex>
@@ -31,7 +32,9 @@
 #include <geode/internal/geode_globals.hpp>
 
 #include "ConnectionQueue.hpp"
+#include "EndpointHealth.hpp"
 #include "ErrType.hpp"
+#include "LatencyTracker.hpp"
 #include "Task.hpp"
 #include "TcrConnection.hpp"
 #include "util/synchronized_set.hpp"
@@ -75,6 +78,20 @@ class TcrEndpoint : public std::enable_shared_from_this<TcrEndpoint> {
   GfErrType send(const TcrMessage& request, TcrMessageReply& reply);
   GfErrType sendRequestConn(const TcrMessage& request, TcrMessageReply& reply,
                             TcrConnection* conn, std::string& failReason);
+
+  /**
+   * Decodes a reply read off <code>conn</code> by TcrConnection::sendRequest
+   * into <code>reply</code>; takes ownership of <code>data</code>.
+   */
+  void setReplyData(const TcrMessage& request, TcrMessageReply& reply,
+                    const char* data, size_t len);
+
+  /**
+   * Checks a decoded reply and completes the request the way
+   * sendRequestConn does.
+   */
+  GfErrType checkReply(const TcrMessage& request, TcrMessageReply& reply,
+                       TcrConnection* conn, std::string& failReason);
   GfErrType sendRequestWithRetry(const TcrMessage& request,
                                  TcrMessageReply& reply, TcrConnection*& conn,
                                  bool& epFailure, std::string& failReason,
@@ -97,6 +114,18 @@ class TcrEndpoint : public std::enable_shared_from_this<TcrEndpoint> {
 
   inline const std::string& name() const { return m_name; }
 
+  /**
+   * Reply latencies of single message reads sent to this endpoint, used by
+   * pools with latency aware reads.
+   */
+  inline LatencyTracker& getReadLatency() { return m_readLatency; }
+
+  /**
+   * Error rate, latency and circuit breaker of this endpoint, maintained by
+   * the pool that sends requests to it.
+   */
+  inline EndpointHealth& getHealth() { return m_health; }
+
   //  setConnectionStatus is now a public method, as it is used by
   //  TcrDistributionManager.
   void setConnectionStatus(bool status);
@@ -189,15 +218,22 @@ class TcrEndpoint : public std::enable_shared_from_this<TcrEndpoint> {
   bool m_isQueueHosted;
 
   static const char* NC_Notification;
+  static const char* NC_Notification_Dispatch;
 
   std::shared_ptr<Properties> getCredentials();
   virtual bool checkDupAndAdd(std::shared_ptr<EventId> eventid);
   virtual void processMarker();
+  void processNotification(TcrMessageReply* msg);
   virtual void triggerRedundancyThread();
   virtual std::shared_ptr<QueryService> getQueryService();
   virtual void closeFailedConnection(TcrConnection*& conn);
   void closeConnection(TcrConnection*& conn);
   virtual void handleNotificationStats(int64_t byteLength);
+  // events handed to dispatch threads since the last call, the waits for a
+  // full queue among them, and the deepest queue so far
+  virtual void handleDispatchStats(uint64_t dispatched, uint64_t waits,
+                                   std::chrono::nanoseconds waitTime,
+                                   size_t maxQueueDepth);
   virtual void closeNotification();
 
   virtual bool handleIOException(const std::string& message,
@@ -232,6 +268,8 @@ class TcrEndpoint : public std::enable_shared_from_this<TcrEndpoint> {
   uint16_t m_distributedMemId;
   bool m_isServerQueueStatusSet;
   volatile bool m_connCreatedWhenMaxConnsIsZero;
+  LatencyTracker m_readLatency;
+  EndpointHealth m_health;
 
   bool compareTransactionIds(int32_t reqTransId, int32_t replyTransId,
                              std::string& failReason, TcrConnection* conn);
@@ -53,6 +53,9 @@ namespace {
 const uint32_t g_headerLen = 17;
 const uint32_t REGULAR_EXPRESSION =
     1;  // come from Java InterestType.REGULAR_EXPRESSION
+// upper bound for the header and the fixed size parts (event id, flags,
+// timeouts) of messages that are sized before being written
+const size_t MESSAGE_OVERHEAD_LENGTH = 256;
 
 inline void readInt(uint8_t* buffer, uint16_t* value) {
   uint16_t tmp = *(buffer++);
@@ -779,6 +782,29 @@ void TcrMessage::writeObjectPart(
   m_request->advanceCursor(sizeOfSerializedObj + 1);
 }
 
+size_t TcrMessage::objectPartSize(const std::shared_ptr<Serializable>& se) {
+  // part length and isObject byte
+  constexpr size_t PART_HEADER_LENGTH = 5;
+  // type id and the widest length prefix
+  constexpr size_t OBJECT_HEADER_LENGTH = 5;
+
+  if (se == nullptr) {
+    return PART_HEADER_LENGTH + 1;
+  }
+  if (auto cacheableBytes = dynamic_cast<const CacheableBytes*>(se.get())) {
+    // written as raw bytes, see writeObjectPart
+    return PART_HEADER_LENGTH + cacheableBytes->length();
+  }
+  if (auto cacheableString = dynamic_cast<const CacheableString*>(se.get())) {
+    // exact for ASCII; other text may need a little more
+    return PART_HEADER_LENGTH + OBJECT_HEADER_LENGTH +
+           cacheableString->length();
+  }
+  // the in-memory size of builtins and PDX instances bounds their serialized
+  // size; user types that do not implement objectSize() report 0
+  return PART_HEADER_LENGTH + OBJECT_HEADER_LENGTH + se->objectSize();
+}
+
 void TcrMessage::writeBytesOnly(const std::shared_ptr<Serializable>& se) {
   auto cBufferLength = m_request->getBufferLength();
   uint8_t* startBytes = nullptr;
@@ -964,7 +990,7 @@ void TcrMessage::handleSpecialFECase() {
   }
 }
 
-void TcrMessage::processChunk(const std::vector<uint8_t>& chunk, int32_t len,
+void TcrMessage::processChunk(const ReceiveBuffer& chunk, int32_t len,
                               uint16_t endpointmemId,
                               const uint8_t isLastChunkAndisSecurityHeader) {
   // TODO: see if security header is there
@@ -980,10 +1006,14 @@ void TcrMessage::processChunk(const std::vector<uint8_t>& chunk, int32_t len,
     throw FatalInternalException("TcrMessage::processChunk: null DM!");
   }
 
+  // a null or empty chunk marks the end of the chunks for this message
+  const bool lastChunk = !chunk || chunk->empty();
+  const uint8_t* bytes = chunk ? chunk->data() : nullptr;
+
   switch (m_msgType) {
     case TcrMessage::REPLY: {
       LOGDEBUG("processChunk - got reply for request %d", m_msgTypeRequest);
-      chunkSecurityHeader(1, chunk, len, isLastChunkAndisSecurityHeader);
+      chunkSecurityHeader(1, bytes, len, isLastChunkAndisSecurityHeader);
       break;
     }
     case TcrMessage::RESPONSE: {
@@ -1004,7 +1034,7 @@ void TcrMessage::processChunk(const std::vector<uint8_t>& chunk, int32_t len,
             m_tcdm->getConnectionManager().getCacheImpl());
         m_chunkedResult->setEndpointMemId(endpointmemId);
         m_tcdm->queueChunk(chunkedContext);
-        if (chunk.empty()) {
+        if (lastChunk) {
           // last chunk -- wait for processing of all the chunks to complete
           m_chunkedResult->waitFinalize();
           auto ex = m_chunkedResult->getException();
@@ -1022,7 +1052,7 @@ void TcrMessage::processChunk(const std::vector<uint8_t>& chunk, int32_t len,
             m_tcdm->getConnectionManager().getCacheImpl());
         m_chunkedResult->setEndpointMemId(endpointmemId);
         m_tcdm->queueChunk(chunkedContext);
-        if (chunk.empty()) {
+        if (lastChunk) {
           // last chunk -- wait for processing of all the chunks to complete
           m_chunkedResult->waitFinalize();
           //  Throw any exception during processing here.
@@ -1040,8 +1070,8 @@ void TcrMessage::processChunk(const std::vector<uint8_t>& chunk, int32_t len,
       } else if (TcrMessage::CQ_EXCEPTION_TYPE == m_msgType ||
                  TcrMessage::CQDATAERROR_MSG_TYPE == m_msgType ||
                  TcrMessage::GET_ALL_DATA_ERROR == m_msgType) {
-        if (!chunk.empty()) {
-          chunkSecurityHeader(1, chunk, len, isLastChunkAndisSecurityHeader);
+        if (!lastChunk) {
+          chunkSecurityHeader(1, bytes, len, isLastChunkAndisSecurityHeader);
         }
       }
       break;
@@ -1058,7 +1088,7 @@ void TcrMessage::processChunk(const std::vector<uint8_t>& chunk, int32_t len,
             m_tcdm->getConnectionManager().getCacheImpl());
         m_chunkedResult->setEndpointMemId(endpointmemId);
         m_tcdm->queueChunk(chunkedContext);
-        if (chunk.empty()) {
+        if (lastChunk) {
           // last chunk -- wait for processing of all the chunks to complete
           m_chunkedResult->waitFinalize();
           //  Throw any exception during processing here.
@@ -1076,8 +1106,8 @@ void TcrMessage::processChunk(const std::vector<uint8_t>& chunk, int32_t len,
       } else if (TcrMessage::CQ_EXCEPTION_TYPE == m_msgType ||
                  TcrMessage::CQDATAERROR_MSG_TYPE == m_msgType ||
                  TcrMessage::GET_ALL_DATA_ERROR == m_msgType) {
-        if (!chunk.empty()) {
-          chunkSecurityHeader(1, chunk, len, isLastChunkAndisSecurityHeader);
+        if (!lastChunk) {
+          chunkSecurityHeader(1, bytes, len, isLastChunkAndisSecurityHeader);
         }
       }
       break;
@@ -1086,7 +1116,7 @@ void TcrMessage::processChunk(const std::vector<uint8_t>& chunk, int32_t len,
                                                     // error
     case EXECUTE_FUNCTION_ERROR:
     case EXECUTE_REGION_FUNCTION_ERROR: {
-      if (!chunk.empty()) {
+      if (!lastChunk) {
         // DeleteArray<const uint8_t> delChunk(bytes);
         //  DataInput input(bytes, len);
         // TODO: this not send two part...
@@ -1094,15 +1124,15 @@ void TcrMessage::processChunk(const std::vector<uint8_t>& chunk, int32_t len,
         // readExceptionPart(input, false);
         // readSecureObjectPart(input, false, true,
         // isLastChunkAndisSecurityHeader );
-        chunkSecurityHeader(1, chunk, len, isLastChunkAndisSecurityHeader);
+        chunkSecurityHeader(1, bytes, len, isLastChunkAndisSecurityHeader);
       }
       break;
     }
     case TcrMessage::EXCEPTION: {
-      if (!chunk.empty()) {
+      if (!lastChunk) {
         auto input =
             m_tcdm->getConnectionManager().getCacheImpl()->createDataInput(
-                chunk.data(), len);
+                bytes, len);
         readExceptionPart(input, isLastChunkAndisSecurityHeader);
         readSecureObjectPart(input, false, true,
                              isLastChunkAndisSecurityHeader);
@@ -1111,18 +1141,18 @@ void TcrMessage::processChunk(const std::vector<uint8_t>& chunk, int32_t len,
     }
     case TcrMessage::RESPONSE_FROM_SECONDARY: {
       // TODO: how many parts
-      chunkSecurityHeader(1, chunk, len, isLastChunkAndisSecurityHeader);
-      if (chunk.size()) {
+      chunkSecurityHeader(1, bytes, len, isLastChunkAndisSecurityHeader);
+      if (!lastChunk) {
         LOGFINEST("processChunk - got response from secondary, ignoring.");
       }
       break;
     }
     case TcrMessage::PUT_DATA_ERROR: {
-      chunkSecurityHeader(1, chunk, len, isLastChunkAndisSecurityHeader);
-      if (!chunk.empty()) {
+      chunkSecurityHeader(1, bytes, len, isLastChunkAndisSecurityHeader);
+      if (!lastChunk) {
         auto input =
             m_tcdm->getConnectionManager().getCacheImpl()->createDataInput(
-                chunk.data(), len);
+                bytes, len);
         auto errorString = readStringPart(input);
 
         if (!errorString.empty()) {
@@ -1139,13 +1169,13 @@ void TcrMessage::processChunk(const std::vector<uint8_t>& chunk, int32_t len,
       break;
     }
     case TcrMessage::GET_ALL_DATA_ERROR: {
-      chunkSecurityHeader(1, chunk, len, isLastChunkAndisSecurityHeader);
+      chunkSecurityHeader(1, bytes, len, isLastChunkAndisSecurityHeader);
 
       break;
     }
     default: {
       // TODO: how many parts what should we do here
-      if (chunk.empty()) {
+      if (lastChunk) {
         LOGWARN(
             "Got unhandled message type %d while processing response, possible "
             "serialization mismatch",
@@ -1166,14 +1196,13 @@ Pool* TcrMessage::getPool() const {
   return nullptr;
 }
 
-void TcrMessage::chunkSecurityHeader(int skipPart,
-                                     const std::vector<uint8_t> bytes,
+void TcrMessage::chunkSecurityHeader(int skipPart, const uint8_t* bytes,
                                      int32_t len,
                                      uint8_t isLastChunkAndSecurityHeader) {
   LOGDEBUG("TcrMessage::chunkSecurityHeader:: skipParts = %d", skipPart);
   if ((isLastChunkAndSecurityHeader & 0x3) == 0x3) {
     auto di = m_tcdm->getConnectionManager().getCacheImpl()->createDataInput(
-        bytes.data(), len);
+        bytes, len);
     skipParts(di, skipPart);
     readSecureObjectPart(di, false, true, isLastChunkAndSecurityHeader);
   }
@@ -2065,6 +2094,13 @@ TcrMessagePut::TcrMessagePut(
   }
 
   numOfParts++;
+
+  m_request->ensureCapacity(MESSAGE_OVERHEAD_LENGTH + m_regionName.length() +
+                            objectPartSize(key) + objectPartSize(value) +
+                            (aCallbackArgument != nullptr
+                                 ? objectPartSize(aCallbackArgument)
+                                 : 0));
+
   writeHeader(m_msgType, numOfParts);
   writeRegionPart(m_regionName);
   writeObjectPart(nullptr);  // operation = null
@@ -2408,6 +2444,17 @@ TcrMessagePutAll::TcrMessagePutAll(
     numOfParts++;
   }
 
+  // Size the request up front so a large batch is serialized into a single
+  // buffer rather than repeatedly growing and copying it.
+  auto requestSize = MESSAGE_OVERHEAD_LENGTH + m_regionName.length();
+  if (aCallbackArgument != nullptr) {
+    requestSize += objectPartSize(aCallbackArgument);
+  }
+  for (const auto& iter : map) {
+    requestSize += objectPartSize(iter.first) + objectPartSize(iter.second);
+  }
+  m_request->ensureCapacity(requestSize);
+
   writeHeader(m_msgType, numOfParts);
   writeRegionPart(m_regionName);
   writeEventIdPart(static_cast<uint32_t>(map.size()) - 1);
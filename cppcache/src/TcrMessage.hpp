@@ -184,7 +184,7 @@ class TcrMessage {
 
   void startProcessChunk(ACE_Semaphore& finalizeSema);
   // nullptr chunk means that this is the last chunk
-  void processChunk(const std::vector<uint8_t>& chunk, int32_t chunkLen,
+  void processChunk(const ReceiveBuffer& chunk, int32_t chunkLen,
                     uint16_t endpointmemId,
                     const uint8_t isLastChunkAndisSecurityHeader = 0x00);
   /* For creating a region on the java server */
@@ -349,6 +349,8 @@ class TcrMessage {
 
   void handleSpecialFECase();
   void writeBytesOnly(const std::shared_ptr<Serializable>& se);
+  /** Estimated length of the part writeObjectPart would write for se. */
+  static size_t objectPartSize(const std::shared_ptr<Serializable>& se);
   std::shared_ptr<Serializable> readCacheableBytes(DataInput& input,
                                                    int lenObj);
   std::shared_ptr<Serializable> readCacheableString(DataInput& input,
@@ -391,8 +393,8 @@ class TcrMessage {
   void writeMillisecondsPart(std::chrono::milliseconds millis);
   void writeByteAndTimeOutPart(uint8_t byteValue,
                                std::chrono::milliseconds timeout);
-  void chunkSecurityHeader(int skipParts, const std::vector<uint8_t> bytes,
-                           int32_t len, uint8_t isLastChunkAndSecurityHeader);
+  void chunkSecurityHeader(int skipParts, const uint8_t* bytes, int32_t len,
+                           uint8_t isLastChunkAndSecurityHeader);
 
   void readEventIdPart(DataInput& input, bool skip = false,
                        int32_t parts = 1);  // skip num parts then read eventid
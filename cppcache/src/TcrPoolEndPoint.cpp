@@ -144,6 +144,19 @@ void TcrPoolEndPoint::handleNotificationStats(int64_t byteLength) {
   m_dm->getStats().incMessageBeingReceived();
 }
 
+void TcrPoolEndPoint::handleDispatchStats(uint64_t dispatched, uint64_t waits,
+                                          std::chrono::nanoseconds waitTime,
+                                          size_t maxQueueDepth) {
+  auto& stats = m_dm->getStats();
+  stats.incNotificationsDispatched(static_cast<int64_t>(dispatched));
+  if (waits > 0) {
+    stats.incNotificationDispatchWaits(static_cast<int32_t>(waits));
+    stats.incNotificationDispatchWaitTime(waitTime.count());
+  }
+  stats.raiseNotificationDispatchMaxQueueDepth(
+      static_cast<int32_t>(maxQueueDepth));
+}
+
 }  // namespace client
 }  // namespace geode
 }  // namespace apache
@@ -50,6 +50,9 @@ class TcrPoolEndPoint : public TcrEndpoint {
   bool handleIOException(const std::string& message, TcrConnection*& conn,
                          bool isBgThread = false) override;
   void handleNotificationStats(int64_t byteLength) override;
+  void handleDispatchStats(uint64_t dispatched, uint64_t waits,
+                           std::chrono::nanoseconds waitTime,
+                           size_t maxQueueDepth) override;
   ~TcrPoolEndPoint() override { m_dm = nullptr; }
   bool isMultiUserMode() override;
 
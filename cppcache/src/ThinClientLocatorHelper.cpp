@@ -97,13 +97,11 @@ std::unique_ptr<Connector> ThinClientLocatorHelper::createConnection(
     if (m_sniProxyHost.empty()) {
       return std::unique_ptr<Connector>(new TcpSslConn(
           hostname, static_cast<uint16_t>(port), timeout, buffer_size,
-          sys_prop.sslTrustStore(), sys_prop.sslKeyStore(),
-          sys_prop.sslKeystorePassword()));
+          m_poolDM->getSslContext()));
     } else {
       return std::unique_ptr<Connector>(new TcpSslConn(
           hostname, static_cast<uint16_t>(port), m_sniProxyHost, m_sniProxyPort,
-          timeout, buffer_size, sys_prop.sslTrustStore(),
-          sys_prop.sslKeyStore(), sys_prop.sslKeystorePassword()));
+          timeout, buffer_size, m_poolDM->getSslContext()));
     }
   } else {
     return std::unique_ptr<Connector>(new TcpConn(
@@ -18,6 +18,7 @@
 #include "ThinClientPoolDM.hpp"
 
 #include <algorithm>
+#include <condition_variable>
 #include <thread>
 
 #include <ace/INET_Addr.h>
@@ -32,10 +33,12 @@
 #include "ExecutionImpl.hpp"
 #include "ExpiryHandler_T.hpp"
 #include "ExpiryTaskManager.hpp"
+#include "SslContext.hpp"
 #include "TcrConnectionManager.hpp"
 #include "TcrEndpoint.hpp"
 #include "ThinClientRegion.hpp"
 #include "ThinClientStickyManager.hpp"
+#include "Tracer.hpp"
 #include "UserAttributes.hpp"
 #include "statistics/PoolStatsSampler.hpp"
 #include "util/exception.hpp"
@@ -97,12 +100,14 @@ class GetAllWork : public PooledWork<GfErrType> {
       m_userAttribute = UserAttributes::threadLocalUserAttributes;
     }
 
-    m_resultCollector = (new ChunkedGetAllResponse(
+    auto resultCollector = new ChunkedGetAllResponse(
         *m_reply, dynamic_cast<ThinClientRegion*>(m_region.get()), m_keys.get(),
         m_responseHandler->getValues(), m_responseHandler->getExceptions(),
         m_responseHandler->getResultKeys(),
         m_responseHandler->getUpdateCounters(), 0, m_addToLocalCache,
-        m_responseHandler->getResponseLock()));
+        m_responseHandler->getResponseLock());
+    resultCollector->setEntryHandler(m_responseHandler->getEntryHandler());
+    m_resultCollector = resultCollector;
 
     m_reply->setChunkedResultHandler(m_resultCollector);
   }
@@ -129,6 +134,107 @@ class GetAllWork : public PooledWork<GfErrType> {
   }
 };
 
+// Opens pool connections on a pool thread while restoreMinConnections does
+// the same on its own thread, sharing its counters.
+class RestoreConnectionsWork : public PooledWork<int> {
+  ThinClientPoolDM* m_poolDM;
+  std::atomic<bool>& m_isRunning;
+  std::atomic<int>& m_pending;
+  std::atomic<int>& m_attempts;
+
+ public:
+  RestoreConnectionsWork(ThinClientPoolDM* poolDM, std::atomic<bool>& isRunning,
+                         std::atomic<int>& pending, std::atomic<int>& attempts)
+      : m_poolDM(poolDM),
+        m_isRunning(isRunning),
+        m_pending(pending),
+        m_attempts(attempts) {}
+
+  int execute() override {
+    return m_poolDM->restoreConnections(m_isRunning, m_pending, m_attempts);
+  }
+};
+
+// connections opened at the same time while restoring min-connections
+static constexpr int MAX_PARALLEL_RESTORES = 8;
+
+// Queries, putAll, function execution and executeCQ with initial results
+// carry their own timeouts and may legitimately run for a long time.
+static bool usesOwnTimeout(int32_t type) {
+  return type == TcrMessage::QUERY ||
+         type == TcrMessage::QUERY_WITH_PARAMETERS ||
+         type == TcrMessage::PUTALL ||
+         type == TcrMessage::PUT_ALL_WITH_CALLBACK ||
+         type == TcrMessage::EXECUTE_FUNCTION ||
+         type == TcrMessage::EXECUTE_REGION_FUNCTION ||
+         type == TcrMessage::EXECUTE_REGION_FUNCTION_SINGLE_HOP ||
+         type == TcrMessage::EXECUTECQ_WITH_IR_MSG_TYPE;
+}
+
+// replies seen from a server before its latency percentiles are trusted
+static constexpr size_t LATENCY_MIN_SAMPLES = 64;
+// latency aware reads time out after this multiple of the p99 latency,
+// bounded below by LATENCY_MIN_TIMEOUT and above by read-timeout
+static constexpr int LATENCY_TIMEOUT_FACTOR = 4;
+static constexpr std::chrono::milliseconds LATENCY_MIN_TIMEOUT{250};
+// every latency aware read earns one credit and arming a hedge costs
+// HEDGE_COST, so at most one read in HEDGE_COST can be hedged
+static constexpr int32_t HEDGE_COST = 10;
+static constexpr int32_t HEDGE_MAX_CREDIT = 10 * HEDGE_COST;
+
+/**
+ * State shared between the thread sending a read to its primary server and
+ * the pool thread that sends the same request to another server if no reply
+ * has arrived after the hedge delay. The hedge keeps its reply only while the
+ * reading thread has not returned; once <code>abandoned</code> is set it
+ * releases its own connection.
+ */
+struct HedgedRead {
+  HedgedRead(const TcrMessage& request, TcrConnection* primary,
+             const std::set<ServerLocation>& excluded)
+      : message(request.getMsgData(), request.getMsgLength()),
+        type(request.getMessageType()),
+        timeout(request.getTimeout()),
+        primary(primary),
+        primaryEP(primary->getEndpointObject()),
+        excluded(excluded) {}
+
+  const std::string message;
+  const int32_t type;
+  const std::chrono::milliseconds timeout;
+  TcrConnection* const primary;
+  const TcrEndpoint* const primaryEP;
+  const std::set<ServerLocation> excluded;
+
+  std::mutex mutex;
+  std::condition_variable cond;
+  bool primaryDone = false;
+  // the hedge won while the primary was still waiting, so the primary
+  // connection was cancelled
+  bool primaryCancelled = false;
+  bool hedgeSent = false;
+  bool hedgeDone = false;
+  std::chrono::steady_clock::time_point hedgeDeadline;
+  TcrConnection* hedgeConn = nullptr;
+  char* hedgeData = nullptr;
+  size_t hedgeDataLen = 0;
+  bool abandoned = false;
+};
+
+class HedgedReadWork : public Callable {
+  std::shared_ptr<ThinClientPoolDM> m_poolDM;
+  std::shared_ptr<HedgedRead> m_read;
+  std::chrono::microseconds m_delay;
+
+ public:
+  HedgedReadWork(std::shared_ptr<ThinClientPoolDM> poolDM,
+                 std::shared_ptr<HedgedRead> read,
+                 std::chrono::microseconds delay)
+      : m_poolDM(std::move(poolDM)), m_read(std::move(read)), m_delay(delay) {}
+
+  void call() override { m_poolDM->sendHedge(m_read, m_delay); }
+};
+
 const char* ThinClientPoolDM::NC_Ping_Thread = "NC Ping Thread";
 const char* ThinClientPoolDM::NC_MC_Thread = "NC MC Thread";
 #define PRIMARY_QUEUE_NOT_AVAILABLE -2
@@ -161,6 +267,7 @@ ThinClientPoolDM::ThinClientPoolDM(const char* name,
       m_updateLocatorListTaskId(-1),
       m_connManageTaskId(-1),
       m_clientOps(0),
+      m_hedgeCredit(0),
       m_PoolStatsSampler(nullptr),
       m_clientMetadataService(nullptr),
       m_primaryServerQueueSize(PRIMARY_QUEUE_NOT_AVAILABLE) {
@@ -233,6 +340,12 @@ void ThinClientPoolDM::init() {
 
   ThinClientPoolDM::startBackgroundThreads();
 
+  // bring the pool up to min-connections now rather than on the first run
+  // of the connection manager task
+  if (m_attrs->getMinConnections() > 0) {
+    m_connSema.release();
+  }
+
   LOGDEBUG("ThinClientPoolDM::init: Completed initialization");
 }
 
@@ -263,6 +376,20 @@ std::shared_ptr<Properties> ThinClientPoolDM::getCredentials(TcrEndpoint* ep) {
   return nullptr;
 }
 
+std::shared_ptr<SslContext> ThinClientPoolDM::getSslContext() const {
+  std::lock_guard<decltype(m_sslContextMutex)> guard(m_sslContextMutex);
+  if (!m_sslContext) {
+    auto& props = m_connManager.getCacheImpl()
+                      ->getDistributedSystem()
+                      .getSystemProperties();
+    m_sslContext = std::make_shared<SslContext>(props.sslTrustStore(),
+                                                props.sslKeyStore(),
+                                                props.sslKeystorePassword(),
+                                                props.sslKtlsEnabled());
+  }
+  return m_sslContext;
+}
+
 void ThinClientPoolDM::startBackgroundThreads() {
   LOGDEBUG("ThinClientPoolDM::startBackgroundThreads: Starting ping thread");
   m_pingTask =
@@ -535,17 +662,51 @@ void ThinClientPoolDM::restoreMinConnections(std::atomic<bool>& isRunning) {
     return;
   }
 
+  std::lock_guard<decltype(m_restoreMutex)> guard(m_restoreMutex);
+
   LOGDEBUG("Restoring minimum connection level");
 
   int min = m_attrs->getMinConnections();
-  int limit = 2 * min;
+  int missing = min - m_poolSize;
+
+  int restored = 0;
+
+  if (missing > 0) {
+    // Each connection resolves, connects and handshakes with a server, so
+    // they are opened side by side, sharing the old limit on attempts.
+    std::atomic<int> pending(missing);
+    std::atomic<int> attempts(2 * min);
+
+    std::vector<std::shared_ptr<RestoreConnectionsWork>> helpers;
+    auto& threadPool = m_connManager.getCacheImpl()->getThreadPool();
+    auto parallelism = (std::min)(missing, MAX_PARALLEL_RESTORES);
+    for (int i = 1; i < parallelism; i++) {
+      auto helper = std::make_shared<RestoreConnectionsWork>(this, isRunning,
+                                                             pending, attempts);
+      threadPool.perform(helper);
+      helpers.push_back(helper);
+    }
+
+    restored = restoreConnections(isRunning, pending, attempts);
+    for (auto& helper : helpers) {
+      restored += helper->getResult();
+    }
+  }
 
+  LOGDEBUG("Restored %d connections", restored);
+  LOGDEBUG("Pool size is %zu, pool counter is %d", size(), m_poolSize.load());
+}
+
+int ThinClientPoolDM::restoreConnections(std::atomic<bool>& isRunning,
+                                         std::atomic<int>& pending,
+                                         std::atomic<int>& attempts) {
   std::set<ServerLocation> excludeServers;
 
   int restored = 0;
 
-  if (m_poolSize < min) {
-    while (m_poolSize < min && limit-- && isRunning) {
+  try {
+    while (isRunning && m_poolSize < m_attrs->getMinConnections() &&
+           attempts-- > 0 && pending-- > 0) {
       TcrConnection* conn = nullptr;
       bool maxConnLimit = false;
       createPoolConnection(conn, excludeServers, maxConnLimit);
@@ -553,12 +714,50 @@ void ThinClientPoolDM::restoreMinConnections(std::atomic<bool>& isRunning) {
         put(conn, false);
         restored++;
         getStats().incMinPoolSizeConnects();
+      } else {
+        ++pending;
+        if (maxConnLimit) {
+          break;
+        }
       }
     }
+  } catch (const Exception& e) {
+    LOGERROR("ThinClientPoolDM::restoreConnections: %s", e.what());
+  } catch (const std::exception& e) {
+    LOGERROR("ThinClientPoolDM::restoreConnections: %s", e.what());
   }
 
-  LOGDEBUG("Restored %d connections", restored);
-  LOGDEBUG("Pool size is %zu, pool counter is %d", size(), m_poolSize.load());
+  return restored;
+}
+
+bool ThinClientPoolDM::warmUp(std::chrono::milliseconds timeout) {
+  if (m_isDestroyed) {
+    throw IllegalStateException("Pool " + m_poolName + " has been destroyed");
+  }
+
+  LOGFINE("Warming up pool %s to %d connections", m_poolName.c_str(),
+          m_attrs->getMinConnections());
+
+  auto start = std::chrono::steady_clock::now();
+  std::atomic<bool> isRunning(true);
+  while (m_poolSize < m_attrs->getMinConnections()) {
+    restoreMinConnections(isRunning);
+    if (m_poolSize >= m_attrs->getMinConnections()) {
+      break;
+    }
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start);
+    if (elapsed >= timeout || m_isDestroyed) {
+      LOGFINE("Pool %s warmed up to %d of %d connections", m_poolName.c_str(),
+              m_poolSize.load(), m_attrs->getMinConnections());
+      return false;
+    }
+    std::this_thread::sleep_for(
+        (std::min)(timeout - elapsed, std::chrono::milliseconds(100)));
+  }
+
+  return true;
 }
 
 void ThinClientPoolDM::manageConnectionsInternal(std::atomic<bool>& isRunning) {
@@ -596,10 +795,24 @@ std::string ThinClientPoolDM::selectEndpoint(
     // Update Locator Request Stats
     getStats().incLoctorRequests();
 
-    if (GF_NOERR != (m_locHelper)
-                        ->getEndpointForNewFwdConn(
-                            outEndpoint, additionalLoc, excludeServers,
-                            m_attrs->m_serverGrp, currentServer)) {
+    // ask for a server whose circuit breaker is closed first
+    auto excludeUnhealthy = excludeServers;
+    addUnavailableServers(excludeUnhealthy);
+    bool found = false;
+    if (excludeUnhealthy.size() > excludeServers.size()) {
+      try {
+        found = GF_NOERR == m_locHelper->getEndpointForNewFwdConn(
+                                outEndpoint, additionalLoc, excludeUnhealthy,
+                                m_attrs->m_serverGrp, currentServer);
+      } catch (const NotConnectedException&) {
+        LOGFINE("Only servers with an open circuit breaker are left");
+      }
+    }
+    if (!found && GF_NOERR != (m_locHelper)
+                                  ->getEndpointForNewFwdConn(
+                                      outEndpoint, additionalLoc,
+                                      excludeServers, m_attrs->m_serverGrp,
+                                      currentServer)) {
       throw IllegalStateException("Locator query failed selecting an endpoint");
     }
     // Update Locator stats
@@ -621,18 +834,25 @@ std::string ThinClientPoolDM::selectEndpoint(
       m_server = 0;
     }
 
-    unsigned int epCount = 0;
-    do {
-      if (!excludeServer(m_attrs->m_initServList[m_server], excludeServers)) {
-        LOGFINE("ThinClientPoolDM: Selecting endpoint [%s] from position %d",
-                m_attrs->m_initServList[m_server].c_str(), m_server);
-        return m_attrs->m_initServList[m_server++];
-      } else {
-        if (++m_server >= m_attrs->m_initServList.size()) {
-          m_server = 0;
+    // first pass skips servers whose circuit breaker is open, the second
+    // takes them too rather than fail
+    for (auto skipUnhealthy : {true, false}) {
+      unsigned int epCount = 0;
+      do {
+        auto& server = m_attrs->m_initServList[m_server];
+        if (!excludeServer(server, excludeServers) &&
+            !(skipUnhealthy && !isEndpointAvailable(server))) {
+          LOGFINE("ThinClientPoolDM: Selecting endpoint [%s] from position %d",
+                  server.c_str(), m_server);
+          m_server++;
+          return server;
+        } else {
+          if (++m_server >= m_attrs->m_initServList.size()) {
+            m_server = 0;
+          }
         }
-      }
-    } while (++epCount < m_attrs->m_initServList.size());
+      } while (++epCount < m_attrs->m_initServList.size());
+    }
 
     throw NotConnectedException("No server endpoints are available.");
   } else {
@@ -1292,14 +1512,7 @@ GfErrType ThinClientPoolDM::sendSyncRequest(
 
   int32_t type = request.getMessageType();
 
-  if (!(type == TcrMessage::QUERY ||
-        type == TcrMessage::QUERY_WITH_PARAMETERS ||
-        type == TcrMessage::PUTALL ||
-        type == TcrMessage::PUT_ALL_WITH_CALLBACK ||
-        type == TcrMessage::EXECUTE_FUNCTION ||
-        type == TcrMessage::EXECUTE_REGION_FUNCTION ||
-        type == TcrMessage::EXECUTE_REGION_FUNCTION_SINGLE_HOP ||
-        type == TcrMessage::EXECUTECQ_WITH_IR_MSG_TYPE)) {
+  if (!usesOwnTimeout(type)) {
     // set only when message is not query, putall and executeCQ
     reply.setTimeout(getReadTimeout());
     request.setTimeout(getReadTimeout());
@@ -1323,15 +1536,7 @@ GfErrType ThinClientPoolDM::sendSyncRequest(
     if (!firstTry) request.updateHeaderForRetry();
     // if it's a query or putall and we had a timeout, just return with the
     // newly selected endpoint without failover-retry
-    if ((type == TcrMessage::QUERY ||
-         type == TcrMessage::QUERY_WITH_PARAMETERS ||
-         type == TcrMessage::PUTALL ||
-         type == TcrMessage::PUT_ALL_WITH_CALLBACK ||
-         type == TcrMessage::EXECUTE_FUNCTION ||
-         type == TcrMessage::EXECUTE_REGION_FUNCTION ||
-         type == TcrMessage::EXECUTE_REGION_FUNCTION_SINGLE_HOP ||
-         type == TcrMessage::EXECUTECQ_WITH_IR_MSG_TYPE) &&
-        error == GF_TIMEOUT) {
+    if (usesOwnTimeout(type) && error == GF_TIMEOUT) {
       return error;
     }
 
@@ -1429,8 +1634,19 @@ GfErrType ThinClientPoolDM::sendSyncRequest(
       }
 
       if (userCredMsgErr == GF_NOERR) {
-        error = ep->sendRequestConnWithRetry(request, reply, conn);
+        const auto start = std::chrono::steady_clock::now();
+        if (isLatencyAwareRead(request)) {
+          // a hedged read may have been answered by another server
+          error = sendLatencyAwareRequest(request, reply, conn, ep,
+                                          excludeServers);
+        } else {
+          error = ep->sendRequestConnWithRetry(request, reply, conn);
+        }
         error = handleEPError(ep, reply, error);
+        updateEndpointHealth(
+            ep, type, error,
+            std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - start));
       } else {
         error = userCredMsgErr;
       }
@@ -1566,6 +1782,321 @@ GfErrType ThinClientPoolDM::sendSyncRequest(
   return error;
 }
 
+bool ThinClientPoolDM::isLatencyAwareRead(const TcrMessage& request) const {
+  auto type = request.getMessageType();
+  return m_attrs->getLatencyAwareReads() &&
+         (type == TcrMessage::REQUEST || type == TcrMessage::CONTAINS_KEY) &&
+         !request.forTransaction() && !m_isSecurityOn && !m_isMultiUserMode &&
+         !m_attrs->getThreadLocalConnectionSetting();
+}
+
+GfErrType ThinClientPoolDM::sendLatencyAwareRequest(
+    TcrMessage& request, TcrMessageReply& reply, TcrConnection*& conn,
+    TcrEndpoint*& ep, const std::set<ServerLocation>& excluded) {
+  auto& latency = ep->getReadLatency();
+  const auto percentiles = latency.getPercentiles();
+
+  auto credit = m_hedgeCredit.load();
+  while (credit < HEDGE_MAX_CREDIT &&
+         !m_hedgeCredit.compare_exchange_weak(credit, credit + 1)) {
+  }
+
+  if (percentiles.samples >= LATENCY_MIN_SAMPLES) {
+    auto timeout = std::chrono::duration_cast<std::chrono::milliseconds>(
+        percentiles.p99 * LATENCY_TIMEOUT_FACTOR);
+    timeout = (std::max)(timeout, LATENCY_MIN_TIMEOUT);
+    timeout = (std::min)(timeout, getReadTimeout());
+    request.setTimeout(timeout);
+    reply.setTimeout(timeout);
+
+    if (takeHedgeCredit()) {
+      return sendHedgedRequest(request, reply, conn, ep, excluded,
+                               percentiles.p95);
+    }
+  }
+
+  const auto start = std::chrono::steady_clock::now();
+  auto error = ep->sendRequestConnWithRetry(request, reply, conn);
+  if (error == GF_NOERR) {
+    latency.record(std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start));
+  } else if (error == GF_TIMEOUT) {
+    latency.record(reply.getTimeout());
+  }
+  return error;
+}
+
+GfErrType ThinClientPoolDM::sendHedgedRequest(
+    TcrMessage& request, TcrMessageReply& reply, TcrConnection*& conn,
+    TcrEndpoint*& ep, const std::set<ServerLocation>& excluded,
+    std::chrono::microseconds hedgeDelay) {
+  auto read = std::make_shared<HedgedRead>(request, conn, excluded);
+  m_connManager.getCacheImpl()->getThreadPool().perform(
+      std::make_shared<HedgedReadWork>(
+          std::static_pointer_cast<ThinClientPoolDM>(shared_from_this()), read,
+          hedgeDelay));
+
+  // The primary copy is sent on this thread. A pool thread only waits out
+  // the hedge delay and sends the hedge copy, so a busy pool delays hedges
+  // but never reads.
+  auto& latency = ep->getReadLatency();
+  char* data = nullptr;
+  size_t dataLen = 0;
+  GfErrType error = GF_NOERR;
+  const auto start = std::chrono::steady_clock::now();
+  try {
+    data = conn->sendRequest(request.getMsgData(), request.getMsgLength(),
+                             &dataLen, request.getTimeout(), reply.getTimeout(),
+                             read->type);
+  } catch (const TimeoutException&) {
+    error = GF_TIMEOUT;
+  } catch (const GeodeIOException&) {
+    error = GF_IOERR;
+  } catch (const Exception&) {
+    error = GF_NOTCON;
+  }
+  const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now() - start);
+
+  std::unique_lock<std::mutex> lock(read->mutex);
+  read->primaryDone = true;
+  read->cond.notify_all();
+  if (error != GF_NOERR && !read->primaryCancelled && read->hedgeSent) {
+    // the hedge may still answer before its own timeout
+    read->cond.wait_until(lock, read->hedgeDeadline,
+                          [&read] { return read->hedgeDone; });
+  }
+  read->abandoned = true;
+  const auto cancelled = read->primaryCancelled;
+  const auto hedgeConn = read->hedgeConn;
+  const auto hedgeData = read->hedgeData;
+  const auto hedgeDataLen = read->hedgeDataLen;
+  lock.unlock();
+
+  if (hedgeConn == nullptr) {
+    if (error == GF_TIMEOUT) {
+      latency.record(reply.getTimeout());
+      return error;
+    } else if (error != GF_NOERR) {
+      return error;
+    }
+    latency.record(elapsed);
+  } else {
+    // The hedge won. A cancelled primary took at least this long, which
+    // still tells its percentiles about the slow reply.
+    if (cancelled) {
+      latency.record(elapsed);
+      error = GF_TIMEOUT;
+    }
+    delete[] data;
+    releaseHedgedConnection(conn, error);
+    conn = hedgeConn;
+    ep = conn->getEndpointObject();
+    data = hedgeData;
+    dataLen = hedgeDataLen;
+  }
+
+  std::string failReason;
+  ep->setReplyData(request, reply, data, dataLen);
+  return ep->checkReply(request, reply, conn, failReason);
+}
+
+void ThinClientPoolDM::sendHedge(const std::shared_ptr<HedgedRead>& read,
+                                 std::chrono::microseconds delay) {
+  {
+    std::unique_lock<std::mutex> lock(read->mutex);
+    if (read->cond.wait_for(lock, delay,
+                            [&read] { return read->primaryDone; })) {
+      return;
+    }
+  }
+
+  auto conn = getFromOtherEP(read->primaryEP, read->excluded);
+  if (conn == nullptr) {
+    return;
+  }
+  bool answered;
+  {
+    std::lock_guard<std::mutex> guard(read->mutex);
+    answered = read->primaryDone;
+    if (!answered) {
+      read->hedgeSent = true;
+      read->hedgeDeadline = std::chrono::steady_clock::now() + read->timeout;
+    }
+  }
+  if (answered) {
+    putInQueue(conn, false);
+    return;
+  }
+
+  LOGFINE("Hedging request type %d to endpoint %s after %s", read->type,
+          conn->getEndpointObject()->name().c_str(), to_string(delay).c_str());
+  auto& latency = conn->getEndpointObject()->getReadLatency();
+  char* data = nullptr;
+  size_t dataLen = 0;
+  GfErrType error = GF_NOERR;
+  const auto start = std::chrono::steady_clock::now();
+  try {
+    data = conn->sendRequest(read->message.data(), read->message.size(),
+                             &dataLen, read->timeout, read->timeout,
+                             read->type);
+    latency.record(std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start));
+  } catch (const TimeoutException&) {
+    error = GF_TIMEOUT;
+    latency.record(read->timeout);
+  } catch (const GeodeIOException&) {
+    error = GF_IOERR;
+  } catch (const Exception&) {
+    error = GF_NOTCON;
+  }
+
+  bool won = false;
+  {
+    std::lock_guard<std::mutex> guard(read->mutex);
+    read->hedgeDone = true;
+    if (error == GF_NOERR && !read->abandoned) {
+      won = true;
+      read->hedgeConn = conn;
+      read->hedgeData = data;
+      read->hedgeDataLen = dataLen;
+      if (!read->primaryDone) {
+        // wake the reading thread, which returns this reply instead
+        read->primaryCancelled = true;
+        read->primary->cancel();
+      }
+    }
+    read->cond.notify_all();
+  }
+
+  if (!won) {
+    delete[] data;
+    releaseHedgedConnection(conn, error);
+  }
+}
+
+void ThinClientPoolDM::releaseHedgedConnection(TcrConnection* conn,
+                                               GfErrType error) {
+  if (error == GF_NOERR && !isDestroyed()) {
+    putInQueue(conn, false);
+    return;
+  }
+
+  if (error != GF_NOERR && error != GF_TIMEOUT && !isDestroyed()) {
+    removeEPConnections(conn->getEndpointObject());
+  }
+  removeEPConnections(1, false);
+  try {
+    GF_SAFE_DELETE_CON(conn);
+  } catch (...) {
+  }
+}
+
+TcrConnection* ThinClientPoolDM::getFromOtherEP(
+    const TcrEndpoint* theEP, const std::set<ServerLocation>& excluded) {
+  std::lock_guard<decltype(mutex_)> lock(mutex_);
+  for (auto itr = queue_.begin(); itr != queue_.end(); itr++) {
+    auto ep = (*itr)->getEndpointObject();
+    if (ep != theEP && ep->connected() &&
+        excluded.find(ServerLocation(ep->name())) == excluded.end()) {
+      TcrConnection* retVal = *itr;
+      queue_.erase(itr);
+      return retVal;
+    }
+  }
+
+  return nullptr;
+}
+
+bool ThinClientPoolDM::takeHedgeCredit() {
+  auto credit = m_hedgeCredit.load();
+  while (credit >= HEDGE_COST) {
+    if (m_hedgeCredit.compare_exchange_weak(credit, credit - HEDGE_COST)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void ThinClientPoolDM::updateEndpointHealth(TcrEndpoint* ep, int32_t type,
+                                            GfErrType error,
+                                            std::chrono::microseconds elapsed) {
+  auto& health = ep->getHealth();
+  if (!usesOwnTimeout(type) && (error == GF_NOERR || error == GF_TIMEOUT)) {
+    health.recordLatency(elapsed);
+  }
+
+  if (error == GF_NOERR) {
+    if (health.recordSuccess()) {
+      LOGINFO("Closed circuit breaker for server %s", ep->name().c_str());
+      updateCircuitStats();
+    }
+  } else if (error == GF_TIMEOUT || error == GF_IOERR || error == GF_NOTCON) {
+    if (health.recordFailure()) {
+      LOGWARN(
+          "Opened circuit breaker for server %s; error rate %.2f, latency %s",
+          ep->name().c_str(), health.getErrorRate(),
+          to_string(health.getLatency()).c_str());
+      getStats().incCircuitOpens();
+      updateCircuitStats();
+    }
+  }
+}
+
+void ThinClientPoolDM::updateCircuitStats() {
+  int32_t open = 0;
+  int32_t halfOpen = 0;
+  {
+    std::lock_guard<decltype(m_endpointsLock)> guard(m_endpointsLock);
+    for (auto& it : m_endpoints) {
+      switch (it.second->getHealth().getState()) {
+        case EndpointHealth::State::OPEN:
+          ++open;
+          break;
+        case EndpointHealth::State::HALF_OPEN:
+          ++halfOpen;
+          break;
+        case EndpointHealth::State::CLOSED:
+          break;
+      }
+    }
+  }
+  getStats().setOpenCircuits(open);
+  getStats().setHalfOpenCircuits(halfOpen);
+}
+
+bool ThinClientPoolDM::isEndpointAvailable(const std::string& endpointName) {
+  auto ep = getEndpoint(endpointName);
+  return !ep || ep->getHealth().getState() != EndpointHealth::State::OPEN;
+}
+
+void ThinClientPoolDM::addUnavailableServers(
+    std::set<ServerLocation>& excludeServers) {
+  std::lock_guard<decltype(m_endpointsLock)> guard(m_endpointsLock);
+  for (auto& it : m_endpoints) {
+    if (it.second->getHealth().getState() == EndpointHealth::State::OPEN) {
+      excludeServers.insert(ServerLocation(it.first));
+    }
+  }
+}
+
+bool ThinClientPoolDM::isHealthier(const std::string& endpointName,
+                                   const std::string& otherName) {
+  auto ep = getEndpoint(endpointName);
+  auto other = getEndpoint(otherName);
+  if (!ep || !other) {
+    return false;
+  }
+
+  auto available = ep->getHealth().getState() == EndpointHealth::State::CLOSED;
+  auto otherAvailable =
+      other->getHealth().getState() == EndpointHealth::State::CLOSED;
+  if (available != otherAvailable) {
+    return available;
+  }
+  return ep->getHealth().getScore() < other->getHealth().getScore();
+}
+
 void ThinClientPoolDM::removeEPFromMetadataIfError(const GfErrType& error,
                                                    const TcrEndpoint* ep) {
   if ((error == GF_IOERR || error == GF_TIMEOUT) && (m_clientMetadataService)) {
@@ -2052,6 +2583,7 @@ void ThinClientPoolDM::pingServerLocal() {
       }
     }
   }
+  updateCircuitStats();
 }
 
 void ThinClientPoolDM::updateLocatorList(std::atomic<bool>& isRunning) {
@@ -2211,29 +2743,46 @@ TcrConnection* ThinClientPoolDM::getNoGetLock(
     bool& isClosed, GfErrType* error, std::set<ServerLocation>& excludeServers,
     bool& maxConnLimit) {
   TcrConnection* returnT = nullptr;
+  bool skippedUnhealthy = false;
   {
     std::lock_guard<decltype(mutex_)> lock(mutex_);
 
-    do {
+    // connections to servers whose circuit breaker is open stay queued
+    auto candidates = queue_.size();
+    while (candidates-- > 0) {
       returnT = popNoLock(isClosed);
-      if (returnT) {
-        if (excludeConnection(returnT, excludeServers)) {
-          returnT->close();
-          _GEODE_SAFE_DELETE(returnT);
-          removeEPConnections(1, false);
-        } else {
-          break;
-        }
-      } else {
+      if (!returnT) {
         break;
+      } else if (excludeConnection(returnT, excludeServers)) {
+        returnT->close();
+        _GEODE_SAFE_DELETE(returnT);
+        removeEPConnections(1, false);
+      } else if (returnT->getEndpointObject()->getHealth().allowRequest()) {
+        break;
+      } else {
+        queue_.push_front(returnT);
+        returnT = nullptr;
+        skippedUnhealthy = true;
       }
-    } while (!returnT);
+    }
   }
 
   if (!returnT) {
     *error = createPoolConnection(returnT, excludeServers, maxConnLimit);
   }
 
+  if (!returnT && skippedUnhealthy) {
+    // every server is unhealthy; use one of them rather than fail
+    std::lock_guard<decltype(mutex_)> lock(mutex_);
+    returnT = popNoLock(isClosed);
+    if (returnT && excludeConnection(returnT, excludeServers)) {
+      queue_.push_front(returnT);
+      returnT = nullptr;
+    } else if (returnT) {
+      *error = GF_NOERR;
+    }
+  }
+
   return returnT;
 }
 
@@ -2323,6 +2872,7 @@ TcrConnection* ThinClientPoolDM::getConnectionFromQueueW(
     GfErrType* error, std::set<ServerLocation>& excludeServers, bool,
     TcrMessage& request, int8_t& version, bool& match, bool& connFound,
     const std::shared_ptr<BucketServerLocation>& serverLocation) {
+  TraceScope trace("pool.checkout");
   TcrConnection* conn = nullptr;
   TcrEndpoint* theEP = nullptr;
   LOGDEBUG("prEnabled = %s, forSingleHop = %s %d",
@@ -2416,6 +2966,11 @@ TcrConnection* ThinClientPoolDM::getConnectionFromQueueW(
       "ThinClientPoolDM::getConnectionFromQueueW return conn = %p match = %d "
       "connFound=%d",
       conn, match, connFound);
+  if (conn == nullptr) {
+    trace.setError();
+  } else if (trace.isRecording()) {
+    trace.setAttribute("server", conn->getEndpointObject()->name());
+  }
   return conn;
 }
 
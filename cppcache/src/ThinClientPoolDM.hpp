@@ -62,6 +62,8 @@ namespace client {
 class CacheImpl;
 class FunctionExecution;
 class ClientMetadataService;
+class SslContext;
+struct HedgedRead;
 
 class ThinClientPoolDM
     : public ThinClientBaseDM,
@@ -91,6 +93,7 @@ class ThinClientPoolDM
   void destroy(bool keepalive = false) override;
   bool isDestroyed() const override;
   std::shared_ptr<QueryService> getQueryService() override;
+  bool warmUp(std::chrono::milliseconds timeout) override;
   virtual std::shared_ptr<QueryService> getQueryServiceWithoutCheck();
   bool isEndpointAttached(TcrEndpoint* ep) override;
   GfErrType sendRequestToAllServers(
@@ -170,6 +173,13 @@ class ThinClientPoolDM
 
   const std::string getSNIProxyHostname() { return m_attrs->getSniProxyHost(); }
   uint16_t getSNIPort() { return m_attrs->getSniProxyPort(); }
+
+  /**
+   * Returns the SSL context shared by this pool's server and locator
+   * connections, loading the stores from the system properties on first use.
+   */
+  std::shared_ptr<SslContext> getSslContext() const;
+
   virtual inline bool isSticky() { return m_sticky; }
   virtual TcrEndpoint* getEndPoint(
       const std::shared_ptr<BucketServerLocation>& serverLocation,
@@ -183,6 +193,16 @@ class ThinClientPoolDM
   }
   int getPrimaryServerQueueSize() const { return m_primaryServerQueueSize; }
 
+  /**
+   * Returns true if requests should rather go to the server named
+   * <code>endpointName</code> than to <code>otherName</code>: its circuit
+   * breaker is closed while the other one's is not, or both are in the same
+   * state and it has the lower health score. Returns false for servers
+   * without an endpoint yet.
+   */
+  bool isHealthier(const std::string& endpointName,
+                   const std::string& otherName);
+
  protected:
   ThinClientStickyManager* m_manager;
   std::vector<std::string> m_canonicalHosts;
@@ -304,17 +324,50 @@ class ThinClientPoolDM
   void manageConnectionsInternal(std::atomic<bool>& isRunning);
   void cleanStaleConnections(std::atomic<bool>& isRunning);
   void restoreMinConnections(std::atomic<bool>& isRunning);
+  int restoreConnections(std::atomic<bool>& isRunning,
+                         std::atomic<int>& pending, std::atomic<int>& attempts);
+  // one restoreMinConnections at a time, so concurrent callers do not
+  // overshoot min-connections
+  std::mutex m_restoreMutex;
+  mutable std::mutex m_sslContextMutex;
+  mutable std::shared_ptr<SslContext> m_sslContext;
   std::atomic<int32_t> m_clientOps;  // Actual Size of Pool
+  // credit earned by latency aware reads and spent on hedging them
+  std::atomic<int32_t> m_hedgeCredit;
   std::unique_ptr<statistics::PoolStatsSampler> m_PoolStatsSampler;
   std::unique_ptr<ClientMetadataService> m_clientMetadataService;
   friend class CacheImpl;
   friend class ThinClientStickyManager;
   friend class FunctionExecution;
+  friend class RestoreConnectionsWork;
+  friend class HedgedReadWork;
   static const char* NC_Ping_Thread;
   static const char* NC_MC_Thread;
   int m_primaryServerQueueSize;
   void removeEPFromMetadataIfError(const GfErrType& error,
                                    const TcrEndpoint* ep);
+
+  bool isLatencyAwareRead(const TcrMessage& request) const;
+  GfErrType sendLatencyAwareRequest(TcrMessage& request,
+                                    TcrMessageReply& reply,
+                                    TcrConnection*& conn, TcrEndpoint*& ep,
+                                    const std::set<ServerLocation>& excluded);
+  GfErrType sendHedgedRequest(TcrMessage& request, TcrMessageReply& reply,
+                              TcrConnection*& conn, TcrEndpoint*& ep,
+                              const std::set<ServerLocation>& excluded,
+                              std::chrono::microseconds hedgeDelay);
+  void sendHedge(const std::shared_ptr<HedgedRead>& read,
+                 std::chrono::microseconds delay);
+  void releaseHedgedConnection(TcrConnection* conn, GfErrType error);
+  TcrConnection* getFromOtherEP(const TcrEndpoint* theEP,
+                                const std::set<ServerLocation>& excluded);
+  bool takeHedgeCredit();
+
+  void updateEndpointHealth(TcrEndpoint* ep, int32_t type, GfErrType error,
+                            std::chrono::microseconds elapsed);
+  void updateCircuitStats();
+  bool isEndpointAvailable(const std::string& endpointName);
+  void addUnavailableServers(std::set<ServerLocation>& excludeServers);
 };
 
 class FunctionExecution : public PooledWork<GfErrType> {
@@ -1240,8 +1240,7 @@ void ThinClientRedundancyManager::startPeriodicAck() {
 // ThinClientRegion
 bool ThinClientRedundancyManager::checkDupAndAdd(
     std::shared_ptr<EventId> eventid) {
-  EventIdMapEntry entry = EventIdMap::make(eventid);
-  return m_eventidmap.put(entry.first, entry.second, true);
+  return m_eventidmap.put(*eventid, true);
 }
 
 void ThinClientRedundancyManager::netDown() {
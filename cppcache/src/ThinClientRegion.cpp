@@ -22,6 +22,7 @@
 #include <regex>
 
 #include <geode/PoolManager.hpp>
+#include <geode/StreamingResultCollector.hpp>
 #include <geode/Struct.hpp>
 #include <geode/SystemProperties.hpp>
 #include <geode/UserFunctionExecutionException.hpp>
@@ -29,6 +30,8 @@
 #include "AutoDelete.hpp"
 #include "CacheImpl.hpp"
 #include "CacheRegionHelper.hpp"
+#include "ColumnarResultsBuilder.hpp"
+#include "CompressedValue.hpp"
 #include "DataInputInternal.hpp"
 #include "PutAllPartialResultServerException.hpp"
 #include "ReadWriteLock.hpp"
@@ -39,6 +42,7 @@
 #include "TcrEndpoint.hpp"
 #include "ThinClientBaseDM.hpp"
 #include "ThinClientPoolDM.hpp"
+#include "Tracer.hpp"
 #include "UserAttributes.hpp"
 #include "Utils.hpp"
 #include "VersionedCacheableObjectPartList.hpp"
@@ -54,6 +58,38 @@ static const std::regex PREDICATE_IS_FULL_QUERY_REGEX(
 
 void setThreadLocalExceptionMessage(std::string exMsg);
 
+namespace {
+
+class NotificationGuard {
+ public:
+  explicit NotificationGuard(ACE_RW_Thread_Mutex& lock)
+      : lock_(lock), acquired_(false) {}
+
+  ~NotificationGuard() { release(); }
+
+  void acquire(bool exclusive) {
+    if (exclusive) {
+      lock_.acquire_write();
+    } else {
+      lock_.acquire_read();
+    }
+    acquired_ = true;
+  }
+
+  void release() {
+    if (acquired_) {
+      lock_.release();
+      acquired_ = false;
+    }
+  }
+
+ private:
+  ACE_RW_Thread_Mutex& lock_;
+  bool acquired_;
+};
+
+}  // namespace
+
 class PutAllWork : public PooledWork<GfErrType> {
   ThinClientPoolDM* m_poolDM;
   std::shared_ptr<BucketServerLocation> m_serverLocation;
@@ -354,6 +390,14 @@ ThinClientRegion::ThinClientRegion(
                          .getSystemProperties()
                          .durableClientId()
                          .empty();
+  if (m_regionAttributes.getWriteBehindBatchSize() > 0) {
+    m_writeBehind.reset(new WriteBehindQueue(
+        m_regionAttributes.getWriteBehindBatchSize(),
+        m_regionAttributes.getWriteBehindBatchInterval(),
+        [this](const HashMapOfCacheable& batch) {
+          return writeBehindBatch(batch);
+        }));
+  }
 }
 
 void ThinClientRegion::initTCR() {
@@ -854,6 +898,7 @@ bool ThinClientRegion::containsValueForKey_remote(
 
 void ThinClientRegion::clear(
     const std::shared_ptr<Serializable>& aCallbackArgument) {
+  flushWriteBehind();
   GfErrType err = GF_NOERR;
   err = localClearNoThrow(aCallbackArgument, CacheEventFlags::NORMAL);
   if (err != GF_NOERR) throwExceptionIfError("Region::clear", err);
@@ -900,12 +945,17 @@ GfErrType ThinClientRegion::getNoThrow_remote(
     std::shared_ptr<Cacheable>& valPtr,
     const std::shared_ptr<Serializable>& aCallbackArgument,
     std::shared_ptr<VersionTag>& versionTag) {
+  if (m_writeBehind && m_writeBehind->contains(keyPtr)) {
+    flushWriteBehind();
+  }
   GfErrType err = GF_NOERR;
 
   /** @brief Create message and send to bridge server */
 
+  TraceScope serialize("serialize");
   TcrMessageRequest request(new DataOutput(m_cacheImpl->createDataOutput()),
                             this, keyPtr, aCallbackArgument, m_tcrdm.get());
+  serialize.end();
   TcrMessageReply reply(true, m_tcrdm.get());
   err = m_tcrdm->sendSyncRequest(request, reply);
   if (err != GF_NOERR) return err;
@@ -913,7 +963,7 @@ GfErrType ThinClientRegion::getNoThrow_remote(
   // put the object into local region
   switch (reply.getMessageType()) {
     case TcrMessage::RESPONSE: {
-      valPtr = reply.getValue();
+      valPtr = decompressFromServer(reply.getValue());
       versionTag = reply.getVersionTag();
       break;
     }
@@ -941,6 +991,7 @@ GfErrType ThinClientRegion::invalidateNoThrow_remote(
     const std::shared_ptr<CacheableKey>& keyPtr,
     const std::shared_ptr<Serializable>& aCallbackArgument,
     std::shared_ptr<VersionTag>& versionTag) {
+  flushWriteBehind();
   GfErrType err = GF_NOERR;
 
   TcrMessageInvalidate request(new DataOutput(m_cacheImpl->createDataOutput()),
@@ -978,10 +1029,24 @@ GfErrType ThinClientRegion::putNoThrow_remote(
     const std::shared_ptr<Cacheable>& valuePtr,
     const std::shared_ptr<Serializable>& aCallbackArgument,
     std::shared_ptr<VersionTag>& versionTag, bool checkDelta) {
+  if (m_writeBehind) {
+    // puts that carry more than a value, or belong to a transaction or an
+    // authenticated view, are sent on their own after what is queued
+    if (aCallbackArgument == nullptr &&
+        !std::dynamic_pointer_cast<Delta>(valuePtr) &&
+        !TSSTXStateWrapper::get().getTXState() &&
+        !UserAttributes::threadLocalUserAttributes) {
+      m_writeBehind->put(keyPtr, valuePtr);
+      return GF_NOERR;
+    }
+    flushWriteBehind();
+  }
   GfErrType err = GF_NOERR;
   // do TCR put
+  TraceScope serialize("serialize");
   // bool delta = valuePtr->hasDelta();
   bool delta = false;
+  auto sentValue = valuePtr;
   auto&& conFlationValue = getCacheImpl()
                                ->getDistributedSystem()
                                .getSystemProperties()
@@ -991,9 +1056,13 @@ GfErrType ThinClientRegion::putNoThrow_remote(
     auto&& temp = std::dynamic_pointer_cast<Delta>(valuePtr);
     delta = temp && temp->hasDelta();
   }
+  if (!delta) {
+    sentValue = compressForServer(valuePtr);
+  }
   TcrMessagePut request(new DataOutput(m_cacheImpl->createDataOutput()), this,
-                        keyPtr, valuePtr, aCallbackArgument, delta,
+                        keyPtr, sentValue, aCallbackArgument, delta,
                         m_tcrdm.get());
+  serialize.end();
   auto reply = std::unique_ptr<TcrMessageReply>(
       new TcrMessageReply(true, m_tcrdm.get()));
   err = m_tcrdm->sendSyncRequest(request, *reply);
@@ -1003,8 +1072,9 @@ GfErrType ThinClientRegion::putNoThrow_remote(
     if (reply->getMessageType() == TcrMessage::PUT_DELTA_ERROR) {
       // Try without delta
       TcrMessagePut putRequest(new DataOutput(m_cacheImpl->createDataOutput()),
-                               this, keyPtr, valuePtr, aCallbackArgument, false,
-                               m_tcrdm.get(), false, true);
+                               this, keyPtr, compressForServer(valuePtr),
+                               aCallbackArgument, false, m_tcrdm.get(), false,
+                               true);
       reply = std::unique_ptr<TcrMessageReply>(
           new TcrMessageReply(true, m_tcrdm.get()));
       err = m_tcrdm->sendSyncRequest(putRequest, *reply);
@@ -1035,11 +1105,36 @@ GfErrType ThinClientRegion::putNoThrow_remote(
   return err;
 }
 
+std::shared_ptr<Cacheable> ThinClientRegion::compressForServer(
+    const std::shared_ptr<Cacheable>& value) const {
+  auto compressed = CompressedValue::create(
+      value, m_regionAttributes.getCompressor(),
+      m_regionAttributes.getCompressionThreshold(), m_cacheImpl);
+  if (CompressedValue::isCompressed(compressed)) {
+    return std::static_pointer_cast<CompressedValue>(compressed)->toBytes();
+  }
+  return value;
+}
+
+std::shared_ptr<Cacheable> ThinClientRegion::decompressFromServer(
+    const std::shared_ptr<Cacheable>& value) const {
+  if (auto&& compressor = m_regionAttributes.getCompressor()) {
+    if (auto bytes = std::dynamic_pointer_cast<CacheableBytes>(value)) {
+      if (auto compressed =
+              CompressedValue::fromBytes(*bytes, compressor, m_cacheImpl)) {
+        return compressed->decompress();
+      }
+    }
+  }
+  return value;
+}
+
 GfErrType ThinClientRegion::createNoThrow_remote(
     const std::shared_ptr<CacheableKey>& keyPtr,
     const std::shared_ptr<Cacheable>& valuePtr,
     const std::shared_ptr<Serializable>& aCallbackArgument,
     std::shared_ptr<VersionTag>& versionTag) {
+  flushWriteBehind();
   return putNoThrow_remote(keyPtr, valuePtr, aCallbackArgument, versionTag,
                            false);
 }
@@ -1048,12 +1143,15 @@ GfErrType ThinClientRegion::destroyNoThrow_remote(
     const std::shared_ptr<CacheableKey>& keyPtr,
     const std::shared_ptr<Serializable>& aCallbackArgument,
     std::shared_ptr<VersionTag>& versionTag) {
+  flushWriteBehind();
   GfErrType err = GF_NOERR;
 
   // do TCR destroy
+  TraceScope serialize("serialize");
   TcrMessageDestroy request(new DataOutput(m_cacheImpl->createDataOutput()),
                             this, keyPtr, nullptr, aCallbackArgument,
                             m_tcrdm.get());
+  serialize.end();
   TcrMessageReply reply(true, m_tcrdm.get());
   err = m_tcrdm->sendSyncRequest(request, reply);
   if (err != GF_NOERR) return err;
@@ -1092,12 +1190,15 @@ GfErrType ThinClientRegion::removeNoThrow_remote(
     const std::shared_ptr<Cacheable>& cvalue,
     const std::shared_ptr<Serializable>& aCallbackArgument,
     std::shared_ptr<VersionTag>& versionTag) {
+  flushWriteBehind();
   GfErrType err = GF_NOERR;
 
   // do TCR remove
+  TraceScope serialize("serialize");
   TcrMessageDestroy request(new DataOutput(m_cacheImpl->createDataOutput()),
                             this, keyPtr, cvalue, aCallbackArgument,
                             m_tcrdm.get());
+  serialize.end();
   TcrMessageReply reply(true, m_tcrdm.get());
   err = m_tcrdm->sendSyncRequest(request, reply);
   if (err != GF_NOERR) {
@@ -1135,6 +1236,7 @@ GfErrType ThinClientRegion::removeNoThrowEX_remote(
     const std::shared_ptr<CacheableKey>& keyPtr,
     const std::shared_ptr<Serializable>& aCallbackArgument,
     std::shared_ptr<VersionTag>& versionTag) {
+  flushWriteBehind();
   GfErrType err = GF_NOERR;
 
   // do TCR remove
@@ -1182,6 +1284,7 @@ GfErrType ThinClientRegion::getAllNoThrow_remote(
         resultKeys,
     bool addToLocalCache,
     const std::shared_ptr<Serializable>& aCallbackArgument) {
+  flushWriteBehind();
   GfErrType err = GF_NOERR;
   MapOfUpdateCounters updateCountMap;
   int32_t destroyTracker = 0;
@@ -1233,6 +1336,39 @@ GfErrType ThinClientRegion::getAllNoThrow_remote(
     return err;
   }
 
+  return handleGetAllReply(reply);
+}
+
+GfErrType ThinClientRegion::getAllStreamingNoThrow_remote(
+    const std::vector<std::shared_ptr<CacheableKey>>* keys,
+    const std::shared_ptr<HashMapOfException>& exceptions,
+    const GetAllEntryHandler& handler,
+    const std::shared_ptr<Serializable>& aCallbackArgument) {
+  flushWriteBehind();
+  // streamed values are never added to the local cache so no update
+  // tracking is required
+  MapOfUpdateCounters updateCountMap;
+  TcrMessageGetAll request(new DataOutput(m_cacheImpl->createDataOutput()),
+                           this, keys, m_tcrdm.get(), aCallbackArgument);
+
+  TcrMessageReply reply(true, m_tcrdm.get());
+  std::recursive_mutex responseLock;
+  ChunkedGetAllResponse resultCollector(reply, this, keys, nullptr, exceptions,
+                                        nullptr, updateCountMap, 0, false,
+                                        responseLock);
+  resultCollector.setEntryHandler(handler);
+
+  reply.setChunkedResultHandler(&resultCollector);
+  auto err = m_tcrdm->sendSyncRequest(request, reply);
+  if (err != GF_NOERR) {
+    return err;
+  }
+
+  return handleGetAllReply(reply);
+}
+
+GfErrType ThinClientRegion::handleGetAllReply(TcrMessageReply& reply) {
+  GfErrType err = GF_NOERR;
   switch (reply.getMessageType()) {
     case TcrMessage::RESPONSE: {
       // nothing to be done; put in local region, if required,
@@ -1632,8 +1768,35 @@ GfErrType ThinClientRegion::putAllNoThrow_remote(
     std::shared_ptr<VersionedCacheableObjectPartList>& versionedObjPartList,
     std::chrono::milliseconds timeout,
     const std::shared_ptr<Serializable>& aCallbackArgument) {
+  flushWriteBehind();
+  return sendPutAllNoThrow_remote(map, versionedObjPartList, timeout,
+                                  aCallbackArgument);
+}
+
+GfErrType ThinClientRegion::sendPutAllNoThrow_remote(
+    const HashMapOfCacheable& map,
+    std::shared_ptr<VersionedCacheableObjectPartList>& versionedObjPartList,
+    std::chrono::milliseconds timeout,
+    const std::shared_ptr<Serializable>& aCallbackArgument) {
   LOGDEBUG("ThinClientRegion::putAllNoThrow_remote");
 
+  if (m_regionAttributes.getCompressor()) {
+    HashMapOfCacheable compressed(map.size());
+    for (const auto& entry : map) {
+      compressed.emplace(entry.first, compressForServer(entry.second));
+    }
+    return dispatchPutAllNoThrow_remote(compressed, versionedObjPartList,
+                                        timeout, aCallbackArgument);
+  }
+  return dispatchPutAllNoThrow_remote(map, versionedObjPartList, timeout,
+                                      aCallbackArgument);
+}
+
+GfErrType ThinClientRegion::dispatchPutAllNoThrow_remote(
+    const HashMapOfCacheable& map,
+    std::shared_ptr<VersionedCacheableObjectPartList>& versionedObjPartList,
+    std::chrono::milliseconds timeout,
+    const std::shared_ptr<Serializable>& aCallbackArgument) {
   if (auto poolDM = std::dynamic_pointer_cast<ThinClientPoolDM>(m_tcrdm)) {
     if (poolDM->getPRSingleHopEnabled() && poolDM->getClientMetaDataService() &&
         !TSSTXStateWrapper::get().getTXState()) {
@@ -1954,6 +2117,7 @@ GfErrType ThinClientRegion::removeAllNoThrow_remote(
     const std::vector<std::shared_ptr<CacheableKey>>& keys,
     std::shared_ptr<VersionedCacheableObjectPartList>& versionedObjPartList,
     const std::shared_ptr<Serializable>& aCallbackArgument) {
+  flushWriteBehind();
   LOGDEBUG("ThinClientRegion::removeAllNoThrow_remote");
 
   if (auto poolDM = std::dynamic_pointer_cast<ThinClientPoolDM>(m_tcrdm)) {
@@ -2178,6 +2342,7 @@ GfErrType ThinClientRegion::unregisterKeys() {
 
 GfErrType ThinClientRegion::destroyRegionNoThrow_remote(
     const std::shared_ptr<Serializable>& aCallbackArgument) {
+  flushWriteBehind();
   GfErrType err = GF_NOERR;
 
   // do TCR destroyRegion
@@ -2684,7 +2849,8 @@ GfErrType ThinClientRegion::clientNotificationHandler(TcrMessage& msg) {
     }
     case TcrMessage::LOCAL_CREATE:
       err = LocalRegion::putNoThrow(
-          msg.getKey(), msg.getValue(), msg.getCallbackArgument(), oldValue, -1,
+          msg.getKey(), decompressFromServer(msg.getValue()),
+          msg.getCallbackArgument(), oldValue, -1,
           CacheEventFlags::NOTIFICATION | CacheEventFlags::LOCAL,
           msg.getVersionTag());
       break;
@@ -2692,7 +2858,8 @@ GfErrType ThinClientRegion::clientNotificationHandler(TcrMessage& msg) {
       //  for update set the NOTIFICATION_UPDATE to trigger the
       // afterUpdate event even if the key is not present in local cache
       err = LocalRegion::putNoThrow(
-          msg.getKey(), msg.getValue(), msg.getCallbackArgument(), oldValue, -1,
+          msg.getKey(), decompressFromServer(msg.getValue()),
+          msg.getCallbackArgument(), oldValue, -1,
           CacheEventFlags::NOTIFICATION | CacheEventFlags::NOTIFICATION_UPDATE |
               CacheEventFlags::LOCAL,
           msg.getVersionTag(), msg.getDelta(), msg.getEventId());
@@ -2783,7 +2950,7 @@ GfErrType ThinClientRegion::handleServerException(
 }
 
 void ThinClientRegion::receiveNotification(TcrMessage* msg) {
-  std::unique_lock<std::mutex> lock(m_notificationMutex, std::defer_lock);
+  NotificationGuard lock(m_notificationLock);
   {
     TryReadGuard guard(m_rwLock, m_destroyPending);
     if (m_destroyPending) {
@@ -2792,7 +2959,8 @@ void ThinClientRegion::receiveNotification(TcrMessage* msg) {
       }
       return;
     }
-    lock.lock();
+    lock.acquire(msg->getMessageType() == TcrMessage::CLIENT_MARKER ||
+                 msg->getKey() == nullptr);
   }
 
   if (msg->getMessageType() == TcrMessage::CLIENT_MARKER) {
@@ -2801,7 +2969,7 @@ void ThinClientRegion::receiveNotification(TcrMessage* msg) {
     clientNotificationHandler(*msg);
   }
 
-  lock.unlock();
+  lock.release();
   if (TcrMessage::getAllEPDisMess() != msg) _GEODE_SAFE_DELETE(msg);
 }
 
@@ -2814,6 +2982,7 @@ void ThinClientRegion::localInvalidateRegion_internal() {
     std::shared_ptr<VersionTag> versionTag;
     m_entries->invalidate(key, me, oldValue, versionTag);
   }
+  clearIndexes();
 }
 
 void ThinClientRegion::invalidateInterestList(
@@ -2828,6 +2997,7 @@ void ThinClientRegion::invalidateInterestList(
   for (const auto& iter : interestList) {
     std::shared_ptr<VersionTag> versionTag;
     m_entries->invalidate(iter.first, me, oldValue, versionTag);
+    updateIndexes(iter.first, nullptr);
   }
 }
 
@@ -2859,6 +3029,7 @@ void ThinClientRegion::localInvalidateForRegisterInterest(
   for (const auto& key : keys) {
     std::shared_ptr<VersionTag> versionTag;
     m_entries->invalidate(key, me, oldValue, versionTag);
+    updateIndexes(key, nullptr);
     updateAccessAndModifiedTimeForEntry(me, true);
   }
 }
@@ -2894,6 +3065,52 @@ void ThinClientRegion::registerInterestGetValues(
   }
 }
 
+void ThinClientRegion::flush() {
+  if (m_writeBehind) {
+    throwExceptionIfError("Region::flush", m_writeBehind->flush());
+  }
+}
+
+void ThinClientRegion::flushWriteBehind() {
+  if (m_writeBehind) {
+    // failures are reported to the WriteBehindListener
+    m_writeBehind->flush();
+  }
+}
+
+GfErrType ThinClientRegion::writeBehindBatch(const HashMapOfCacheable& batch) {
+  std::shared_ptr<VersionedCacheableObjectPartList> versionedObjPartList;
+  auto err = sendPutAllNoThrow_remote(batch, versionedObjPartList,
+                                      DEFAULT_RESPONSE_TIMEOUT, nullptr);
+  if (err != GF_NOERR) {
+    LOGWARN("Region %s: failed to write %zu queued puts, error %d",
+            m_fullPath.c_str(), batch.size(), err);
+  }
+
+  auto listener = m_regionAttributes.getWriteBehindListener();
+  if (!listener) {
+    return err;
+  }
+  try {
+    if (err == GF_NOERR) {
+      listener->afterFlush(*this, batch);
+    } else {
+      try {
+        throwExceptionIfError("Region::flush", err);
+      } catch (const Exception& ex) {
+        listener->afterFlushError(*this, batch, ex);
+      }
+    }
+  } catch (const Exception& ex) {
+    LOGERROR("Exception in WriteBehindListener for region %s: %s: %s",
+             m_fullPath.c_str(), ex.getName().c_str(), ex.what());
+  } catch (...) {
+    LOGERROR("Unknown exception in WriteBehindListener for region %s",
+             m_fullPath.c_str());
+  }
+  return err;
+}
+
 void ThinClientRegion::destroyDM(bool keepEndpoints) {
   if (m_tcrdm != nullptr) {
     m_tcrdm->destroy(keepEndpoints);
@@ -2905,9 +3122,13 @@ void ThinClientRegion::release(bool invokeCallbacks) {
     return;
   }
 
-  std::unique_lock<std::mutex> lock(m_notificationMutex, std::defer_lock);
+  if (m_writeBehind) {
+    m_writeBehind->close();
+  }
+
+  NotificationGuard lock(m_notificationLock);
   if (!m_notifyRelease) {
-    lock.lock();
+    lock.acquire(true);
   }
 
   destroyDM(invokeCallbacks);
@@ -3379,6 +3600,17 @@ void ChunkedKeySetResponse::handleChunk(const uint8_t* chunk, int32_t chunkLen,
 void ChunkedQueryResponse::reset() {
   m_queryResults->clear();
   m_structFieldNames.clear();
+  if (m_columnarBuilder) {
+    m_columnarBuilder->reset();
+  }
+}
+
+void ChunkedQueryResponse::readValue(DataInput& input) {
+  if (m_columnarBuilder) {
+    m_columnarBuilder->readCell(input);
+  } else {
+    m_queryResults->push_back(input.readObject());
+  }
 }
 
 void ChunkedQueryResponse::readObjectPartList(DataInput& input,
@@ -3397,9 +3629,7 @@ void ChunkedQueryResponse::readObjectPartList(DataInput& input,
       throw IllegalStateException(exMsgPtr);
     } else {
       if (isResultSet) {
-        std::shared_ptr<Cacheable> value;
-        input.readObject(value);
-        m_queryResults->push_back(value);
+        readValue(input);
       } else {
         auto code = static_cast<DSCode>(input.read());
         if (code == DSCode::FixedIDByte) {
@@ -3434,6 +3664,20 @@ void ChunkedQueryResponse::handleChunk(const uint8_t* chunk, int32_t chunkLen,
                                        uint8_t isLastChunkWithSecurity,
                                        const CacheImpl* cacheImpl) {
   LOGDEBUG("ChunkedQueryResponse::handleChunk..");
+  readChunk(chunk, chunkLen, isLastChunkWithSecurity, cacheImpl);
+
+  if (m_chunkHandler && !m_queryResults->empty()) {
+    // the handler may retain the results so start a fresh vector rather than
+    // clearing this one
+    auto results = std::move(m_queryResults);
+    m_queryResults = CacheableVector::create();
+    m_chunkHandler(results, m_structFieldNames);
+  }
+}
+
+void ChunkedQueryResponse::readChunk(const uint8_t* chunk, int32_t chunkLen,
+                                     uint8_t isLastChunkWithSecurity,
+                                     const CacheImpl* cacheImpl) {
   auto input = cacheImpl->createDataInput(chunk, chunkLen, m_msg.getPool());
 
   uint32_t partLen;
@@ -3450,7 +3694,11 @@ void ChunkedQueryResponse::handleChunk(const uint8_t* chunk, int32_t chunkLen,
     input.readInt32();  // ignored part length
     input.read();       // ignored is object
     auto intVal = std::dynamic_pointer_cast<CacheableInt32>(input.readObject());
-    m_queryResults->push_back(intVal);
+    if (m_columnarBuilder) {
+      m_columnarBuilder->addCell(intVal);
+    } else {
+      m_queryResults->push_back(intVal);
+    }
     m_msg.readSecureObjectPart(input, false, true, isLastChunkWithSecurity);
     return;
   }
@@ -3503,6 +3751,9 @@ void ChunkedQueryResponse::handleChunk(const uint8_t* chunk, int32_t chunkLen,
   }
 
   bool isResultSet = (m_structFieldNames.size() == 0);
+  if (m_columnarBuilder) {
+    m_columnarBuilder->setFieldNames(m_structFieldNames);
+  }
 
   auto arrayType = static_cast<DSCode>(input.read());
 
@@ -3510,17 +3761,14 @@ void ChunkedQueryResponse::handleChunk(const uint8_t* chunk, int32_t chunkLen,
     int32_t arraySize = input.readArrayLength();
     skipClass(input);
     for (int32_t arrayItem = 0; arrayItem < arraySize; ++arrayItem) {
-      std::shared_ptr<Serializable> value;
       if (isResultSet) {
-        input.readObject(value);
-        m_queryResults->push_back(value);
+        readValue(input);
       } else {
         input.read();
         int32_t arraySize2 = input.readArrayLength();
         skipClass(input);
         for (int32_t index = 0; index < arraySize2; ++index) {
-          input.readObject(value);
-          m_queryResults->push_back(value);
+          readValue(input);
         }
       }
     }
@@ -3598,6 +3846,16 @@ void ChunkedFunctionExecutionResponse::handleChunk(
     return;
   }
 
+  auto streaming = dynamic_cast<StreamingResultCollector*>(m_rc.get());
+  if (streaming && streaming->isCancelled()) {
+    // drain the chunk without deserializing the result nobody will take;
+    // reading on keeps the connection usable for the next operation
+    input.reset();
+    input.advanceCursor(partLen + 5);
+    m_msg.readSecureObjectPart(input, false, true, isLastChunkWithSecurity);
+    return;
+  }
+
   auto startLen = static_cast<size_t>(
       input.getBytesRead() -
       1);  // from here need to look value part + memberid AND -1 for array type
@@ -3720,13 +3978,24 @@ void ChunkedGetAllResponse::handleChunk(const uint8_t* chunk, int32_t chunkLen,
     return;
   }
 
+  // when streaming, collect only this chunk's values and hand them off
+  // immediately rather than growing the shared result map
+  auto values = m_entryHandler ? std::make_shared<HashMapOfCacheable>()
+                               : m_values;
   VersionedCacheableObjectPartList objectList(
-      m_keys, &m_keysOffset, m_values, m_exceptions, m_resultKeys, m_region,
+      m_keys, &m_keysOffset, values, m_exceptions, m_resultKeys, m_region,
       &m_trackerMap, m_destroyTracker, m_addToLocalCache, m_dsmemId,
       m_responseLock);
 
   objectList.fromData(input);
 
+  if (m_entryHandler) {
+    std::lock_guard<decltype(m_responseLock)> guard(m_responseLock);
+    for (const auto& entry : *values) {
+      m_entryHandler(entry.first, entry.second);
+    }
+  }
+
   m_msg.readSecureObjectPart(input, false, true, isLastChunkWithSecurity);
 }
 
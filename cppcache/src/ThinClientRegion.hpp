@@ -20,6 +20,7 @@
 #ifndef GEODE_THINCLIENTREGION_H_
 #define GEODE_THINCLIENTREGION_H_
 
+#include <functional>
 #include <mutex>
 #include <unordered_map>
 
@@ -33,11 +34,13 @@
 #include "RegionGlobalLocks.hpp"
 #include "TcrChunkedContext.hpp"
 #include "TcrMessage.hpp"
+#include "WriteBehindQueue.hpp"
 
 namespace apache {
 namespace geode {
 namespace client {
 
+class ColumnarResultsBuilder;
 class ThinClientBaseDM;
 class TcrEndpoint;
 
@@ -99,6 +102,8 @@ class APACHE_GEODE_EXPORT ThinClientRegion : public LocalRegion {
       std::chrono::milliseconds timeout =
           DEFAULT_QUERY_RESPONSE_TIMEOUT) override;
 
+  void flush() override;
+
   /** @brief Public Methods from RegionInternal
    *  These are all virtual methods
    */
@@ -191,6 +196,20 @@ class APACHE_GEODE_EXPORT ThinClientRegion : public LocalRegion {
              const std::shared_ptr<Serializable>& callBack,
              std::shared_ptr<VersionTag> versionTag) override;
 
+  /**
+   * Returns value as it is sent to the server, compressed if the region has
+   * a compressor.
+   */
+  std::shared_ptr<Cacheable> compressForServer(
+      const std::shared_ptr<Cacheable>& value) const;
+
+  /**
+   * Returns a value received from the server, decompressed if it was
+   * compressed by the region's compressor.
+   */
+  std::shared_ptr<Cacheable> decompressFromServer(
+      const std::shared_ptr<Cacheable>& value) const;
+
  protected:
   GfErrType getNoThrow_remote(
       const std::shared_ptr<CacheableKey>& keyPtr,
@@ -232,6 +251,11 @@ class APACHE_GEODE_EXPORT ThinClientRegion : public LocalRegion {
           resultKeys,
       bool addToLocalCache,
       const std::shared_ptr<Serializable>& aCallbackArgument) override;
+  GfErrType getAllStreamingNoThrow_remote(
+      const std::vector<std::shared_ptr<CacheableKey>>* keys,
+      const std::shared_ptr<HashMapOfException>& exceptions,
+      const GetAllEntryHandler& handler,
+      const std::shared_ptr<Serializable>& aCallbackArgument) override;
   GfErrType destroyRegionNoThrow_remote(
       const std::shared_ptr<Serializable>& aCallbackArgument) override;
   GfErrType registerKeysNoThrow(
@@ -293,7 +317,9 @@ class APACHE_GEODE_EXPORT ThinClientRegion : public LocalRegion {
       m_durableInterestListRegexForUpdatesAsInvalidates;
 
   bool m_notifyRelease;
-  std::mutex m_notificationMutex;
+  // shared by key events so they can be applied in parallel; exclusive for
+  // markers, region wide events and release
+  ACE_RW_Thread_Mutex m_notificationLock;
 
   bool m_isDurableClnt;
 
@@ -330,6 +356,7 @@ class APACHE_GEODE_EXPORT ThinClientRegion : public LocalRegion {
   GfErrType getNoThrow_FullObject(
       std::shared_ptr<EventId> eventId, std::shared_ptr<Cacheable>& fullObject,
       std::shared_ptr<VersionTag>& versionTag) override;
+  GfErrType handleGetAllReply(TcrMessageReply& reply);
 
   GfErrType singleHopPutAllNoThrow_remote(
       ThinClientPoolDM* tcrdm, const HashMapOfCacheable& map,
@@ -355,6 +382,22 @@ class APACHE_GEODE_EXPORT ThinClientRegion : public LocalRegion {
   ACE_RW_Thread_Mutex m_RegionMutex;
   bool m_isMetaDataRefreshed;
 
+  // queued puts when write-behind is enabled, otherwise null
+  std::unique_ptr<WriteBehindQueue> m_writeBehind;
+
+  void flushWriteBehind();
+  GfErrType writeBehindBatch(const HashMapOfCacheable& batch);
+  GfErrType sendPutAllNoThrow_remote(
+      const HashMapOfCacheable& map,
+      std::shared_ptr<VersionedCacheableObjectPartList>& versionedObjPartList,
+      std::chrono::milliseconds timeout,
+      const std::shared_ptr<Serializable>& aCallbackArgument);
+  GfErrType dispatchPutAllNoThrow_remote(
+      const HashMapOfCacheable& map,
+      std::shared_ptr<VersionedCacheableObjectPartList>& versionedObjPartList,
+      std::chrono::milliseconds timeout,
+      const std::shared_ptr<Serializable>& aCallbackArgument);
+
   typedef std::unordered_map<
       std::shared_ptr<BucketServerLocation>, std::shared_ptr<Serializable>,
       dereference_hash<std::shared_ptr<BucketServerLocation>>,
@@ -412,12 +455,22 @@ class ChunkedInterestResponse : public TcrChunkedResult {
  *
  */
 class ChunkedQueryResponse : public TcrChunkedResult {
+ public:
+  typedef std::function<void(const std::shared_ptr<CacheableVector>&,
+                             const std::vector<std::string>&)>
+      ChunkHandler;
+
  private:
   TcrMessage& m_msg;
   std::shared_ptr<CacheableVector> m_queryResults;
   std::vector<std::string> m_structFieldNames;
+  ChunkHandler m_chunkHandler;
+  ColumnarResultsBuilder* m_columnarBuilder;
 
   void skipClass(DataInput& input);
+  void readValue(DataInput& input);
+  void readChunk(const uint8_t* chunk, int32_t chunkLen,
+                 uint8_t isLastChunkWithSecurity, const CacheImpl* cacheImpl);
 
   // disabled
   ChunkedQueryResponse(const ChunkedQueryResponse&);
@@ -427,7 +480,8 @@ class ChunkedQueryResponse : public TcrChunkedResult {
   inline explicit ChunkedQueryResponse(TcrMessage& msg)
       : TcrChunkedResult(),
         m_msg(msg),
-        m_queryResults(CacheableVector::create()) {}
+        m_queryResults(CacheableVector::create()),
+        m_columnarBuilder(nullptr) {}
 
   inline const std::shared_ptr<CacheableVector>& getQueryResults() const {
     return m_queryResults;
@@ -437,6 +491,22 @@ class ChunkedQueryResponse : public TcrChunkedResult {
     return m_structFieldNames;
   }
 
+  /**
+   * When set, the results decoded from each chunk are handed to the handler
+   * and released instead of being accumulated across the whole response.
+   */
+  inline void setChunkHandler(ChunkHandler handler) {
+    m_chunkHandler = std::move(handler);
+  }
+
+  /**
+   * When set, values are decoded directly into the builder's columns and
+   * getQueryResults stays empty.
+   */
+  inline void setColumnarBuilder(ColumnarResultsBuilder* builder) {
+    m_columnarBuilder = builder;
+  }
+
   virtual void handleChunk(const uint8_t* chunk, int32_t chunkLen,
                            uint8_t isLastChunkWithSecurity,
                            const CacheImpl* cacheImpl);
@@ -513,6 +583,7 @@ class ChunkedGetAllResponse : public TcrChunkedResult {
   bool m_addToLocalCache;
   uint32_t m_keysOffset;
   std::recursive_mutex& m_responseLock;
+  Region::GetAllEntryHandler m_entryHandler;
   // disabled
   ChunkedGetAllResponse(const ChunkedGetAllResponse&);
   ChunkedGetAllResponse& operator=(const ChunkedGetAllResponse&);
@@ -554,6 +625,17 @@ class ChunkedGetAllResponse : public TcrChunkedResult {
   }
   MapOfUpdateCounters& getUpdateCounters() { return m_trackerMap; }
   std::recursive_mutex& getResponseLock() { return m_responseLock; }
+
+  /**
+   * When set, the entries of each chunk are handed to the handler as soon as
+   * the chunk is processed instead of being accumulated into the values map.
+   */
+  void setEntryHandler(const Region::GetAllEntryHandler& handler) {
+    m_entryHandler = handler;
+  }
+  const Region::GetAllEntryHandler& getEntryHandler() const {
+    return m_entryHandler;
+  }
 };
 
 /**
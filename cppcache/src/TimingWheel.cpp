@@ -0,0 +1,306 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "TimingWheel.hpp"
+
+#include <algorithm>
+
+#include <ace/OS_NS_sys_time.h>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+constexpr size_t TimingWheel::LEVELS;
+constexpr size_t TimingWheel::SLOT_BITS;
+constexpr size_t TimingWheel::SLOTS;
+constexpr uint64_t TimingWheel::SLOT_MASK;
+
+TimingWheel::TimingWheel(std::chrono::milliseconds tick)
+    : m_tick(std::max(clock::duration(tick), clock::duration(1))),
+      m_start(clock::now()),
+      m_stopped(false),
+      m_currentTick(0),
+      m_nextId(0) {
+  for (auto& level : m_slots) {
+    level.fill(nullptr);
+  }
+}
+
+TimingWheel::~TimingWheel() {
+  for (auto& entry : m_tasks) {
+    if (!entry.second->dontCallHandleClose) {
+      entry.second->handler->handle_close(ACE_INVALID_HANDLE,
+                                          ACE_Event_Handler::TIMER_MASK);
+    }
+  }
+}
+
+TimingWheel::id_type TimingWheel::schedule(ACE_Event_Handler* handler,
+                                           clock::duration delay,
+                                           clock::duration interval) {
+  std::unique_ptr<Task> task(new Task());
+  task->handler = handler;
+  task->interval = interval;
+
+  std::lock_guard<std::mutex> guard(m_mutex);
+  task->id = ++m_nextId;
+  task->deadline = std::max(tickAt(clock::now()) + ticksFor(delay),
+                            m_currentTick + 1);
+  link(task.get());
+  const auto id = task->id;
+  m_tasks.emplace(id, std::move(task));
+  return id;
+}
+
+int TimingWheel::reset(id_type id, clock::duration interval) {
+  std::lock_guard<std::mutex> guard(m_mutex);
+  const auto found = m_tasks.find(id);
+  if (found == m_tasks.end() || found->second->cancelled) {
+    return -1;
+  }
+  found->second->interval = interval;
+  return 0;
+}
+
+int TimingWheel::cancel(id_type id, bool dontCallHandleClose) {
+  ACE_Event_Handler* handler = nullptr;
+  {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    const auto found = m_tasks.find(id);
+    if (found == m_tasks.end() || found->second->cancelled) {
+      return 0;
+    }
+    auto task = found->second.get();
+    if (task->firing) {
+      // expire() finishes the task once the handler returns
+      task->cancelled = true;
+      task->dontCallHandleClose = dontCallHandleClose;
+      return 1;
+    }
+    unlink(task);
+    handler = task->handler;
+    m_tasks.erase(found);
+  }
+  if (!dontCallHandleClose) {
+    handler->handle_close(ACE_INVALID_HANDLE, ACE_Event_Handler::TIMER_MASK);
+  }
+  return 1;
+}
+
+int TimingWheel::cancel(ACE_Event_Handler* handler, bool dontCallHandleClose) {
+  int cancelled = 0;
+  {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    for (auto entry = m_tasks.begin(); entry != m_tasks.end();) {
+      auto task = entry->second.get();
+      if (task->handler != handler || task->cancelled) {
+        ++entry;
+      } else if (task->firing) {
+        task->cancelled = true;
+        task->dontCallHandleClose = true;
+        ++cancelled;
+        ++entry;
+      } else {
+        unlink(task);
+        entry = m_tasks.erase(entry);
+        ++cancelled;
+      }
+    }
+  }
+  if (cancelled > 0 && !dontCallHandleClose) {
+    handler->handle_close(ACE_INVALID_HANDLE, ACE_Event_Handler::TIMER_MASK);
+  }
+  return cancelled;
+}
+
+size_t TimingWheel::expire(clock::time_point now) {
+  std::vector<Task*> due;
+  {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    const auto target = tickAt(now);
+    while (m_currentTick < target) {
+      ++m_currentTick;
+
+      // refill lower levels from every level whose range just wrapped
+      size_t top = 0;
+      while (top + 1 < LEVELS &&
+             (m_currentTick &
+              ((uint64_t(1) << (SLOT_BITS * (top + 1))) - 1)) == 0) {
+        ++top;
+      }
+      for (size_t level = top; level > 0; --level) {
+        cascade(level);
+      }
+
+      auto& head = m_slots[0][m_currentTick & SLOT_MASK];
+      while (auto task = head) {
+        unlink(task);
+        if (task->deadline <= m_currentTick) {
+          task->firing = true;
+          due.push_back(task);
+        } else {
+          link(task);
+        }
+      }
+    }
+  }
+
+  if (due.empty()) {
+    return 0;
+  }
+
+  const auto currentTime = ACE_OS::gettimeofday();
+  for (auto task : due) {
+    task->handler->handle_timeout(currentTime, nullptr);
+  }
+
+  // reschedule after the upcalls so an interval reset from within
+  // handle_timeout() takes effect immediately
+  std::vector<ACE_Event_Handler*> finished;
+  std::vector<ACE_Event_Handler*> closed;
+  {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    for (auto task : due) {
+      task->firing = false;
+      if (task->cancelled) {
+        if (!task->dontCallHandleClose) {
+          closed.push_back(task->handler);
+        }
+        m_tasks.erase(task->id);
+      } else if (task->interval > clock::duration::zero()) {
+        task->deadline =
+            m_currentTick + std::max(ticksFor(task->interval), uint64_t(1));
+        link(task);
+      } else {
+        finished.push_back(task->handler);
+        m_tasks.erase(task->id);
+      }
+    }
+  }
+  for (auto handler : closed) {
+    handler->handle_close(ACE_INVALID_HANDLE, ACE_Event_Handler::TIMER_MASK);
+  }
+  for (auto handler : finished) {
+    delete handler;
+  }
+  return due.size();
+}
+
+void TimingWheel::run() {
+  std::unique_lock<std::mutex> lock(m_mutex);
+  while (!m_stopped) {
+    const auto nextTick =
+        m_start + m_tick * static_cast<clock::rep>(m_currentTick + 1);
+    if (m_condition.wait_until(lock, nextTick, [this] { return m_stopped; })) {
+      break;
+    }
+    lock.unlock();
+    expire(clock::now());
+    lock.lock();
+  }
+}
+
+void TimingWheel::stop() {
+  std::lock_guard<std::mutex> guard(m_mutex);
+  m_stopped = true;
+  m_condition.notify_all();
+}
+
+size_t TimingWheel::size() const {
+  std::lock_guard<std::mutex> guard(m_mutex);
+  return m_tasks.size();
+}
+
+uint64_t TimingWheel::ticksFor(clock::duration duration) const {
+  if (duration <= clock::duration::zero()) {
+    return 0;
+  }
+  return static_cast<uint64_t>((duration + m_tick - clock::duration(1)) /
+                               m_tick);
+}
+
+uint64_t TimingWheel::tickAt(clock::time_point time) const {
+  if (time <= m_start) {
+    return 0;
+  }
+  return static_cast<uint64_t>((time - m_start) / m_tick);
+}
+
+void TimingWheel::link(Task* task) {
+  const auto delta =
+      task->deadline > m_currentTick ? task->deadline - m_currentTick : 0;
+
+  size_t level = 0;
+  while (level + 1 < LEVELS &&
+         delta >= (uint64_t(1) << (SLOT_BITS * (level + 1)))) {
+    ++level;
+  }
+
+  // deadlines beyond the top level's range park in its furthest slot and
+  // are placed again when that slot cascades
+  const auto range = uint64_t(1) << (SLOT_BITS * LEVELS);
+  const auto placement =
+      delta < range ? std::max(task->deadline, m_currentTick)
+                    : m_currentTick + range - 1;
+
+  task->level = static_cast<uint8_t>(level);
+  task->slot =
+      static_cast<uint8_t>((placement >> (SLOT_BITS * level)) & SLOT_MASK);
+
+  auto& head = m_slots[task->level][task->slot];
+  task->prev = nullptr;
+  task->next = head;
+  if (head) {
+    head->prev = task;
+  }
+  head = task;
+  task->linked = true;
+}
+
+void TimingWheel::unlink(Task* task) {
+  if (!task->linked) {
+    return;
+  }
+  if (task->prev) {
+    task->prev->next = task->next;
+  } else {
+    m_slots[task->level][task->slot] = task->next;
+  }
+  if (task->next) {
+    task->next->prev = task->prev;
+  }
+  task->prev = task->next = nullptr;
+  task->linked = false;
+}
+
+void TimingWheel::cascade(size_t level) {
+  auto& head =
+      m_slots[level][(m_currentTick >> (SLOT_BITS * level)) & SLOT_MASK];
+  auto task = head;
+  head = nullptr;
+  while (task) {
+    auto next = task->next;
+    task->linked = false;
+    link(task);
+    task = next;
+  }
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
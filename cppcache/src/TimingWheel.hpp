@@ -0,0 +1,156 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_TIMINGWHEEL_H_
+#define GEODE_TIMINGWHEEL_H_
+
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <ace/Event_Handler.h>
+
+#include <geode/internal/geode_globals.hpp>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * @class TimingWheel TimingWheel.hpp
+ *
+ * Hierarchical timing wheel for expiry tasks. Time advances in fixed ticks
+ * and every task lives in a bucket selected by its deadline, so scheduling,
+ * resetting and cancelling are constant time regardless of how many tasks
+ * are pending. All tasks due on a tick are collected under one lock
+ * acquisition and their handlers are invoked outside the lock.
+ *
+ * Handlers see the same contract as with ExpiryTaskManager's timer heap:
+ * handle_timeout() is called when a task is due, a task with a non-zero
+ * interval is rescheduled afterwards (so resetting the interval from within
+ * handle_timeout() takes effect immediately), a finished one-shot task has
+ * its handler deleted, and cancel() calls handle_close() on the handler.
+ * Deadlines are rounded up to a whole tick.
+ */
+class APACHE_GEODE_EXPORT TimingWheel {
+ public:
+  typedef long id_type;
+  typedef std::chrono::steady_clock clock;
+
+  explicit TimingWheel(std::chrono::milliseconds tick);
+
+  /**
+   * Calls handle_close() on the handlers of all tasks still pending.
+   */
+  ~TimingWheel();
+
+  TimingWheel(const TimingWheel&) = delete;
+  TimingWheel& operator=(const TimingWheel&) = delete;
+
+  /**
+   * Schedule handler to be invoked after delay and, if interval is non-zero,
+   * every interval after that. Returns the id of the task.
+   */
+  id_type schedule(ACE_Event_Handler* handler, clock::duration delay,
+                   clock::duration interval);
+
+  /**
+   * Set the interval of a task. Returns 0 if successful, -1 if no such task.
+   */
+  int reset(id_type id, clock::duration interval);
+
+  /**
+   * Cancel a task, calling handle_close() on its handler unless
+   * dontCallHandleClose is set. Returns 1 if a task was cancelled, 0
+   * otherwise.
+   */
+  int cancel(id_type id, bool dontCallHandleClose = false);
+
+  /**
+   * Cancel every task scheduled for handler. Returns the number of tasks
+   * cancelled.
+   */
+  int cancel(ACE_Event_Handler* handler, bool dontCallHandleClose = true);
+
+  /**
+   * Advance the wheel to now and fire every task due by then. Returns the
+   * number of handlers invoked.
+   */
+  size_t expire(clock::time_point now);
+
+  /**
+   * Runs expire() once per tick until stop() is called.
+   */
+  void run();
+
+  void stop();
+
+  size_t size() const;
+
+ private:
+  struct Task {
+    id_type id;
+    ACE_Event_Handler* handler;
+    uint64_t deadline;
+    clock::duration interval;
+    Task* prev;
+    Task* next;
+    uint8_t level;
+    uint8_t slot;
+    bool linked;
+    bool firing;
+    bool cancelled;
+    bool dontCallHandleClose;
+  };
+
+  static constexpr size_t LEVELS = 4;
+  static constexpr size_t SLOT_BITS = 8;
+  static constexpr size_t SLOTS = 1 << SLOT_BITS;
+  static constexpr uint64_t SLOT_MASK = SLOTS - 1;
+
+  uint64_t ticksFor(clock::duration duration) const;
+  uint64_t tickAt(clock::time_point time) const;
+
+  void link(Task* task);
+  void unlink(Task* task);
+  void cascade(size_t level);
+
+  const clock::duration m_tick;
+  const clock::time_point m_start;
+
+  mutable std::mutex m_mutex;
+  std::condition_variable m_condition;
+  bool m_stopped;
+
+  uint64_t m_currentTick;
+  id_type m_nextId;
+  std::unordered_map<id_type, std::unique_ptr<Task>> m_tasks;
+  std::array<std::array<Task*, SLOTS>, LEVELS> m_slots;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_TIMINGWHEEL_H_
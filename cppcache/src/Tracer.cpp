@@ -0,0 +1,259 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "Tracer.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <geode/ExceptionTypes.hpp>
+
+#include "DistributedSystemImpl.hpp"
+#include "util/Log.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+namespace {
+
+// splitmix64; cheap enough to run on every sampling decision and seeded per
+// thread so that threads never contend for it.
+uint64_t nextRandom() {
+  static thread_local uint64_t state =
+      (static_cast<uint64_t>(std::random_device{}()) << 32) ^
+      std::random_device{}() ^
+      std::hash<std::thread::id>{}(std::this_thread::get_id());
+  uint64_t z = (state += 0x9e3779b97f4a7c15ULL);
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+  return z ^ (z >> 31);
+}
+
+uint64_t toThreshold(double sampleRate) {
+  if (sampleRate <= 0.0) {
+    return 0;
+  }
+  if (sampleRate >= 1.0) {
+    return std::numeric_limits<uint64_t>::max();
+  }
+  return static_cast<uint64_t>(sampleRate * 18446744073709551616.0);
+}
+
+}  // namespace
+
+thread_local TraceContext Tracer::s_current;
+
+Tracer::Tracer(double sampleRate, size_t bufferSize,
+               std::chrono::milliseconds exportInterval,
+               std::shared_ptr<TraceExporter> exporter)
+    : m_threshold(toThreshold(sampleRate)),
+      m_sampleAll(sampleRate >= 1.0),
+      m_bufferSize(std::max<size_t>(bufferSize, 1)),
+      m_exportInterval(exportInterval),
+      m_exporter(std::move(exporter)),
+      m_dropped(0),
+      m_droppedReported(0),
+      m_stopped(false) {
+  if (!m_exporter) {
+    throw IllegalArgumentException("Tracer: an exporter is required");
+  }
+  m_thread = std::thread([this] { run(); });
+  LOGFINE("Tracer started with sample rate %f", sampleRate);
+}
+
+Tracer::~Tracer() noexcept { stop(); }
+
+bool Tracer::sample() {
+  return m_sampleAll || (m_threshold != 0 && nextRandom() < m_threshold);
+}
+
+uint64_t Tracer::nextId() {
+  uint64_t id;
+  do {
+    id = nextRandom();
+  } while (id == 0);
+  return id;
+}
+
+void Tracer::record(TraceSpan&& span) {
+  {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    if (m_stopped) {
+      return;
+    }
+    if (m_buffer.size() >= m_bufferSize) {
+      m_buffer.pop_front();
+      ++m_dropped;
+    }
+    m_buffer.push_back(std::move(span));
+    if (m_buffer.size() * 2 < m_bufferSize) {
+      return;
+    }
+  }
+  m_cond.notify_one();
+}
+
+void Tracer::stop() {
+  {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    if (m_stopped) {
+      return;
+    }
+    m_stopped = true;
+  }
+  m_cond.notify_one();
+  if (m_thread.joinable()) {
+    m_thread.join();
+  }
+
+  try {
+    m_exporter->shutdown();
+  } catch (const std::exception& ex) {
+    LOGWARN("Tracer: exporter failed to shut down: %s", ex.what());
+  } catch (...) {
+    LOGWARN("Tracer: exporter failed to shut down");
+  }
+}
+
+void Tracer::run() {
+  DistributedSystemImpl::setThreadName("NC Tracer");
+  std::unique_lock<std::mutex> lock(m_mutex);
+  for (;;) {
+    m_cond.wait_for(lock, m_exportInterval, [this] {
+      return m_stopped ||
+             (!m_buffer.empty() && m_buffer.size() * 2 >= m_bufferSize);
+    });
+    // nothing is buffered after stop, so this batch is the last one
+    auto stopped = m_stopped;
+    exportBatch(lock);
+    if (stopped) {
+      return;
+    }
+  }
+}
+
+void Tracer::exportBatch(std::unique_lock<std::mutex>& lock) {
+  if (m_buffer.empty()) {
+    return;
+  }
+  std::vector<TraceSpan> batch(std::make_move_iterator(m_buffer.begin()),
+                               std::make_move_iterator(m_buffer.end()));
+  m_buffer.clear();
+  lock.unlock();
+
+  size_t dropped = m_dropped;
+  if (dropped != m_droppedReported) {
+    LOGWARN("Tracer: dropped %zu spans because the exporter fell behind",
+            dropped - m_droppedReported);
+    m_droppedReported = dropped;
+  }
+
+  try {
+    m_exporter->exportSpans(batch);
+  } catch (const std::exception& ex) {
+    LOGWARN("Tracer: exporter failed: %s", ex.what());
+  } catch (...) {
+    LOGWARN("Tracer: exporter failed");
+  }
+
+  lock.lock();
+}
+
+TraceScope::TraceScope(Tracer* tracer, const char* name) : m_tracer(nullptr) {
+  const auto& current = Tracer::s_current;
+  if (current.isSampled()) {
+    start(current, name);
+  } else if (tracer != nullptr && tracer->sample()) {
+    TraceContext root;
+    root.tracer = tracer;
+    root.traceIdHigh = Tracer::nextId();
+    root.traceIdLow = Tracer::nextId();
+    start(root, name);
+  }
+}
+
+TraceScope::TraceScope(const char* name) : m_tracer(nullptr) {
+  const auto& current = Tracer::s_current;
+  if (current.isSampled()) {
+    start(current, name);
+  }
+}
+
+TraceScope::TraceScope(const TraceContext& parent, const char* name)
+    : m_tracer(nullptr) {
+  if (parent.isSampled()) {
+    start(parent, name);
+  }
+}
+
+TraceScope::~TraceScope() noexcept { end(); }
+
+void TraceScope::end() noexcept {
+  if (!m_span) {
+    return;
+  }
+  m_span->duration = std::chrono::steady_clock::now() - m_start;
+  Tracer::s_current = m_previous;
+  try {
+    m_tracer->record(std::move(*m_span));
+  } catch (...) {
+    // a span is not worth failing the operation for
+  }
+  m_span.reset();
+}
+
+void TraceScope::setAttribute(const char* key, const std::string& value) {
+  if (m_span) {
+    m_span->attributes.emplace_back(key, value);
+  }
+}
+
+void TraceScope::setError() {
+  if (m_span) {
+    m_span->error = true;
+  }
+}
+
+void TraceScope::start(const TraceContext& parent, const char* name) {
+  m_tracer = parent.tracer;
+  m_previous = Tracer::s_current;
+
+  m_span = std::unique_ptr<TraceSpan>(new TraceSpan());
+  m_span->traceIdHigh = parent.traceIdHigh;
+  m_span->traceIdLow = parent.traceIdLow;
+  m_span->spanId = Tracer::nextId();
+  m_span->parentSpanId = parent.spanId;
+  m_span->name = name;
+  m_span->start = std::chrono::system_clock::now();
+  m_start = std::chrono::steady_clock::now();
+
+  auto& current = Tracer::s_current;
+  current.tracer = m_tracer;
+  current.traceIdHigh = parent.traceIdHigh;
+  current.traceIdLow = parent.traceIdLow;
+  current.spanId = m_span->spanId;
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
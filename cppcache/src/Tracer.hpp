@@ -0,0 +1,177 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#ifndef GEODE_TRACER_H_
+#define GEODE_TRACER_H_
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include <geode/TraceExporter.hpp>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+class Tracer;
+
+/**
+ * Identifies the span a thread is currently working in. A context without a
+ * tracer belongs to an operation that was not sampled.
+ */
+struct TraceContext {
+  Tracer* tracer = nullptr;
+  uint64_t traceIdHigh = 0;
+  uint64_t traceIdLow = 0;
+  uint64_t spanId = 0;
+
+  bool isSampled() const { return tracer != nullptr; }
+};
+
+/**
+ * @class Tracer Tracer.hpp
+ *
+ * Decides which operations are traced and collects the spans they record.
+ * Finished spans are kept in a bounded buffer, dropping the oldest when it
+ * is full, and handed to the exporter in batches on a thread of the
+ * tracer's own.
+ */
+class Tracer {
+ public:
+  Tracer(double sampleRate, size_t bufferSize,
+         std::chrono::milliseconds exportInterval,
+         std::shared_ptr<TraceExporter> exporter);
+  ~Tracer() noexcept;
+
+  Tracer(const Tracer&) = delete;
+  Tracer& operator=(const Tracer&) = delete;
+
+  /**
+   * Returns true if a new operation should be traced.
+   */
+  bool sample();
+
+  /**
+   * Returns a random, non-zero span or trace id.
+   */
+  static uint64_t nextId();
+
+  void record(TraceSpan&& span);
+
+  /**
+   * Exports the buffered spans, shuts the exporter down and stops the export
+   * thread. Spans recorded afterwards are discarded.
+   */
+  void stop();
+
+  size_t getDroppedCount() const { return m_dropped; }
+
+  /**
+   * Returns the span the calling thread is working in.
+   */
+  static const TraceContext& current() { return s_current; }
+
+ private:
+  void run();
+  void exportBatch(std::unique_lock<std::mutex>& lock);
+
+  static thread_local TraceContext s_current;
+
+  const uint64_t m_threshold;
+  const bool m_sampleAll;
+  const size_t m_bufferSize;
+  const std::chrono::milliseconds m_exportInterval;
+  std::shared_ptr<TraceExporter> m_exporter;
+
+  std::mutex m_mutex;
+  std::condition_variable m_cond;
+  std::deque<TraceSpan> m_buffer;
+  std::atomic<size_t> m_dropped;
+  size_t m_droppedReported;
+  bool m_stopped;
+  std::thread m_thread;
+
+  friend class TraceScope;
+};
+
+/**
+ * @class TraceScope Tracer.hpp
+ *
+ * Records one span from construction to destruction and makes it the
+ * calling thread's current span meanwhile, so that scopes opened further
+ * down the call stack become its children. Nothing is allocated or timed
+ * unless the operation is sampled.
+ */
+class TraceScope {
+ public:
+  /**
+   * Starts a child of the thread's current span, or the root span of a new
+   * trace if there is none and the tracer samples the operation.
+   */
+  TraceScope(Tracer* tracer, const char* name);
+
+  /**
+   * Starts a child of the thread's current span, if there is one.
+   */
+  explicit TraceScope(const char* name);
+
+  /**
+   * Starts a child of a span handed over from another thread.
+   */
+  TraceScope(const TraceContext& parent, const char* name);
+
+  ~TraceScope() noexcept;
+
+  TraceScope(const TraceScope&) = delete;
+  TraceScope& operator=(const TraceScope&) = delete;
+
+  bool isRecording() const { return m_span != nullptr; }
+
+  /**
+   * Finishes the span before the scope is left, for phases that end in the
+   * middle of a block.
+   */
+  void end() noexcept;
+
+  void setAttribute(const char* key, const std::string& value);
+
+  void setError();
+
+ private:
+  void start(const TraceContext& parent, const char* name);
+
+  std::unique_ptr<TraceSpan> m_span;
+  Tracer* m_tracer;
+  TraceContext m_previous;
+  std::chrono::steady_clock::time_point m_start;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_TRACER_H_
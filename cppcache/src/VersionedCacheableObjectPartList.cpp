@@ -59,29 +59,13 @@ void VersionedCacheableObjectPartList::readObjectPart(
     }
     m_exceptions->emplace(keyPtr, ex);
   } else if (m_serializeValues) {
-    // read length
-    int32_t skipLen = input.readArrayLength();
-    int8_t* bytes = nullptr;
-    if (skipLen > 0) {
-      // readObject
-      bytes = new int8_t[skipLen];
-      input.readBytesOnly(bytes, skipLen);
-    }
-    m_values->emplace(keyPtr, CacheableBytes::create(
-                                  std::vector<int8_t>(bytes, bytes + skipLen)));
-
-    /* adongre
-     * CID 29377: Resource leak (RESOURCE_LEAK)Calling allocation function
-     * "apache::geode::client::DataInput::readBytes(unsigned char **, int *)" on
-     * "bytes".
-     */
-    _GEODE_SAFE_DELETE_ARRAY(bytes);
-
+    m_values->emplace(keyPtr, CacheableBytes::create(input.readByteArray()));
   } else {
     // set nullptr to indicate that there is no exception for the key on this
     // index
     // readObject
     input.readObject(value);
+    if (m_region) value = m_region->decompressFromServer(value);
     if (m_values) m_values->emplace(keyPtr, value);
   }
 }
@@ -0,0 +1,131 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "WriteBehindQueue.hpp"
+
+#include "DistributedSystemImpl.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+WriteBehindQueue::WriteBehindQueue(uint32_t batchSize,
+                                   std::chrono::milliseconds interval,
+                                   Writer writer)
+    : m_batchSize(batchSize > 0 ? batchSize : 1),
+      m_interval(interval),
+      m_writer(std::move(writer)),
+      m_appDomainContext(createAppDomainContext()),
+      m_pending(std::make_shared<HashMapOfCacheable>()),
+      m_closed(false) {
+  if (m_interval > std::chrono::milliseconds::zero()) {
+    m_thread = std::thread([this] {
+      if (m_appDomainContext) {
+        m_appDomainContext->run([this] { run(); });
+      } else {
+        run();
+      }
+    });
+  }
+}
+
+WriteBehindQueue::~WriteBehindQueue() noexcept { close(); }
+
+void WriteBehindQueue::put(const std::shared_ptr<CacheableKey>& key,
+                           const std::shared_ptr<Cacheable>& value) {
+  bool first;
+  bool full;
+  {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    first = m_pending->empty();
+    if (first) {
+      m_oldest = std::chrono::steady_clock::now();
+    }
+    (*m_pending)[key] = value;
+    full = m_closed || m_pending->size() >= m_batchSize;
+  }
+  if (full) {
+    flush();
+  } else if (first) {
+    m_wakeup.notify_one();
+  }
+}
+
+bool WriteBehindQueue::contains(
+    const std::shared_ptr<CacheableKey>& key) const {
+  std::lock_guard<std::mutex> guard(m_mutex);
+  return m_pending->find(key) != m_pending->end() ||
+         (m_writing && m_writing->find(key) != m_writing->end());
+}
+
+size_t WriteBehindQueue::size() const {
+  std::lock_guard<std::mutex> guard(m_mutex);
+  return m_pending->size();
+}
+
+GfErrType WriteBehindQueue::flush() {
+  std::lock_guard<std::mutex> writeGuard(m_writeMutex);
+  std::shared_ptr<HashMapOfCacheable> batch;
+  {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    if (m_pending->empty()) {
+      return GF_NOERR;
+    }
+    batch = std::move(m_pending);
+    m_pending = std::make_shared<HashMapOfCacheable>();
+    m_writing = batch;
+  }
+  auto err = m_writer(*batch);
+  std::lock_guard<std::mutex> guard(m_mutex);
+  m_writing = nullptr;
+  return err;
+}
+
+void WriteBehindQueue::close() {
+  {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    m_closed = true;
+  }
+  m_wakeup.notify_all();
+  if (m_thread.joinable()) {
+    m_thread.join();
+  }
+  flush();
+}
+
+void WriteBehindQueue::run() {
+  DistributedSystemImpl::setThreadName("NC WriteBehind");
+  std::unique_lock<std::mutex> lock(m_mutex);
+  while (!m_closed) {
+    if (m_pending->empty()) {
+      m_wakeup.wait_for(lock, m_interval);
+      continue;
+    }
+    auto due = m_oldest + m_interval;
+    if (std::chrono::steady_clock::now() < due) {
+      m_wakeup.wait_until(lock, due);
+      continue;
+    }
+    lock.unlock();
+    flush();
+    lock.lock();
+  }
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
@@ -0,0 +1,118 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_WRITEBEHINDQUEUE_H_
+#define GEODE_WRITEBEHINDQUEUE_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include <geode/CacheableBuiltins.hpp>
+
+#include "AppDomainContext.hpp"
+#include "ErrType.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * @class WriteBehindQueue WriteBehindQueue.hpp
+ *
+ * Holds back puts for a region in write-behind mode. A put replaces any
+ * queued value for the same key; the queued values are handed to the writer
+ * as one batch once batchSize keys are queued, once the oldest queued put
+ * is interval old, or on flush(). Batches are written one at a time in the
+ * order they were taken from the queue.
+ */
+class WriteBehindQueue {
+ public:
+  typedef std::function<GfErrType(const HashMapOfCacheable& batch)> Writer;
+
+  /**
+   * @param interval the longest time a put is held back; zero writes
+   * batches only when full or flushed.
+   */
+  WriteBehindQueue(uint32_t batchSize, std::chrono::milliseconds interval,
+                   Writer writer);
+
+  /**
+   * Writes anything still queued, then stops the timer thread.
+   */
+  ~WriteBehindQueue() noexcept;
+
+  WriteBehindQueue(const WriteBehindQueue&) = delete;
+  WriteBehindQueue& operator=(const WriteBehindQueue&) = delete;
+
+  /**
+   * Queues a put. Writes the batch in the calling thread when it is full.
+   */
+  void put(const std::shared_ptr<CacheableKey>& key,
+           const std::shared_ptr<Cacheable>& value);
+
+  /**
+   * True if a put for key is queued or in the batch being written, that is
+   * if the server may not have the key's latest value yet.
+   */
+  bool contains(const std::shared_ptr<CacheableKey>& key) const;
+
+  size_t size() const;
+
+  /**
+   * Writes all queued puts in the calling thread, waiting for a batch being
+   * written by another thread first.
+   *
+   * @return the writer's result, GF_NOERR if nothing was queued.
+   */
+  GfErrType flush();
+
+  /**
+   * Writes anything still queued and stops the timer thread. Later puts are
+   * written immediately.
+   */
+  void close();
+
+ private:
+  void run();
+
+  const uint32_t m_batchSize;
+  const std::chrono::milliseconds m_interval;
+  const Writer m_writer;
+  std::unique_ptr<AppDomainContext> m_appDomainContext;
+  std::shared_ptr<HashMapOfCacheable> m_pending;
+  // the batch the writer is sending, if any
+  std::shared_ptr<HashMapOfCacheable> m_writing;
+  std::chrono::steady_clock::time_point m_oldest;
+  bool m_closed;
+  mutable std::mutex m_mutex;
+  std::condition_variable m_wakeup;
+  // held while a batch is written so batches reach the server in order
+  std::mutex m_writeMutex;
+  std::thread m_thread;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_WRITEBEHINDQUEUE_H_
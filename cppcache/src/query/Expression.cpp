@@ -0,0 +1,636 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Expression.hpp"
+
+#include <cctype>
+#include <cmath>
+#include <functional>
+#include <limits>
+
+#include <geode/CacheableDate.hpp>
+#include <geode/ExceptionTypes.hpp>
+#include <geode/PdxInstance.hpp>
+#include <geode/Struct.hpp>
+#include <geode/internal/DataSerializablePrimitive.hpp>
+
+namespace apache {
+namespace geode {
+namespace client {
+namespace query {
+
+using internal::DataSerializablePrimitive;
+using internal::DSCode;
+
+namespace {
+
+template <class T>
+const T& as(const DataSerializablePrimitive& primitive) {
+  return dynamic_cast<const T&>(primitive);
+}
+
+int typeRank(Value::Type type) {
+  switch (type) {
+    case Value::Type::Undefined:
+      return 0;
+    case Value::Type::Null:
+      return 1;
+    case Value::Type::Boolean:
+      return 2;
+    case Value::Type::Integer:
+    case Value::Type::Double:
+      return 3;
+    case Value::Type::String:
+      return 4;
+    case Value::Type::Entry:
+      return 5;
+    case Value::Type::Object:
+      return 6;
+  }
+  return 7;
+}
+
+Value arithmetic(Operator op, const Value& left, const Value& right) {
+  if (op == Operator::Add &&
+      (left.type() == Value::Type::String ||
+       right.type() == Value::Type::String)) {
+    if (left.type() == Value::Type::String &&
+        right.type() == Value::Type::String) {
+      return Value::of(left.string() + right.string());
+    }
+    return Value();
+  }
+  if (!left.isNumeric() || !right.isNumeric()) {
+    return Value();
+  }
+  if (left.type() == Value::Type::Integer &&
+      right.type() == Value::Type::Integer) {
+    auto l = left.integer();
+    auto r = right.integer();
+    switch (op) {
+      case Operator::Add:
+        return Value::of(l + r);
+      case Operator::Subtract:
+        return Value::of(l - r);
+      case Operator::Multiply:
+        return Value::of(l * r);
+      case Operator::Divide:
+        if (r == 0) {
+          throw QueryException("Division by zero in query");
+        }
+        return Value::of(l / r);
+      case Operator::Modulo:
+        if (r == 0) {
+          throw QueryException("Division by zero in query");
+        }
+        return Value::of(l % r);
+      default:
+        return Value();
+    }
+  }
+  auto l = left.number();
+  auto r = right.number();
+  switch (op) {
+    case Operator::Add:
+      return Value::of(l + r);
+    case Operator::Subtract:
+      return Value::of(l - r);
+    case Operator::Multiply:
+      return Value::of(l * r);
+    case Operator::Divide:
+      return Value::of(l / r);
+    case Operator::Modulo:
+      return Value::of(std::fmod(l, r));
+    default:
+      return Value();
+  }
+}
+
+std::string getterField(const std::string& method) {
+  if (method.size() > 3 && method.compare(0, 3, "get") == 0) {
+    auto field = method.substr(3);
+    field[0] = static_cast<char>(
+        std::tolower(static_cast<unsigned char>(field[0])));
+    return field;
+  }
+  return method;
+}
+
+}  // namespace
+
+Value::Value()
+    : type_(Type::Undefined),
+      boolean_(false),
+      integer_(0),
+      double_(0),
+      str_(nullptr) {}
+
+Value Value::null() {
+  Value value;
+  value.type_ = Type::Null;
+  return value;
+}
+
+Value Value::of(bool boolean) {
+  Value value;
+  value.type_ = Type::Boolean;
+  value.boolean_ = boolean;
+  return value;
+}
+
+Value Value::of(int64_t integer) {
+  Value value;
+  value.type_ = Type::Integer;
+  value.integer_ = integer;
+  return value;
+}
+
+Value Value::of(double number) {
+  Value value;
+  value.type_ = Type::Double;
+  value.double_ = number;
+  return value;
+}
+
+Value Value::of(std::string string) {
+  Value value;
+  value.type_ = Type::String;
+  value.string_ = std::move(string);
+  return value;
+}
+
+Value Value::entry(const std::shared_ptr<CacheableKey>& key,
+                   const std::shared_ptr<Serializable>& object) {
+  Value value;
+  value.type_ = Type::Entry;
+  value.key_ = key;
+  value.object_ = object;
+  return value;
+}
+
+Value Value::from(const std::shared_ptr<Serializable>& object) {
+  if (!object) {
+    return null();
+  }
+
+  Value value;
+  value.object_ = object;
+  value.type_ = Type::Object;
+
+  auto primitive = dynamic_cast<const DataSerializablePrimitive*>(object.get());
+  if (!primitive) {
+    return value;
+  }
+
+  switch (primitive->getDsCode()) {
+    case DSCode::CacheableBoolean:
+      value.type_ = Type::Boolean;
+      value.boolean_ = as<CacheableBoolean>(*primitive).value();
+      break;
+    case DSCode::CacheableByte:
+      value.type_ = Type::Integer;
+      value.integer_ = as<CacheableByte>(*primitive).value();
+      break;
+    case DSCode::CacheableInt16:
+      value.type_ = Type::Integer;
+      value.integer_ = as<CacheableInt16>(*primitive).value();
+      break;
+    case DSCode::CacheableInt32:
+      value.type_ = Type::Integer;
+      value.integer_ = as<CacheableInt32>(*primitive).value();
+      break;
+    case DSCode::CacheableInt64:
+      value.type_ = Type::Integer;
+      value.integer_ = as<CacheableInt64>(*primitive).value();
+      break;
+    case DSCode::CacheableFloat:
+      value.type_ = Type::Double;
+      value.double_ = as<CacheableFloat>(*primitive).value();
+      break;
+    case DSCode::CacheableDouble:
+      value.type_ = Type::Double;
+      value.double_ = as<CacheableDouble>(*primitive).value();
+      break;
+    case DSCode::CacheableDate:
+      value.type_ = Type::Integer;
+      value.integer_ = as<CacheableDate>(*primitive).milliseconds();
+      break;
+    case DSCode::CacheableString:
+    case DSCode::CacheableASCIIString:
+    case DSCode::CacheableASCIIStringHuge:
+    case DSCode::CacheableStringHuge:
+      value.type_ = Type::String;
+      value.str_ = &as<CacheableString>(*primitive);
+      break;
+    default:
+      break;
+  }
+  return value;
+}
+
+std::shared_ptr<Serializable> Value::toSerializable() const {
+  if (object_) {
+    return object_;
+  }
+  switch (type_) {
+    case Type::Boolean:
+      return CacheableBoolean::create(boolean_);
+    case Type::Integer:
+      if (integer_ >= std::numeric_limits<int32_t>::min() &&
+          integer_ <= std::numeric_limits<int32_t>::max()) {
+        return CacheableInt32::create(static_cast<int32_t>(integer_));
+      }
+      return CacheableInt64::create(integer_);
+    case Type::Double:
+      return CacheableDouble::create(double_);
+    case Type::String:
+      return CacheableString::create(string_);
+    default:
+      return nullptr;
+  }
+}
+
+void Value::toKeys(std::vector<std::shared_ptr<CacheableKey>>& keys) const {
+  switch (type_) {
+    case Type::Integer:
+    case Type::Double:
+      break;
+    case Type::Undefined:
+    case Type::Null:
+    case Type::Entry:
+      return;
+    default:
+      if (auto key = std::dynamic_pointer_cast<CacheableKey>(toSerializable())) {
+        keys.push_back(key);
+      }
+      return;
+  }
+
+  auto value = number();
+  if (type_ == Type::Integer || (std::isfinite(value) &&
+                                 value == std::trunc(value) &&
+                                 value >= -9223372036854775808.0 &&
+                                 value < 9223372036854775808.0)) {
+    auto integer =
+        type_ == Type::Integer ? integer_ : static_cast<int64_t>(value);
+    if (integer >= std::numeric_limits<int8_t>::min() &&
+        integer <= std::numeric_limits<int8_t>::max()) {
+      keys.push_back(CacheableByte::create(static_cast<int8_t>(integer)));
+    }
+    if (integer >= std::numeric_limits<int16_t>::min() &&
+        integer <= std::numeric_limits<int16_t>::max()) {
+      keys.push_back(CacheableInt16::create(static_cast<int16_t>(integer)));
+    }
+    if (integer >= std::numeric_limits<int32_t>::min() &&
+        integer <= std::numeric_limits<int32_t>::max()) {
+      keys.push_back(CacheableInt32::create(static_cast<int32_t>(integer)));
+    }
+    keys.push_back(CacheableInt64::create(integer));
+    keys.push_back(CacheableDate::create(CacheableDate::duration(integer)));
+    if (static_cast<int64_t>(static_cast<double>(integer)) != integer) {
+      return;
+    }
+    value = static_cast<double>(integer);
+  }
+  if (static_cast<double>(static_cast<float>(value)) == value) {
+    keys.push_back(CacheableFloat::create(static_cast<float>(value)));
+  }
+  keys.push_back(CacheableDouble::create(value));
+}
+
+bool Value::equals(const Value& other) const {
+  if (isNumeric() && other.isNumeric()) {
+    if (type_ == Type::Integer && other.type_ == Type::Integer) {
+      return integer_ == other.integer_;
+    }
+    return number() == other.number();
+  }
+  if (type_ != other.type_) {
+    return false;
+  }
+  switch (type_) {
+    case Type::Undefined:
+    case Type::Null:
+      return true;
+    case Type::Boolean:
+      return boolean_ == other.boolean_;
+    case Type::String:
+      return string() == other.string();
+    case Type::Entry:
+      return key_ && other.key_ && *key_ == *other.key_;
+    case Type::Object: {
+      if (object_ == other.object_) {
+        return true;
+      }
+      auto key = dynamic_cast<const CacheableKey*>(object_.get());
+      auto otherKey = dynamic_cast<const CacheableKey*>(other.object_.get());
+      return key && otherKey && *key == *otherKey;
+    }
+    default:
+      return false;
+  }
+}
+
+int Value::compare(const Value& other, bool& comparable) const {
+  comparable = true;
+  if (isNumeric() && other.isNumeric()) {
+    if (type_ == Type::Integer && other.type_ == Type::Integer) {
+      return integer_ < other.integer_ ? -1 : integer_ > other.integer_ ? 1 : 0;
+    }
+    auto l = number();
+    auto r = other.number();
+    if (std::isnan(l) || std::isnan(r)) {
+      comparable = false;
+      return 0;
+    }
+    return l < r ? -1 : l > r ? 1 : 0;
+  }
+  if (type_ == Type::String && other.type_ == Type::String) {
+    return string().compare(other.string());
+  }
+  if (type_ == Type::Boolean && other.type_ == Type::Boolean) {
+    return static_cast<int>(boolean_) - static_cast<int>(other.boolean_);
+  }
+  comparable = false;
+  return 0;
+}
+
+int Value::sortCompare(const Value& other) const {
+  bool comparable;
+  auto result = compare(other, comparable);
+  if (comparable) {
+    return result;
+  }
+  auto rank = typeRank(type_);
+  auto otherRank = typeRank(other.type_);
+  if (rank != otherRank) {
+    return rank < otherRank ? -1 : 1;
+  }
+  return 0;
+}
+
+size_t Value::hash() const {
+  switch (type_) {
+    case Type::Boolean:
+      return std::hash<bool>()(boolean_);
+    case Type::Integer:
+      return std::hash<double>()(static_cast<double>(integer_));
+    case Type::Double:
+      return std::hash<double>()(double_);
+    case Type::String:
+      return std::hash<std::string>()(string());
+    case Type::Entry:
+      return key_ ? static_cast<size_t>(key_->hashcode()) : 0;
+    case Type::Object: {
+      auto key = dynamic_cast<const CacheableKey*>(object_.get());
+      return key ? static_cast<size_t>(key->hashcode())
+                 : std::hash<const void*>()(object_.get());
+    }
+    default:
+      return static_cast<size_t>(type_);
+  }
+}
+
+Value LiteralExpression::evaluate(const Context&) const { return value_; }
+
+Value ParameterExpression::evaluate(const Context& context) const {
+  if (!context.parameters || index_ < 1 ||
+      index_ > context.parameters->size()) {
+    throw QueryException("Query parameter $" + std::to_string(index_) +
+                         " is not bound");
+  }
+  return Value::from((*context.parameters)[index_ - 1]);
+}
+
+Value IdentifierExpression::evaluate(const Context& context) const {
+  if (name_ == context.alias || name_ == "this") {
+    return context.current;
+  }
+  return FieldExpression::field(context.current, name_, false);
+}
+
+Value FieldExpression::evaluate(const Context& context) const {
+  return field(target_->evaluate(context), name_, isMethod_);
+}
+
+Value FieldExpression::field(const Value& target, const std::string& name,
+                             bool isMethod) {
+  if (target.isUndefined() || target.isNull()) {
+    return Value();
+  }
+
+  if (isMethod && name == "toString") {
+    if (target.type() == Value::Type::String) {
+      return target;
+    }
+    auto object = target.toSerializable();
+    return object ? Value::of(object->toString()) : Value();
+  }
+  auto fieldName = isMethod ? getterField(name) : name;
+
+  if (target.type() == Value::Type::Entry) {
+    if (fieldName == "key") {
+      return Value::from(target.key());
+    } else if (fieldName == "value") {
+      return Value::from(target.object());
+    }
+    return Value();
+  }
+
+  if (target.type() != Value::Type::Object) {
+    return Value();
+  }
+
+  if (auto pdx = std::dynamic_pointer_cast<PdxInstance>(target.object())) {
+    if (pdx->hasField(fieldName)) {
+      return Value::from(pdx->getCacheableField(fieldName));
+    }
+  } else if (auto st = std::dynamic_pointer_cast<Struct>(target.object())) {
+    for (int32_t i = 0; i < st->size(); i++) {
+      if (st->getFieldName(i) == fieldName) {
+        return Value::from((*st)[i]);
+      }
+    }
+  }
+  return Value();
+}
+
+bool fieldPath(const Expression& expression, const std::string& alias,
+               std::vector<std::string>& path) {
+  if (auto identifier =
+          dynamic_cast<const IdentifierExpression*>(&expression)) {
+    if (identifier->name() != alias && identifier->name() != "this") {
+      path.push_back(identifier->name());
+    }
+    return true;
+  }
+  if (auto field = dynamic_cast<const FieldExpression*>(&expression)) {
+    if (field->isMethod() && field->name() == "toString") {
+      return false;
+    }
+    if (!fieldPath(field->target(), alias, path)) {
+      return false;
+    }
+    path.push_back(field->isMethod() ? getterField(field->name())
+                                     : field->name());
+    return true;
+  }
+  return false;
+}
+
+Value UnaryExpression::evaluate(const Context& context) const {
+  auto value = operand_->evaluate(context);
+  if (op_ == Operator::Not) {
+    if (value.type() != Value::Type::Boolean) {
+      return Value();
+    }
+    return Value::of(!value.boolean());
+  }
+  if (value.type() == Value::Type::Integer) {
+    return Value::of(-value.integer());
+  } else if (value.type() == Value::Type::Double) {
+    return Value::of(-value.number());
+  }
+  return Value();
+}
+
+Value BinaryExpression::evaluate(const Context& context) const {
+  if (op_ == Operator::And || op_ == Operator::Or) {
+    auto left = left_->evaluate(context);
+    bool shortCircuit = op_ == Operator::And ? left.isFalse() : left.isTrue();
+    if (shortCircuit) {
+      return left;
+    }
+    auto right = right_->evaluate(context);
+    if (op_ == Operator::And ? right.isFalse() : right.isTrue()) {
+      return right;
+    }
+    if (left.type() == Value::Type::Boolean &&
+        right.type() == Value::Type::Boolean) {
+      return Value::of(op_ == Operator::And);
+    }
+    return Value();
+  }
+
+  auto left = left_->evaluate(context);
+  auto right = right_->evaluate(context);
+
+  switch (op_) {
+    case Operator::Equal:
+    case Operator::NotEqual: {
+      if (left.isUndefined() || right.isUndefined()) {
+        return Value();
+      }
+      auto equal = left.equals(right);
+      return Value::of(op_ == Operator::Equal ? equal : !equal);
+    }
+    case Operator::Less:
+    case Operator::LessEqual:
+    case Operator::Greater:
+    case Operator::GreaterEqual: {
+      bool comparable;
+      auto result = left.compare(right, comparable);
+      if (!comparable) {
+        return Value();
+      }
+      switch (op_) {
+        case Operator::Less:
+          return Value::of(result < 0);
+        case Operator::LessEqual:
+          return Value::of(result <= 0);
+        case Operator::Greater:
+          return Value::of(result > 0);
+        default:
+          return Value::of(result >= 0);
+      }
+    }
+    case Operator::Like:
+      if (left.type() != Value::Type::String ||
+          right.type() != Value::Type::String) {
+        return Value();
+      }
+      return Value::of(like(left.string(), right.string()));
+    default:
+      return arithmetic(op_, left, right);
+  }
+}
+
+bool BinaryExpression::like(const std::string& value,
+                            const std::string& pattern) {
+  // Iterative wildcard match: '%' matches any run, '_' any one character and
+  // '\' escapes the next pattern character.
+  size_t v = 0;
+  size_t p = 0;
+  size_t starP = std::string::npos;
+  size_t starV = 0;
+  while (v < value.size()) {
+    if (p < pattern.size() && pattern[p] == '%') {
+      starP = ++p;
+      starV = v;
+      continue;
+    }
+    if (p < pattern.size()) {
+      auto c = pattern[p];
+      size_t width = 1;
+      if (c == '\\' && p + 1 < pattern.size()) {
+        c = pattern[p + 1];
+        width = 2;
+      } else if (c == '_') {
+        p++;
+        v++;
+        continue;
+      }
+      if (c == value[v]) {
+        p += width;
+        v++;
+        continue;
+      }
+    }
+    if (starP == std::string::npos) {
+      return false;
+    }
+    p = starP;
+    v = ++starV;
+  }
+  while (p < pattern.size() && pattern[p] == '%') {
+    p++;
+  }
+  return p == pattern.size();
+}
+
+Value InExpression::evaluate(const Context& context) const {
+  auto value = value_->evaluate(context);
+  if (value.isUndefined()) {
+    return Value();
+  }
+  for (const auto& candidate : candidates_) {
+    if (value.equals(candidate->evaluate(context))) {
+      return Value::of(true);
+    }
+  }
+  return Value::of(false);
+}
+
+Value FunctionExpression::evaluate(const Context& context) const {
+  auto defined = !argument_->evaluate(context).isUndefined();
+  return Value::of(function_ == Function::IsDefined ? defined : !defined);
+}
+
+}  // namespace query
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
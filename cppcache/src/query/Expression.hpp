@@ -0,0 +1,309 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_QUERY_EXPRESSION_H_
+#define GEODE_QUERY_EXPRESSION_H_
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <geode/CacheableBuiltins.hpp>
+#include <geode/CacheableKey.hpp>
+#include <geode/CacheableString.hpp>
+#include <geode/Serializable.hpp>
+
+namespace apache {
+namespace geode {
+namespace client {
+namespace query {
+
+/**
+ * A value produced while evaluating a query. Values read from cached
+ * objects keep a reference to the object so projections return it as is.
+ */
+class Value {
+ public:
+  enum class Type {
+    Undefined,
+    Null,
+    Boolean,
+    Integer,
+    Double,
+    String,
+    Entry,
+    Object
+  };
+
+  Value();
+
+  static Value null();
+  static Value of(bool value);
+  static Value of(int64_t value);
+  static Value of(double value);
+  static Value of(std::string value);
+  static Value entry(const std::shared_ptr<CacheableKey>& key,
+                     const std::shared_ptr<Serializable>& value);
+  static Value from(const std::shared_ptr<Serializable>& object);
+
+  Type type() const { return type_; }
+  bool isUndefined() const { return type_ == Type::Undefined; }
+  bool isNull() const { return type_ == Type::Null; }
+  bool isTrue() const { return type_ == Type::Boolean && boolean_; }
+  bool isFalse() const { return type_ == Type::Boolean && !boolean_; }
+  bool isNumeric() const {
+    return type_ == Type::Integer || type_ == Type::Double;
+  }
+
+  bool boolean() const { return boolean_; }
+  int64_t integer() const { return integer_; }
+  double number() const {
+    return type_ == Type::Integer ? static_cast<double>(integer_) : double_;
+  }
+  const std::string& string() const {
+    return str_ ? str_->value() : string_;
+  }
+
+  /** The cached object this value was read from, if any. */
+  const std::shared_ptr<Serializable>& object() const { return object_; }
+
+  /** For entries, the entry's key; the value is object(). */
+  const std::shared_ptr<CacheableKey>& key() const { return key_; }
+
+  /** The value as it is returned in query results. */
+  std::shared_ptr<Serializable> toSerializable() const;
+
+  /**
+   * Appends every region key equal to this value. A number matches keys of
+   * each numeric type that holds it exactly, as comparing it with a key
+   * would, so several keys may be added.
+   */
+  void toKeys(std::vector<std::shared_ptr<CacheableKey>>& keys) const;
+
+  bool equals(const Value& other) const;
+
+  /**
+   * Orders this value against another. Returns false in comparable when the
+   * two cannot be ordered against each other.
+   */
+  int compare(const Value& other, bool& comparable) const;
+
+  /** Total order used for sorting: undefined and null first, then by type. */
+  int sortCompare(const Value& other) const;
+
+  size_t hash() const;
+
+ private:
+  Type type_;
+  bool boolean_;
+  int64_t integer_;
+  double double_;
+  std::string string_;
+  const CacheableString* str_;
+  std::shared_ptr<Serializable> object_;
+  std::shared_ptr<CacheableKey> key_;
+};
+
+/**
+ * State of one evaluation: the object the query is iterating over and the
+ * name it is bound to.
+ */
+struct Context {
+  const std::string& alias;
+  const Value& current;
+  const std::shared_ptr<CacheableVector>& parameters;
+};
+
+class Expression {
+ public:
+  virtual ~Expression() noexcept = default;
+
+  virtual Value evaluate(const Context& context) const = 0;
+
+  /** True when the value does not depend on the entry being evaluated. */
+  virtual bool isConstant() const { return false; }
+};
+
+class LiteralExpression : public Expression {
+ public:
+  explicit LiteralExpression(Value value) : value_(std::move(value)) {}
+
+  Value evaluate(const Context& context) const override;
+  bool isConstant() const override { return true; }
+
+ private:
+  Value value_;
+};
+
+class ParameterExpression : public Expression {
+ public:
+  explicit ParameterExpression(size_t index) : index_(index) {}
+
+  Value evaluate(const Context& context) const override;
+  bool isConstant() const override { return true; }
+
+ private:
+  size_t index_;
+};
+
+/**
+ * A bare name. Resolves to the iteration object when it is the iterator's
+ * alias or "this", otherwise to a field of the iteration object.
+ */
+class IdentifierExpression : public Expression {
+ public:
+  explicit IdentifierExpression(std::string name) : name_(std::move(name)) {}
+
+  Value evaluate(const Context& context) const override;
+
+  const std::string& name() const { return name_; }
+
+ private:
+  std::string name_;
+};
+
+/** target.name or target.name() */
+class FieldExpression : public Expression {
+ public:
+  FieldExpression(std::unique_ptr<Expression> target, std::string name,
+                  bool isMethod)
+      : target_(std::move(target)),
+        name_(std::move(name)),
+        isMethod_(isMethod) {}
+
+  Value evaluate(const Context& context) const override;
+
+  const Expression& target() const { return *target_; }
+  const std::string& name() const { return name_; }
+  bool isMethod() const { return isMethod_; }
+
+  /** Reads a field or getter of a value. */
+  static Value field(const Value& target, const std::string& name,
+                     bool isMethod);
+
+ private:
+  std::unique_ptr<Expression> target_;
+  std::string name_;
+  bool isMethod_;
+};
+
+/**
+ * Resolves an expression made only of field accesses on the iteration object
+ * into its field names, mapping getters such as getFoo() to foo. Returns
+ * false for any other expression.
+ */
+bool fieldPath(const Expression& expression, const std::string& alias,
+               std::vector<std::string>& path);
+
+enum class Operator {
+  And,
+  Or,
+  Not,
+  Equal,
+  NotEqual,
+  Less,
+  LessEqual,
+  Greater,
+  GreaterEqual,
+  Like,
+  Add,
+  Subtract,
+  Multiply,
+  Divide,
+  Modulo,
+  Negate
+};
+
+class UnaryExpression : public Expression {
+ public:
+  UnaryExpression(Operator op, std::unique_ptr<Expression> operand)
+      : op_(op), operand_(std::move(operand)) {}
+
+  Value evaluate(const Context& context) const override;
+  bool isConstant() const override { return operand_->isConstant(); }
+
+ private:
+  Operator op_;
+  std::unique_ptr<Expression> operand_;
+};
+
+class BinaryExpression : public Expression {
+ public:
+  BinaryExpression(Operator op, std::unique_ptr<Expression> left,
+                   std::unique_ptr<Expression> right)
+      : op_(op), left_(std::move(left)), right_(std::move(right)) {}
+
+  Value evaluate(const Context& context) const override;
+  bool isConstant() const override {
+    return left_->isConstant() && right_->isConstant();
+  }
+
+  Operator op() const { return op_; }
+  const Expression& left() const { return *left_; }
+  const Expression& right() const { return *right_; }
+
+  static bool like(const std::string& value, const std::string& pattern);
+
+ private:
+  Operator op_;
+  std::unique_ptr<Expression> left_;
+  std::unique_ptr<Expression> right_;
+};
+
+/** value IN SET(a, b, ...) */
+class InExpression : public Expression {
+ public:
+  InExpression(std::unique_ptr<Expression> value,
+               std::vector<std::unique_ptr<Expression>> candidates)
+      : value_(std::move(value)), candidates_(std::move(candidates)) {}
+
+  Value evaluate(const Context& context) const override;
+
+  const Expression& value() const { return *value_; }
+  const std::vector<std::unique_ptr<Expression>>& candidates() const {
+    return candidates_;
+  }
+
+ private:
+  std::unique_ptr<Expression> value_;
+  std::vector<std::unique_ptr<Expression>> candidates_;
+};
+
+/** IS_DEFINED(x), IS_UNDEFINED(x) */
+class FunctionExpression : public Expression {
+ public:
+  enum class Function { IsDefined, IsUndefined };
+
+  FunctionExpression(Function function, std::unique_ptr<Expression> argument)
+      : function_(function), argument_(std::move(argument)) {}
+
+  Value evaluate(const Context& context) const override;
+
+ private:
+  Function function_;
+  std::unique_ptr<Expression> argument_;
+};
+
+}  // namespace query
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_QUERY_EXPRESSION_H_
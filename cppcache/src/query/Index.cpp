@@ -0,0 +1,206 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Index.hpp"
+
+#include <cmath>
+
+#include <geode/ExceptionTypes.hpp>
+
+#include "../CacheableToken.hpp"
+#include "Parser.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+namespace query {
+
+Index::Index(std::string name, Type type, const std::string& indexedExpression,
+             const std::string& fromClause)
+    : name_(std::move(name)), type_(type) {
+  auto statement =
+      Parser("SELECT " + indexedExpression + " FROM " + fromClause).parse();
+  if (statement->projections.size() != 1 ||
+      statement->iteration != Iteration::Values || statement->where ||
+      !statement->orderBy.empty() || statement->limit >= 0 ||
+      statement->distinct) {
+    throw IllegalArgumentException("Index " + name_ +
+                                   ": expected a single indexed expression "
+                                   "over region values");
+  }
+
+  regionPath_ = statement->regionPath;
+  alias_ = statement->alias;
+  expression_ = std::move(statement->projections.front().expression);
+  if (!fieldPath(*expression_, alias_, path_) || path_.empty()) {
+    throw IllegalArgumentException(
+        "Index " + name_ + ": indexed expression " + indexedExpression +
+        " is not a field path");
+  }
+}
+
+Value Index::evaluate(const std::shared_ptr<Serializable>& value) const {
+  auto current = Value::from(value);
+  Context context{alias_, current, nullptr};
+  return expression_->evaluate(context);
+}
+
+void Index::update(const std::shared_ptr<CacheableKey>& key,
+                   const std::shared_ptr<Serializable>& value, bool ifAbsent,
+                   const std::function<bool()>& isCurrent) {
+  auto cacheable = std::dynamic_pointer_cast<Cacheable>(value);
+  if (cacheable && CacheableToken::isOverflowed(cacheable)) {
+    // The value was moved to disk but the entry still holds it.
+    return;
+  }
+  auto removed =
+      value == nullptr || (cacheable && CacheableToken::isToken(cacheable));
+  Value indexed;
+  if (!removed) {
+    indexed = evaluate(value);
+  }
+
+  std::lock_guard<decltype(mutex_)> guard(mutex_);
+  if (isCurrent && !isCurrent()) {
+    return;
+  }
+  auto previous = indexed_.find(key);
+  if (previous != indexed_.end()) {
+    if (ifAbsent && !removed) {
+      return;
+    }
+    erase(key, previous->second);
+    indexed_.erase(previous);
+  }
+  // UNDEFINED and NaN never satisfy a comparison, so they are not indexed.
+  if (!removed && !indexed.isUndefined() &&
+      !(indexed.type() == Value::Type::Double &&
+        std::isnan(indexed.number()))) {
+    insert(key, indexed);
+    indexed_.emplace(key, std::move(indexed));
+  }
+}
+
+void Index::remove(const std::shared_ptr<CacheableKey>& key) {
+  std::lock_guard<decltype(mutex_)> guard(mutex_);
+  auto previous = indexed_.find(key);
+  if (previous != indexed_.end()) {
+    erase(key, previous->second);
+    indexed_.erase(previous);
+  }
+}
+
+void Index::clear() {
+  std::lock_guard<decltype(mutex_)> guard(mutex_);
+  hashed_.clear();
+  sorted_.clear();
+  indexed_.clear();
+}
+
+size_t Index::size() const {
+  std::lock_guard<decltype(mutex_)> guard(mutex_);
+  return indexed_.size();
+}
+
+void Index::insert(const std::shared_ptr<CacheableKey>& key,
+                   const Value& value) {
+  if (type_ == Type::Hash) {
+    hashed_[value].insert(key);
+  } else {
+    sorted_[value].insert(key);
+  }
+}
+
+void Index::erase(const std::shared_ptr<CacheableKey>& key,
+                  const Value& value) {
+  if (type_ == Type::Hash) {
+    auto found = hashed_.find(value);
+    if (found != hashed_.end()) {
+      found->second.erase(key);
+      if (found->second.empty()) {
+        hashed_.erase(found);
+      }
+    }
+  } else {
+    auto found = sorted_.find(value);
+    if (found != sorted_.end()) {
+      found->second.erase(key);
+      if (found->second.empty()) {
+        sorted_.erase(found);
+      }
+    }
+  }
+}
+
+void Index::lookup(const Value& value, key_list& keys) const {
+  std::lock_guard<decltype(mutex_)> guard(mutex_);
+  const key_set* found = nullptr;
+  if (type_ == Type::Hash) {
+    auto iter = hashed_.find(value);
+    found = iter == hashed_.end() ? nullptr : &iter->second;
+  } else {
+    auto iter = sorted_.find(value);
+    found = iter == sorted_.end() ? nullptr : &iter->second;
+  }
+  if (found) {
+    keys.insert(keys.end(), found->begin(), found->end());
+  }
+}
+
+void Index::lookupRange(const Value* low, bool lowInclusive, const Value* high,
+                        bool highInclusive, key_list& keys) const {
+  if (type_ != Type::Sorted) {
+    throw IllegalStateException("Index " + name_ +
+                                " does not support range lookups");
+  }
+
+  std::lock_guard<decltype(mutex_)> guard(mutex_);
+  auto iter = low ? sorted_.lower_bound(*low) : sorted_.begin();
+  bool inRange = false;
+  for (; iter != sorted_.end(); ++iter) {
+    bool comparable;
+    if (low) {
+      auto result = iter->first.compare(*low, comparable);
+      if (!comparable) {
+        // Past the values that can be ordered against the bound.
+        break;
+      }
+      if (result == 0 && !lowInclusive) {
+        continue;
+      }
+    }
+    if (high) {
+      auto result = iter->first.compare(*high, comparable);
+      if (!comparable) {
+        if (low || inRange) {
+          break;
+        }
+        continue;
+      }
+      inRange = true;
+      if (result > 0 || (result == 0 && !highInclusive)) {
+        break;
+      }
+    }
+    keys.insert(keys.end(), iter->second.begin(), iter->second.end());
+  }
+}
+
+}  // namespace query
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
@@ -0,0 +1,152 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_QUERY_INDEX_H_
+#define GEODE_QUERY_INDEX_H_
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <geode/CacheableKey.hpp>
+#include <geode/internal/functional.hpp>
+
+#include "Expression.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+namespace query {
+
+/**
+ * Secondary index over a field path of the values of a region, mapping each
+ * indexed field value to the keys whose values hold it. Hash indexes answer
+ * equality lookups; sorted indexes also answer range lookups.
+ *
+ * Lookups return candidate keys only; callers re-evaluate the full predicate
+ * against the current value of each key.
+ */
+class Index {
+ public:
+  enum class Type { Hash, Sorted };
+
+  typedef std::vector<std::shared_ptr<CacheableKey>> key_list;
+
+  /**
+   * @param indexedExpression field path to index, e.g. "status" or
+   * "p.status"
+   * @param fromClause region the index covers, e.g. "/portfolios p"
+   * @throws QueryException if the expressions cannot be parsed
+   * @throws IllegalArgumentException if the indexed expression is not a
+   * field path over the region's values
+   */
+  Index(std::string name, Type type, const std::string& indexedExpression,
+        const std::string& fromClause);
+
+  Index(const Index&) = delete;
+  Index& operator=(const Index&) = delete;
+
+  const std::string& name() const { return name_; }
+  Type type() const { return type_; }
+  const std::string& regionPath() const { return regionPath_; }
+  const std::vector<std::string>& path() const { return path_; }
+
+  /**
+   * Re-indexes a key after its value changed. A nullptr value removes the
+   * key. When ifAbsent is set, keys already indexed are left untouched.
+   * When isCurrent is given it is called with the index locked, and the
+   * update is dropped if value is no longer the key's value, so updates
+   * racing for a key leave the index with the value the key keeps.
+   */
+  void update(const std::shared_ptr<CacheableKey>& key,
+              const std::shared_ptr<Serializable>& value,
+              bool ifAbsent = false,
+              const std::function<bool()>& isCurrent = nullptr);
+
+  void remove(const std::shared_ptr<CacheableKey>& key);
+
+  void clear();
+
+  /** Number of keys in the index. */
+  size_t size() const;
+
+  /** Appends the keys whose indexed value equals value. */
+  void lookup(const Value& value, key_list& keys) const;
+
+  /**
+   * Appends the keys whose indexed value lies between the given bounds; a
+   * nullptr bound is open. Only valid on sorted indexes.
+   */
+  void lookupRange(const Value* low, bool lowInclusive, const Value* high,
+                   bool highInclusive, key_list& keys) const;
+
+ private:
+  struct ValueHash {
+    size_t operator()(const Value& value) const { return value.hash(); }
+  };
+
+  struct ValueEqualTo {
+    bool operator()(const Value& lhs, const Value& rhs) const {
+      return lhs.equals(rhs);
+    }
+  };
+
+  struct ValueLess {
+    bool operator()(const Value& lhs, const Value& rhs) const {
+      return lhs.sortCompare(rhs) < 0;
+    }
+  };
+
+  typedef internal::dereference_hash<std::shared_ptr<CacheableKey>> key_hash;
+  typedef internal::dereference_equal_to<std::shared_ptr<CacheableKey>>
+      key_equal_to;
+  typedef std::unordered_set<std::shared_ptr<CacheableKey>, key_hash,
+                             key_equal_to>
+      key_set;
+
+  Value evaluate(const std::shared_ptr<Serializable>& value) const;
+  void insert(const std::shared_ptr<CacheableKey>& key, const Value& value);
+  void erase(const std::shared_ptr<CacheableKey>& key, const Value& value);
+
+  std::string name_;
+  Type type_;
+  std::string regionPath_;
+  std::string alias_;
+  std::vector<std::string> path_;
+  std::unique_ptr<Expression> expression_;
+
+  mutable std::mutex mutex_;
+  std::unordered_map<Value, key_set, ValueHash, ValueEqualTo> hashed_;
+  std::map<Value, key_set, ValueLess> sorted_;
+  std::unordered_map<std::shared_ptr<CacheableKey>, Value, key_hash,
+                     key_equal_to>
+      indexed_;
+};
+
+}  // namespace query
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_QUERY_INDEX_H_
@@ -0,0 +1,85 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "IndexManager.hpp"
+
+#include <geode/ExceptionTypes.hpp>
+
+namespace apache {
+namespace geode {
+namespace client {
+namespace query {
+
+IndexManager::IndexManager() : m_indexes(std::make_shared<index_list>()) {}
+
+void IndexManager::add(const std::shared_ptr<Index>& index) {
+  std::lock_guard<decltype(m_mutex)> guard(m_mutex);
+  auto current = indexes();
+  for (const auto& existing : *current) {
+    if (existing->name() == index->name()) {
+      throw IllegalArgumentException("Index " + index->name() +
+                                     " already exists");
+    }
+  }
+  auto updated = std::make_shared<index_list>(*current);
+  updated->push_back(index);
+  std::atomic_store(&m_indexes,
+                    std::shared_ptr<const index_list>(std::move(updated)));
+}
+
+bool IndexManager::remove(const std::string& name) {
+  std::lock_guard<decltype(m_mutex)> guard(m_mutex);
+  auto updated = std::make_shared<index_list>(*indexes());
+  for (auto iter = updated->begin(); iter != updated->end(); ++iter) {
+    if ((*iter)->name() == name) {
+      updated->erase(iter);
+      std::atomic_store(&m_indexes,
+                        std::shared_ptr<const index_list>(std::move(updated)));
+      return true;
+    }
+  }
+  return false;
+}
+
+std::shared_ptr<const Index> IndexManager::find(
+    const std::vector<std::string>& path, bool sorted) const {
+  std::shared_ptr<const Index> found;
+  for (const auto& index : *indexes()) {
+    if (index->path() != path) {
+      continue;
+    }
+    if (index->type() == Index::Type::Hash) {
+      if (!sorted) {
+        return index;
+      }
+    } else if (!found) {
+      found = index;
+    }
+  }
+  return found;
+}
+
+void IndexManager::clear() {
+  for (const auto& index : *indexes()) {
+    index->clear();
+  }
+}
+
+}  // namespace query
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
@@ -0,0 +1,92 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_QUERY_INDEXMANAGER_H_
+#define GEODE_QUERY_INDEXMANAGER_H_
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "Index.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+namespace query {
+
+/**
+ * The indexes of one region. Region updates are applied to every index
+ * without locking the index list, which is replaced on add and remove.
+ */
+class IndexManager {
+ public:
+  typedef std::vector<std::shared_ptr<Index>> index_list;
+
+  IndexManager();
+
+  IndexManager(const IndexManager&) = delete;
+  IndexManager& operator=(const IndexManager&) = delete;
+
+  /** @throws IllegalArgumentException if the name is already in use */
+  void add(const std::shared_ptr<Index>& index);
+
+  bool remove(const std::string& name);
+
+  /**
+   * Finds an index over the given field path, preferring a hash index unless
+   * a sorted one is required.
+   */
+  std::shared_ptr<const Index> find(const std::vector<std::string>& path,
+                                    bool sorted) const;
+
+  std::shared_ptr<const index_list> indexes() const {
+    return std::atomic_load(&m_indexes);
+  }
+
+  bool empty() const { return indexes()->empty(); }
+
+  /**
+   * Applies a changed value, or a removal when value is nullptr, to each
+   * index that isCurrent still holds it for; see Index::update.
+   */
+  void update(const std::shared_ptr<CacheableKey>& key,
+              const std::shared_ptr<Serializable>& value,
+              const std::function<bool()>& isCurrent = nullptr) {
+    auto indexes = this->indexes();
+    for (const auto& index : *indexes) {
+      index->update(key, value, false, isCurrent);
+    }
+  }
+
+  void clear();
+
+ private:
+  std::mutex m_mutex;
+  std::shared_ptr<const index_list> m_indexes;
+};
+
+}  // namespace query
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_QUERY_INDEXMANAGER_H_
@@ -0,0 +1,579 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Parser.hpp"
+
+#include <cctype>
+#include <cstring>
+
+#include <geode/ExceptionTypes.hpp>
+
+namespace apache {
+namespace geode {
+namespace client {
+namespace query {
+
+namespace {
+
+const char* const kReserved[] = {
+    "select",    "distinct", "from",   "where", "and",   "or",
+    "not",       "order",    "by",     "asc",   "desc",  "limit",
+    "as",        "in",       "like",   "true",  "false", "null",
+    "undefined", "set",      "import"};
+
+bool equalsIgnoreCase(const std::string& text, const char* keyword) {
+  auto length = std::strlen(keyword);
+  if (text.size() != length) {
+    return false;
+  }
+  for (size_t i = 0; i < length; i++) {
+    if (std::tolower(static_cast<unsigned char>(text[i])) != keyword[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool isReserved(const std::string& text) {
+  for (auto keyword : kReserved) {
+    if (equalsIgnoreCase(text, keyword)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool isIdentifierStart(char c) {
+  return std::isalpha(static_cast<unsigned char>(c)) || c == '_';
+}
+
+bool isIdentifierPart(char c) {
+  return std::isalnum(static_cast<unsigned char>(c)) || c == '_';
+}
+
+}  // namespace
+
+Parser::Parser(const std::string& queryString) : current_(0) {
+  tokenize(queryString);
+}
+
+void Parser::tokenize(const std::string& queryString) {
+  static const char* const symbols[] = {"<>", "!=", "<=", ">=", "(", ")",
+                                        ",",  ".",  "*",  "/",  "+", "-",
+                                        "%",  "=",  "<",  ">",  ":"};
+
+  size_t i = 0;
+  const auto length = queryString.size();
+  while (i < length) {
+    auto c = queryString[i];
+    if (std::isspace(static_cast<unsigned char>(c))) {
+      i++;
+      continue;
+    }
+
+    auto start = i;
+    if (isIdentifierStart(c)) {
+      while (i < length && isIdentifierPart(queryString[i])) {
+        i++;
+      }
+      tokens_.push_back({TokenType::Identifier,
+                         queryString.substr(start, i - start), start});
+    } else if (std::isdigit(static_cast<unsigned char>(c))) {
+      auto type = TokenType::Integer;
+      while (i < length &&
+             std::isdigit(static_cast<unsigned char>(queryString[i]))) {
+        i++;
+      }
+      if (i + 1 < length && queryString[i] == '.' &&
+          std::isdigit(static_cast<unsigned char>(queryString[i + 1]))) {
+        type = TokenType::Double;
+        i++;
+        while (i < length &&
+               std::isdigit(static_cast<unsigned char>(queryString[i]))) {
+          i++;
+        }
+      }
+      if (i < length && (queryString[i] == 'e' || queryString[i] == 'E')) {
+        type = TokenType::Double;
+        i++;
+        if (i < length && (queryString[i] == '+' || queryString[i] == '-')) {
+          i++;
+        }
+        while (i < length &&
+               std::isdigit(static_cast<unsigned char>(queryString[i]))) {
+          i++;
+        }
+      }
+      auto text = queryString.substr(start, i - start);
+      if (i < length) {
+        auto suffix = std::tolower(static_cast<unsigned char>(queryString[i]));
+        if (suffix == 'l' && type == TokenType::Integer) {
+          i++;
+        } else if (suffix == 'd' || suffix == 'f') {
+          type = TokenType::Double;
+          i++;
+        }
+      }
+      tokens_.push_back({type, text, start});
+    } else if (c == '\'') {
+      std::string text;
+      i++;
+      while (true) {
+        if (i >= length) {
+          throw QueryException("Unterminated string literal at position " +
+                               std::to_string(start) + " in query");
+        }
+        if (queryString[i] == '\'') {
+          if (i + 1 < length && queryString[i + 1] == '\'') {
+            text += '\'';
+            i += 2;
+            continue;
+          }
+          i++;
+          break;
+        }
+        text += queryString[i++];
+      }
+      tokens_.push_back({TokenType::String, text, start});
+    } else if (c == '$') {
+      i++;
+      while (i < length &&
+             std::isdigit(static_cast<unsigned char>(queryString[i]))) {
+        i++;
+      }
+      if (i == start + 1) {
+        throw QueryException("Expected parameter number at position " +
+                             std::to_string(start) + " in query");
+      }
+      tokens_.push_back({TokenType::Parameter,
+                         queryString.substr(start + 1, i - start - 1), start});
+    } else {
+      const char* match = nullptr;
+      for (auto symbol : symbols) {
+        if (queryString.compare(i, std::strlen(symbol), symbol) == 0) {
+          match = symbol;
+          break;
+        }
+      }
+      if (!match) {
+        throw QueryException("Unexpected character '" + std::string(1, c) +
+                             "' at position " + std::to_string(i) +
+                             " in query");
+      }
+      i += std::strlen(match);
+      tokens_.push_back({TokenType::Symbol, match, start});
+    }
+  }
+  tokens_.push_back({TokenType::End, "", length});
+}
+
+const Parser::Token& Parser::peek(size_t ahead) const {
+  auto index = current_ + ahead;
+  return index < tokens_.size() ? tokens_[index] : tokens_.back();
+}
+
+Parser::Token Parser::next() {
+  auto token = peek();
+  if (current_ < tokens_.size() - 1) {
+    current_++;
+  }
+  return token;
+}
+
+bool Parser::isKeyword(const char* keyword, size_t ahead) const {
+  const auto& token = peek(ahead);
+  return token.type == TokenType::Identifier &&
+         equalsIgnoreCase(token.text, keyword);
+}
+
+bool Parser::acceptKeyword(const char* keyword) {
+  if (isKeyword(keyword)) {
+    next();
+    return true;
+  }
+  return false;
+}
+
+void Parser::expectKeyword(const char* keyword) {
+  if (!acceptKeyword(keyword)) {
+    std::string upper(keyword);
+    for (auto& c : upper) {
+      c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+    }
+    fail("Expected " + upper);
+  }
+}
+
+bool Parser::isSymbol(const char* symbol, size_t ahead) const {
+  const auto& token = peek(ahead);
+  return token.type == TokenType::Symbol && token.text == symbol;
+}
+
+bool Parser::acceptSymbol(const char* symbol) {
+  if (isSymbol(symbol)) {
+    next();
+    return true;
+  }
+  return false;
+}
+
+void Parser::expectSymbol(const char* symbol) {
+  if (!acceptSymbol(symbol)) {
+    fail(std::string("Expected '") + symbol + "'");
+  }
+}
+
+std::string Parser::expectIdentifier() {
+  const auto& token = peek();
+  if (token.type != TokenType::Identifier || isReserved(token.text)) {
+    fail("Expected identifier");
+  }
+  return next().text;
+}
+
+void Parser::fail(const std::string& message) const {
+  const auto& token = peek();
+  if (token.type == TokenType::End) {
+    throw QueryException(message + " at end of query");
+  }
+  throw QueryException(message + " at position " +
+                       std::to_string(token.position) + " near '" +
+                       token.text + "' in query");
+}
+
+std::unique_ptr<SelectStatement> Parser::parse() {
+  if (isKeyword("import")) {
+    fail("IMPORT is not supported by local queries");
+  }
+
+  std::unique_ptr<SelectStatement> statement(new SelectStatement());
+  expectKeyword("select");
+  statement->distinct = acceptKeyword("distinct");
+  parseProjections(*statement);
+
+  expectKeyword("from");
+  parseFrom(*statement);
+
+  if (acceptKeyword("where")) {
+    statement->where = parseExpression();
+  }
+
+  if (acceptKeyword("order")) {
+    expectKeyword("by");
+    do {
+      OrderBy order;
+      order.expression = parseExpression();
+      order.ascending = true;
+      if (acceptKeyword("desc")) {
+        order.ascending = false;
+      } else {
+        acceptKeyword("asc");
+      }
+      statement->orderBy.push_back(std::move(order));
+    } while (acceptSymbol(","));
+  }
+
+  if (acceptKeyword("limit")) {
+    if (peek().type != TokenType::Integer) {
+      fail("Expected LIMIT count");
+    }
+    statement->limit = std::stoll(next().text);
+  }
+
+  if (peek().type != TokenType::End) {
+    fail("Unexpected token");
+  }
+  return statement;
+}
+
+void Parser::parseProjections(SelectStatement& statement) {
+  if (acceptSymbol("*")) {
+    return;
+  }
+
+  if (isKeyword("count") && isSymbol("(", 1) && isSymbol("*", 2) &&
+      isSymbol(")", 3)) {
+    current_ += 4;
+    statement.count = true;
+    return;
+  }
+
+  do {
+    Projection projection;
+    if (peek().type == TokenType::Identifier && isSymbol(":", 1)) {
+      projection.name = expectIdentifier();
+      next();
+      projection.expression = parseExpression();
+    } else {
+      projection.expression = parseExpression();
+      if (acceptKeyword("as")) {
+        projection.name = expectIdentifier();
+      } else if (auto identifier = dynamic_cast<const IdentifierExpression*>(
+                     projection.expression.get())) {
+        projection.name = identifier->name();
+      } else if (auto field = dynamic_cast<const FieldExpression*>(
+                     projection.expression.get())) {
+        projection.name = field->name();
+      } else {
+        projection.name =
+            "field" + std::to_string(statement.projections.size() + 1);
+      }
+    }
+    statement.projections.push_back(std::move(projection));
+  } while (acceptSymbol(","));
+}
+
+void Parser::parseFrom(SelectStatement& statement) {
+  if (isSymbol("/")) {
+    parseRegionPath(statement);
+    acceptKeyword("as");
+    if (peek().type == TokenType::Identifier && !isReserved(peek().text)) {
+      statement.alias = next().text;
+    }
+  } else {
+    statement.alias = expectIdentifier();
+    expectKeyword("in");
+    parseRegionPath(statement);
+  }
+
+  if (isSymbol(",")) {
+    fail("Joins are not supported by local queries");
+  }
+}
+
+void Parser::parseRegionPath(SelectStatement& statement) {
+  expectSymbol("/");
+  statement.regionPath = expectIdentifier();
+  while (acceptSymbol("/")) {
+    statement.regionPath += "/" + expectIdentifier();
+  }
+
+  statement.iteration = Iteration::Values;
+  if (acceptSymbol(".")) {
+    auto collection = expectIdentifier();
+    if (collection == "values") {
+      statement.iteration = Iteration::Values;
+    } else if (collection == "keys" || collection == "keySet") {
+      statement.iteration = Iteration::Keys;
+    } else if (collection == "entries" || collection == "entrySet") {
+      statement.iteration = Iteration::Entries;
+    } else {
+      throw QueryException("Unsupported region collection '" + collection +
+                           "' in query");
+    }
+    if (acceptSymbol("(")) {
+      expectSymbol(")");
+    }
+  }
+}
+
+std::unique_ptr<Expression> Parser::parseExpression() {
+  auto left = parseAnd();
+  while (acceptKeyword("or")) {
+    auto right = parseAnd();
+    left = std::unique_ptr<Expression>(
+        new BinaryExpression(Operator::Or, std::move(left), std::move(right)));
+  }
+  return left;
+}
+
+std::unique_ptr<Expression> Parser::parseAnd() {
+  auto left = parseNot();
+  while (acceptKeyword("and")) {
+    auto right = parseNot();
+    left = std::unique_ptr<Expression>(
+        new BinaryExpression(Operator::And, std::move(left), std::move(right)));
+  }
+  return left;
+}
+
+std::unique_ptr<Expression> Parser::parseNot() {
+  if (acceptKeyword("not")) {
+    return std::unique_ptr<Expression>(
+        new UnaryExpression(Operator::Not, parseNot()));
+  }
+  return parseComparison();
+}
+
+std::unique_ptr<Expression> Parser::parseComparison() {
+  auto left = parseAdditive();
+
+  if (acceptKeyword("in")) {
+    if (!acceptKeyword("set")) {
+      if (!isSymbol("(")) {
+        fail("Expected SET(...) after IN");
+      }
+    }
+    expectSymbol("(");
+    std::vector<std::unique_ptr<Expression>> candidates;
+    if (!isSymbol(")")) {
+      do {
+        candidates.push_back(parseAdditive());
+      } while (acceptSymbol(","));
+    }
+    expectSymbol(")");
+    return std::unique_ptr<Expression>(
+        new InExpression(std::move(left), std::move(candidates)));
+  }
+
+  Operator op;
+  if (acceptKeyword("like")) {
+    op = Operator::Like;
+  } else if (acceptSymbol("=")) {
+    op = Operator::Equal;
+  } else if (acceptSymbol("<>") || acceptSymbol("!=")) {
+    op = Operator::NotEqual;
+  } else if (acceptSymbol("<=")) {
+    op = Operator::LessEqual;
+  } else if (acceptSymbol(">=")) {
+    op = Operator::GreaterEqual;
+  } else if (acceptSymbol("<")) {
+    op = Operator::Less;
+  } else if (acceptSymbol(">")) {
+    op = Operator::Greater;
+  } else {
+    return left;
+  }
+
+  auto right = parseAdditive();
+  return std::unique_ptr<Expression>(
+      new BinaryExpression(op, std::move(left), std::move(right)));
+}
+
+std::unique_ptr<Expression> Parser::parseAdditive() {
+  auto left = parseMultiplicative();
+  while (true) {
+    Operator op;
+    if (acceptSymbol("+")) {
+      op = Operator::Add;
+    } else if (acceptSymbol("-")) {
+      op = Operator::Subtract;
+    } else {
+      return left;
+    }
+    auto right = parseMultiplicative();
+    left = std::unique_ptr<Expression>(
+        new BinaryExpression(op, std::move(left), std::move(right)));
+  }
+}
+
+std::unique_ptr<Expression> Parser::parseMultiplicative() {
+  auto left = parseUnary();
+  while (true) {
+    Operator op;
+    if (acceptSymbol("*")) {
+      op = Operator::Multiply;
+    } else if (acceptSymbol("/")) {
+      op = Operator::Divide;
+    } else if (acceptSymbol("%")) {
+      op = Operator::Modulo;
+    } else {
+      return left;
+    }
+    auto right = parseUnary();
+    left = std::unique_ptr<Expression>(
+        new BinaryExpression(op, std::move(left), std::move(right)));
+  }
+}
+
+std::unique_ptr<Expression> Parser::parseUnary() {
+  if (acceptSymbol("-")) {
+    return std::unique_ptr<Expression>(
+        new UnaryExpression(Operator::Negate, parseUnary()));
+  }
+  return parsePostfix();
+}
+
+std::unique_ptr<Expression> Parser::parsePostfix() {
+  auto expression = parsePrimary();
+  while (acceptSymbol(".")) {
+    auto name = expectIdentifier();
+    bool isMethod = false;
+    if (acceptSymbol("(")) {
+      if (!isSymbol(")")) {
+        fail("Method arguments are not supported by local queries");
+      }
+      next();
+      isMethod = true;
+    }
+    expression = std::unique_ptr<Expression>(
+        new FieldExpression(std::move(expression), name, isMethod));
+  }
+  return expression;
+}
+
+std::unique_ptr<Expression> Parser::parsePrimary() {
+  const auto& token = peek();
+  switch (token.type) {
+    case TokenType::Integer:
+      return std::unique_ptr<Expression>(new LiteralExpression(
+          Value::of(static_cast<int64_t>(std::stoll(next().text)))));
+    case TokenType::Double:
+      return std::unique_ptr<Expression>(
+          new LiteralExpression(Value::of(std::stod(next().text))));
+    case TokenType::String:
+      return std::unique_ptr<Expression>(
+          new LiteralExpression(Value::of(next().text)));
+    case TokenType::Parameter:
+      return std::unique_ptr<Expression>(
+          new ParameterExpression(std::stoul(next().text)));
+    case TokenType::Symbol:
+      if (acceptSymbol("(")) {
+        auto expression = parseExpression();
+        expectSymbol(")");
+        return expression;
+      }
+      break;
+    case TokenType::Identifier:
+      if (acceptKeyword("true")) {
+        return std::unique_ptr<Expression>(
+            new LiteralExpression(Value::of(true)));
+      } else if (acceptKeyword("false")) {
+        return std::unique_ptr<Expression>(
+            new LiteralExpression(Value::of(false)));
+      } else if (acceptKeyword("null")) {
+        return std::unique_ptr<Expression>(
+            new LiteralExpression(Value::null()));
+      } else if (acceptKeyword("undefined")) {
+        return std::unique_ptr<Expression>(new LiteralExpression(Value()));
+      } else if (isSymbol("(", 1)) {
+        FunctionExpression::Function function;
+        if (isKeyword("is_defined")) {
+          function = FunctionExpression::Function::IsDefined;
+        } else if (isKeyword("is_undefined")) {
+          function = FunctionExpression::Function::IsUndefined;
+        } else {
+          fail("Unsupported function '" + token.text + "'");
+        }
+        current_ += 2;
+        auto argument = parseExpression();
+        expectSymbol(")");
+        return std::unique_ptr<Expression>(
+            new FunctionExpression(function, std::move(argument)));
+      }
+      return std::unique_ptr<Expression>(
+          new IdentifierExpression(expectIdentifier()));
+    default:
+      break;
+  }
+  fail("Unexpected token");
+}
+
+}  // namespace query
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
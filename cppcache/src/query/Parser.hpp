@@ -0,0 +1,102 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_QUERY_PARSER_H_
+#define GEODE_QUERY_PARSER_H_
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "SelectStatement.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+namespace query {
+
+/**
+ * Recursive descent parser for the subset of OQL evaluated locally:
+ *
+ *   SELECT [DISTINCT] (* | COUNT(*) | expr [AS name], ...)
+ *   FROM /region[.values|.keySet|.entrySet] [[AS] alias] | alias IN /region
+ *   [WHERE expr] [ORDER BY expr [ASC|DESC], ...] [LIMIT n]
+ *
+ * Throws QueryException on anything outside that subset.
+ */
+class Parser {
+ public:
+  explicit Parser(const std::string& queryString);
+
+  std::unique_ptr<SelectStatement> parse();
+
+ private:
+  enum class TokenType {
+    Identifier,
+    Integer,
+    Double,
+    String,
+    Parameter,
+    Symbol,
+    End
+  };
+
+  struct Token {
+    TokenType type;
+    std::string text;
+    size_t position;
+  };
+
+  void tokenize(const std::string& queryString);
+
+  const Token& peek(size_t ahead = 0) const;
+  Token next();
+  bool isKeyword(const char* keyword, size_t ahead = 0) const;
+  bool acceptKeyword(const char* keyword);
+  void expectKeyword(const char* keyword);
+  bool isSymbol(const char* symbol, size_t ahead = 0) const;
+  bool acceptSymbol(const char* symbol);
+  void expectSymbol(const char* symbol);
+  std::string expectIdentifier();
+  [[noreturn]] void fail(const std::string& message) const;
+
+  void parseProjections(SelectStatement& statement);
+  void parseFrom(SelectStatement& statement);
+  void parseRegionPath(SelectStatement& statement);
+
+  std::unique_ptr<Expression> parseExpression();
+  std::unique_ptr<Expression> parseAnd();
+  std::unique_ptr<Expression> parseNot();
+  std::unique_ptr<Expression> parseComparison();
+  std::unique_ptr<Expression> parseAdditive();
+  std::unique_ptr<Expression> parseMultiplicative();
+  std::unique_ptr<Expression> parseUnary();
+  std::unique_ptr<Expression> parsePostfix();
+  std::unique_ptr<Expression> parsePrimary();
+
+  std::vector<Token> tokens_;
+  size_t current_;
+};
+
+}  // namespace query
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_QUERY_PARSER_H_
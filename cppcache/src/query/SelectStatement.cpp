@@ -0,0 +1,405 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "SelectStatement.hpp"
+
+#include <algorithm>
+#include <unordered_set>
+
+#include <geode/ExceptionTypes.hpp>
+
+#include "../ResultSetImpl.hpp"
+#include "../StructSetImpl.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+namespace query {
+
+namespace {
+
+struct Row {
+  std::vector<Value> values;
+  std::vector<Value> sortKeys;
+};
+
+struct RowHash {
+  size_t operator()(const std::vector<Value>& values) const {
+    size_t hash = 17;
+    for (const auto& value : values) {
+      hash = hash * 31 + value.hash();
+    }
+    return hash;
+  }
+};
+
+struct RowEqualTo {
+  bool operator()(const std::vector<Value>& lhs,
+                  const std::vector<Value>& rhs) const {
+    if (lhs.size() != rhs.size()) {
+      return false;
+    }
+    for (size_t i = 0; i < lhs.size(); i++) {
+      if (!lhs[i].equals(rhs[i])) {
+        return false;
+      }
+    }
+    return true;
+  }
+};
+
+std::shared_ptr<Serializable> resultValue(const Value& value) {
+  if (value.type() == Value::Type::Entry) {
+    throw QueryException(
+        "Region entries cannot be returned by a local query; select the "
+        "entry's key or value instead");
+  }
+  return value.toSerializable();
+}
+
+bool constantCandidates(const InExpression& in,
+                        std::vector<const Expression*>& candidates) {
+  for (const auto& candidate : in.candidates()) {
+    if (!candidate->isConstant()) {
+      candidates.clear();
+      return false;
+    }
+    candidates.push_back(candidate.get());
+  }
+  return !candidates.empty();
+}
+
+void conjuncts(const Expression& expression,
+               std::vector<const Expression*>& result) {
+  auto binary = dynamic_cast<const BinaryExpression*>(&expression);
+  if (binary && binary->op() == Operator::And) {
+    conjuncts(binary->left(), result);
+    conjuncts(binary->right(), result);
+  } else {
+    result.push_back(&expression);
+  }
+}
+
+}  // namespace
+
+SelectStatement::SelectStatement()
+    : distinct(false),
+      count(false),
+      iteration(Iteration::Values),
+      limit(-1) {}
+
+SelectStatement::~SelectStatement() noexcept = default;
+
+bool SelectStatement::isKeyReference(const Expression& expression) const {
+  if (auto identifier =
+          dynamic_cast<const IdentifierExpression*>(&expression)) {
+    if (iteration == Iteration::Keys) {
+      return identifier->name() == alias || identifier->name() == "this";
+    }
+    return iteration == Iteration::Entries && identifier->name() == "key";
+  }
+  if (auto field = dynamic_cast<const FieldExpression*>(&expression)) {
+    auto target = dynamic_cast<const IdentifierExpression*>(&field->target());
+    return iteration == Iteration::Entries && target &&
+           (target->name() == alias || target->name() == "this") &&
+           (field->name() == "key" || field->name() == "getKey");
+  }
+  return false;
+}
+
+bool SelectStatement::valuePath(const Expression& expression,
+                                std::vector<std::string>& path) const {
+  if (iteration == Iteration::Keys || !fieldPath(expression, alias, path)) {
+    return false;
+  }
+  if (iteration == Iteration::Entries) {
+    if (path.empty() || path.front() != "value") {
+      return false;
+    }
+    path.erase(path.begin());
+  }
+  return !path.empty();
+}
+
+bool SelectStatement::keyLookup(const Expression& term, const Context& context,
+                                key_list& keys) const {
+  std::vector<const Expression*> candidates;
+  if (auto binary = dynamic_cast<const BinaryExpression*>(&term)) {
+    if (binary->op() != Operator::Equal) {
+      return false;
+    }
+    if (isKeyReference(binary->left()) && binary->right().isConstant()) {
+      candidates.push_back(&binary->right());
+    } else if (isKeyReference(binary->right()) && binary->left().isConstant()) {
+      candidates.push_back(&binary->left());
+    }
+  } else if (auto in = dynamic_cast<const InExpression*>(&term)) {
+    if (isKeyReference(in->value())) {
+      constantCandidates(*in, candidates);
+    }
+  }
+  if (candidates.empty()) {
+    return false;
+  }
+
+  for (auto candidate : candidates) {
+    candidate->evaluate(context).toKeys(keys);
+  }
+  return true;
+}
+
+bool SelectStatement::indexLookup(QuerySource& source, const Expression& term,
+                                  const Context& context, bool ranges,
+                                  key_list& keys) const {
+  std::vector<std::string> path;
+
+  if (auto in = dynamic_cast<const InExpression*>(&term)) {
+    std::vector<const Expression*> candidates;
+    if (ranges || !valuePath(in->value(), path) ||
+        !constantCandidates(*in, candidates)) {
+      return false;
+    }
+    auto index = source.findIndex(path, false);
+    if (!index) {
+      return false;
+    }
+    for (auto candidate : candidates) {
+      index->lookup(candidate->evaluate(context), keys);
+    }
+    return true;
+  }
+
+  auto binary = dynamic_cast<const BinaryExpression*>(&term);
+  if (!binary) {
+    return false;
+  }
+
+  auto op = binary->op();
+  const Expression* field = &binary->left();
+  const Expression* constant = &binary->right();
+  if (!constant->isConstant()) {
+    std::swap(field, constant);
+    if (!constant->isConstant()) {
+      return false;
+    }
+    // Mirror the comparison so the field is on the left.
+    switch (op) {
+      case Operator::Less:
+        op = Operator::Greater;
+        break;
+      case Operator::LessEqual:
+        op = Operator::GreaterEqual;
+        break;
+      case Operator::Greater:
+        op = Operator::Less;
+        break;
+      case Operator::GreaterEqual:
+        op = Operator::LessEqual;
+        break;
+      default:
+        break;
+    }
+  }
+
+  bool isRange = op == Operator::Less || op == Operator::LessEqual ||
+                 op == Operator::Greater || op == Operator::GreaterEqual;
+  if ((ranges ? !isRange : op != Operator::Equal) ||
+      !valuePath(*field, path)) {
+    return false;
+  }
+
+  auto index = source.findIndex(path, ranges);
+  if (!index) {
+    return false;
+  }
+
+  auto bound = constant->evaluate(context);
+  switch (op) {
+    case Operator::Equal:
+      index->lookup(bound, keys);
+      break;
+    case Operator::Less:
+      index->lookupRange(nullptr, false, &bound, false, keys);
+      break;
+    case Operator::LessEqual:
+      index->lookupRange(nullptr, false, &bound, true, keys);
+      break;
+    case Operator::Greater:
+      index->lookupRange(&bound, false, nullptr, false, keys);
+      break;
+    default:
+      index->lookupRange(&bound, true, nullptr, false, keys);
+      break;
+  }
+  return true;
+}
+
+bool SelectStatement::candidateKeys(
+    QuerySource& source, const std::shared_ptr<CacheableVector>& parameters,
+    key_list& keys) const {
+  if (!where) {
+    return false;
+  }
+
+  std::vector<const Expression*> terms;
+  conjuncts(*where, terms);
+
+  Value none;
+  Context context{alias, none, parameters};
+
+  // Cheapest first: point lookups by key, then index equality, then index
+  // ranges. Any one conjunct narrows the candidates; WHERE is still applied
+  // to each of them.
+  for (auto term : terms) {
+    if (keyLookup(*term, context, keys)) {
+      return true;
+    }
+  }
+  for (auto ranges : {false, true}) {
+    for (auto term : terms) {
+      if (indexLookup(source, *term, context, ranges, keys)) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+std::shared_ptr<SelectResults> SelectStatement::execute(
+    QuerySource& source,
+    const std::shared_ptr<CacheableVector>& parameters) const {
+  std::vector<Row> rows;
+  std::unordered_set<std::vector<Value>, RowHash, RowEqualTo> seen;
+  int32_t matched = 0;
+  bool earlyLimit = limit >= 0 && orderBy.empty() && !count;
+
+  auto visitor = [&](const std::shared_ptr<CacheableKey>& key,
+                     const std::shared_ptr<Serializable>& value) -> bool {
+    if (earlyLimit && rows.size() >= static_cast<size_t>(limit)) {
+      return false;
+    }
+    if (value == nullptr && iteration != Iteration::Keys) {
+      return true;
+    }
+
+    Value current;
+    switch (iteration) {
+      case Iteration::Values:
+        current = Value::from(value);
+        break;
+      case Iteration::Keys:
+        current = Value::from(key);
+        break;
+      case Iteration::Entries:
+        current = Value::entry(key, value);
+        break;
+    }
+
+    Context context{alias, current, parameters};
+    if (where && !where->evaluate(context).isTrue()) {
+      return true;
+    }
+
+    if (count) {
+      ++matched;
+      return true;
+    }
+
+    Row row;
+    if (projections.empty()) {
+      row.values.push_back(current);
+    } else {
+      row.values.reserve(projections.size());
+      for (const auto& projection : projections) {
+        row.values.push_back(projection.expression->evaluate(context));
+      }
+    }
+    if (distinct && !seen.insert(row.values).second) {
+      return true;
+    }
+    for (const auto& order : orderBy) {
+      row.sortKeys.push_back(order.expression->evaluate(context));
+    }
+    rows.push_back(std::move(row));
+    return !earlyLimit || rows.size() < static_cast<size_t>(limit);
+  };
+
+  key_list keys;
+  if (candidateKeys(source, parameters, keys)) {
+    key_set visited;
+    for (const auto& key : keys) {
+      if (keys.size() > 1 && !visited.insert(key).second) {
+        continue;
+      }
+      std::shared_ptr<Serializable> value;
+      if (source.get(key, value) && !visitor(key, value)) {
+        break;
+      }
+    }
+  } else {
+    source.forEach(visitor);
+  }
+
+  auto results = CacheableVector::create();
+  if (count) {
+    results->push_back(CacheableInt32::create(matched));
+    return std::make_shared<ResultSetImpl>(results);
+  }
+
+  if (!orderBy.empty()) {
+    std::stable_sort(rows.begin(), rows.end(),
+                     [this](const Row& lhs, const Row& rhs) {
+                       for (size_t i = 0; i < orderBy.size(); i++) {
+                         auto result =
+                             lhs.sortKeys[i].sortCompare(rhs.sortKeys[i]);
+                         if (result != 0) {
+                           return orderBy[i].ascending ? result < 0
+                                                      : result > 0;
+                         }
+                       }
+                       return false;
+                     });
+    if (limit >= 0 && rows.size() > static_cast<size_t>(limit)) {
+      rows.resize(static_cast<size_t>(limit));
+    }
+  }
+
+  if (projections.size() > 1) {
+    std::vector<std::string> fieldNames;
+    for (const auto& projection : projections) {
+      fieldNames.push_back(projection.name);
+    }
+    results->reserve(rows.size() * projections.size());
+    for (const auto& row : rows) {
+      for (const auto& value : row.values) {
+        results->push_back(resultValue(value));
+      }
+    }
+    return std::make_shared<StructSetImpl>(results, fieldNames);
+  }
+
+  results->reserve(rows.size());
+  for (const auto& row : rows) {
+    results->push_back(resultValue(row.values.front()));
+  }
+  return std::make_shared<ResultSetImpl>(results);
+}
+
+}  // namespace query
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
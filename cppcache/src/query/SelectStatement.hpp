@@ -0,0 +1,128 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_QUERY_SELECTSTATEMENT_H_
+#define GEODE_QUERY_SELECTSTATEMENT_H_
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include <geode/SelectResults.hpp>
+
+#include "Expression.hpp"
+#include "Index.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+namespace query {
+
+/**
+ * The data a statement iterates over, usually the local entries of a region.
+ */
+class QuerySource {
+ public:
+  typedef std::function<bool(const std::shared_ptr<CacheableKey>&,
+                             const std::shared_ptr<Serializable>&)>
+      Visitor;
+
+  virtual ~QuerySource() noexcept = default;
+
+  /** Visits every entry until the visitor returns false. */
+  virtual void forEach(const Visitor& visitor) = 0;
+
+  /** Looks up a single entry, returning false if it is not present. */
+  virtual bool get(const std::shared_ptr<CacheableKey>& key,
+                   std::shared_ptr<Serializable>& value) = 0;
+
+  /**
+   * Returns an index over the given field path of the values, or nullptr if
+   * there is none. When sorted is set the index must support ranges.
+   */
+  virtual std::shared_ptr<const Index> findIndex(
+      const std::vector<std::string>& /*path*/, bool /*sorted*/) {
+    return nullptr;
+  }
+};
+
+/** What the FROM clause iterates over. */
+enum class Iteration { Values, Keys, Entries };
+
+struct Projection {
+  std::unique_ptr<Expression> expression;
+  std::string name;
+};
+
+struct OrderBy {
+  std::unique_ptr<Expression> expression;
+  bool ascending;
+};
+
+/**
+ * A parsed SELECT over a single region. Built by Parser and executed against
+ * a QuerySource.
+ */
+class SelectStatement {
+ public:
+  SelectStatement();
+  ~SelectStatement() noexcept;
+
+  bool distinct;
+  bool count;
+  std::vector<Projection> projections;
+  std::string regionPath;
+  Iteration iteration;
+  std::string alias;
+  std::unique_ptr<Expression> where;
+  std::vector<OrderBy> orderBy;
+  int64_t limit;
+
+  std::shared_ptr<SelectResults> execute(
+      QuerySource& source,
+      const std::shared_ptr<CacheableVector>& parameters) const;
+
+ private:
+  typedef Index::key_list key_list;
+  typedef std::unordered_set<
+      std::shared_ptr<CacheableKey>,
+      internal::dereference_hash<std::shared_ptr<CacheableKey>>,
+      internal::dereference_equal_to<std::shared_ptr<CacheableKey>>>
+      key_set;
+
+  bool candidateKeys(QuerySource& source,
+                     const std::shared_ptr<CacheableVector>& parameters,
+                     key_list& keys) const;
+  bool keyLookup(const Expression& term, const Context& context,
+                 key_list& keys) const;
+  bool indexLookup(QuerySource& source, const Expression& term,
+                   const Context& context, bool ranges, key_list& keys) const;
+  bool isKeyReference(const Expression& expression) const;
+  bool valuePath(const Expression& expression,
+                 std::vector<std::string>& path) const;
+};
+
+}  // namespace query
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_QUERY_SELECTSTATEMENT_H_
@@ -38,6 +38,7 @@
 #include "../ClientHealthStats.hpp"
 #include "../ClientProxyMembershipID.hpp"
 #include "../CppCacheLibrary.hpp"
+#include "../DataOutputBufferPool.hpp"
 #include "../DistributedSystem.hpp"
 #include "../TcrConnectionManager.hpp"
 #include "../util/Log.hpp"
@@ -326,9 +327,30 @@ void HostStatSampler::writeGfs() {
   changeArchive(archiveFilename);
 }
 
+void HostStatSampler::putDataOutputBufferPoolStats() {
+  // the pool counts for the whole process without locking, so its totals
+  // are copied into the cache statistics as they are sampled
+  auto factory = m_statMngr->getStatisticsFactory();
+  const auto cacheStatType = factory->findType("CachePerfStats");
+  if (cacheStatType == nullptr) return;
+  auto cachePerfStats = factory->findFirstStatisticsByType(cacheStatType);
+  if (cachePerfStats == nullptr) return;
+
+  const auto stats = client::DataOutputBufferPool::getStatistics();
+  cachePerfStats->setLong("dataOutputBufferHits",
+                          static_cast<int64_t>(stats.hits));
+  cachePerfStats->setLong("dataOutputBufferMisses",
+                          static_cast<int64_t>(stats.misses));
+  cachePerfStats->setLong("dataOutputBuffersRecycled",
+                          static_cast<int64_t>(stats.recycled));
+  cachePerfStats->setLong("dataOutputBuffersDiscarded",
+                          static_cast<int64_t>(stats.discarded));
+}
+
 void HostStatSampler::forceSample() {
   std::lock_guard<decltype(m_samplingLock)> guard(m_samplingLock);
 
+  putDataOutputBufferPoolStats();
   if (m_archiver) {
     m_archiver->sample();
     m_archiver->flush();
@@ -338,6 +360,7 @@ void HostStatSampler::forceSample() {
 void HostStatSampler::doSample(const boost::filesystem::path& archiveFilename) {
   std::lock_guard<decltype(m_samplingLock)> guard(m_samplingLock);
 
+  putDataOutputBufferPoolStats();
   if (!m_adminError) {
     putStatsInAdminRegion();
   }
@@ -217,6 +217,7 @@ class HostStatSampler {
    * Update New Stats in Admin Region.
    */
   void putStatsInAdminRegion();
+  void putDataOutputBufferPoolStats();
 
   void initStatDiskSpaceEnabled();
 
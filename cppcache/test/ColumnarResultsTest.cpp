@@ -0,0 +1,140 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <geode/ColumnarResults.hpp>
+#include <geode/ExceptionTypes.hpp>
+
+#include "ColumnarResultsBuilder.hpp"
+#include "DataInputInternal.hpp"
+#include "ResultSetImpl.hpp"
+#include "StructSetImpl.hpp"
+
+using apache::geode::client::CacheableDouble;
+using apache::geode::client::CacheableInt32;
+using apache::geode::client::CacheableString;
+using apache::geode::client::CacheableVector;
+using apache::geode::client::ColumnarResults;
+using apache::geode::client::ColumnarResultsBuilder;
+using apache::geode::client::DataInputInternal;
+using apache::geode::client::MessageException;
+using apache::geode::client::ResultSetImpl;
+using apache::geode::client::StructSetImpl;
+
+TEST(ColumnarResultsTest, readCellDecodesIntoTypedColumns) {
+  // (7, "ab"), (9, null), (11, "ab") as Int32 (57), ASCII string (87) and
+  // NullObj (41)
+  const uint8_t buffer[] = {57, 0, 0, 0, 7,  87, 0, 2, 'a', 'b',
+                            57, 0, 0, 0, 9,  41, 57, 0, 0, 0,
+                            11, 87, 0, 2, 'a', 'b'};
+  DataInputInternal input(buffer, sizeof(buffer));
+
+  ColumnarResultsBuilder builder;
+  builder.setFieldNames({"id", "name"});
+  for (int i = 0; i < 6; ++i) {
+    builder.readCell(input);
+  }
+  auto results = builder.build();
+
+  ASSERT_EQ(3u, results->size());
+  ASSERT_EQ(2u, results->getColumnCount());
+  EXPECT_EQ(1u, results->getFieldIndex("name"));
+  EXPECT_EQ(ColumnarResults::ColumnType::Int32, results->getColumnType(0));
+  EXPECT_EQ(ColumnarResults::ColumnType::String, results->getColumnType(1));
+  EXPECT_EQ((std::vector<int32_t>{7, 9, 11}), results->getInt32Column(0));
+  EXPECT_EQ((std::vector<int32_t>{0, -1, 0}), results->getStringCodes(1));
+  EXPECT_EQ(std::vector<std::string>{"ab"},
+            results->getStringDictionary(1));
+  EXPECT_FALSE(results->isNull(1, 0));
+  EXPECT_TRUE(results->isNull(1, 1));
+  EXPECT_EQ(nullptr, results->getObject(1, 1));
+}
+
+TEST(ColumnarResultsTest, leadingNullsAreBackfilled) {
+  ColumnarResultsBuilder builder;
+  builder.addCell(nullptr);
+  builder.addCell(CacheableDouble::create(2.5));
+  auto results = builder.build();
+
+  ASSERT_EQ(2u, results->size());
+  EXPECT_EQ("result", results->getFieldName(0));
+  EXPECT_EQ(ColumnarResults::ColumnType::Double, results->getColumnType(0));
+  EXPECT_EQ((std::vector<double>{0, 2.5}), results->getDoubleColumn(0));
+  EXPECT_TRUE(results->isNull(0, 0));
+  EXPECT_FALSE(results->isNull(1, 0));
+}
+
+TEST(ColumnarResultsTest, mixedTypesAreStoredAsObjects) {
+  ColumnarResultsBuilder builder;
+  builder.addCell(CacheableInt32::create(1));
+  builder.addCell(nullptr);
+  builder.addCell(CacheableString::create("x"));
+  auto results = builder.build();
+
+  ASSERT_EQ(ColumnarResults::ColumnType::Object, results->getColumnType(0));
+  const auto& objects = results->getObjectColumn(0);
+  ASSERT_EQ(3u, objects.size());
+  auto first = std::dynamic_pointer_cast<CacheableInt32>(objects[0]);
+  ASSERT_NE(nullptr, first);
+  EXPECT_EQ(1, first->value());
+  EXPECT_TRUE(results->isNull(1, 0));
+  EXPECT_EQ("x", results->getObject(2, 0)->toString());
+  EXPECT_THROW(results->getInt32Column(0),
+               apache::geode::client::IllegalStateException);
+}
+
+TEST(ColumnarResultsTest, incompleteRowThrows) {
+  ColumnarResultsBuilder builder;
+  builder.setFieldNames({"a", "b"});
+  builder.addCell(CacheableInt32::create(1));
+  EXPECT_THROW(builder.build(), MessageException);
+}
+
+TEST(ColumnarResultsTest, createFromSelectResults) {
+  auto values = CacheableVector::create();
+  for (int32_t i = 0; i < 3; ++i) {
+    values->push_back(CacheableInt32::create(i));
+    values->push_back(CacheableString::create(i % 2 ? "odd" : "even"));
+  }
+  auto results =
+      ColumnarResults::create(StructSetImpl(values, {"id", "parity"}));
+
+  ASSERT_EQ(3u, results->size());
+  EXPECT_EQ("parity", results->getFieldName(1));
+  EXPECT_EQ((std::vector<int32_t>{0, 1, 2}), results->getInt32Column(0));
+  EXPECT_EQ((std::vector<int32_t>{0, 1, 0}), results->getStringCodes(1));
+  EXPECT_EQ(2u, results->getStringDictionary(1).size());
+
+  auto single = ColumnarResults::create(ResultSetImpl(values));
+  ASSERT_EQ(6u, single->size());
+  EXPECT_EQ(ColumnarResults::ColumnType::Object, single->getColumnType(0));
+}
+
+TEST(ColumnarResultsTest, createFromFunctionResults) {
+  std::vector<std::shared_ptr<apache::geode::client::Cacheable>> values{
+      CacheableInt32::create(4), CacheableInt32::create(5)};
+  auto results = ColumnarResults::create(values);
+
+  ASSERT_EQ(2u, results->size());
+  EXPECT_EQ((std::vector<int32_t>{4, 5}), results->getInt32Column(0));
+}
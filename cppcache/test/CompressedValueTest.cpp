@@ -0,0 +1,194 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <geode/Cache.hpp>
+#include <geode/CacheFactory.hpp>
+#include <geode/CacheableString.hpp>
+#include <geode/Compressor.hpp>
+
+#include "CacheRegionHelper.hpp"
+#include "CompressedValue.hpp"
+
+namespace {
+
+using apache::geode::client::Cacheable;
+using apache::geode::client::CacheableBytes;
+using apache::geode::client::CacheableString;
+using apache::geode::client::CacheFactory;
+using apache::geode::client::CacheRegionHelper;
+using apache::geode::client::CompressedValue;
+using apache::geode::client::Compressor;
+
+class RunLengthCompressor : public Compressor {
+ public:
+  std::vector<int8_t> compress(const std::vector<int8_t>& input) override {
+    std::vector<int8_t> output;
+    for (size_t i = 0; i < input.size();) {
+      int8_t run = 1;
+      while (i + run < input.size() && run < 127 &&
+             input[i + run] == input[i]) {
+        run++;
+      }
+      output.push_back(run);
+      output.push_back(input[i]);
+      i += run;
+    }
+    return output;
+  }
+
+  std::vector<int8_t> decompress(const std::vector<int8_t>& input) override {
+    decompressions++;
+    std::vector<int8_t> output;
+    for (size_t i = 0; i + 1 < input.size(); i += 2) {
+      output.insert(output.end(), input[i], input[i + 1]);
+    }
+    return output;
+  }
+
+  int decompressions = 0;
+};
+
+TEST(CompressedValueTest, wireFormRoundTrips) {
+  auto compressor = std::make_shared<RunLengthCompressor>();
+  CompressedValue value(std::vector<int8_t>{1, 2, 3}, compressor, nullptr);
+
+  auto bytes = value.toBytes();
+  EXPECT_EQ(15, bytes->length());
+  auto received = CompressedValue::fromBytes(*bytes, compressor, nullptr);
+  ASSERT_NE(nullptr, received);
+  EXPECT_EQ(bytes->value(), received->toBytes()->value());
+  EXPECT_TRUE(CompressedValue::isCompressed(received));
+}
+
+TEST(CompressedValueTest, plainByteArraysAreNotCompressedValues) {
+  auto compressor = std::make_shared<RunLengthCompressor>();
+  auto bytes = CacheableBytes::create(std::vector<int8_t>{0x47, 0x43, 0x5a});
+
+  EXPECT_EQ(nullptr, CompressedValue::fromBytes(*bytes, compressor, nullptr));
+  EXPECT_EQ(nullptr, CompressedValue::fromBytes(
+                         *CompressedValue(std::vector<int8_t>{1}, compressor,
+                                          nullptr)
+                              .toBytes(),
+                         nullptr, nullptr));
+  EXPECT_FALSE(CompressedValue::isCompressed(bytes));
+}
+
+TEST(CompressedValueTest, byteArraysWithAnotherHashAreNotCompressedValues) {
+  auto compressor = std::make_shared<RunLengthCompressor>();
+  auto bytes =
+      CompressedValue(std::vector<int8_t>{1, 2, 3}, compressor, nullptr)
+          .toBytes()
+          ->value();
+  bytes.back() = 4;
+
+  EXPECT_EQ(nullptr, CompressedValue::fromBytes(
+                         *CacheableBytes::create(bytes), compressor, nullptr));
+}
+
+TEST(CompressedValueTest, byteArraysThatLookCompressedAreAlwaysCompressed) {
+  auto cache = CacheFactory{}.set("log-level", "none").create();
+  auto cacheImpl = CacheRegionHelper::getCacheImpl(&cache);
+  auto compressor = std::make_shared<RunLengthCompressor>();
+  auto lookalike = CompressedValue(std::vector<int8_t>{1, 2, 3}, compressor,
+                                   nullptr)
+                       .toBytes();
+
+  auto value = CompressedValue::create(lookalike, compressor, 1024, cacheImpl);
+  ASSERT_TRUE(CompressedValue::isCompressed(value));
+  auto compressed = std::static_pointer_cast<CompressedValue>(value);
+  auto received = CompressedValue::fromBytes(*compressed->toBytes(),
+                                             compressor, cacheImpl);
+  ASSERT_NE(nullptr, received);
+  auto decompressed =
+      std::dynamic_pointer_cast<CacheableBytes>(received->decompress());
+  ASSERT_NE(nullptr, decompressed);
+  EXPECT_EQ(lookalike->value(), decompressed->value());
+
+  auto plain = CacheableBytes::create(std::vector<int8_t>{1, 2, 3});
+  EXPECT_EQ(plain, CompressedValue::create(plain, compressor, 1024, cacheImpl));
+}
+
+TEST(CompressedValueTest, overlappingReadsShareOneCopy) {
+  auto cache = CacheFactory{}.set("log-level", "none").create();
+  auto cacheImpl = CacheRegionHelper::getCacheImpl(&cache);
+  auto compressor = std::make_shared<RunLengthCompressor>();
+  auto value = CompressedValue::create(
+      CacheableBytes::create(std::vector<int8_t>(64, 1)), compressor, 0,
+      cacheImpl);
+  ASSERT_TRUE(CompressedValue::isCompressed(value));
+  auto compressed = std::static_pointer_cast<CompressedValue>(value);
+
+  auto first = compressed->decompress();
+  auto second = compressed->decompress();
+  EXPECT_EQ(first, second);
+  EXPECT_EQ(1, compressor->decompressions);
+
+  first = nullptr;
+  second = nullptr;
+  EXPECT_NE(nullptr, compressed->decompress());
+  EXPECT_EQ(2, compressor->decompressions);
+}
+
+TEST(CompressedValueTest, valueIsSharedWhileItsCreatorHoldsIt) {
+  auto cache = CacheFactory{}.set("log-level", "none").create();
+  auto cacheImpl = CacheRegionHelper::getCacheImpl(&cache);
+  auto compressor = std::make_shared<RunLengthCompressor>();
+  std::shared_ptr<Cacheable> bytes =
+      CacheableBytes::create(std::vector<int8_t>(64, 1));
+  auto value = CompressedValue::create(bytes, compressor, 0, cacheImpl);
+  ASSERT_TRUE(CompressedValue::isCompressed(value));
+  auto compressed = std::static_pointer_cast<CompressedValue>(value);
+
+  EXPECT_TRUE(compressed->holds(bytes));
+  EXPECT_EQ(bytes, compressed->decompress());
+  EXPECT_EQ(0, compressor->decompressions);
+
+  EXPECT_FALSE(compressed->holds(compressed->decompressCopy()));
+  bytes = nullptr;
+  EXPECT_NE(nullptr, compressed->decompress());
+  EXPECT_EQ(2, compressor->decompressions);
+}
+
+TEST(CompressedValueTest, copiesAreNotShared) {
+  auto cache = CacheFactory{}.set("log-level", "none").create();
+  auto cacheImpl = CacheRegionHelper::getCacheImpl(&cache);
+  auto compressor = std::make_shared<RunLengthCompressor>();
+  auto value = CompressedValue::create(
+      CacheableBytes::create(std::vector<int8_t>(64, 1)), compressor, 0,
+      cacheImpl);
+  ASSERT_TRUE(CompressedValue::isCompressed(value));
+  auto compressed = std::static_pointer_cast<CompressedValue>(value);
+
+  auto shared = compressed->decompress();
+  auto copy = compressed->decompressCopy();
+  EXPECT_NE(shared, copy);
+  EXPECT_NE(copy, compressed->decompressCopy());
+  EXPECT_EQ(shared, compressed->decompress());
+}
+
+TEST(CompressedValueTest, createLeavesValueWithoutCompressor) {
+  auto value = CacheableString::create("value");
+
+  EXPECT_EQ(value, CompressedValue::create(value, nullptr, 0, nullptr));
+  EXPECT_EQ(nullptr, CompressedValue::create(nullptr, nullptr, 0, nullptr));
+}
+
+}  // namespace
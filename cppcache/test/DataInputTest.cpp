@@ -130,6 +130,18 @@ class TestDataInput {
     return m_dataInput.readBooleanArray();
   }
 
+  std::vector<int16_t> readShortArray() { return m_dataInput.readShortArray(); }
+
+  std::vector<int32_t> readIntArray() { return m_dataInput.readIntArray(); }
+
+  std::vector<int64_t> readLongArray() { return m_dataInput.readLongArray(); }
+
+  std::vector<float> readFloatArray() { return m_dataInput.readFloatArray(); }
+
+  std::vector<double> readDoubleArray() {
+    return m_dataInput.readDoubleArray();
+  }
+
   void readArrayOfByteArrays(int8_t ***arrayofBytearr, int32_t &arrayLength,
                              int32_t **elementLength) {
     m_dataInput.readArrayOfByteArrays(arrayofBytearr, arrayLength,
@@ -516,6 +528,22 @@ TEST_F(DataInputTest, TestReadCharArray) {
       << "Correct const char *";
 }
 
+TEST_F(DataInputTest, TestReadNumericArrays) {
+  TestDataInput dataInput(
+      "020001FFFE0112345678"
+      "01FFFFFFFFFFFFFFFF"
+      "014048F5C3"
+      "02400921FB54442EEA8000000000000000"
+      "FF");
+  EXPECT_EQ(std::vector<int16_t>({1, -2}), dataInput.readShortArray());
+  EXPECT_EQ(std::vector<int32_t>({0x12345678}), dataInput.readIntArray());
+  EXPECT_EQ(std::vector<int64_t>({-1}), dataInput.readLongArray());
+  EXPECT_EQ(std::vector<float>({3.14f}), dataInput.readFloatArray());
+  EXPECT_EQ(std::vector<double>({3.14159265359, -0.0}),
+            dataInput.readDoubleArray());
+  EXPECT_TRUE(dataInput.readDoubleArray().empty());
+}
+
 TEST_F(DataInputTest, TestReadString) {
   TestDataInput dataInput(
       "57001B596F7520686164206D65206174206D65617420746F726E61646F2E");
@@ -0,0 +1,84 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "DataOutputBufferPool.hpp"
+
+using apache::geode::client::DataOutputBufferPool;
+
+TEST(DataOutputBufferPoolTest, capacityIsRoundedUpToSizeClass) {
+  EXPECT_EQ(4096, DataOutputBufferPool::capacityFor(1));
+  EXPECT_EQ(4096, DataOutputBufferPool::capacityFor(4096));
+  EXPECT_EQ(8192, DataOutputBufferPool::capacityFor(4097));
+  EXPECT_EQ(16 * 1024 * 1024,
+            DataOutputBufferPool::capacityFor(16 * 1024 * 1024));
+  EXPECT_EQ(16 * 1024 * 1024 + 4096,
+            DataOutputBufferPool::capacityFor(16 * 1024 * 1024 + 1));
+}
+
+TEST(DataOutputBufferPoolTest, checkedInBufferIsReusedOnSameThread) {
+  // run on a fresh thread so the thread cache starts out empty
+  std::thread([] {
+    size_t size;
+    auto buffer = DataOutputBufferPool::checkout(10000, &size);
+    EXPECT_EQ(16384, size);
+    DataOutputBufferPool::checkin(buffer, size);
+
+    const auto before = DataOutputBufferPool::getStatistics();
+    size_t reusedSize;
+    auto reused = DataOutputBufferPool::checkout(9000, &reusedSize);
+    const auto after = DataOutputBufferPool::getStatistics();
+
+    EXPECT_EQ(buffer, reused);
+    EXPECT_EQ(16384, reusedSize);
+    EXPECT_LE(before.hits + 1, after.hits);
+    DataOutputBufferPool::checkin(reused, reusedSize);
+  }).join();
+}
+
+TEST(DataOutputBufferPoolTest, oversizedBufferIsDiscarded) {
+  std::thread([] {
+    size_t size;
+    auto buffer =
+        DataOutputBufferPool::checkout(DataOutputBufferPool::MAX_BUFFER_SIZE + 1,
+                                       &size);
+    const auto before = DataOutputBufferPool::getStatistics();
+    DataOutputBufferPool::checkin(buffer, size);
+    const auto after = DataOutputBufferPool::getStatistics();
+
+    EXPECT_LE(before.discarded + 1, after.discarded);
+  }).join();
+}
+
+TEST(DataOutputBufferPoolTest, growPreservesContents) {
+  size_t size;
+  auto buffer = DataOutputBufferPool::checkout(16, &size);
+  for (uint8_t i = 0; i < 16; ++i) {
+    buffer[i] = i;
+  }
+
+  size_t newSize;
+  auto grown = DataOutputBufferPool::grow(buffer, size, 16, size + 1, &newSize);
+  EXPECT_EQ(2 * size, newSize);
+  for (uint8_t i = 0; i < 16; ++i) {
+    EXPECT_EQ(i, grown[i]);
+  }
+  DataOutputBufferPool::checkin(grown, newSize);
+}
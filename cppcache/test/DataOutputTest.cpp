@@ -19,6 +19,7 @@
 
 #include <limits>
 #include <random>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -223,6 +224,23 @@ TEST_F(DataOutputTest, TestWriteDouble) {
   EXPECT_BYTEARRAY_EQ("400921FB54442EEA", dataOutput.getByteArray());
 }
 
+TEST_F(DataOutputTest, TestWriteNumericArrays) {
+  TestDataOutput dataOutput(nullptr);
+  dataOutput.writeShortArray({1, -2});
+  dataOutput.writeIntArray({0x12345678});
+  dataOutput.writeLongArray({-1});
+  dataOutput.writeFloatArray({3.14f});
+  dataOutput.writeDoubleArray({3.14159265359, -0.0});
+  dataOutput.writeDoubleArray({});
+  EXPECT_BYTEARRAY_EQ(
+      "020001FFFE0112345678"
+      "01FFFFFFFFFFFFFFFF"
+      "014048F5C3"
+      "02400921FB54442EEA8000000000000000"
+      "00",
+      dataOutput.getByteArray());
+}
+
 TEST_F(DataOutputTest, TestWriteString) {
   TestDataOutput dataOutput(nullptr);
   dataOutput.writeString("You had me at meat tornado.");
@@ -339,4 +357,20 @@ TEST_F(DataOutputTest, TestCursorNegativeAdvance) {
       << "Correct length after negative advance";
 }
 
+TEST_F(DataOutputTest, TestGrowAndReset) {
+  TestDataOutput dataOutput(nullptr);
+  const std::vector<int8_t> bytes(100000, 0x2A);
+  dataOutput.writeBytesOnly(bytes.data(), bytes.size());
+  dataOutput.write(static_cast<int8_t>(0x2B));
+  ASSERT_EQ(bytes.size() + 1, dataOutput.getBufferLength());
+  EXPECT_EQ(0x2A, dataOutput.getBuffer()[0]);
+  EXPECT_EQ(0x2A, dataOutput.getBuffer()[bytes.size() - 1]);
+  EXPECT_EQ(0x2B, dataOutput.getBuffer()[bytes.size()]);
+
+  dataOutput.reset();
+  EXPECT_EQ(0, dataOutput.getBufferLength());
+  dataOutput.write(static_cast<uint8_t>(55U));
+  EXPECT_BYTEARRAY_EQ("37", dataOutput.getByteArray());
+}
+
 }  // namespace
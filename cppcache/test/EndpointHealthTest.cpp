@@ -0,0 +1,121 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <chrono>
+
+#include <gtest/gtest.h>
+
+#include "EndpointHealth.hpp"
+
+using apache::geode::client::EndpointHealth;
+using std::chrono::microseconds;
+using std::chrono::milliseconds;
+
+using State = EndpointHealth::State;
+
+TEST(EndpointHealthTest, newEndpointIsClosed) {
+  EndpointHealth health;
+  EXPECT_EQ(State::CLOSED, health.getState());
+  EXPECT_TRUE(health.allowRequest());
+  EXPECT_EQ(0.0, health.getErrorRate());
+}
+
+TEST(EndpointHealthTest, consecutiveFailuresOpenCircuit) {
+  EndpointHealth health(3, 1.0, milliseconds(100));
+  auto now = EndpointHealth::clock::now();
+
+  EXPECT_FALSE(health.recordFailure(now));
+  EXPECT_FALSE(health.recordFailure(now));
+  EXPECT_TRUE(health.recordFailure(now));
+  EXPECT_EQ(State::OPEN, health.getState(now));
+  EXPECT_FALSE(health.allowRequest(now));
+
+  // further failures keep it open without opening it again
+  EXPECT_FALSE(health.recordFailure(now + milliseconds(10)));
+}
+
+TEST(EndpointHealthTest, successResetsFailureRun) {
+  EndpointHealth health(3, 1.0, milliseconds(100));
+  auto now = EndpointHealth::clock::now();
+
+  health.recordFailure(now);
+  health.recordFailure(now);
+  health.recordSuccess(now);
+  EXPECT_FALSE(health.recordFailure(now));
+  EXPECT_EQ(State::CLOSED, health.getState(now));
+}
+
+TEST(EndpointHealthTest, halfOpenCircuitLetsOneTrialThroughPerInterval) {
+  EndpointHealth health(1, 1.0, milliseconds(100));
+  auto now = EndpointHealth::clock::now();
+  health.recordFailure(now);
+
+  auto later = now + milliseconds(100);
+  EXPECT_EQ(State::HALF_OPEN, health.getState(later));
+  EXPECT_TRUE(health.allowRequest(later));
+  EXPECT_FALSE(health.allowRequest(later + milliseconds(50)));
+  EXPECT_TRUE(health.allowRequest(later + milliseconds(100)));
+}
+
+TEST(EndpointHealthTest, trialOutcomeClosesOrReopensCircuit) {
+  EndpointHealth health(1, 1.0, milliseconds(100));
+  auto now = EndpointHealth::clock::now();
+  health.recordFailure(now);
+
+  // a late reply while open does not close the circuit
+  EXPECT_FALSE(health.recordSuccess(now + milliseconds(50)));
+  EXPECT_EQ(State::OPEN, health.getState(now + milliseconds(50)));
+
+  now += milliseconds(100);
+  EXPECT_TRUE(health.recordFailure(now));
+  EXPECT_EQ(State::OPEN, health.getState(now));
+
+  now += milliseconds(100);
+  EXPECT_TRUE(health.recordSuccess(now));
+  EXPECT_EQ(State::CLOSED, health.getState(now));
+  EXPECT_TRUE(health.allowRequest(now));
+}
+
+TEST(EndpointHealthTest, highErrorRateOpensCircuit) {
+  EndpointHealth health(100, 0.3, milliseconds(100));
+  auto now = EndpointHealth::clock::now();
+
+  bool opened = false;
+  for (int i = 0; i < 60 && !opened; ++i) {
+    opened = health.recordFailure(now);
+    opened = opened || health.recordFailure(now);
+    health.recordSuccess(now);
+  }
+  EXPECT_TRUE(opened);
+  EXPECT_GE(health.getErrorRate(), 0.3);
+}
+
+TEST(EndpointHealthTest, scoreGrowsWithLatencyAndErrors) {
+  EndpointHealth fast;
+  EndpointHealth slow;
+  for (int i = 0; i < 10; ++i) {
+    fast.recordLatency(microseconds(100));
+    slow.recordLatency(microseconds(1000));
+  }
+  EXPECT_EQ(microseconds(100), fast.getLatency());
+  EXPECT_LT(fast.getScore(), slow.getScore());
+
+  auto score = fast.getScore();
+  fast.recordFailure();
+  EXPECT_GT(fast.getScore(), score);
+}
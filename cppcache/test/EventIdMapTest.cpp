@@ -0,0 +1,98 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "EventIdMap.hpp"
+
+using apache::geode::client::EventId;
+using apache::geode::client::EventIdMap;
+
+namespace {
+
+std::shared_ptr<EventId> eventId(const char* member, int64_t thread,
+                                 int64_t sequence) {
+  std::string memId(member);
+  return EventId::create(&memId[0], static_cast<uint32_t>(memId.size()),
+                         thread, sequence);
+}
+
+}  // namespace
+
+TEST(EventIdMapTest, putOnlyNewRejectsOldSequences) {
+  EventIdMap map;
+  map.init(std::chrono::seconds(300));
+
+  EXPECT_TRUE(map.put(*eventId("member1", 1, 5), true));
+  EXPECT_FALSE(map.put(*eventId("member1", 1, 5), true));
+  EXPECT_FALSE(map.put(*eventId("member1", 1, 4), true));
+  EXPECT_TRUE(map.put(*eventId("member1", 1, 6), true));
+
+  EXPECT_TRUE(map.put(*eventId("member1", 2, 1), true));
+  EXPECT_TRUE(map.put(*eventId("member2", 1, 1), true));
+}
+
+TEST(EventIdMapTest, sharedPtrAndEventIdKeysMatch) {
+  EventIdMap map;
+  map.init(std::chrono::seconds(300));
+
+  auto entry = EventIdMap::make(eventId("member1", 7, 10));
+  EXPECT_TRUE(map.put(entry.first, entry.second, true));
+  EXPECT_FALSE(map.put(*eventId("member1", 7, 9), true));
+  EXPECT_TRUE(map.isDuplicate(entry.first, entry.second));
+  EXPECT_TRUE(map.remove(entry.first));
+  EXPECT_TRUE(map.put(*eventId("member1", 7, 9), true));
+}
+
+TEST(EventIdMapTest, getUnAckedReturnsEachSourceOnce) {
+  EventIdMap map;
+  map.init(std::chrono::seconds(300));
+
+  for (int64_t thread = 0; thread < 50; thread++) {
+    map.put(*eventId("member1", thread, 1));
+  }
+
+  auto unacked = map.getUnAcked();
+  EXPECT_EQ(50, unacked.size());
+  EXPECT_EQ(0, map.getUnAcked().size());
+
+  EXPECT_EQ(50, map.clearAckedFlags(unacked));
+  EXPECT_EQ(50, map.getUnAcked().size());
+
+  map.put(*eventId("member1", 3, 2));
+  unacked = map.getUnAcked();
+  ASSERT_EQ(1, unacked.size());
+  EXPECT_EQ(3, unacked[0].first->getThrId());
+  EXPECT_EQ(2, unacked[0].second->getSeqNum());
+}
+
+TEST(EventIdMapTest, expireRemovesIdleSources) {
+  EventIdMap map;
+  map.init(std::chrono::milliseconds(0));
+
+  map.put(*eventId("member1", 1, 1));
+  map.put(*eventId("member1", 2, 1));
+  EXPECT_EQ(0, map.expire(true));
+
+  map.getUnAcked();
+  std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  EXPECT_EQ(2, map.expire(true));
+  EXPECT_TRUE(map.put(*eventId("member1", 1, 1), true));
+}
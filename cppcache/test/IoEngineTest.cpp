@@ -0,0 +1,161 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <future>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include <boost/asio.hpp>
+
+#include <gtest/gtest.h>
+
+#include <geode/ExceptionTypes.hpp>
+
+#include "IoEngine.hpp"
+#include "TcpConn.hpp"
+
+using apache::geode::client::Connector;
+using apache::geode::client::IllegalArgumentException;
+using apache::geode::client::IoEngine;
+using apache::geode::client::TcpConn;
+
+namespace {
+
+// Accepts one connection and echoes everything it reads back to the sender.
+class EchoServer {
+ public:
+  EchoServer()
+      : acceptor_(context_, boost::asio::ip::tcp::endpoint(
+                                boost::asio::ip::address_v4::loopback(), 0)),
+        thread_([this] { serve(); }) {}
+
+  ~EchoServer() {
+    boost::system::error_code ignored;
+    acceptor_.close(ignored);
+    thread_.join();
+  }
+
+  uint16_t port() const { return acceptor_.local_endpoint().port(); }
+
+ private:
+  void serve() {
+    boost::system::error_code ec;
+    boost::asio::ip::tcp::socket socket(context_);
+    acceptor_.accept(socket, ec);
+    char buffer[256];
+    while (!ec) {
+      auto n = socket.read_some(boost::asio::buffer(buffer), ec);
+      if (!ec) {
+        boost::asio::write(socket, boost::asio::buffer(buffer, n), ec);
+      }
+    }
+  }
+
+  boost::asio::io_context context_;
+  boost::asio::ip::tcp::acceptor acceptor_;
+  std::thread thread_;
+};
+
+}  // namespace
+
+TEST(IoEngineTest, requiresAtLeastOneThread) {
+  EXPECT_THROW(IoEngine(0), IllegalArgumentException);
+}
+
+TEST(IoEngineTest, blockingSendAndReceiveCompleteOnReactor) {
+  IoEngine engine(2);
+  EXPECT_EQ(2u, engine.getThreadCount());
+
+  EchoServer server;
+  std::unique_ptr<Connector> conn(new TcpConn(
+      "127.0.0.1", server.port(), std::chrono::seconds(5), 65536, &engine));
+
+  const std::string message = "hello";
+  EXPECT_EQ(message.size(), conn->send(message.data(), message.size(),
+                                       std::chrono::seconds(5)));
+
+  char reply[5];
+  EXPECT_EQ(sizeof(reply),
+            conn->receive(reply, sizeof(reply), std::chrono::seconds(5)));
+  EXPECT_EQ(message, std::string(reply, sizeof(reply)));
+}
+
+TEST(IoEngineTest, receiveTimesOutWhenNothingArrives) {
+  IoEngine engine(1);
+  EchoServer server;
+  std::unique_ptr<Connector> conn(new TcpConn(
+      "127.0.0.1", server.port(), std::chrono::seconds(5), 65536, &engine));
+
+  char reply[1];
+  EXPECT_THROW(
+      conn->receive(reply, sizeof(reply), std::chrono::milliseconds(50)),
+      boost::system::system_error);
+
+  // The connection stays usable after the cancelled read.
+  EXPECT_EQ(1u, conn->send("x", 1, std::chrono::seconds(5)));
+  EXPECT_EQ(1u, conn->receive(reply, sizeof(reply), std::chrono::seconds(5)));
+  EXPECT_EQ('x', reply[0]);
+}
+
+TEST(IoEngineTest, asyncReceiveCallsHandlerOnReactorThread) {
+  IoEngine engine(1);
+  EchoServer server;
+  std::unique_ptr<Connector> conn(new TcpConn(
+      "127.0.0.1", server.port(), std::chrono::seconds(5), 65536, &engine));
+
+  char reply[3];
+  std::promise<std::thread::id> handled;
+  conn->asyncReceive(reply, sizeof(reply),
+                     [&handled](const boost::system::error_code& ec,
+                                std::size_t n) {
+                       EXPECT_FALSE(ec);
+                       EXPECT_EQ(3u, n);
+                       handled.set_value(std::this_thread::get_id());
+                     });
+  conn->asyncSend("abc", 3,
+                  [](const boost::system::error_code& ec, std::size_t n) {
+                    EXPECT_FALSE(ec);
+                    EXPECT_EQ(3u, n);
+                  });
+
+  auto future = handled.get_future();
+  ASSERT_EQ(std::future_status::ready,
+            future.wait_for(std::chrono::seconds(5)));
+  EXPECT_NE(std::this_thread::get_id(), future.get());
+  EXPECT_EQ("abc", std::string(reply, sizeof(reply)));
+}
+
+TEST(IoEngineTest, asyncSendWithoutEngineCompletesBeforeReturning) {
+  EchoServer server;
+  std::unique_ptr<Connector> conn(new TcpConn(
+      "127.0.0.1", server.port(), std::chrono::seconds(5), 65536));
+
+  bool handled = false;
+  conn->asyncSend("abc", 3,
+                  [&handled](const boost::system::error_code& ec,
+                             std::size_t n) {
+                    EXPECT_FALSE(ec);
+                    EXPECT_EQ(3u, n);
+                    handled = true;
+                  });
+  EXPECT_TRUE(handled);
+
+  char reply[3];
+  EXPECT_EQ(3u, conn->receive(reply, sizeof(reply), std::chrono::seconds(5)));
+}
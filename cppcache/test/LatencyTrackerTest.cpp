@@ -0,0 +1,66 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <chrono>
+
+#include <gtest/gtest.h>
+
+#include "LatencyTracker.hpp"
+
+using apache::geode::client::LatencyTracker;
+using std::chrono::microseconds;
+
+TEST(LatencyTrackerTest, emptyTrackerHasNoSamples) {
+  LatencyTracker tracker;
+  auto percentiles = tracker.getPercentiles();
+  EXPECT_EQ(0u, percentiles.samples);
+  EXPECT_EQ(microseconds::zero(), percentiles.p95);
+}
+
+TEST(LatencyTrackerTest, percentilesOfUniformLatencies) {
+  LatencyTracker tracker(100);
+  for (int i = 1; i <= 100; ++i) {
+    tracker.record(microseconds(i));
+  }
+  auto percentiles = tracker.getPercentiles();
+  EXPECT_EQ(100u, percentiles.samples);
+  EXPECT_EQ(microseconds(95), percentiles.p95);
+  EXPECT_EQ(microseconds(99), percentiles.p99);
+}
+
+TEST(LatencyTrackerTest, oldSamplesLeaveTheWindow) {
+  LatencyTracker tracker(32);
+  for (int i = 0; i < 32; ++i) {
+    tracker.record(microseconds(10000));
+  }
+  EXPECT_EQ(microseconds(10000), tracker.getPercentiles().p95);
+
+  for (int i = 0; i < 32; ++i) {
+    tracker.record(microseconds(100));
+  }
+  auto percentiles = tracker.getPercentiles();
+  EXPECT_EQ(32u, percentiles.samples);
+  EXPECT_EQ(microseconds(100), percentiles.p99);
+}
+
+TEST(LatencyTrackerTest, firstSamplesAreUsedRightAway) {
+  LatencyTracker tracker;
+  tracker.record(microseconds(500));
+  EXPECT_EQ(1u, tracker.getPercentiles().samples);
+  EXPECT_EQ(microseconds(500), tracker.getPercentiles().p99);
+}
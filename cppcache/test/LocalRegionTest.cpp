@@ -15,18 +15,134 @@
  * limitations under the License.
  */
 
+#include <memory>
+#include <string>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include <geode/AuthenticatedView.hpp>
 #include <geode/Cache.hpp>
+#include <geode/Compressor.hpp>
+#include <geode/DataSerializable.hpp>
+#include <geode/Delta.hpp>
 #include <geode/PoolManager.hpp>
 #include <geode/RegionFactory.hpp>
 #include <geode/RegionShortcut.hpp>
+#include <geode/Struct.hpp>
+
+#include "CacheImpl.hpp"
+#include "CacheRegionHelper.hpp"
+#include "LocalRegion.hpp"
+#include "StructSetImpl.hpp"
+#include "query/Index.hpp"
+#include "query/IndexManager.hpp"
 
+using apache::geode::client::Cacheable;
+using apache::geode::client::CacheableString;
+using apache::geode::client::CacheableVector;
 using apache::geode::client::CacheClosedException;
+using apache::geode::client::CacheEventFlags;
 using apache::geode::client::CacheFactory;
+using apache::geode::client::CacheImpl;
+using apache::geode::client::CacheRegionHelper;
+using apache::geode::client::CacheStatistics;
+using apache::geode::client::Compressor;
+using apache::geode::client::DataInput;
+using apache::geode::client::DataOutput;
+using apache::geode::client::DataSerializable;
+using apache::geode::client::Delta;
+using apache::geode::client::EventId;
+using apache::geode::client::LocalRegion;
 using apache::geode::client::RegionAttributesFactory;
 using apache::geode::client::RegionShortcut;
+using apache::geode::client::Serializable;
+using apache::geode::client::StructSetImpl;
+using apache::geode::client::VersionTag;
+using apache::geode::client::query::Index;
+using apache::geode::client::query::Value;
+
+namespace {
+
+/**
+ * A region whose server only answers the full value of a failed delta on
+ * the second request, as when the first request raced a destroy.
+ */
+class FullValueRegion : public LocalRegion {
+ public:
+  FullValueRegion(CacheImpl* cache, std::shared_ptr<Cacheable> fullValue)
+      : LocalRegion("fullValue", cache, nullptr,
+                    RegionAttributesFactory().create(),
+                    std::make_shared<CacheStatistics>()),
+        fullValue_(std::move(fullValue)) {}
+
+ protected:
+  GfErrType getNoThrow_FullObject(std::shared_ptr<EventId>,
+                                  std::shared_ptr<Cacheable>& fullObject,
+                                  std::shared_ptr<VersionTag>&) override {
+    if (++requests_ == 2) {
+      fullObject = fullValue_;
+    }
+    return GF_NOERR;
+  }
+
+ private:
+  std::shared_ptr<Cacheable> fullValue_;
+  int requests_ = 0;
+};
+
+class Text : public DataSerializable, public Delta {
+ public:
+  Text() = default;
+  explicit Text(std::string text) : text_(std::move(text)) {}
+
+  static std::shared_ptr<Serializable> create() {
+    return std::make_shared<Text>();
+  }
+
+  void toData(DataOutput& output) const override { output.writeString(text_); }
+  void fromData(DataInput& input) override { text_ = input.readString(); }
+
+  bool hasDelta() const override { return true; }
+  void toDelta(DataOutput& output) const override { toData(output); }
+  void fromDelta(DataInput& input) override { text_ += input.readString(); }
+  std::shared_ptr<Delta> clone() const override {
+    return std::make_shared<Text>(text_);
+  }
+
+  const std::string& text() const { return text_; }
+
+ private:
+  std::string text_;
+};
+
+class RunLengthCompressor : public Compressor {
+ public:
+  std::vector<int8_t> compress(const std::vector<int8_t>& input) override {
+    std::vector<int8_t> output;
+    for (size_t i = 0; i < input.size();) {
+      int8_t run = 1;
+      while (i + run < input.size() && run < 127 &&
+             input[i + run] == input[i]) {
+        run++;
+      }
+      output.push_back(run);
+      output.push_back(input[i]);
+      i += run;
+    }
+    return output;
+  }
+
+  std::vector<int8_t> decompress(const std::vector<int8_t>& input) override {
+    std::vector<int8_t> output;
+    for (size_t i = 0; i + 1 < input.size(); i += 2) {
+      output.insert(output.end(), input[i], input[i + 1]);
+    }
+    return output;
+  }
+};
+
+}  // namespace
 
 /**
  * Cache should close and throw exceptions on methods called after close.
@@ -77,3 +193,66 @@ TEST(LocalRegionTest, subRegions) {
   auto subRegions3 = rootRegion3->subregions(true);
   EXPECT_EQ(0, subRegions3.size());
 }
+
+TEST(LocalRegionTest, fullValueAfterInvalidDeltaIsIndexed) {
+  auto cache = CacheFactory{}.set("log-level", "none").create();
+
+  auto values = CacheableVector::create();
+  values->push_back(CacheableString::create("active"));
+  auto rows = std::make_shared<StructSetImpl>(
+      values, std::vector<std::string>{"status"});
+  auto region = std::make_shared<FullValueRegion>(
+      CacheRegionHelper::getCacheImpl(&cache), (*rows)[0]);
+  auto index = std::make_shared<Index>("status", Index::Type::Hash,
+                                       "r.status", "/fullValue r");
+  region->getIndexManager().add(index);
+
+  // a delta for a key that is not cached cannot be applied
+  uint8_t deltaBytes[] = {0};
+  auto delta = cache.createDataInput(deltaBytes, sizeof(deltaBytes));
+  auto key = CacheableString::create("key");
+  std::shared_ptr<Cacheable> oldValue;
+  EXPECT_EQ(GF_NOERR,
+            region->putNoThrow(key, nullptr, nullptr, oldValue, -1,
+                               CacheEventFlags::LOCAL, nullptr, &delta));
+
+  EXPECT_TRUE(region->containsKey(key));
+  Index::key_list keys;
+  index->lookup(Value::of(std::string("active")), keys);
+  ASSERT_EQ(1, keys.size());
+  EXPECT_EQ("key", keys[0]->toString());
+}
+
+TEST(LocalRegionTest, deltaForCompressedValueIsAppliedToACopy) {
+  auto cache = CacheFactory{}.set("log-level", "none").create();
+  cache.getTypeRegistry().registerType(Text::create, 1);
+  auto region = std::make_shared<LocalRegion>(
+      "compressed", CacheRegionHelper::getCacheImpl(&cache), nullptr,
+      RegionAttributesFactory()
+          .setCompressor(std::make_shared<RunLengthCompressor>())
+          .setCompressionThreshold(0)
+          .create(),
+      std::make_shared<CacheStatistics>());
+
+  auto key = CacheableString::create("key");
+  auto original = std::make_shared<Text>(std::string(64, 'a'));
+  region->put(key, original);
+
+  auto output = cache.createDataOutput();
+  output.writeString("b");
+  auto delta =
+      cache.createDataInput(output.getBuffer(), output.getBufferLength());
+  std::shared_ptr<Cacheable> value;
+  std::shared_ptr<Cacheable> oldValue;
+  EXPECT_EQ(GF_NOERR,
+            region->putNoThrow(key, value, nullptr, oldValue, -1,
+                               CacheEventFlags::LOCAL, nullptr, &delta));
+
+  auto current = std::dynamic_pointer_cast<Text>(region->get(key, nullptr));
+  ASSERT_NE(nullptr, current);
+  EXPECT_EQ(std::string(64, 'a') + "b", current->text());
+  EXPECT_EQ(std::string(64, 'a'), original->text());
+  auto old = std::dynamic_pointer_cast<Text>(oldValue);
+  ASSERT_NE(nullptr, old);
+  EXPECT_EQ(std::string(64, 'a'), old->text());
+}
@@ -0,0 +1,102 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "PartitionedDispatcher.hpp"
+
+using apache::geode::client::PartitionedDispatcher;
+
+TEST(PartitionedDispatcherTest, itemsWithSameHashKeepTheirOrder) {
+  std::mutex mutex;
+  std::vector<std::vector<int>> seen(4);
+  {
+    PartitionedDispatcher<int> dispatcher(
+        3, 8,
+        [&](int& item) {
+          std::lock_guard<std::mutex> guard(mutex);
+          seen[item % 4].push_back(item);
+        },
+        "test");
+    for (int i = 0; i < 1000; i++) {
+      dispatcher.dispatch(i % 4, i);
+    }
+  }
+
+  for (size_t key = 0; key < seen.size(); key++) {
+    ASSERT_EQ(250, seen[key].size());
+    for (size_t i = 0; i < seen[key].size(); i++) {
+      EXPECT_EQ(static_cast<int>(key + i * 4), seen[key][i]);
+    }
+  }
+}
+
+TEST(PartitionedDispatcherTest, drainWaitsForDispatchedItems) {
+  std::atomic<int> handled(0);
+  PartitionedDispatcher<int> dispatcher(
+      2, 16,
+      [&](int&) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        ++handled;
+      },
+      "test");
+  for (int i = 0; i < 20; i++) {
+    dispatcher.dispatch(i, i);
+  }
+  dispatcher.drain();
+  EXPECT_EQ(20, handled);
+  EXPECT_EQ(20, dispatcher.getStatistics().dispatched);
+}
+
+TEST(PartitionedDispatcherTest, fullQueueBlocksDispatch) {
+  std::mutex gate;
+  std::unique_lock<std::mutex> closed(gate);
+  std::atomic<bool> started(false);
+  PartitionedDispatcher<int> dispatcher(
+      1, 2,
+      [&](int&) {
+        started = true;
+        std::lock_guard<std::mutex> guard(gate);
+      },
+      "test");
+
+  // one item held by the worker plus a full queue
+  dispatcher.dispatch(0, 0);
+  while (!started) {
+    std::this_thread::yield();
+  }
+  dispatcher.dispatch(0, 1);
+  dispatcher.dispatch(0, 2);
+
+  std::thread producer([&] { dispatcher.dispatch(0, 3); });
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  closed.unlock();
+  producer.join();
+  dispatcher.drain();
+
+  auto stats = dispatcher.getStatistics();
+  EXPECT_EQ(4, stats.dispatched);
+  EXPECT_LE(1, stats.blocked);
+  EXPECT_LT(std::chrono::nanoseconds::zero(), stats.blockedTime);
+  EXPECT_EQ(2, stats.maxQueueDepth);
+}
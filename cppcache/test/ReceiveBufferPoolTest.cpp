@@ -0,0 +1,73 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "ReceiveBufferPool.hpp"
+
+using apache::geode::client::ReceiveBufferPool;
+
+TEST(ReceiveBufferPoolTest, acquireReturnsRequestedSize) {
+  ReceiveBufferPool pool(4, 1024);
+
+  auto buffer = pool.acquire(100);
+  ASSERT_NE(nullptr, buffer);
+  EXPECT_EQ(100, buffer->size());
+  EXPECT_EQ(0, pool.pooled());
+}
+
+TEST(ReceiveBufferPoolTest, releasedBufferIsReused) {
+  ReceiveBufferPool pool(4, 1024);
+
+  auto buffer = pool.acquire(100);
+  auto data = buffer->data();
+  buffer = nullptr;
+  EXPECT_EQ(1, pool.pooled());
+
+  auto reused = pool.acquire(50);
+  EXPECT_EQ(data, reused->data());
+  EXPECT_EQ(50, reused->size());
+  EXPECT_EQ(0, pool.pooled());
+}
+
+TEST(ReceiveBufferPoolTest, oversizedBufferIsNotPooled) {
+  ReceiveBufferPool pool(4, 1024);
+
+  pool.acquire(2048);
+  EXPECT_EQ(0, pool.pooled());
+}
+
+TEST(ReceiveBufferPoolTest, poolHoldsAtMostMaxPooledBuffers) {
+  ReceiveBufferPool pool(2, 1024);
+
+  {
+    auto first = pool.acquire(10);
+    auto second = pool.acquire(10);
+    auto third = pool.acquire(10);
+  }
+  EXPECT_EQ(2, pool.pooled());
+}
+
+TEST(ReceiveBufferPoolTest, bufferOutlivesPool) {
+  std::shared_ptr<std::vector<uint8_t>> buffer;
+  {
+    ReceiveBufferPool pool(4, 1024);
+    buffer = pool.acquire(10);
+  }
+  (*buffer)[9] = 1;
+  EXPECT_EQ(1, (*buffer)[9]);
+}
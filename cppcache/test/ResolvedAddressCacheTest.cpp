@@ -0,0 +1,69 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <chrono>
+#include <thread>
+
+#include <boost/asio.hpp>
+
+#include <gtest/gtest.h>
+
+#include "ResolvedAddressCache.hpp"
+
+using apache::geode::client::ResolvedAddressCache;
+
+namespace {
+
+ResolvedAddressCache::results_type resolveLoopback(uint16_t port) {
+  boost::asio::io_context context;
+  boost::asio::ip::tcp::resolver resolver(context);
+  return resolver.resolve("127.0.0.1", std::to_string(port));
+}
+
+}  // namespace
+
+TEST(ResolvedAddressCacheTest, findsInsertedAddresses) {
+  ResolvedAddressCache cache(std::chrono::minutes(1));
+  ResolvedAddressCache::results_type results;
+  EXPECT_FALSE(cache.find("localhost", 40404, results));
+
+  cache.insert("localhost", 40404, resolveLoopback(40404));
+  ASSERT_TRUE(cache.find("localhost", 40404, results));
+  ASSERT_FALSE(results.empty());
+  EXPECT_EQ(40404, results.begin()->endpoint().port());
+
+  EXPECT_FALSE(cache.find("localhost", 40405, results));
+}
+
+TEST(ResolvedAddressCacheTest, eraseForgetsAddresses) {
+  ResolvedAddressCache cache(std::chrono::minutes(1));
+  cache.insert("localhost", 40404, resolveLoopback(40404));
+  cache.erase("localhost", 40404);
+
+  ResolvedAddressCache::results_type results;
+  EXPECT_FALSE(cache.find("localhost", 40404, results));
+}
+
+TEST(ResolvedAddressCacheTest, addressesExpire) {
+  ResolvedAddressCache cache(std::chrono::milliseconds(10));
+  cache.insert("localhost", 40404, resolveLoopback(40404));
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+  ResolvedAddressCache::results_type results;
+  EXPECT_FALSE(cache.find("localhost", 40404, results));
+}
@@ -0,0 +1,106 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <openssl/ssl.h>
+
+#include <chrono>
+#include <memory>
+#include <string>
+
+#include <boost/asio.hpp>
+
+#include <gtest/gtest.h>
+
+#include <geode/ExceptionTypes.hpp>
+
+#include "SslContext.hpp"
+#include "SslServer.hpp"
+#include "TcpSslConn.hpp"
+
+using apache::geode::client::Connector;
+using apache::geode::client::SslContext;
+using apache::geode::client::SslException;
+using apache::geode::client::TcpSslConn;
+
+namespace {
+
+class SslContextTest : public ::testing::TestWithParam<int> {
+ protected:
+  // Handshakes with server, naming it serverName, and echoes a message so
+  // that session tickets sent after a TLS 1.3 handshake are read. Returns
+  // whether the session was resumed.
+  bool connect(SslContext& context, const SslServer& server,
+               const std::string& serverName) {
+    boost::asio::io_context io;
+    boost::asio::ip::tcp::socket socket(io);
+    socket.connect(boost::asio::ip::tcp::endpoint(
+        boost::asio::ip::address_v4::loopback(), server.port()));
+
+    auto ssl = SSL_new(context.get().native_handle());
+    context.prepare(ssl, serverName);
+    SSL_set_fd(ssl, static_cast<int>(socket.native_handle()));
+    EXPECT_EQ(1, SSL_connect(ssl));
+    char message[4] = {'p', 'i', 'n', 'g'};
+    EXPECT_EQ(4, SSL_write(ssl, message, 4));
+    EXPECT_EQ(4, SSL_read(ssl, message, 4));
+
+    auto reused = SSL_session_reused(ssl) == 1;
+    SSL_set_shutdown(ssl, SSL_SENT_SHUTDOWN | SSL_RECEIVED_SHUTDOWN);
+    SSL_free(ssl);
+    return reused;
+  }
+};
+
+}  // namespace
+
+TEST_P(SslContextTest, resumesSessionWithSameServer) {
+  SslServer server(GetParam());
+  SslContext context(server.certificateFile(), "", "");
+
+  EXPECT_FALSE(connect(context, server, "server"));
+  EXPECT_EQ(1u, context.sessionCount());
+  EXPECT_TRUE(connect(context, server, "server"));
+  EXPECT_EQ(1, server.resumedHandshakes());
+
+  // a session is only offered to the server it was negotiated with
+  EXPECT_FALSE(connect(context, server, "other"));
+  EXPECT_EQ(2u, context.sessionCount());
+  EXPECT_EQ(GetParam(), server.lastVersion());
+}
+
+TEST_P(SslContextTest, failedHandshakeForgetsSession) {
+  SslServer server(GetParam());
+  auto context = std::make_shared<SslContext>(server.certificateFile(), "", "");
+  {
+    TcpSslConn sslConn("127.0.0.1", server.port(), std::chrono::seconds(5),
+                       65536, context);
+    Connector& conn = sslConn;
+    char message[4] = {'p', 'i', 'n', 'g'};
+    conn.send(message, 4, std::chrono::seconds(5));
+    ASSERT_EQ(4u, conn.receive(message, 4, std::chrono::seconds(5)));
+  }
+  EXPECT_EQ(1u, context->sessionCount());
+
+  server.refuseHandshakes();
+  EXPECT_THROW(TcpSslConn("127.0.0.1", server.port(), std::chrono::seconds(5),
+                          65536, context),
+               SslException);
+  EXPECT_EQ(0u, context->sessionCount());
+}
+
+INSTANTIATE_TEST_SUITE_P(TlsVersions, SslContextTest,
+                         ::testing::Values(TLS1_2_VERSION, TLS1_3_VERSION));
@@ -0,0 +1,149 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "SslServer.hpp"
+
+#include <openssl/pem.h>
+#include <openssl/x509.h>
+
+#include <cstdio>
+#include <stdexcept>
+
+#include <boost/filesystem.hpp>
+
+namespace {
+
+EVP_PKEY* generateKey() {
+  EVP_PKEY* key = nullptr;
+  auto context = EVP_PKEY_CTX_new_id(EVP_PKEY_RSA, nullptr);
+  if (context == nullptr || EVP_PKEY_keygen_init(context) <= 0 ||
+      EVP_PKEY_CTX_set_rsa_keygen_bits(context, 2048) <= 0 ||
+      EVP_PKEY_keygen(context, &key) <= 0) {
+    key = nullptr;
+  }
+  EVP_PKEY_CTX_free(context);
+  if (key == nullptr) {
+    throw std::runtime_error("SslServer: cannot generate a key");
+  }
+  return key;
+}
+
+X509* selfSign(EVP_PKEY* key) {
+  auto certificate = X509_new();
+  X509_set_version(certificate, 2);
+  ASN1_INTEGER_set(X509_get_serialNumber(certificate), 1);
+  X509_gmtime_adj(X509_getm_notBefore(certificate), -60);
+  X509_gmtime_adj(X509_getm_notAfter(certificate), 24 * 60 * 60);
+  X509_set_pubkey(certificate, key);
+  auto name = X509_get_subject_name(certificate);
+  X509_NAME_add_entry_by_txt(
+      name, "CN", MBSTRING_ASC,
+      reinterpret_cast<const unsigned char*>("localhost"), -1, -1, 0);
+  X509_set_issuer_name(certificate, name);
+  if (X509_sign(certificate, key, EVP_sha256()) == 0) {
+    X509_free(certificate);
+    throw std::runtime_error("SslServer: cannot sign the certificate");
+  }
+  return certificate;
+}
+
+}  // namespace
+
+SslServer::SslServer(int version, const std::string& ciphers)
+    : context_(SSL_CTX_new(TLS_server_method())),
+      acceptor_(io_, boost::asio::ip::tcp::endpoint(
+                         boost::asio::ip::address_v4::loopback(), 0)),
+      stopped_(false),
+      refuse_(false),
+      handshakes_(0),
+      resumed_(0),
+      lastVersion_(0) {
+  auto key = generateKey();
+  auto certificate = selfSign(key);
+  SSL_CTX_use_certificate(context_, certificate);
+  SSL_CTX_use_PrivateKey(context_, key);
+  SSL_CTX_set_min_proto_version(context_, version);
+  SSL_CTX_set_max_proto_version(context_, version);
+  if (!ciphers.empty()) {
+    SSL_CTX_set_cipher_list(context_, ciphers.c_str());
+  }
+  // TLS 1.2 clients resume by session id from the server's cache
+  static const unsigned char sessionContext[] = "SslServer";
+  SSL_CTX_set_session_id_context(context_, sessionContext,
+                                 sizeof(sessionContext));
+
+  certificateFile_ = (boost::filesystem::temp_directory_path() /
+                      boost::filesystem::unique_path("%%%%-%%%%-%%%%.pem"))
+                         .string();
+  auto file = std::fopen(certificateFile_.c_str(), "w");
+  if (file == nullptr) {
+    throw std::runtime_error("SslServer: cannot write " + certificateFile_);
+  }
+  PEM_write_X509(file, certificate);
+  std::fclose(file);
+  X509_free(certificate);
+  EVP_PKEY_free(key);
+
+  thread_ = std::thread([this] { serve(); });
+}
+
+SslServer::~SslServer() {
+  stopped_ = true;
+  // wake the accept
+  boost::system::error_code ignored;
+  boost::asio::ip::tcp::socket wakeup(io_);
+  wakeup.connect(acceptor_.local_endpoint(), ignored);
+  thread_.join();
+  acceptor_.close(ignored);
+  SSL_CTX_free(context_);
+  boost::filesystem::remove(certificateFile_, ignored);
+}
+
+void SslServer::serve() {
+  while (!stopped_) {
+    boost::system::error_code ec;
+    boost::asio::ip::tcp::socket socket(io_);
+    acceptor_.accept(socket, ec);
+    if (ec || stopped_) {
+      break;
+    }
+    if (!refuse_) {
+      echo(socket);
+    }
+  }
+}
+
+void SslServer::echo(boost::asio::ip::tcp::socket& socket) {
+  auto ssl = SSL_new(context_);
+  SSL_set_fd(ssl, static_cast<int>(socket.native_handle()));
+  if (SSL_accept(ssl) == 1) {
+    lastVersion_ = SSL_version(ssl);
+    if (SSL_session_reused(ssl)) {
+      ++resumed_;
+    }
+    ++handshakes_;
+
+    char buffer[4096];
+    int read;
+    while ((read = SSL_read(ssl, buffer, sizeof(buffer))) > 0) {
+      if (SSL_write(ssl, buffer, read) <= 0) {
+        break;
+      }
+    }
+  }
+  SSL_free(ssl);
+}
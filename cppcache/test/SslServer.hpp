@@ -0,0 +1,80 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_SSLSERVER_H_
+#define GEODE_SSLSERVER_H_
+
+#include <openssl/ssl.h>
+
+#include <atomic>
+#include <string>
+#include <thread>
+
+#include <boost/asio.hpp>
+
+/**
+ * A TLS server on the loopback interface that echoes what it receives, one
+ * connection at a time. It presents a self-signed certificate, written to
+ * certificateFile() for clients to trust, and counts the handshakes it
+ * completed.
+ */
+class SslServer {
+ public:
+  /**
+   * @param version the only protocol version accepted, such as
+   * TLS1_2_VERSION, or 0 for any.
+   * @param ciphers the TLS 1.2 cipher list, or empty for OpenSSL's default.
+   */
+  explicit SslServer(int version = 0, const std::string& ciphers = "");
+  ~SslServer();
+
+  SslServer(const SslServer&) = delete;
+  SslServer& operator=(const SslServer&) = delete;
+
+  uint16_t port() const { return acceptor_.local_endpoint().port(); }
+
+  const std::string& certificateFile() const { return certificateFile_; }
+
+  /** Closes later connections before their handshake. */
+  void refuseHandshakes() { refuse_ = true; }
+
+  int handshakes() const { return handshakes_; }
+
+  int resumedHandshakes() const { return resumed_; }
+
+  /** The protocol version negotiated by the last handshake. */
+  int lastVersion() const { return lastVersion_; }
+
+ private:
+  void serve();
+  void echo(boost::asio::ip::tcp::socket& socket);
+
+  SSL_CTX* context_;
+  std::string certificateFile_;
+  boost::asio::io_context io_;
+  boost::asio::ip::tcp::acceptor acceptor_;
+  std::atomic<bool> stopped_;
+  std::atomic<bool> refuse_;
+  std::atomic<int> handshakes_;
+  std::atomic<int> resumed_;
+  std::atomic<int> lastVersion_;
+  std::thread thread_;
+};
+
+#endif  // GEODE_SSLSERVER_H_
@@ -0,0 +1,120 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <geode/ExceptionTypes.hpp>
+#include <geode/StreamingResultCollector.hpp>
+
+using apache::geode::client::Cacheable;
+using apache::geode::client::CacheableInt32;
+using apache::geode::client::FunctionExecutionException;
+using apache::geode::client::IllegalStateException;
+using apache::geode::client::StreamingResultCollector;
+
+TEST(StreamingResultCollectorTest, deliversResultsInOrderWithBoundedQueue) {
+  StreamingResultCollector collector(2);
+  std::atomic<int> added(0);
+  std::thread producer([&] {
+    for (int i = 0; i < 10; ++i) {
+      collector.addResult(CacheableInt32::create(i));
+      ++added;
+    }
+    collector.endResults();
+  });
+
+  // the producer cannot get past a full queue until a result is taken
+  while (added.load() < 2) {
+    std::this_thread::yield();
+  }
+  EXPECT_EQ(2, added.load());
+
+  std::shared_ptr<Cacheable> result;
+  for (int i = 0; i < 10; ++i) {
+    ASSERT_TRUE(collector.next(result));
+    EXPECT_EQ(i, std::dynamic_pointer_cast<CacheableInt32>(result)->value());
+  }
+  EXPECT_FALSE(collector.next(result));
+  producer.join();
+}
+
+TEST(StreamingResultCollectorTest, cancelReleasesBlockedProducer) {
+  StreamingResultCollector collector(1);
+  collector.addResult(CacheableInt32::create(1));
+  std::thread producer([&] {
+    collector.addResult(CacheableInt32::create(2));
+    collector.addResult(CacheableInt32::create(3));
+  });
+
+  collector.cancel();
+  producer.join();
+
+  std::shared_ptr<Cacheable> result;
+  EXPECT_TRUE(collector.isCancelled());
+  EXPECT_FALSE(collector.next(result));
+}
+
+TEST(StreamingResultCollectorTest, failureIsRaisedAfterQueuedResults) {
+  StreamingResultCollector collector;
+  collector.addResult(CacheableInt32::create(1));
+  collector.setException(
+      std::make_exception_ptr(IllegalStateException("server failed")));
+
+  std::shared_ptr<Cacheable> result;
+  EXPECT_TRUE(collector.next(result));
+  EXPECT_THROW(collector.next(result), IllegalStateException);
+}
+
+TEST(StreamingResultCollectorTest, nextTimesOutWithoutResults) {
+  StreamingResultCollector collector;
+  std::shared_ptr<Cacheable> result;
+  EXPECT_THROW(collector.next(result, std::chrono::milliseconds(10)),
+               FunctionExecutionException);
+}
+
+TEST(StreamingResultCollectorTest, failsExecutionWhenResultsAreNotTaken) {
+  StreamingResultCollector collector(1);
+  collector.setTimeout(std::chrono::milliseconds(10));
+  collector.addResult(CacheableInt32::create(1));
+  EXPECT_THROW(collector.addResult(CacheableInt32::create(2)),
+               FunctionExecutionException);
+
+  // later results are dropped; the consumer gets the queued one, then the
+  // error
+  collector.addResult(CacheableInt32::create(3));
+  std::shared_ptr<Cacheable> result;
+  ASSERT_TRUE(collector.next(result));
+  EXPECT_EQ(1, std::dynamic_pointer_cast<CacheableInt32>(result)->value());
+  EXPECT_THROW(collector.next(result), FunctionExecutionException);
+}
+
+TEST(StreamingResultCollectorTest, retryFailsOnceAResultWasTaken) {
+  StreamingResultCollector collector;
+  collector.addResult(CacheableInt32::create(1));
+  collector.clearResults();
+
+  collector.addResult(CacheableInt32::create(2));
+  std::shared_ptr<Cacheable> result;
+  ASSERT_TRUE(collector.next(result));
+  EXPECT_EQ(2, std::dynamic_pointer_cast<CacheableInt32>(result)->value());
+  EXPECT_THROW(collector.clearResults(), FunctionExecutionException);
+}
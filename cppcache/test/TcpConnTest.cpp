@@ -0,0 +1,111 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/asio.hpp>
+
+#include <gtest/gtest.h>
+
+#include "TcpConn.hpp"
+
+using apache::geode::client::Connector;
+using apache::geode::client::TcpConn;
+
+namespace {
+
+// Accepts one connection, writes payload to it in a single write and keeps
+// the connection open until destroyed.
+class WritingServer {
+ public:
+  explicit WritingServer(std::string payload)
+      : payload_(std::move(payload)),
+        acceptor_(context_, boost::asio::ip::tcp::endpoint(
+                                boost::asio::ip::address_v4::loopback(), 0)),
+        thread_([this] { serve(); }) {}
+
+  ~WritingServer() {
+    boost::system::error_code ignored;
+    acceptor_.close(ignored);
+    thread_.join();
+  }
+
+  uint16_t port() const { return acceptor_.local_endpoint().port(); }
+
+ private:
+  void serve() {
+    boost::system::error_code ec;
+    boost::asio::ip::tcp::socket socket(context_);
+    acceptor_.accept(socket, ec);
+    boost::asio::write(socket, boost::asio::buffer(payload_), ec);
+    char buffer[1];
+    socket.read_some(boost::asio::buffer(buffer), ec);
+  }
+
+  std::string payload_;
+  boost::asio::io_context context_;
+  boost::asio::ip::tcp::acceptor acceptor_;
+  std::thread thread_;
+};
+
+}  // namespace
+
+TEST(TcpConnTest, receivesFramesOutOfOneRead) {
+  WritingServer server("headerbody-of-message-onenext");
+  std::unique_ptr<Connector> conn(new TcpConn(
+      "127.0.0.1", server.port(), std::chrono::seconds(5), 65536));
+
+  std::vector<char> buffer(32);
+  ASSERT_EQ(6u, conn->receive(buffer.data(), 6, std::chrono::seconds(5)));
+  EXPECT_EQ("header", std::string(buffer.data(), 6));
+  ASSERT_EQ(19u, conn->receive(buffer.data(), 19, std::chrono::seconds(5)));
+  EXPECT_EQ("body-of-message-one", std::string(buffer.data(), 19));
+  ASSERT_EQ(4u, conn->receive(buffer.data(), 4, std::chrono::seconds(5)));
+  EXPECT_EQ("next", std::string(buffer.data(), 4));
+}
+
+TEST(TcpConnTest, largeReadStraddlesReadAheadBuffer) {
+  std::string large(100 * 1024, '\0');
+  for (size_t i = 0; i < large.size(); ++i) {
+    large[i] = static_cast<char>('a' + i % 26);
+  }
+  WritingServer server("head" + large);
+  std::unique_ptr<Connector> conn(new TcpConn(
+      "127.0.0.1", server.port(), std::chrono::seconds(5), 65536));
+
+  std::vector<char> buffer(large.size());
+  ASSERT_EQ(4u, conn->receive(buffer.data(), 4, std::chrono::seconds(5)));
+  EXPECT_EQ("head", std::string(buffer.data(), 4));
+  ASSERT_EQ(large.size(), conn->receive(buffer.data(), large.size(),
+                                        std::chrono::seconds(5)));
+  EXPECT_EQ(large, std::string(buffer.data(), buffer.size()));
+}
+
+TEST(TcpConnTest, receiveTimesOutAfterReadAheadIsDrained) {
+  WritingServer server("abc");
+  std::unique_ptr<Connector> conn(new TcpConn(
+      "127.0.0.1", server.port(), std::chrono::seconds(5), 65536));
+
+  char buffer[4];
+  ASSERT_EQ(1u, conn->receive(buffer, 1, std::chrono::seconds(5)));
+  EXPECT_THROW(conn->receive(buffer, 4, std::chrono::milliseconds(50)),
+               boost::system::system_error);
+}
@@ -0,0 +1,86 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <openssl/ssl.h>
+
+#include <chrono>
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "SslContext.hpp"
+#include "SslServer.hpp"
+#include "TcpSslConn.hpp"
+
+using apache::geode::client::Connector;
+using apache::geode::client::SslContext;
+using apache::geode::client::TcpSslConn;
+
+namespace {
+
+void expectEcho(const SslServer& server,
+                const std::shared_ptr<SslContext>& context) {
+  TcpSslConn sslConn("127.0.0.1", server.port(), std::chrono::seconds(5),
+                     65536, context);
+  Connector& conn = sslConn;
+  const std::string message(10000, 'x');
+  ASSERT_EQ(message.size(), conn.send(message.data(), message.size(),
+                                      std::chrono::seconds(5)));
+  std::string echoed(message.size(), '\0');
+  ASSERT_EQ(message.size(), conn.receive(&echoed[0], echoed.size(),
+                                         std::chrono::seconds(5)));
+  EXPECT_EQ(message, echoed);
+}
+
+}  // namespace
+
+TEST(TcpSslConnTest, offloadsRecordsToTheKernel) {
+  if (!SslContext::ktlsSupported()) {
+    GTEST_SKIP() << "the kernel does not offer the tls upper layer protocol";
+  }
+  SslServer server;
+  auto context =
+      std::make_shared<SslContext>(server.certificateFile(), "", "", true);
+
+  expectEcho(server, context);
+  expectEcho(server, context);
+  EXPECT_TRUE(context->useKtls());
+  EXPECT_EQ(TLS1_2_VERSION, server.lastVersion());
+  EXPECT_EQ(1, server.resumedHandshakes());
+}
+
+TEST(TcpSslConnTest, fallsBackWhenCipherCannotBeOffloaded) {
+  // the kernel offloads AEAD ciphers only
+  SslServer server(TLS1_2_VERSION, "AES128-SHA256");
+  auto context =
+      std::make_shared<SslContext>(server.certificateFile(), "", "", true);
+
+  expectEcho(server, context);
+  EXPECT_FALSE(context->useKtls());
+  expectEcho(server, context);
+}
+
+TEST(TcpSslConnTest, fallsBackWhenServerRequiresTls13) {
+  SslServer server(TLS1_3_VERSION);
+  auto context =
+      std::make_shared<SslContext>(server.certificateFile(), "", "", true);
+
+  expectEcho(server, context);
+  EXPECT_FALSE(context->useKtls());
+  EXPECT_EQ(TLS1_3_VERSION, server.lastVersion());
+}
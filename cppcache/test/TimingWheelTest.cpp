@@ -0,0 +1,166 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+
+#include <gtest/gtest.h>
+
+#include "TimingWheel.hpp"
+
+using apache::geode::client::TimingWheel;
+
+namespace {
+
+class CountingHandler : public ACE_Event_Handler {
+ public:
+  CountingHandler(int& timeouts, int& closes, int& deletes)
+      : timeouts_(timeouts), closes_(closes), deletes_(deletes) {}
+
+  ~CountingHandler() override { ++deletes_; }
+
+  int handle_timeout(const ACE_Time_Value&, const void*) override {
+    ++timeouts_;
+    return 0;
+  }
+
+  int handle_close(ACE_HANDLE, ACE_Reactor_Mask) override {
+    ++closes_;
+    return 0;
+  }
+
+ private:
+  int& timeouts_;
+  int& closes_;
+  int& deletes_;
+};
+
+class ResettingHandler : public ACE_Event_Handler {
+ public:
+  explicit ResettingHandler(TimingWheel& wheel) : wheel_(wheel), id_(0) {}
+
+  int handle_timeout(const ACE_Time_Value&, const void*) override {
+    wheel_.reset(id_, TimingWheel::clock::duration::zero());
+    return 0;
+  }
+
+  TimingWheel& wheel_;
+  TimingWheel::id_type id_;
+};
+
+const auto TICK = std::chrono::milliseconds(10);
+
+}  // namespace
+
+TEST(TimingWheelTest, oneShotTaskFiresOnceAndDeletesHandler) {
+  int timeouts = 0, closes = 0, deletes = 0;
+  TimingWheel wheel(TICK);
+  const auto now = TimingWheel::clock::now();
+
+  wheel.schedule(new CountingHandler(timeouts, closes, deletes),
+                 std::chrono::milliseconds(50),
+                 TimingWheel::clock::duration::zero());
+  EXPECT_EQ(0, wheel.expire(now));
+  EXPECT_EQ(0, timeouts);
+
+  EXPECT_EQ(1, wheel.expire(now + std::chrono::milliseconds(100)));
+  EXPECT_EQ(1, timeouts);
+  EXPECT_EQ(1, deletes);
+  EXPECT_EQ(0, closes);
+  EXPECT_EQ(0, wheel.size());
+}
+
+TEST(TimingWheelTest, intervalTaskIsRescheduled) {
+  int timeouts = 0, closes = 0, deletes = 0;
+  CountingHandler handler(timeouts, closes, deletes);
+  TimingWheel wheel(TICK);
+  const auto now = TimingWheel::clock::now();
+
+  auto id = wheel.schedule(&handler, std::chrono::milliseconds(20),
+                           std::chrono::milliseconds(20));
+  wheel.expire(now + std::chrono::milliseconds(100));
+  EXPECT_EQ(1, timeouts);
+  wheel.expire(now + std::chrono::milliseconds(200));
+  EXPECT_EQ(2, timeouts);
+  EXPECT_EQ(1, wheel.size());
+
+  EXPECT_EQ(1, wheel.cancel(id));
+  EXPECT_EQ(1, closes);
+  EXPECT_EQ(0, wheel.size());
+}
+
+TEST(TimingWheelTest, cancelledTaskDoesNotFire) {
+  int timeouts = 0, closes = 0, deletes = 0;
+  CountingHandler handler(timeouts, closes, deletes);
+  TimingWheel wheel(TICK);
+  const auto now = TimingWheel::clock::now();
+
+  auto id = wheel.schedule(&handler, std::chrono::milliseconds(20),
+                           TimingWheel::clock::duration::zero());
+  EXPECT_EQ(1, wheel.cancel(id, true));
+  EXPECT_EQ(0, wheel.cancel(id));
+  wheel.expire(now + std::chrono::milliseconds(100));
+  EXPECT_EQ(0, timeouts);
+  EXPECT_EQ(0, closes);
+}
+
+TEST(TimingWheelTest, resetInsideHandleTimeoutEndsTask) {
+  TimingWheel wheel(TICK);
+  const auto now = TimingWheel::clock::now();
+
+  auto handler = new ResettingHandler(wheel);
+  handler->id_ = wheel.schedule(handler, std::chrono::milliseconds(10),
+                                std::chrono::seconds(1));
+  EXPECT_EQ(1, wheel.expire(now + std::chrono::milliseconds(100)));
+  EXPECT_EQ(0, wheel.size());
+}
+
+TEST(TimingWheelTest, tasksCascadeFromHigherLevels) {
+  int timeouts = 0, closes = 0, deletes = 0;
+  TimingWheel wheel(std::chrono::milliseconds(1));
+  const auto now = TimingWheel::clock::now();
+
+  for (auto delay : {std::chrono::milliseconds(300),
+                     std::chrono::milliseconds(70000),
+                     std::chrono::milliseconds(20000000)}) {
+    wheel.schedule(new CountingHandler(timeouts, closes, deletes), delay,
+                   TimingWheel::clock::duration::zero());
+  }
+
+  wheel.expire(now + std::chrono::milliseconds(250));
+  EXPECT_EQ(0, timeouts);
+  wheel.expire(now + std::chrono::milliseconds(350));
+  EXPECT_EQ(1, timeouts);
+  wheel.expire(now + std::chrono::milliseconds(69000));
+  EXPECT_EQ(1, timeouts);
+  wheel.expire(now + std::chrono::milliseconds(71000));
+  EXPECT_EQ(2, timeouts);
+  wheel.expire(now + std::chrono::milliseconds(20001000));
+  EXPECT_EQ(3, timeouts);
+  EXPECT_EQ(3, deletes);
+}
+
+TEST(TimingWheelTest, pendingHandlersAreClosedOnDestruction) {
+  int timeouts = 0, closes = 0, deletes = 0;
+  CountingHandler handler(timeouts, closes, deletes);
+  {
+    TimingWheel wheel(TICK);
+    wheel.schedule(&handler, std::chrono::seconds(10),
+                   TimingWheel::clock::duration::zero());
+  }
+  EXPECT_EQ(1, closes);
+  EXPECT_EQ(0, timeouts);
+}
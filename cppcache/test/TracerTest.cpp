@@ -0,0 +1,228 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "FileTraceExporter.hpp"
+#include "Tracer.hpp"
+
+using apache::geode::client::FileTraceExporter;
+using apache::geode::client::TraceContext;
+using apache::geode::client::TraceExporter;
+using apache::geode::client::Tracer;
+using apache::geode::client::TraceScope;
+using apache::geode::client::TraceSpan;
+
+namespace {
+
+class CollectingExporter : public TraceExporter {
+ public:
+  void exportSpans(const std::vector<TraceSpan>& spans) override {
+    std::lock_guard<std::mutex> guard(mutex_);
+    spans_.insert(spans_.end(), spans.begin(), spans.end());
+  }
+
+  void shutdown() override { shutdown_ = true; }
+
+  std::vector<TraceSpan> spans() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return spans_;
+  }
+
+  bool isShutdown() const { return shutdown_; }
+
+ private:
+  std::mutex mutex_;
+  std::vector<TraceSpan> spans_;
+  bool shutdown_ = false;
+};
+
+class BlockingExporter : public CollectingExporter {
+ public:
+  void exportSpans(const std::vector<TraceSpan>& spans) override {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      exporting_ = true;
+      cond_.notify_all();
+      cond_.wait(lock, [this] { return released_; });
+    }
+    CollectingExporter::exportSpans(spans);
+  }
+
+  void waitUntilExporting() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cond_.wait(lock, [this] { return exporting_; });
+  }
+
+  void release() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    released_ = true;
+    cond_.notify_all();
+  }
+
+ private:
+  std::mutex mutex_;
+  std::condition_variable cond_;
+  bool exporting_ = false;
+  bool released_ = false;
+};
+
+}  // namespace
+
+TEST(TracerTest, unsampledOperationsRecordNothing) {
+  auto exporter = std::make_shared<CollectingExporter>();
+  Tracer tracer(0.0, 16, std::chrono::seconds(60), exporter);
+  {
+    TraceScope root(&tracer, "Region::get");
+    EXPECT_FALSE(root.isRecording());
+    TraceScope child("send");
+    EXPECT_FALSE(child.isRecording());
+  }
+  tracer.stop();
+
+  EXPECT_TRUE(exporter->spans().empty());
+  EXPECT_TRUE(exporter->isShutdown());
+}
+
+TEST(TracerTest, childSpansShareTraceAndLinkToParent) {
+  auto exporter = std::make_shared<CollectingExporter>();
+  Tracer tracer(1.0, 16, std::chrono::seconds(60), exporter);
+  {
+    TraceScope root(&tracer, "Region::get");
+    root.setAttribute("region", "/region");
+    {
+      TraceScope child("send");
+      EXPECT_TRUE(child.isRecording());
+    }
+    TraceScope failed("server.wait");
+    failed.setError();
+  }
+  EXPECT_FALSE(Tracer::current().isSampled());
+  tracer.stop();
+
+  auto spans = exporter->spans();
+  ASSERT_EQ(3u, spans.size());
+  // spans are recorded as they finish, children first
+  const auto& send = spans[0];
+  const auto& wait = spans[1];
+  const auto& root = spans[2];
+  EXPECT_EQ("send", send.name);
+  EXPECT_EQ("server.wait", wait.name);
+  EXPECT_EQ("Region::get", root.name);
+
+  EXPECT_EQ(0u, root.parentSpanId);
+  EXPECT_NE(0u, root.spanId);
+  EXPECT_EQ(root.spanId, send.parentSpanId);
+  EXPECT_EQ(root.spanId, wait.parentSpanId);
+  EXPECT_EQ(root.traceIdHigh, send.traceIdHigh);
+  EXPECT_EQ(root.traceIdLow, send.traceIdLow);
+  EXPECT_NE(send.spanId, wait.spanId);
+
+  EXPECT_FALSE(send.error);
+  EXPECT_TRUE(wait.error);
+  ASSERT_EQ(1u, root.attributes.size());
+  EXPECT_EQ("region", root.attributes[0].first);
+  EXPECT_EQ("/region", root.attributes[0].second);
+  EXPECT_GE(root.duration, send.duration);
+}
+
+TEST(TracerTest, contextCarriesSpanToAnotherThread) {
+  auto exporter = std::make_shared<CollectingExporter>();
+  Tracer tracer(1.0, 16, std::chrono::seconds(60), exporter);
+  uint64_t rootSpanId;
+  {
+    TraceScope root(&tracer, "Region::getAll");
+    TraceContext context = Tracer::current();
+    rootSpanId = context.spanId;
+    std::thread worker([&context] {
+      EXPECT_FALSE(Tracer::current().isSampled());
+      TraceScope chunk(context, "chunk.process");
+      EXPECT_TRUE(chunk.isRecording());
+    });
+    worker.join();
+  }
+  tracer.stop();
+
+  auto spans = exporter->spans();
+  ASSERT_EQ(2u, spans.size());
+  EXPECT_EQ("chunk.process", spans[0].name);
+  EXPECT_EQ(rootSpanId, spans[0].parentSpanId);
+  EXPECT_EQ(spans[1].traceIdLow, spans[0].traceIdLow);
+}
+
+TEST(TracerTest, fullBufferDropsOldestSpans) {
+  auto exporter = std::make_shared<BlockingExporter>();
+  Tracer tracer(1.0, 4, std::chrono::hours(1), exporter);
+  auto record = [&tracer](int i) {
+    TraceScope span(&tracer, "Region::put");
+    span.setAttribute("i", std::to_string(i));
+  };
+
+  // half a buffer wakes the export thread, which then blocks in the exporter
+  record(0);
+  record(1);
+  exporter->waitUntilExporting();
+  for (int i = 2; i < 8; ++i) {
+    record(i);
+  }
+  EXPECT_EQ(2u, tracer.getDroppedCount());
+
+  exporter->release();
+  tracer.stop();
+
+  std::vector<std::string> exported;
+  for (const auto& span : exporter->spans()) {
+    exported.push_back(span.attributes[0].second);
+  }
+  EXPECT_EQ((std::vector<std::string>{"0", "1", "4", "5", "6", "7"}),
+            exported);
+}
+
+TEST(FileTraceExporterTest, writesOtlpJsonFields) {
+  TraceSpan span;
+  span.traceIdHigh = 0x0102030405060708ULL;
+  span.traceIdLow = 0x090a0b0c0d0e0f10ULL;
+  span.spanId = 0xffULL;
+  span.parentSpanId = 0x1ULL;
+  span.name = "Region::\"get\"";
+  span.start = std::chrono::system_clock::time_point(
+      std::chrono::duration_cast<std::chrono::system_clock::duration>(
+          std::chrono::seconds(1)));
+  span.duration = std::chrono::nanoseconds(500);
+  span.attributes.emplace_back("region", "/r");
+  span.error = true;
+
+  EXPECT_EQ(
+      "{\"traceId\":\"0102030405060708090a0b0c0d0e0f10\","
+      "\"spanId\":\"00000000000000ff\","
+      "\"parentSpanId\":\"0000000000000001\","
+      "\"name\":\"Region::\\\"get\\\"\","
+      "\"startTimeUnixNano\":\"1000000000\","
+      "\"endTimeUnixNano\":\"1000000500\","
+      "\"attributes\":[{\"key\":\"region\",\"value\":{\"stringValue\":\"/r\"}}"
+      "],\"status\":{\"code\":2}}",
+      FileTraceExporter::toJson(span));
+}
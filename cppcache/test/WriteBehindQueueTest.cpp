@@ -0,0 +1,149 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "WriteBehindQueue.hpp"
+
+using apache::geode::client::CacheableInt32;
+using apache::geode::client::CacheableKey;
+using apache::geode::client::CacheableString;
+using apache::geode::client::HashMapOfCacheable;
+using apache::geode::client::WriteBehindQueue;
+
+namespace {
+
+class BatchRecorder {
+ public:
+  WriteBehindQueue::Writer writer(GfErrType result = GF_NOERR) {
+    return [this, result](const HashMapOfCacheable& batch) {
+      std::lock_guard<std::mutex> guard(mutex_);
+      batches_.push_back(batch);
+      return result;
+    };
+  }
+
+  std::vector<HashMapOfCacheable> batches() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return batches_;
+  }
+
+ private:
+  std::mutex mutex_;
+  std::vector<HashMapOfCacheable> batches_;
+};
+
+std::shared_ptr<CacheableKey> key(const char* name) {
+  return CacheableString::create(name);
+}
+
+}  // namespace
+
+TEST(WriteBehindQueueTest, coalescesPutsToTheSameKey) {
+  BatchRecorder recorder;
+  WriteBehindQueue queue(10, std::chrono::milliseconds::zero(),
+                         recorder.writer());
+  queue.put(key("a"), CacheableInt32::create(1));
+  queue.put(key("a"), CacheableInt32::create(2));
+  queue.put(key("b"), CacheableInt32::create(3));
+
+  EXPECT_EQ(2u, queue.size());
+  EXPECT_TRUE(queue.contains(key("a")));
+  EXPECT_TRUE(recorder.batches().empty());
+
+  EXPECT_EQ(GF_NOERR, queue.flush());
+  auto batches = recorder.batches();
+  ASSERT_EQ(1u, batches.size());
+  ASSERT_EQ(2u, batches[0].size());
+  EXPECT_EQ(2, std::dynamic_pointer_cast<CacheableInt32>(
+                   batches[0].at(key("a")))
+                   ->value());
+  EXPECT_EQ(0u, queue.size());
+}
+
+TEST(WriteBehindQueueTest, writesFullBatches) {
+  BatchRecorder recorder;
+  WriteBehindQueue queue(2, std::chrono::milliseconds::zero(),
+                         recorder.writer());
+  queue.put(key("a"), CacheableInt32::create(1));
+  queue.put(key("b"), CacheableInt32::create(2));
+  queue.put(key("c"), CacheableInt32::create(3));
+
+  auto batches = recorder.batches();
+  ASSERT_EQ(1u, batches.size());
+  EXPECT_EQ(2u, batches[0].size());
+  EXPECT_EQ(1u, queue.size());
+}
+
+TEST(WriteBehindQueueTest, writesAfterInterval) {
+  BatchRecorder recorder;
+  WriteBehindQueue queue(100, std::chrono::milliseconds(20),
+                         recorder.writer());
+  queue.put(key("a"), CacheableInt32::create(1));
+
+  for (int i = 0; i < 100 && recorder.batches().empty(); ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  ASSERT_EQ(1u, recorder.batches().size());
+  EXPECT_EQ(0u, queue.size());
+}
+
+TEST(WriteBehindQueueTest, closeWritesQueuedPutsAndReportsErrors) {
+  BatchRecorder recorder;
+  WriteBehindQueue queue(100, std::chrono::seconds(60),
+                         recorder.writer(GF_NOTCON));
+  queue.put(key("a"), CacheableInt32::create(1));
+  EXPECT_EQ(GF_NOTCON, queue.flush());
+
+  queue.put(key("b"), CacheableInt32::create(2));
+  queue.close();
+  EXPECT_EQ(2u, recorder.batches().size());
+
+  // once closed puts are written immediately
+  queue.put(key("c"), CacheableInt32::create(3));
+  EXPECT_EQ(3u, recorder.batches().size());
+}
+
+TEST(WriteBehindQueueTest, containsKeysOfTheBatchBeingWritten) {
+  std::promise<void> writing;
+  std::promise<void> release;
+  auto released = release.get_future().share();
+  WriteBehindQueue queue(100, std::chrono::milliseconds::zero(),
+                         [&](const HashMapOfCacheable&) {
+                           writing.set_value();
+                           released.wait();
+                           return GF_NOERR;
+                         });
+  queue.put(key("a"), CacheableInt32::create(1));
+
+  std::thread flusher([&queue] { queue.flush(); });
+  writing.get_future().wait();
+  EXPECT_EQ(0u, queue.size());
+  EXPECT_TRUE(queue.contains(key("a")));
+  EXPECT_FALSE(queue.contains(key("b")));
+
+  release.set_value();
+  flusher.join();
+  EXPECT_FALSE(queue.contains(key("a")));
+}
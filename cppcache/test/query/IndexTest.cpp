@@ -0,0 +1,208 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <geode/ExceptionTypes.hpp>
+#include <geode/Struct.hpp>
+
+#include "StructSetImpl.hpp"
+#include "query/IndexManager.hpp"
+#include "query/Parser.hpp"
+
+using apache::geode::client::CacheableInt32;
+using apache::geode::client::CacheableKey;
+using apache::geode::client::CacheableString;
+using apache::geode::client::CacheableVector;
+using apache::geode::client::IllegalArgumentException;
+using apache::geode::client::Serializable;
+using apache::geode::client::StructSet;
+using apache::geode::client::StructSetImpl;
+using apache::geode::client::query::Index;
+using apache::geode::client::query::IndexManager;
+using apache::geode::client::query::Parser;
+using apache::geode::client::query::QuerySource;
+using apache::geode::client::query::Value;
+
+namespace {
+
+class IndexTest : public ::testing::Test, public QuerySource {
+ protected:
+  void SetUp() override {
+    auto values = CacheableVector::create();
+    const char* status[] = {"active", "inactive", "active", "closed"};
+    const int32_t prices[] = {30, 10, 50, 20};
+    for (int32_t i = 0; i < 4; i++) {
+      values->push_back(CacheableString::create(status[i]));
+      values->push_back(CacheableInt32::create(prices[i]));
+    }
+    rows_ = std::make_shared<StructSetImpl>(
+        values, std::vector<std::string>{"status", "price"});
+    for (size_t i = 0; i < rows_->size(); i++) {
+      keys_.push_back(CacheableString::create("key" + std::to_string(i)));
+    }
+  }
+
+  std::shared_ptr<Index> populate(Index::Type type,
+                                  const std::string& expression) {
+    auto index =
+        std::make_shared<Index>("index", type, expression, "/region r");
+    for (size_t i = 0; i < keys_.size(); i++) {
+      index->update(keys_[i], (*rows_)[i]);
+    }
+    return index;
+  }
+
+  static std::vector<std::string> names(const Index::key_list& keys) {
+    std::vector<std::string> result;
+    for (const auto& key : keys) {
+      result.push_back(key->toString());
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+  }
+
+  void forEach(const Visitor& visitor) override {
+    scans++;
+    for (size_t i = 0; i < keys_.size(); i++) {
+      if (!visitor(keys_[i], (*rows_)[i])) {
+        break;
+      }
+    }
+  }
+
+  bool get(const std::shared_ptr<CacheableKey>& key,
+           std::shared_ptr<Serializable>& value) override {
+    for (size_t i = 0; i < keys_.size(); i++) {
+      if (*keys_[i] == *key) {
+        value = (*rows_)[i];
+        return true;
+      }
+    }
+    return false;
+  }
+
+  std::shared_ptr<const Index> findIndex(const std::vector<std::string>& path,
+                                         bool sorted) override {
+    return manager_.find(path, sorted);
+  }
+
+  std::shared_ptr<StructSet> rows_;
+  std::vector<std::shared_ptr<CacheableKey>> keys_;
+  IndexManager manager_;
+  int scans = 0;
+};
+
+}  // namespace
+
+TEST_F(IndexTest, hashIndexFollowsUpdates) {
+  auto index = populate(Index::Type::Hash, "r.status");
+  EXPECT_EQ(std::vector<std::string>{"status"}, index->path());
+  EXPECT_EQ(4, index->size());
+
+  Index::key_list keys;
+  index->lookup(Value::of(std::string("active")), keys);
+  EXPECT_EQ((std::vector<std::string>{"key0", "key2"}), names(keys));
+
+  index->update(keys_[0], (*rows_)[3]);
+  index->remove(keys_[2]);
+  index->update(keys_[1], nullptr);
+  keys.clear();
+  index->lookup(Value::of(std::string("active")), keys);
+  EXPECT_TRUE(keys.empty());
+  index->lookup(Value::of(std::string("closed")), keys);
+  EXPECT_EQ((std::vector<std::string>{"key0", "key3"}), names(keys));
+  EXPECT_EQ(2, index->size());
+}
+
+TEST_F(IndexTest, updatesForReplacedValuesAreDropped) {
+  auto index = populate(Index::Type::Hash, "r.status");
+  auto replaced = [] { return false; };
+
+  index->update(keys_[0], (*rows_)[3], false, replaced);
+  index->update(keys_[2], nullptr, false, replaced);
+  Index::key_list keys;
+  index->lookup(Value::of(std::string("active")), keys);
+  EXPECT_EQ((std::vector<std::string>{"key0", "key2"}), names(keys));
+  EXPECT_EQ(4, index->size());
+}
+
+TEST_F(IndexTest, sortedIndexAnswersRanges) {
+  auto index = populate(Index::Type::Sorted, "price");
+
+  auto low = Value::of(static_cast<int64_t>(20));
+  auto high = Value::of(40.0);
+  Index::key_list keys;
+  index->lookupRange(&low, true, &high, false, keys);
+  EXPECT_EQ((std::vector<std::string>{"key0", "key3"}), names(keys));
+
+  keys.clear();
+  index->lookupRange(nullptr, false, &low, false, keys);
+  EXPECT_EQ(std::vector<std::string>{"key1"}, names(keys));
+
+  keys.clear();
+  index->lookupRange(&low, false, nullptr, false, keys);
+  EXPECT_EQ((std::vector<std::string>{"key0", "key2"}), names(keys));
+}
+
+TEST_F(IndexTest, rejectsExpressionsThatAreNotFields) {
+  EXPECT_THROW(Index("bad", Index::Type::Hash, "price * 2", "/region"),
+               IllegalArgumentException);
+  EXPECT_THROW(Index("bad", Index::Type::Hash, "r", "/region r"),
+               IllegalArgumentException);
+  EXPECT_THROW(Index("bad", Index::Type::Hash, "key", "/region.entrySet"),
+               IllegalArgumentException);
+}
+
+TEST_F(IndexTest, managerRejectsDuplicateNames) {
+  manager_.add(populate(Index::Type::Hash, "status"));
+  EXPECT_THROW(manager_.add(populate(Index::Type::Sorted, "price")),
+               IllegalArgumentException);
+  EXPECT_TRUE(manager_.remove("index"));
+  EXPECT_FALSE(manager_.remove("index"));
+  EXPECT_TRUE(manager_.empty());
+}
+
+TEST_F(IndexTest, queriesUseMatchingIndexes) {
+  auto query =
+      "SELECT p.price FROM /region p WHERE p.getStatus() = 'active' AND "
+      "p.price > 40";
+  auto statement = Parser(query).parse();
+
+  auto results = statement->execute(*this, nullptr);
+  EXPECT_EQ(1, results->size());
+  EXPECT_EQ(1, scans);
+
+  manager_.add(populate(Index::Type::Hash, "status"));
+  results = statement->execute(*this, nullptr);
+  ASSERT_EQ(1, results->size());
+  EXPECT_EQ(50,
+            std::dynamic_pointer_cast<CacheableInt32>((*results)[0])->value());
+  EXPECT_EQ(1, scans);
+
+  manager_.remove("index");
+  manager_.add(populate(Index::Type::Sorted, "price"));
+  statement = Parser("SELECT * FROM /region WHERE 25 < price").parse();
+  results = statement->execute(*this, nullptr);
+  EXPECT_EQ(2, results->size());
+  EXPECT_EQ(1, scans);
+}
@@ -0,0 +1,224 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <geode/ExceptionTypes.hpp>
+#include <geode/ResultSet.hpp>
+#include <geode/Struct.hpp>
+#include <geode/StructSet.hpp>
+
+#include "StructSetImpl.hpp"
+#include "query/Parser.hpp"
+
+using apache::geode::client::CacheableDouble;
+using apache::geode::client::CacheableInt16;
+using apache::geode::client::CacheableInt32;
+using apache::geode::client::CacheableInt64;
+using apache::geode::client::CacheableKey;
+using apache::geode::client::CacheableString;
+using apache::geode::client::CacheableVector;
+using apache::geode::client::QueryException;
+using apache::geode::client::SelectResults;
+using apache::geode::client::Serializable;
+using apache::geode::client::Struct;
+using apache::geode::client::StructSet;
+using apache::geode::client::StructSetImpl;
+using apache::geode::client::query::Parser;
+using apache::geode::client::query::QuerySource;
+
+namespace {
+
+class VectorQuerySource : public QuerySource {
+ public:
+  void forEach(const Visitor& visitor) override {
+    for (const auto& entry : entries) {
+      if (!visitor(entry.first, entry.second)) {
+        break;
+      }
+    }
+  }
+
+  bool get(const std::shared_ptr<CacheableKey>& key,
+           std::shared_ptr<Serializable>& value) override {
+    lookups++;
+    for (const auto& entry : entries) {
+      if (*entry.first == *key) {
+        value = entry.second;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  std::vector<std::pair<std::shared_ptr<CacheableKey>,
+                        std::shared_ptr<Serializable>>>
+      entries;
+  int lookups = 0;
+};
+
+class SelectStatementTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    auto values = CacheableVector::create();
+    const char* names[] = {"apple", "banana", "cherry", "date", "elder"};
+    const int32_t prices[] = {30, 10, 50, 20, 40};
+    for (int32_t i = 0; i < 5; i++) {
+      values->push_back(CacheableInt32::create(i));
+      values->push_back(CacheableString::create(names[i]));
+      values->push_back(CacheableInt32::create(prices[i]));
+    }
+    products_ = std::make_shared<StructSetImpl>(
+        values, std::vector<std::string>{"id", "name", "price"});
+    for (size_t i = 0; i < products_->size(); i++) {
+      source_.entries.emplace_back(
+          CacheableString::create("key" + std::to_string(i)), (*products_)[i]);
+    }
+  }
+
+  std::shared_ptr<SelectResults> execute(
+      const std::string& query,
+      std::shared_ptr<CacheableVector> parameters = nullptr) {
+    return Parser(query).parse()->execute(source_, parameters);
+  }
+
+  static int32_t intAt(const std::shared_ptr<SelectResults>& results,
+                       size_t index) {
+    return std::dynamic_pointer_cast<CacheableInt32>((*results)[index])
+        ->value();
+  }
+
+  static std::string stringAt(const std::shared_ptr<SelectResults>& results,
+                              size_t index) {
+    return std::dynamic_pointer_cast<CacheableString>((*results)[index])
+        ->value();
+  }
+
+  std::shared_ptr<StructSet> products_;
+  VectorQuerySource source_;
+};
+
+}  // namespace
+
+TEST_F(SelectStatementTest, filtersAndProjectsFields) {
+  auto results =
+      execute("SELECT p.name FROM /products p WHERE p.price > 25 AND id <> 4");
+  ASSERT_EQ(2, results->size());
+  EXPECT_EQ("apple", stringAt(results, 0));
+  EXPECT_EQ("cherry", stringAt(results, 1));
+}
+
+TEST_F(SelectStatementTest, selectsWholeValues) {
+  auto results = execute("select * from /products where name like '_a%'");
+  ASSERT_EQ(2, results->size());
+  auto product = std::dynamic_pointer_cast<Struct>((*results)[0]);
+  ASSERT_NE(nullptr, product);
+  EXPECT_EQ("banana", std::dynamic_pointer_cast<CacheableString>(
+                          (*product)["name"])
+                          ->value());
+}
+
+TEST_F(SelectStatementTest, returnsStructsForMultipleProjections) {
+  auto results = execute(
+      "SELECT name, p.price * 2 AS doubled FROM /products.values p "
+      "ORDER BY price DESC LIMIT 2");
+  auto structs = std::dynamic_pointer_cast<StructSet>(results);
+  ASSERT_NE(nullptr, structs);
+  ASSERT_EQ(2, structs->size());
+  EXPECT_EQ(1, structs->getFieldIndex("doubled"));
+  auto first = std::dynamic_pointer_cast<Struct>((*structs)[0]);
+  EXPECT_EQ("cherry",
+            std::dynamic_pointer_cast<CacheableString>((*first)[0])->value());
+  EXPECT_EQ(100,
+            std::dynamic_pointer_cast<CacheableInt32>((*first)[1])->value());
+}
+
+TEST_F(SelectStatementTest, countsDistinctAndParameters) {
+  auto parameters = CacheableVector::create();
+  parameters->push_back(CacheableInt32::create(20));
+  auto results =
+      execute("SELECT COUNT(*) FROM /products WHERE price >= $1", parameters);
+  ASSERT_EQ(1, results->size());
+  EXPECT_EQ(4, intAt(results, 0));
+
+  results = execute(
+      "SELECT DISTINCT p.price > 25 FROM /products p WHERE "
+      "p.id IN SET(0, 1, 2)");
+  EXPECT_EQ(2, results->size());
+}
+
+TEST_F(SelectStatementTest, usesKeyLookupForEntryKeyEquality) {
+  auto results = execute(
+      "SELECT e.value.name FROM /products.entrySet e "
+      "WHERE e.key = 'key3' AND e.value.price < 100");
+  ASSERT_EQ(1, results->size());
+  EXPECT_EQ("date", stringAt(results, 0));
+  EXPECT_EQ(1, source_.lookups);
+
+  results =
+      execute("SELECT k FROM /products.keySet k WHERE k IN ('key1', 'x')");
+  ASSERT_EQ(1, results->size());
+  EXPECT_EQ("key1", stringAt(results, 0));
+  EXPECT_EQ(3, source_.lookups);
+}
+
+TEST_F(SelectStatementTest, keyLookupMatchesNumericKeysOfAnyType) {
+  source_.entries.emplace_back(CacheableInt16::create(7),
+                               CacheableString::create("int16"));
+  source_.entries.emplace_back(CacheableInt64::create(1099511627776),
+                               CacheableString::create("int64"));
+  source_.entries.emplace_back(CacheableDouble::create(2.5),
+                               CacheableString::create("double"));
+  source_.entries.emplace_back(CacheableDouble::create(9),
+                               CacheableString::create("whole double"));
+
+  auto results = execute("SELECT e.value FROM /products.entrySet e "
+                         "WHERE e.key = 7");
+  ASSERT_EQ(1, results->size());
+  EXPECT_EQ("int16", stringAt(results, 0));
+
+  results = execute("SELECT e.value FROM /products.entrySet e "
+                    "WHERE e.key IN SET(1099511627776, 2.5, 9, 7.0, 7)");
+  ASSERT_EQ(4, results->size());
+  EXPECT_EQ("int64", stringAt(results, 0));
+  EXPECT_EQ("double", stringAt(results, 1));
+  EXPECT_EQ("whole double", stringAt(results, 2));
+  EXPECT_EQ("int16", stringAt(results, 3));
+
+  auto parameters = CacheableVector::create();
+  parameters->push_back(CacheableInt64::create(7));
+  results = execute("SELECT k FROM /products.keySet k WHERE k = $1",
+                    parameters);
+  ASSERT_EQ(1, results->size());
+  EXPECT_EQ(7, std::dynamic_pointer_cast<CacheableInt16>((*results)[0])
+                   ->value());
+
+  // the scan agrees with the lookup
+  results = execute("SELECT k FROM /products.keySet k WHERE k + 0 = 7");
+  EXPECT_EQ(1, results->size());
+}
+
+TEST_F(SelectStatementTest, rejectsUnsupportedQueries) {
+  EXPECT_THROW(Parser("SELECT * FROM /a, /b").parse(), QueryException);
+  EXPECT_THROW(Parser("SELECT * FROM /a WHERE").parse(), QueryException);
+  EXPECT_THROW(Parser("SELECT foo(1) FROM /a").parse(), QueryException);
+  EXPECT_THROW(execute("SELECT * FROM /products.entries"), QueryException);
+}